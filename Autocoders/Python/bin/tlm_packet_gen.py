@@ -50,6 +50,8 @@ namespace ${packet_list_namespace} {
     extern const Svc::TlmPacketizerPacketList ${packet_list_name}Pkts;
     // set of channels to ignore
     extern const Svc::TlmPacketizerPacket ${packet_list_name}Ignore;
+    // placement of channels in packets
+    extern const Svc::TlmPacketizerScatterPlan ${packet_list_name}Scatter;
 
 }
 
@@ -105,6 +107,43 @@ namespace ${packet_list_namespace} {
 
   const Svc::TlmPacketizerPacket ${packet_list_name}Ignore = { ignoreList, 0, 0, FW_NUM_ARRAY_ELEMENTS(ignoreList) };
 
+  // scatter plan: pages of ${scatter_page_size} channel ids starting at ${scatter_min_id}
+  static const U16 scatterPages[] = {
+#for $row in $scatter_pages
+      $row
+#end for
+  };
+
+  static const U16 scatterSlots[] = {
+#for $row in $scatter_slots
+      $row
+#end for
+  };
+
+  static const Svc::TlmPacketizerScatterChannel scatterChannels[] = {
+#for $channel_id,$first,$num_entries,$channel_name in $scatter_channels
+      {$channel_id, $first, $num_entries}, // $channel_name
+#end for
+  };
+
+  static const Svc::TlmPacketizerScatterEntry scatterEntries[] = {
+#for $packet_index,$offset,$channel_size,$channel_name,$packet in $scatter_entries
+      {$packet_index, $offset, $channel_size}, // $channel_name in $packet
+#end for
+  };
+
+  const Svc::TlmPacketizerScatterPlan ${packet_list_name}Scatter = {
+      $scatter_min_id,
+      $scatter_page_shift,
+      FW_NUM_ARRAY_ELEMENTS(scatterPages),
+      scatterPages,
+      scatterSlots,
+      scatterChannels,
+      FW_NUM_ARRAY_ELEMENTS(scatterChannels),
+      scatterEntries,
+      FW_NUM_ARRAY_ELEMENTS(scatterEntries)
+  };
+
 } // end namespace ${packet_list_namespace}
 
 """
@@ -116,6 +155,13 @@ DEBUG = logging.getLogger("debug")
 
 PACKET_VIEW_DIR = "./Packet-Views"
 
+# Must match Svc::TLMPACKETIZER_SCATTER_NONE
+SCATTER_NONE = 0xFFFF
+# Largest page size tried for the scatter plan, as a power of two
+SCATTER_MAX_PAGE_SHIFT = 12
+# Number of values per line of the generated scatter tables
+SCATTER_VALUES_PER_LINE = 16
+
 
 class TlmPacketParseValueError(ValueError):
     pass
@@ -247,6 +293,91 @@ class TlmPacketParser(object):
 
         return ch_size_dict
 
+    def gen_scatter_plan(self, packet_list, ignore_list):
+        """
+        Computes the scatter plan giving the place of each channel in the packets.
+        Returns a dictionary of the plan fields for the implementation template.
+        """
+        # ignored channels have no entries, even when they are also in a packet,
+        # as TlmPacketizer drops them without a scatter plan
+        ignored = set(channel_id for channel_id, channel_name in ignore_list)
+        # scatter entries of each channel, in packet order
+        channel_entries = {}
+        channel_names = {}
+        for channel_id, channel_name in ignore_list:
+            channel_entries[channel_id] = []
+            channel_names[channel_id] = channel_name
+        for packet_index, (packet, id, level, channel_list) in enumerate(packet_list):
+            offset = 0
+            for channel_id, channel_size, channel_name in channel_list:
+                if channel_id not in ignored:
+                    channel_entries.setdefault(channel_id, []).append(
+                        (packet_index, offset, channel_size, channel_name, packet)
+                    )
+                    channel_names[channel_id] = channel_name
+                offset += channel_size
+
+        ids = sorted(channel_entries)
+        if len(ids) >= SCATTER_NONE:
+            raise TlmPacketParseValueError("Too many channels for scatter plan")
+        scatter_channels = []
+        scatter_entries = []
+        for channel_id in ids:
+            scatter_channels.append(
+                (
+                    channel_id,
+                    len(scatter_entries),
+                    len(channel_entries[channel_id]),
+                    channel_names[channel_id],
+                )
+            )
+            scatter_entries.extend(channel_entries[channel_id])
+        if len(scatter_entries) >= SCATTER_NONE:
+            raise TlmPacketParseValueError("Too many packet entries for scatter plan")
+
+        min_id = ids[0] if ids else 0
+        # pick the page size that needs the fewest table entries
+        best = None
+        for page_shift in range(SCATTER_MAX_PAGE_SHIFT + 1):
+            used_pages = sorted(set((channel_id - min_id) >> page_shift for channel_id in ids))
+            num_pages = (used_pages[-1] + 1) if used_pages else 0
+            table_size = num_pages + (len(used_pages) << page_shift)
+            if best is None or table_size < best[0]:
+                best = (table_size, page_shift, num_pages, used_pages)
+        (table_size, page_shift, num_pages, used_pages) = best
+        if len(used_pages) >= SCATTER_NONE:
+            raise TlmPacketParseValueError("Too many pages for scatter plan")
+
+        pages = [SCATTER_NONE] * num_pages
+        for run, page in enumerate(used_pages):
+            pages[page] = run
+        slots = [SCATTER_NONE] * (len(used_pages) << page_shift)
+        for channel_index, channel_id in enumerate(ids):
+            index = channel_id - min_id
+            run = pages[index >> page_shift]
+            slots[(run << page_shift) | (index & ((1 << page_shift) - 1))] = channel_index
+
+        def rows(values):
+            text = ["0x%04X," % value for value in values]
+            return [
+                " ".join(text[i : i + SCATTER_VALUES_PER_LINE])
+                for i in range(0, len(text), SCATTER_VALUES_PER_LINE)
+            ]
+
+        print(
+            "Scatter plan: %d channels %d entries page size %d table entries %d"
+            % (len(ids), len(scatter_entries), 1 << page_shift, table_size)
+        )
+        return {
+            "scatter_min_id": min_id,
+            "scatter_page_shift": page_shift,
+            "scatter_page_size": 1 << page_shift,
+            "scatter_pages": rows(pages),
+            "scatter_slots": rows(slots),
+            "scatter_channels": scatter_channels,
+            "scatter_entries": scatter_entries,
+        }
+
     def gen_packet_file(self, xml_filename):
 
         view_path = PACKET_VIEW_DIR
@@ -437,6 +568,10 @@ class TlmPacketParser(object):
         )
 
         it.packet_list = packet_list_container
+        for name, value in self.gen_scatter_plan(
+            packet_list_container, it.ignore_list
+        ).items():
+            setattr(it, name, value)
         it.output_header = "%s/%sAc.hpp" % (file_dir, output_file_base)
 
         open(header, "w").write(str(ht))
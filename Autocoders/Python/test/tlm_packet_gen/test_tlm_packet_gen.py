@@ -0,0 +1,77 @@
+"""
+test_tlm_packet_gen.py:
+
+Checks the scatter plan computed by tlm_packet_gen.py against the places TlmPacketizer gives channels.
+"""
+from pathlib import Path
+import importlib.util
+import os
+import sys
+
+build_root = Path(os.environ["BUILD_ROOT"])
+sys.path.append(str(build_root / "Autocoders" / "Python" / "src"))
+
+
+def load_generator():
+    """
+    Loads bin/tlm_packet_gen.py as a module
+    """
+    path = build_root / "Autocoders" / "Python" / "bin" / "tlm_packet_gen.py"
+    spec = importlib.util.spec_from_file_location("tlm_packet_gen", str(path))
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+PACKETS = [
+    ("Packet1", 4, 1, [(10, 4, "Chan10"), (100, 2, "Chan100"), (333, 1, "Chan333")]),
+    ("Packet2", 8, 2, [(10, 4, "Chan10"), (13, 8, "Chan13"), (250, 2, "Chan250")]),
+]
+
+
+def entries_of(plan, channel_id):
+    """
+    Returns the (packet, offset, size) entries of a channel in the plan
+    """
+    for id, first, count, name in plan["scatter_channels"]:
+        if id == channel_id:
+            return [
+                entry[0:3] for entry in plan["scatter_entries"][first : first + count]
+            ]
+    return None
+
+
+def test_scatter_plan():
+    """
+    Tests that every packetized channel gets its places in packet order
+    """
+    generator = load_generator()
+    plan = generator.TlmPacketParser().gen_scatter_plan(PACKETS, [(25, "Chan25")])
+    assert [channel[0] for channel in plan["scatter_channels"]] == [
+        10,
+        13,
+        25,
+        100,
+        250,
+        333,
+    ]
+    assert entries_of(plan, 10) == [(0, 0, 4), (1, 0, 4)]
+    assert entries_of(plan, 13) == [(1, 4, 8)]
+    assert entries_of(plan, 25) == []
+    assert entries_of(plan, 100) == [(0, 4, 2)]
+    assert entries_of(plan, 250) == [(1, 12, 2)]
+    assert entries_of(plan, 333) == [(0, 6, 1)]
+
+
+def test_scatter_plan_ignored_packetized():
+    """
+    Tests that the ignore list wins over the packets, as it does in TlmPacketizer
+    """
+    generator = load_generator()
+    plan = generator.TlmPacketParser().gen_scatter_plan(
+        PACKETS, [(25, "Chan25"), (100, "Chan100")]
+    )
+    assert entries_of(plan, 100) == []
+    # the ignored channel still takes its space in the packet
+    assert entries_of(plan, 333) == [(0, 6, 1)]
+    assert len(plan["scatter_entries"]) == 5
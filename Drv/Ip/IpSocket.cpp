@@ -36,9 +36,16 @@
 #include <cstring>
 #elif defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <cerrno>
 #include <arpa/inet.h>
+#if defined TGT_OS_TYPE_LINUX && defined SO_ZEROCOPY && defined MSG_ZEROCOPY
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <poll.h>
+#define SOCKET_ZEROCOPY_SUPPORTED
+#endif
 #else
 #error OS not supported for IP Socket Communications
 #endif
@@ -46,7 +53,9 @@
 
 namespace Drv {
 
-IpSocket::IpSocket() : m_timeoutSeconds(0), m_timeoutMicroseconds(0), m_port(0) {
+IpSocket::IpSocket()
+    : m_timeoutSeconds(0), m_timeoutMicroseconds(0), m_port(0), m_zeroCopyThreshold(0), m_zeroCopy(false),
+      m_zeroCopySent(0), m_zeroCopyDone(0) {
     ::memset(m_hostname, 0, sizeof(m_hostname));
 }
 
@@ -160,6 +169,168 @@ SocketIpStatus IpSocket::send(const SocketDescriptor& socketDescriptor, const U8
     return SOCK_SUCCESS;
 }
 
+SocketIpStatus IpSocket::sendv(const SocketDescriptor& socketDescriptor, const SocketSegment* const segments,
+                               const U32 count) {
+    FW_ASSERT(segments != nullptr);
+    FW_ASSERT(count <= SOCKET_MAX_SEGMENTS, static_cast<FwAssertArgType>(count));
+#ifdef TGT_OS_TYPE_VXWORKS
+    // Segments sent one at a time
+    for (U32 i = 0; i < count; i++) {
+        SocketIpStatus status = this->send(socketDescriptor, segments[i].data, segments[i].size);
+        if (status != SOCK_SUCCESS) {
+            return status;
+        }
+    }
+    return SOCK_SUCCESS;
+#else
+    struct iovec vectors[SOCKET_MAX_SEGMENTS];
+    U32 vectorCount = 0;
+    U32 size = 0;
+    for (U32 i = 0; i < count; i++) {
+        // Empty segments take no part in the send
+        if (segments[i].size > 0) {
+            FW_ASSERT(segments[i].data != nullptr);
+            vectors[vectorCount].iov_base = const_cast<U8*>(segments[i].data);
+            vectors[vectorCount].iov_len = segments[i].size;
+            vectorCount++;
+            size += segments[i].size;
+        }
+    }
+    U32 flags = 0;
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+    if (this->m_zeroCopy && (size >= this->m_zeroCopyThreshold)) {
+        flags = MSG_ZEROCOPY;
+    }
+#endif
+    struct msghdr message;
+    ::memset(&message, 0, sizeof(message));
+    message.msg_iov = vectors;
+    message.msg_iovlen = vectorCount;
+    U32 total = 0;
+    I32 sent = 0;
+    SocketIpStatus status = SOCK_SUCCESS;
+    // Attempt to send out data and retry as necessary
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (total < size); i++) {
+        errno = 0;
+        // Send using my specific protocol
+        sent = this->sendvProtocol(socketDescriptor, message, flags);
+        // Error is EINTR or timeout just try again
+        if (((sent == -1) && (errno == EINTR)) || (sent == 0)) {
+            continue;
+        }
+        // Error bad file descriptor is a close along with reset
+        else if ((sent == -1) && ((errno == EBADF) || (errno == ECONNRESET))) {
+            status = SOCK_DISCONNECTED;
+            break;
+        }
+        // Error returned, and it wasn't an interrupt nor a disconnect
+        else if (sent == -1) {
+            status = SOCK_SEND_ERROR;
+            break;
+        }
+        FW_ASSERT(sent > 0, sent);
+        total += static_cast<U32>(sent);
+        this->m_zeroCopySent += (flags != 0) ? 1 : 0;
+        // Skip the segments sent and trim the one partially sent
+        size_t skip = static_cast<size_t>(sent);
+        while ((message.msg_iovlen > 0) && (skip >= message.msg_iov[0].iov_len)) {
+            skip -= message.msg_iov[0].iov_len;
+            message.msg_iov++;
+            message.msg_iovlen--;
+        }
+        if (message.msg_iovlen > 0) {
+            message.msg_iov[0].iov_base = static_cast<U8*>(message.msg_iov[0].iov_base) + skip;
+            message.msg_iov[0].iov_len -= skip;
+        }
+    }
+    // The segments belong to the caller again only once the kernel has released them, even when the send failed part
+    // way through. The first error is the one reported.
+    if (this->m_zeroCopyDone != this->m_zeroCopySent) {
+        const SocketIpStatus released = this->waitZeroCopy(socketDescriptor);
+        status = (status == SOCK_SUCCESS) ? released : status;
+    }
+    if (status != SOCK_SUCCESS) {
+        return status;
+    }
+    // Failed to retry enough to send all data
+    if (total < size) {
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    // Ensure we sent everything
+    FW_ASSERT(total == size, static_cast<FwAssertArgType>(total), static_cast<FwAssertArgType>(size));
+    return SOCK_SUCCESS;
+#endif
+}
+
+I32 IpSocket::sendvProtocol(const SocketDescriptor& socketDescriptor, struct msghdr& message, const U32 flags) {
+#ifdef TGT_OS_TYPE_VXWORKS
+    FW_ASSERT(0);
+    return -1;
+#else
+    return static_cast<I32>(::sendmsg(socketDescriptor.fd, &message, static_cast<int>(SOCKET_IP_SEND_FLAGS | flags)));
+#endif
+}
+
+void IpSocket::setZeroCopyThreshold(const U32 threshold) {
+    this->m_zeroCopyThreshold = threshold;
+}
+
+void IpSocket::setupZeroCopy(PlatformIntType socketFd) {
+    this->m_zeroCopy = false;
+    this->m_zeroCopySent = 0;
+    this->m_zeroCopyDone = 0;
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+    int enable = 1;
+    this->m_zeroCopy = (this->m_zeroCopyThreshold > 0) &&
+        (::setsockopt(socketFd, SOL_SOCKET, SO_ZEROCOPY, &enable, sizeof(enable)) == 0);
+#endif
+}
+
+SocketIpStatus IpSocket::waitZeroCopy(const SocketDescriptor& socketDescriptor) {
+#ifdef SOCKET_ZEROCOPY_SUPPORTED
+    // Each notification reports a range of sends released, in the order the sends were made
+    while (this->m_zeroCopyDone != this->m_zeroCopySent) {
+        U8 control[CMSG_SPACE(sizeof(struct sock_extended_err))];
+        struct msghdr notification;
+        ::memset(&notification, 0, sizeof(notification));
+        notification.msg_control = control;
+        notification.msg_controllen = sizeof(control);
+        errno = 0;
+        if (::recvmsg(socketDescriptor.fd, &notification, MSG_ERRQUEUE) < 0) {
+            if ((errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR)) {
+                return SOCK_SEND_ERROR;
+            }
+            // Pending notifications are signaled as an error condition on the socket, as is a reset connection
+            struct pollfd pending;
+            pending.fd = socketDescriptor.fd;
+            pending.events = 0;
+            pending.revents = 0;
+            int error = 0;
+            socklen_t length = sizeof(error);
+            if ((::poll(&pending, 1, -1) < 0) && (errno != EINTR)) {
+                return SOCK_SEND_ERROR;
+            } else if (((pending.revents & (POLLHUP | POLLNVAL)) != 0) ||
+                       ((::getsockopt(socketDescriptor.fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0) &&
+                        (error != 0))) {
+                return SOCK_DISCONNECTED;
+            }
+            continue;
+        }
+        for (struct cmsghdr* header = CMSG_FIRSTHDR(&notification); header != nullptr;
+             header = CMSG_NXTHDR(&notification, header)) {
+            const struct sock_extended_err* error = reinterpret_cast<const struct sock_extended_err*>(CMSG_DATA(header));
+            if ((((header->cmsg_level == SOL_IP) && (header->cmsg_type == IP_RECVERR)) ||
+                 ((header->cmsg_level == SOL_IPV6) && (header->cmsg_type == IPV6_RECVERR))) &&
+                (error->ee_origin == SO_EE_ORIGIN_ZEROCOPY)) {
+                // ee_data is the last send of the range released
+                this->m_zeroCopyDone = error->ee_data + 1;
+            }
+        }
+    }
+#endif
+    return SOCK_SUCCESS;
+}
+
 SocketIpStatus IpSocket::recv(const SocketDescriptor& socketDescriptor, U8* data, U32& req_read) {
     I32 size = 0;
     // Try to read until we fail to receive data
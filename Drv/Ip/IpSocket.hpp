@@ -16,6 +16,9 @@
 #include <IpCfg.hpp>
 #include <Os/Mutex.hpp>
 
+// Declared by sys/socket.h, which is kept out of this header
+struct msghdr;
+
 namespace Drv {
 
 struct SocketDescriptor final {
@@ -23,6 +26,12 @@ struct SocketDescriptor final {
     PlatformIntType serverFd = -1; //!< Used for server sockets to track the listening file descriptor
 };
 
+//! A run of data sent by `sendv`, segments are sent back to back as though they were one contiguous buffer
+struct SocketSegment final {
+    const U8* data = nullptr; //!< Data of the segment, may be nullptr when size is 0
+    U32 size = 0; //!< Size of the segment
+};
+
 /**
  * \brief Status enumeration for socket return values
  */
@@ -113,6 +122,37 @@ class IpSocket {
      * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
      */
     SocketIpStatus send(const SocketDescriptor& socketDescriptor, const U8* const data, const U32 size);
+    /**
+     * \brief send data gathered from several segments out the IP socket
+     *
+     * Sends the segments out of the IpSocket as though they were one contiguous buffer, without first copying them
+     * together. For example, a frame header, a payload held elsewhere and a trailer. Partial transmissions are retried
+     * as with `send` and the same statuses are returned. Datagram sockets send the segments as one datagram.
+     *
+     * When zero copy is enabled (see `setZeroCopyThreshold`) and the segments total at least the threshold, the kernel
+     * transmits directly from the segments. This call then waits until the kernel has released them before returning,
+     * including when the send fails part way through, so the caller may reuse the segments as with any other send. The kernel releases the segments once the peer has
+     * acknowledged the data, so unlike a copying send this blocks on a peer that is not reading.
+     *
+     * Note: delegates to `sendvProtocol` to send the data
+     *
+     * \param socketDescriptor: socket descriptor to send to
+     * \param segments: segments to send, in order
+     * \param count: number of segments. Must be no more than SOCKET_MAX_SEGMENTS
+     * \return status of the send, SOCK_DISCONNECTED to reopen, SOCK_SUCCESS on success, something else on error
+     */
+    SocketIpStatus sendv(const SocketDescriptor& socketDescriptor, const SocketSegment* const segments, const U32 count);
+
+    /**
+     * \brief set the size from which `sendv` transmits without copying to the kernel
+     *
+     * Zero copy sends (MSG_ZEROCOPY) pin the data in place of copying it, which pays off for large sends only as the
+     * caller then waits on the kernel to release the data. Only supported by TCP sockets on Linux, elsewhere all sends
+     * copy. Must be called before `open`.
+     *
+     * \param threshold: smallest send in bytes made without copying, 0 to always copy. Default: 0
+     */
+    void setZeroCopyThreshold(const U32 threshold);
     /**
      * \brief receive data from the IP socket from the given buffer
      *
@@ -205,10 +245,42 @@ class IpSocket {
      */
     virtual I32 recvProtocol(const SocketDescriptor& socketDescriptor, U8* const data, const U32 size) = 0;
 
+    /**
+     * \brief Protocol specific implementation of a gathered send.  Called directly with retry from sendv.
+     *
+     * The default implementation sends the message on a connected socket.
+     *
+     * \param socketDescriptor: socket descriptor to send to
+     * \param message: message holding the data segments still to send
+     * \param flags: flags to send with, in addition to SOCKET_IP_SEND_FLAGS
+     * \return: size of data sent, or -1 on error.
+     */
+    virtual I32 sendvProtocol(const SocketDescriptor& socketDescriptor, struct msghdr& message, const U32 flags);
+
+    /**
+     * \brief enable zero copy sends on an opened socket when a threshold is set
+     *
+     * Protocols supporting zero copy call this on open. Sends fall back to copying when the socket does not support it.
+     *
+     * \param socketFd: opened socket
+     */
+    void setupZeroCopy(PlatformIntType socketFd);
+
+    /**
+     * \brief wait for the kernel to release the data of every zero copy send made on the socket
+     * \param socketDescriptor: socket descriptor sent to
+     * \return SOCK_SUCCESS once released, SOCK_DISCONNECTED when the socket closed first, SOCK_SEND_ERROR on error
+     */
+    SocketIpStatus waitZeroCopy(const SocketDescriptor& socketDescriptor);
+
     U32 m_timeoutSeconds;
     U32 m_timeoutMicroseconds;
     U16 m_port;  //!< IP address port used
     char m_hostname[SOCKET_MAX_HOSTNAME_SIZE];  //!< Hostname to supply
+    U32 m_zeroCopyThreshold;  //!< Smallest send made without copying, 0 when disabled
+    bool m_zeroCopy;  //!< Zero copy enabled on the open socket
+    U32 m_zeroCopySent;  //!< Zero copy sends made on the open socket
+    U32 m_zeroCopyDone;  //!< Zero copy sends released by the kernel
 };
 }  // namespace Drv
 
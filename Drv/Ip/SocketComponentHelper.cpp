@@ -113,6 +113,48 @@ SocketIpStatus SocketComponentHelper::send(const U8* const data, const U32 size)
     return status;
 }
 
+SocketIpStatus SocketComponentHelper::sendv(const SocketSegment* const segments, const U32 count) {
+    SocketIpStatus status = SOCK_SUCCESS;
+    this->m_lock.lock();
+    SocketDescriptor descriptor = this->m_descriptor;
+    this->m_lock.unlock();
+    // Prevent transmission before connection, or after a disconnect
+    if (descriptor.fd == -1) {
+        status = this->reconnect();
+        // if reconnect wasn't successful, pass the that up to the caller
+        if(status != SOCK_SUCCESS) {
+            return status;
+        }
+        // Refresh local copy after reconnect
+        this->m_lock.lock();
+        descriptor = this->m_descriptor;
+        this->m_lock.unlock();
+    }
+    status = this->getSocketHandler().sendv(descriptor, segments, count);
+    if (status == SOCK_DISCONNECTED) {
+        this->close();
+    }
+    return status;
+}
+
+SocketIpStatus SocketComponentHelper::sendSegments(const Fw::Buffer& header,
+                                                   const Fw::Buffer& payload,
+                                                   const Fw::Buffer& trailer) {
+    SocketSegment segments[3];
+    segments[0].data = header.getData();
+    segments[0].size = header.getSize();
+    segments[1].data = payload.getData();
+    segments[1].size = payload.getSize();
+    segments[2].data = trailer.getData();
+    segments[2].size = trailer.getSize();
+    return this->sendv(segments, static_cast<U32>(FW_NUM_ARRAY_ELEMENTS(segments)));
+}
+
+void SocketComponentHelper::setZeroCopyThreshold(const U32 threshold) {
+    Os::ScopeLock scopedLock(this->m_lock);
+    this->getSocketHandler().setZeroCopyThreshold(threshold);
+}
+
 void SocketComponentHelper::shutdown() {
     Os::ScopeLock scopedLock(this->m_lock);
     this->getSocketHandler().shutdown(this->m_descriptor);
@@ -174,23 +216,7 @@ void SocketComponentHelper::readLoop() {
         }
         // If the network connection is open, read from it
         if (this->isOpened() and this->running()) {
-            Fw::Buffer buffer = this->getBuffer();
-            U8* data = buffer.getData();
-            FW_ASSERT(data);
-            U32 size = buffer.getSize();
-            // recv blocks, so it may have been a while since its done an isOpened check
-            status = this->recv(data, size);
-            if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN) && (status != SOCK_NO_DATA_AVAILABLE)) {
-                Fw::Logger::log("[WARNING] Failed to recv from port with status %d and errno %d\n",
-                                status,
-                                errno);
-                this->close();
-                buffer.setSize(0);
-            } else {
-                // Send out received data
-                buffer.setSize(size);
-            }
-            this->sendBuffer(buffer, status);
+            status = this->readSocket();
         }
     }
     // As long as not told to stop, and we are successful interrupted or ordered to retry, keep receiving
@@ -200,6 +226,27 @@ void SocketComponentHelper::readLoop() {
     this->close(); // Close the port entirely
 }
 
+SocketIpStatus SocketComponentHelper::readSocket() {
+    Fw::Buffer buffer = this->getBuffer();
+    U8* data = buffer.getData();
+    FW_ASSERT(data);
+    U32 size = buffer.getSize();
+    // recv blocks, so it may have been a while since its done an isOpened check
+    SocketIpStatus status = this->recv(data, size);
+    if ((status != SOCK_SUCCESS) && (status != SOCK_INTERRUPTED_TRY_AGAIN) && (status != SOCK_NO_DATA_AVAILABLE)) {
+        Fw::Logger::log("[WARNING] Failed to recv from port with status %d and errno %d\n",
+                        status,
+                        errno);
+        this->close();
+        buffer.setSize(0);
+    } else {
+        // Send out received data
+        buffer.setSize(size);
+    }
+    this->sendBuffer(buffer, status);
+    return status;
+}
+
 void SocketComponentHelper::readTask(void* pointer) {
     FW_ASSERT(pointer);
     SocketComponentHelper* self = reinterpret_cast<SocketComponentHelper*>(pointer);
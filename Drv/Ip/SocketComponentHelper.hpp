@@ -103,6 +103,39 @@ class SocketComponentHelper {
      */
     SocketIpStatus send(const U8* const data, const U32 size);
 
+    /**
+     * \brief send data gathered from several segments to the IP socket
+     *
+     * Sends the segments as though they were one contiguous buffer. See IpSocket::sendv.
+     *
+     * \param segments: segments to send, in order
+     * \param count: number of segments. Must be no more than SOCKET_MAX_SEGMENTS
+     * \return status of send, SOCK_SUCCESS for success, something else on error
+     */
+    SocketIpStatus sendv(const SocketSegment* const segments, const U32 count);
+
+    /**
+     * \brief send a header, payload and trailer to the IP socket as one transmission
+     *
+     * Gathers the three buffers into segments and sends them with sendv. Backs the sendSegments port of the socket
+     * components. Buffers stay owned by the caller.
+     *
+     * \param header: buffer sent first
+     * \param payload: buffer sent after the header
+     * \param trailer: buffer sent last
+     * \return status of send, SOCK_SUCCESS for success, something else on error
+     */
+    SocketIpStatus sendSegments(const Fw::Buffer& header, const Fw::Buffer& payload, const Fw::Buffer& trailer);
+
+    /**
+     * \brief set the size from which sends are made without copying to the kernel
+     *
+     * See IpSocket::setZeroCopyThreshold. Takes effect when the socket is next opened.
+     *
+     * \param threshold: smallest send in bytes made without copying, 0 to always copy
+     */
+    void setZeroCopyThreshold(const U32 threshold);
+
     /**
      * \brief receive data from the IP socket from the given buffer
      *
@@ -160,6 +193,16 @@ class SocketComponentHelper {
      * \brief receive off the TCP socket
      */
     virtual void readLoop();
+
+    /**
+     * \brief read once from the open socket and send out the data
+     *
+     * Called by the read loop while the socket is open. The default implementation fills one buffer from getBuffer
+     * and passes it to sendBuffer. Inheritors may override it to receive several buffers per call.
+     *
+     * \return status of the receive, the read loop stops on errors when not reconnecting
+     */
+    virtual SocketIpStatus readSocket();
     /**
      * \brief returns a reference to the socket handler
      *
@@ -81,6 +81,7 @@ SocketIpStatus TcpClientSocket::openProtocol(SocketDescriptor& socketDescriptor)
         ::close(socketFd);
         return SOCK_FAILED_TO_CONNECT;
     }
+    this->setupZeroCopy(socketFd);
     socketDescriptor.fd = socketFd;
     Fw::Logger::log("Connected to %s:%hu as a tcp client\n", m_hostname, m_port);
     return SOCK_SUCCESS;
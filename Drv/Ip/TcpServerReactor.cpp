@@ -0,0 +1,426 @@
+// ======================================================================
+// \title  TcpServerReactor.cpp
+// \brief  cpp file for TcpServerReactor implementation class
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Drv/Ip/TcpServerReactor.hpp>
+#include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <FpConfig.hpp>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+
+namespace Drv {
+
+namespace {
+//! epoll tag of the listening socket, client entries are tagged with their index
+const U64 LISTEN_TAG = SOCKET_REACTOR_MAX_CLIENTS;
+//! epoll tag of the wake eventfd
+const U64 WAKE_TAG = SOCKET_REACTOR_MAX_CLIENTS + 1;
+}  // namespace
+
+TcpServerReactor::TcpServerReactor()
+    : m_epollFd(-1),
+      m_wakeFd(-1),
+      m_allocator(nullptr),
+      m_allocationId(0),
+      m_allocation(nullptr),
+      m_queue_size(0),
+      m_nextId(0),
+      m_clientCount(0),
+      m_backpressure(0),
+      m_stop(true) {
+    for (U32 i = 0; i < SOCKET_REACTOR_MAX_CLIENTS; i++) {
+        this->m_clients[i].fd = -1;
+        this->m_clients[i].id = 0;
+        this->m_clients[i].queue = nullptr;
+        this->m_clients[i].head = 0;
+        this->m_clients[i].count = 0;
+        this->m_clients[i].writeArmed = false;
+    }
+}
+
+TcpServerReactor::~TcpServerReactor() {}
+
+SocketIpStatus TcpServerReactor::configure(const char* hostname,
+                                           const U16 port,
+                                           NATIVE_UINT_TYPE allocationId,
+                                           Fw::MemAllocator& allocator,
+                                           const FwSizeType queue_size) {
+    FW_ASSERT(this->m_allocation == nullptr);  // It is a coding error to configure the reactor multiple times
+    FW_ASSERT(queue_size > 0);
+    const FwSizeType total = queue_size * SOCKET_REACTOR_MAX_CLIENTS;
+    FW_ASSERT(total <= std::numeric_limits<NATIVE_UINT_TYPE>::max(), static_cast<FwAssertArgType>(total));
+
+    // Allocate a single chunk of memory for every client queue. Memory recover is neither needed nor used.
+    NATIVE_UINT_TYPE allocated = static_cast<NATIVE_UINT_TYPE>(total);
+    bool recoverable = false;
+    this->m_allocator = &allocator;
+    this->m_allocationId = allocationId;
+    this->m_allocation = static_cast<U8*>(allocator.allocate(allocationId, allocated, recoverable));
+    FW_ASSERT(this->m_allocation != nullptr);
+    FW_ASSERT(allocated == total, static_cast<FwAssertArgType>(allocated), static_cast<FwAssertArgType>(total));
+    this->m_queue_size = queue_size;
+    for (U32 i = 0; i < SOCKET_REACTOR_MAX_CLIENTS; i++) {
+        this->m_clients[i].queue = this->m_allocation + (i * queue_size);
+    }
+    return this->m_socket.configure(hostname, port, SOCKET_SEND_TIMEOUT_SECONDS, SOCKET_SEND_TIMEOUT_MICROSECONDS);
+}
+
+void TcpServerReactor::cleanup() {
+    // Deallocate memory ignoring error conditions
+    if ((this->m_allocator != nullptr) && (this->m_allocation != nullptr)) {
+        this->m_allocator->deallocate(this->m_allocationId, this->m_allocation);
+    }
+    this->m_allocation = nullptr;
+    for (U32 i = 0; i < SOCKET_REACTOR_MAX_CLIENTS; i++) {
+        this->m_clients[i].queue = nullptr;
+    }
+}
+
+SocketIpStatus TcpServerReactor::start(const Fw::StringBase& name,
+                                       const Os::Task::ParamType priority,
+                                       const Os::Task::ParamType stack,
+                                       const Os::Task::ParamType cpuAffinity) {
+    FW_ASSERT(this->m_allocation != nullptr);  // Must be configured before being started
+    FW_ASSERT(m_task.getState() == Os::Task::State::NOT_STARTED);  // It is a coding error to start this task multiple times
+    // Enough backlog for every client connecting at once
+    SocketIpStatus status = this->m_socket.startup(this->m_descriptor, SOCKET_REACTOR_MAX_CLIENTS);
+    if (status != SOCK_SUCCESS) {
+        return status;
+    }
+    // Every socket is polled, none may block the task
+    const int flags = ::fcntl(this->m_descriptor.serverFd, F_GETFL, 0);
+    this->m_epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    this->m_wakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event listen_event;
+    ::memset(&listen_event, 0, sizeof(listen_event));
+    listen_event.events = EPOLLIN;
+    listen_event.data.u64 = LISTEN_TAG;
+    struct epoll_event wake_event;
+    ::memset(&wake_event, 0, sizeof(wake_event));
+    wake_event.events = EPOLLIN;
+    wake_event.data.u64 = WAKE_TAG;
+    if ((flags == -1) || (::fcntl(this->m_descriptor.serverFd, F_SETFL, flags | O_NONBLOCK) == -1) ||
+        (this->m_epollFd == -1) || (this->m_wakeFd == -1) ||
+        (::epoll_ctl(this->m_epollFd, EPOLL_CTL_ADD, this->m_descriptor.serverFd, &listen_event) == -1) ||
+        (::epoll_ctl(this->m_epollFd, EPOLL_CTL_ADD, this->m_wakeFd, &wake_event) == -1)) {
+        (void)::close(this->m_epollFd);
+        (void)::close(this->m_wakeFd);
+        this->m_epollFd = -1;
+        this->m_wakeFd = -1;
+        this->m_socket.terminate(this->m_descriptor);
+        this->m_descriptor.serverFd = -1;
+        return SOCK_FAILED_TO_SET_SOCKET_OPTIONS;
+    }
+    this->m_stop = false;
+    Os::Task::Arguments arguments(name, TcpServerReactor::reactorTask, this, priority, stack, cpuAffinity);
+    Os::Task::Status stat = m_task.start(arguments);
+    FW_ASSERT(Os::Task::OP_OK == stat, static_cast<FwAssertArgType>(stat));
+    return SOCK_SUCCESS;
+}
+
+void TcpServerReactor::stop() {
+    this->m_lock.lock();
+    this->m_stop = true;
+    const PlatformIntType wake = this->m_wakeFd;
+    this->m_lock.unlock();
+    if (wake != -1) {
+        const U64 one = 1;
+        (void)::write(wake, &one, sizeof(one));
+    }
+}
+
+Os::Task::Status TcpServerReactor::join() {
+    return m_task.join();
+}
+
+SocketIpStatus TcpServerReactor::send(const U8* const data, const U32 size, const U32 clientId) {
+    FW_ASSERT((data != nullptr) || (size == 0));
+    FW_ASSERT(this->m_allocation != nullptr);
+    if (size > this->m_queue_size) {
+        return SOCK_SEND_ERROR;
+    }
+    {
+        bool wake = false;
+        Os::ScopeLock scopedLock(this->m_lock);
+        // Nothing is queued unless every targeted client has room, so a retried send is not duplicated
+        U32 targets = 0;
+        for (U32 i = 0; i < SOCKET_REACTOR_MAX_CLIENTS; i++) {
+            const Client& client = this->m_clients[i];
+            if ((client.fd != -1) && ((clientId == BROADCAST) || (client.id == clientId))) {
+                targets++;
+                if ((this->m_queue_size - client.count) < size) {
+                    this->m_backpressure++;
+                    return SOCK_INTERRUPTED_TRY_AGAIN;
+                }
+            }
+        }
+        if (targets == 0) {
+            return SOCK_DISCONNECTED;
+        }
+        for (U32 i = 0; i < SOCKET_REACTOR_MAX_CLIENTS; i++) {
+            Client& client = this->m_clients[i];
+            if ((client.fd != -1) && ((clientId == BROADCAST) || (client.id == clientId))) {
+                // Copy to the tail of the queue, wrapping to the start of the storage
+                const FwSizeType tail = (client.head + client.count) % this->m_queue_size;
+                const FwSizeType first = FW_MIN(static_cast<FwSizeType>(size), this->m_queue_size - tail);
+                ::memcpy(client.queue + tail, data, first);
+                ::memcpy(client.queue, data + first, size - first);
+                // The task only needs waking for a queue it has emptied
+                wake = wake || ((client.count == 0) && (not client.writeArmed));
+                client.count += size;
+            }
+        }
+        // Written under the lock, the task closes the eventfd under the lock once the clients are gone
+        if (wake) {
+            const U64 one = 1;
+            (void)::write(this->m_wakeFd, &one, sizeof(one));
+        }
+    }
+    return SOCK_SUCCESS;
+}
+
+U16 TcpServerReactor::getListenPort() {
+    return this->m_socket.getListenPort();
+}
+
+U32 TcpServerReactor::getClientCount() {
+    Os::ScopeLock scopedLock(this->m_lock);
+    return this->m_clientCount;
+}
+
+U32 TcpServerReactor::getBackpressureCount() {
+    Os::ScopeLock scopedLock(this->m_lock);
+    return this->m_backpressure;
+}
+
+void TcpServerReactor::reactorLoop() {
+    struct epoll_event events[SOCKET_REACTOR_MAX_CLIENTS + 2];
+    while (true) {
+        this->m_lock.lock();
+        const bool stop = this->m_stop;
+        this->m_lock.unlock();
+        if (stop) {
+            break;
+        }
+        const int ready = ::epoll_wait(this->m_epollFd, events, static_cast<int>(FW_NUM_ARRAY_ELEMENTS(events)), -1);
+        if (ready == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            Fw::Logger::log("[WARNING] Failed to wait for clients with errno %d\n", errno);
+            break;
+        }
+        bool accept = false;
+        for (int i = 0; i < ready; i++) {
+            const U64 tag = events[i].data.u64;
+            if (tag == LISTEN_TAG) {
+                // Accepted once the events of this wait are handled, a new client may reuse the entry of a closed one
+                accept = true;
+            } else if (tag == WAKE_TAG) {
+                U64 value = 0;
+                (void)::read(this->m_wakeFd, &value, sizeof(value));
+                for (U32 index = 0; index < SOCKET_REACTOR_MAX_CLIENTS; index++) {
+                    Client& client = this->m_clients[index];
+                    if ((client.fd != -1) && (not client.writeArmed)) {
+                        this->flushClient(client);
+                    }
+                }
+            } else {
+                FW_ASSERT(tag < SOCKET_REACTOR_MAX_CLIENTS, static_cast<FwAssertArgType>(tag));
+                Client& client = this->m_clients[tag];
+                const U32 flags = events[i].events;
+                if ((client.fd != -1) && ((flags & EPOLLIN) || (flags & (EPOLLERR | EPOLLHUP)))) {
+                    // A hang up or error is reported by the read
+                    this->readClient(client);
+                }
+                if ((client.fd != -1) && (flags & EPOLLOUT)) {
+                    this->flushClient(client);
+                }
+            }
+        }
+        if (accept) {
+            this->acceptClients();
+        }
+    }
+    // Disconnect every client and stop listening
+    for (U32 i = 0; i < SOCKET_REACTOR_MAX_CLIENTS; i++) {
+        if (this->m_clients[i].fd != -1) {
+            this->disconnectClient(this->m_clients[i]);
+        }
+    }
+    Os::ScopeLock scopedLock(this->m_lock);
+    this->m_socket.terminate(this->m_descriptor);
+    this->m_descriptor.serverFd = -1;
+    (void)::close(this->m_epollFd);
+    (void)::close(this->m_wakeFd);
+    this->m_epollFd = -1;
+    this->m_wakeFd = -1;
+}
+
+void TcpServerReactor::acceptClients() {
+    while (true) {
+        const PlatformIntType fd =
+            ::accept4(this->m_descriptor.serverFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd == -1) {
+            if (errno == EINTR) {
+                continue;
+            } else if ((errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+                Fw::Logger::log("[WARNING] Failed to accept client with errno %d\n", errno);
+            }
+            return;
+        }
+        // Small frames go out as they are queued
+        int enable = 1;
+        (void)::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+        Client* client = nullptr;
+        U32 index = 0;
+        U32 id = 0;
+        this->m_lock.lock();
+        for (; index < SOCKET_REACTOR_MAX_CLIENTS; index++) {
+            if (this->m_clients[index].fd == -1) {
+                client = &this->m_clients[index];
+                id = this->m_nextId;
+                this->m_nextId = (this->m_nextId + 1 == BROADCAST) ? 0 : this->m_nextId + 1;
+                client->fd = fd;
+                client->id = id;
+                client->head = 0;
+                client->count = 0;
+                client->writeArmed = false;
+                this->m_clientCount++;
+                break;
+            }
+        }
+        this->m_lock.unlock();
+        if (client == nullptr) {
+            Fw::Logger::log("[WARNING] Refused client, %d clients connected\n", SOCKET_REACTOR_MAX_CLIENTS);
+            (void)::close(fd);
+            continue;
+        }
+        struct epoll_event event;
+        ::memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.u64 = index;
+        if (::epoll_ctl(this->m_epollFd, EPOLL_CTL_ADD, fd, &event) == -1) {
+            Fw::Logger::log("[WARNING] Failed to poll client with errno %d\n", errno);
+            this->disconnectClient(*client);
+            continue;
+        }
+        Fw::Logger::log("Accepted client %u on port %hu\n", id, this->getListenPort());
+        this->connected(id);
+    }
+}
+
+void TcpServerReactor::readClient(Client& client) {
+    Fw::Buffer buffer = this->getBuffer();
+    U8* data = buffer.getData();
+    FW_ASSERT(data);
+    const U32 id = client.id;
+    I32 size = -1;
+    do {
+        size = static_cast<I32>(::recv(client.fd, data, buffer.getSize(), SOCKET_IP_RECV_FLAGS));
+    } while ((size == -1) && (errno == EINTR));
+
+    if (size > 0) {
+        buffer.setSize(static_cast<U32>(size));
+        this->sendBuffer(buffer, SOCK_SUCCESS, id);
+    } else if ((size == -1) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+        buffer.setSize(0);
+        this->sendBuffer(buffer, SOCK_NO_DATA_AVAILABLE, id);
+    } else {
+        // Zero bytes read is an orderly shutdown of the client
+        const SocketIpStatus status = (size == 0) ? SOCK_DISCONNECTED : SOCK_READ_ERROR;
+        this->disconnectClient(client);
+        buffer.setSize(0);
+        this->sendBuffer(buffer, status, id);
+    }
+}
+
+void TcpServerReactor::flushClient(Client& client) {
+    while (true) {
+        this->m_lock.lock();
+        const FwSizeType head = client.head;
+        const FwSizeType count = client.count;
+        // Disarmed under the lock so a sender queuing after this point wakes the task
+        const bool disarm = (count == 0) && client.writeArmed;
+        client.writeArmed = client.writeArmed && not disarm;
+        this->m_lock.unlock();
+        if (count == 0) {
+            if (disarm) {
+                this->armWrite(client, false);
+            }
+            return;
+        }
+        // Senders only append past the queued data, so the queued bytes may be written without the lock
+        const FwSizeType chunk = FW_MIN(count, this->m_queue_size - head);
+        const ssize_t sent = ::send(client.fd, client.queue + head, chunk, SOCKET_IP_SEND_FLAGS | MSG_NOSIGNAL);
+        if (sent == -1) {
+            if (errno == EINTR) {
+                continue;
+            } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                // Resumed once the client has read some of its data
+                this->m_lock.lock();
+                const bool arm = not client.writeArmed;
+                client.writeArmed = true;
+                this->m_lock.unlock();
+                if (arm) {
+                    this->armWrite(client, true);
+                }
+            } else {
+                this->disconnectClient(client);
+            }
+            return;
+        }
+        this->m_lock.lock();
+        client.head = (head + static_cast<FwSizeType>(sent)) % this->m_queue_size;
+        client.count -= static_cast<FwSizeType>(sent);
+        this->m_lock.unlock();
+    }
+}
+
+void TcpServerReactor::disconnectClient(Client& client) {
+    FW_ASSERT(client.fd != -1);
+    (void)::epoll_ctl(this->m_epollFd, EPOLL_CTL_DEL, client.fd, nullptr);
+    (void)::shutdown(client.fd, SHUT_RDWR);
+    (void)::close(client.fd);
+    Os::ScopeLock scopedLock(this->m_lock);
+    client.fd = -1;
+    client.head = 0;
+    client.count = 0;
+    client.writeArmed = false;
+    this->m_clientCount--;
+}
+
+void TcpServerReactor::armWrite(Client& client, bool arm) {
+    const U64 index = static_cast<U64>(&client - this->m_clients);
+    struct epoll_event event;
+    ::memset(&event, 0, sizeof(event));
+    event.events = arm ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+    event.data.u64 = index;
+    (void)::epoll_ctl(this->m_epollFd, EPOLL_CTL_MOD, client.fd, &event);
+}
+
+void TcpServerReactor::reactorTask(void* pointer) {
+    FW_ASSERT(pointer);
+    TcpServerReactor* self = reinterpret_cast<TcpServerReactor*>(pointer);
+    self->reactorLoop();
+}
+
+}  // namespace Drv
@@ -0,0 +1,221 @@
+// ======================================================================
+// \title  TcpServerReactor.hpp
+// \brief  hpp file for TcpServerReactor implementation class
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#ifndef DRV_TcpServerReactor_HPP
+#define DRV_TcpServerReactor_HPP
+
+#include <Fw/Buffer/Buffer.hpp>
+#include <Fw/Types/MemAllocator.hpp>
+#include <Drv/Ip/TcpServerSocket.hpp>
+#include <Os/Task.hpp>
+#include <Os/Mutex.hpp>
+#include <IpCfg.hpp>
+
+namespace Drv {
+/**
+ * \brief serves multiple TCP clients from a single epoll task
+ *
+ * Defines an Os::Task that accepts clients on a TcpServerSocket, reads from every connected client and writes the data
+ * queued for each client, all from one epoll loop. Outgoing data is copied into a per-client queue by `send`, either for
+ * one client or for every client, and written by the task as each client's socket accepts it. A send that does not fit
+ * in the queue of a targeted client is refused as a whole, pushing back on the caller instead of blocking the task on a
+ * slow client.
+ *
+ * Clients are identified by an id that is not reused when a client disconnects, so data sent to a client that has gone
+ * is refused rather than delivered to the next client.
+ *
+ * Note: uses epoll and eventfd and is thus only available on Linux.
+ */
+class TcpServerReactor {
+  public:
+    //! Client id addressing every connected client
+    static const U32 BROADCAST = 0xFFFFFFFF;
+
+    /**
+     * \brief constructs the reactor
+     */
+    TcpServerReactor();
+
+    /**
+     * \brief destructor of the reactor
+     */
+    virtual ~TcpServerReactor();
+
+    /**
+     * \brief configure the listening address and allocate the client queues
+     *
+     * Configures the hostname and port clients connect to and allocates a queue of queue_size bytes per client from
+     * the allocator. Must be called before `start`. Hostname DNS translation is left up to the caller and thus hostname
+     * must be an IP address in dot-notation of the form "x.x.x.x".
+     *
+     * \param hostname: ip address to listen on in the form x.x.x.x
+     * \param port: port to listen on, 0 for any free port
+     * \param allocationId: identifier used when dealing with the Fw::MemAllocator
+     * \param allocator: Fw::MemAllocator used to acquire the client queues
+     * \param queue_size: bytes of outgoing data queued per client. Default: SOCKET_REACTOR_QUEUE_SIZE
+     * \return status of the configure
+     */
+    SocketIpStatus configure(const char* hostname,
+                             const U16 port,
+                             NATIVE_UINT_TYPE allocationId,
+                             Fw::MemAllocator& allocator,
+                             const FwSizeType queue_size = SOCKET_REACTOR_QUEUE_SIZE);
+
+    /**
+     * \brief return the client queues to the allocator
+     *
+     * Must be called after the task has been stopped and joined.
+     */
+    void cleanup();
+
+    /**
+     * \brief start listening and start the reactor task
+     *
+     * \param name: name of the task
+     * \param priority: priority of the started task. See: Os::Task::start. Default: TASK_DEFAULT, not prioritized
+     * \param stack: stack size provided to the task. See: Os::Task::start. Default: TASK_DEFAULT, posix threads default
+     * \param cpuAffinity: cpu affinity provided to task. See: Os::Task::start. Default: TASK_DEFAULT, don't care
+     * \return status of the listening socket setup
+     */
+    SocketIpStatus start(const Fw::StringBase& name,
+                         const Os::Task::ParamType priority = Os::Task::TASK_DEFAULT,
+                         const Os::Task::ParamType stack = Os::Task::TASK_DEFAULT,
+                         const Os::Task::ParamType cpuAffinity = Os::Task::TASK_DEFAULT);
+
+    /**
+     * \brief stop the reactor task, disconnecting every client and closing the listening socket
+     */
+    void stop();
+
+    /**
+     * \brief joins the stopped reactor task
+     * \return: Os::Task::Status passed back from the Os::Task::join call.
+     */
+    Os::Task::Status join();
+
+    /**
+     * \brief queue data to send to one client or to every client
+     *
+     * Copies the data into the queue of each targeted client and wakes the task to write it. When the data does not fit
+     * in the queue of a targeted client nothing is queued and SOCK_INTERRUPTED_TRY_AGAIN is returned so the caller may
+     * retry once the clients have caught up.
+     *
+     * \param data: data to send
+     * \param size: size of the data
+     * \param clientId: client to send to, BROADCAST for every client. Default: BROADCAST
+     * \return SOCK_SUCCESS when queued, SOCK_INTERRUPTED_TRY_AGAIN when a targeted queue is full, SOCK_DISCONNECTED
+     *         when there is no such client, SOCK_SEND_ERROR when the data can never fit in a queue
+     */
+    SocketIpStatus send(const U8* const data, const U32 size, const U32 clientId = BROADCAST);
+
+    /**
+     * \brief get the port being listened on
+     * \return listen port, 0 before the listening socket is setup
+     */
+    U16 getListenPort();
+
+    /**
+     * \brief get the number of connected clients
+     * \return connected clients
+     */
+    U32 getClientCount();
+
+    /**
+     * \brief get the number of sends refused because a client queue was full
+     * \return refused sends
+     */
+    U32 getBackpressureCount();
+
+  PROTECTED:
+    /**
+     * \brief returns a buffer to fill with data read from a client
+     *
+     * Note: this must be implemented by the inheritor
+     *
+     * \return Fw::Buffer to fill with data
+     */
+    virtual Fw::Buffer getBuffer() = 0;
+
+    /**
+     * \brief sends out a buffer filled with data read from a client
+     *
+     * Note: this must be implemented by the inheritor
+     *
+     * \param buffer: buffer gotten by getBuffer, sized to the data read
+     * \param status: status of the read, the buffer holds no data unless SOCK_SUCCESS
+     * \param clientId: client the data was read from
+     */
+    virtual void sendBuffer(Fw::Buffer buffer, SocketIpStatus status, U32 clientId) = 0;
+
+    /**
+     * \brief called when a client has connected
+     *
+     * Note: this must be implemented by the inheritor
+     *
+     * \param clientId: id of the new client
+     */
+    virtual void connected(U32 clientId) = 0;
+
+    /**
+     * \brief the reactor task body, runs until stopped
+     */
+    void reactorLoop();
+
+    /**
+     * \brief a task designed to run the reactor loop
+     *
+     * \param pointer: pointer to "this" reactor
+     */
+    static void reactorTask(void* pointer);
+
+  PRIVATE:
+    //! Connected client and the data queued for it
+    struct Client {
+        PlatformIntType fd; //!< client socket, -1 for a free entry
+        U32 id; //!< client id
+        U8* queue; //!< queue storage of m_queue_size bytes
+        FwSizeType head; //!< offset of the oldest queued byte
+        FwSizeType count; //!< bytes queued
+        bool writeArmed; //!< waiting for the socket to accept more data
+    };
+
+    //! Accept every pending client
+    void acceptClients();
+
+    //! Read once from a client and send out the data
+    void readClient(Client& client);
+
+    //! Write the queued data of a client until the queue is empty or the socket is full
+    void flushClient(Client& client);
+
+    //! Disconnect a client and discard its queued data
+    void disconnectClient(Client& client);
+
+    //! Watch a client for writability, or stop watching. The caller updates writeArmed under the lock.
+    void armWrite(Client& client, bool arm);
+
+    TcpServerSocket m_socket; //!< listening socket
+    SocketDescriptor m_descriptor; //!< listening socket descriptor
+    Os::Task m_task; //!< reactor task
+    Os::Mutex m_lock; //!< protects the client table and queue counts, taken by senders and the task
+    Client m_clients[SOCKET_REACTOR_MAX_CLIENTS]; //!< client table
+    PlatformIntType m_epollFd; //!< epoll instance
+    PlatformIntType m_wakeFd; //!< eventfd waking the task for new data and stop requests
+    Fw::MemAllocator* m_allocator; //!< allocator of the client queues
+    NATIVE_UINT_TYPE m_allocationId; //!< allocation identifier
+    U8* m_allocation; //!< storage of every client queue
+    FwSizeType m_queue_size; //!< bytes of queue per client
+    U32 m_nextId; //!< id of the next client
+    U32 m_clientCount; //!< connected clients
+    U32 m_backpressure; //!< sends refused on a full queue
+    bool m_stop; //!< stops the task when set to true
+};
+}  // namespace Drv
+#endif  // DRV_TcpServerReactor_HPP
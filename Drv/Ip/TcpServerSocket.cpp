@@ -45,7 +45,7 @@ U16 TcpServerSocket::getListenPort() {
     return port;
 }
 
-SocketIpStatus TcpServerSocket::startup(SocketDescriptor& socketDescriptor) {
+SocketIpStatus TcpServerSocket::startup(SocketDescriptor& socketDescriptor, const U32 backlog) {
     PlatformIntType serverFd = -1;
     struct sockaddr_in address;
     // Acquire a socket, or return error
@@ -77,12 +77,17 @@ SocketIpStatus TcpServerSocket::startup(SocketDescriptor& socketDescriptor) {
         ::close(serverFd);
         return SOCK_FAILED_TO_READ_BACK_PORT;
     }
-    // TCP requires listening on the socket. Since we only expect a single client, set the TCP backlog (second argument) to 1 to prevent queuing of multiple clients.
-    if (::listen(serverFd, 1) < 0) {
+    // TCP requires listening on the socket. When a single client is expected, the TCP backlog (second argument) of 1
+    // prevents queuing of multiple clients.
+    if (::listen(serverFd, static_cast<int>(backlog)) < 0) {
         ::close(serverFd);
         return SOCK_FAILED_TO_LISTEN; // What we have here is a failure to communicate
     }
-    Fw::Logger::log("Listening for single client at %s:%hu\n", m_hostname, m_port);
+    if (backlog == 1) {
+        Fw::Logger::log("Listening for single client at %s:%hu\n", m_hostname, m_port);
+    } else {
+        Fw::Logger::log("Listening for clients at %s:%hu\n", m_hostname, m_port);
+    }
     FW_ASSERT(serverFd != -1);
     socketDescriptor.serverFd = serverFd;
     this->m_port = ntohs(address.sin_port);
@@ -114,6 +119,7 @@ SocketIpStatus TcpServerSocket::openProtocol(SocketDescriptor& socketDescriptor)
     }
 
     Fw::Logger::log("Accepted client at %s:%hu\n", m_hostname, m_port);
+    this->setupZeroCopy(clientFd);
     socketDescriptor.fd = clientFd;
     return SOCK_SUCCESS;
 }
@@ -38,9 +38,10 @@ class TcpServerSocket : public IpSocket {
      * nature of this component, only one (1) client can be handled at a time. After this call succeeds, clients may
      * connect. This call does not block, block occurs on `open` while waiting to accept incoming clients.
      * \param socketDescriptor: server descriptor will be written here
+     * \param backlog: connecting clients queued by the OS before being accepted. Default: 1, a single client
      * \return status of the server socket setup.
      */
-    SocketIpStatus startup(SocketDescriptor& socketDescriptor);
+    SocketIpStatus startup(SocketDescriptor& socketDescriptor, const U32 backlog = 1);
 
     /**
      * \brief close the server socket created by the `startup` call
@@ -29,12 +29,14 @@
     #include <cstring>
 #elif defined TGT_OS_TYPE_LINUX || TGT_OS_TYPE_DARWIN
     #include <sys/socket.h>
+    #include <sys/uio.h>
     #include <unistd.h>
     #include <arpa/inet.h>
 #else
     #error OS not supported for IP Socket Communications
 #endif
 
+#include <cerrno>
 #include <cstring>
 #include <new>
 
@@ -50,7 +52,7 @@ struct SocketState {
     }
 };
 
-UdpSocket::UdpSocket() : IpSocket(), m_state(new(std::nothrow) SocketState), m_recv_port(0) {
+UdpSocket::UdpSocket() : IpSocket(), m_state(new(std::nothrow) SocketState), m_recv_port(0), m_recv_buffer_size(0) {
     FW_ASSERT(m_state != nullptr);
 }
 
@@ -66,10 +68,11 @@ SocketIpStatus UdpSocket::configureSend(const char* const hostname, const U16 po
     return this->IpSocket::configure(hostname, port, timeout_seconds, timeout_microseconds);
 }
 
-SocketIpStatus UdpSocket::configureRecv(const char* hostname, const U16 port) {
+SocketIpStatus UdpSocket::configureRecv(const char* hostname, const U16 port, const U32 recv_buffer_size) {
     FW_ASSERT(this->isValidPort(port));
     FW_ASSERT(hostname != nullptr);
     this->m_recv_port = port;
+    this->m_recv_buffer_size = recv_buffer_size;
     (void) Fw::StringUtils::string_copy(this->m_recv_hostname, hostname, static_cast<FwSizeType>(SOCKET_MAX_HOSTNAME_SIZE));
     return SOCK_SUCCESS;
 }
@@ -151,6 +154,16 @@ SocketIpStatus UdpSocket::openProtocol(SocketDescriptor& socketDescriptor) {
         memcpy(&this->m_state->m_addr_send, &address, sizeof(this->m_state->m_addr_send));
     }
 
+    // Deeper receive buffer so bursts are not dropped between reads
+    if (this->m_recv_buffer_size != 0) {
+        int recv_buffer_size = static_cast<int>(this->m_recv_buffer_size);
+        if (::setsockopt(socketFd, SOL_SOCKET, SO_RCVBUF, reinterpret_cast<char*>(&recv_buffer_size),
+                         sizeof(recv_buffer_size)) < 0) {
+            ::close(socketFd);
+            return SOCK_FAILED_TO_SET_SOCKET_OPTIONS;
+        }
+    }
+
     // When we are setting up for receiving as well, then we must bind to a port
     if ((status = this->bind(socketFd)) != SOCK_SUCCESS) {
         ::close(socketFd);
@@ -179,9 +192,128 @@ I32 UdpSocket::sendProtocol(const SocketDescriptor& socketDescriptor, const U8*
                     reinterpret_cast<struct sockaddr *>(&this->m_state->m_addr_send), sizeof(this->m_state->m_addr_send)));
 }
 
+I32 UdpSocket::sendvProtocol(const SocketDescriptor& socketDescriptor, struct msghdr& message, const U32 flags) {
+    FW_ASSERT(this->m_state->m_addr_send.sin_family != 0); // Make sure the address was previously setup
+    message.msg_name = &this->m_state->m_addr_send;
+    message.msg_namelen = sizeof(this->m_state->m_addr_send);
+    return static_cast<I32>(::sendmsg(socketDescriptor.fd, &message, static_cast<int>(SOCKET_IP_SEND_FLAGS | flags)));
+}
+
 I32 UdpSocket::recvProtocol(const SocketDescriptor& socketDescriptor, U8* const data, const U32 size) {
     FW_ASSERT(this->m_state->m_addr_recv.sin_family != 0); // Make sure the address was previously setup
     return static_cast<I32>(::recvfrom(socketDescriptor.fd, data, size, SOCKET_IP_RECV_FLAGS, nullptr, nullptr));
 }
 
+SocketIpStatus UdpSocket::recvBatch(const SocketDescriptor& socketDescriptor, U8* const* const data, U32* const sizes,
+                                    U32& count) {
+    FW_ASSERT(this->m_state->m_addr_recv.sin_family != 0); // Make sure the address was previously setup
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT((count > 0) && (count <= SOCKET_UDP_BATCH_SIZE), static_cast<FwAssertArgType>(count));
+#ifdef TGT_OS_TYPE_LINUX
+    struct mmsghdr messages[SOCKET_UDP_BATCH_SIZE];
+    struct iovec vectors[SOCKET_UDP_BATCH_SIZE];
+    ::memset(messages, 0, sizeof(messages));
+    for (U32 i = 0; i < count; i++) {
+        FW_ASSERT(data[i] != nullptr);
+        vectors[i].iov_base = data[i];
+        vectors[i].iov_len = sizes[i];
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    I32 received = -1;
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (received == -1); i++) {
+        errno = 0;
+        // Blocks for the first datagram only, the rest of the batch is what is already queued
+        received = static_cast<I32>(::recvmmsg(socketDescriptor.fd, messages, count,
+                                               SOCKET_IP_RECV_FLAGS | MSG_WAITFORONE, nullptr));
+        // Error is EINTR, just try again
+        if ((received == -1) && (errno != EINTR)) {
+            break;
+        }
+    }
+    if (received == -1) {
+        count = 0;
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            return SOCK_NO_DATA_AVAILABLE;
+        } else if (errno == EINTR) {
+            return SOCK_INTERRUPTED_TRY_AGAIN;
+        } else if ((errno == ECONNRESET) || (errno == EBADF)) {
+            return SOCK_DISCONNECTED;
+        }
+        return SOCK_READ_ERROR;
+    }
+    FW_ASSERT((received > 0) && (static_cast<U32>(received) <= count), received, count);
+    for (I32 i = 0; i < received; i++) {
+        sizes[i] = messages[i].msg_len;
+    }
+    count = static_cast<U32>(received);
+    return SOCK_SUCCESS;
+#else
+    // One datagram per call where recvmmsg is unavailable
+    SocketIpStatus status = this->recv(socketDescriptor, data[0], sizes[0]);
+    count = (status == SOCK_SUCCESS) ? 1 : 0;
+    return status;
+#endif
+}
+
+SocketIpStatus UdpSocket::sendBatch(const SocketDescriptor& socketDescriptor, const U8* const* const data,
+                                    const U32* const sizes, U32& count) {
+    FW_ASSERT(this->m_state->m_addr_send.sin_family != 0); // Make sure the address was previously setup
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(sizes != nullptr);
+    FW_ASSERT(count <= SOCKET_UDP_BATCH_SIZE, static_cast<FwAssertArgType>(count));
+    U32 total = 0;
+#ifdef TGT_OS_TYPE_LINUX
+    struct mmsghdr messages[SOCKET_UDP_BATCH_SIZE];
+    struct iovec vectors[SOCKET_UDP_BATCH_SIZE];
+    ::memset(messages, 0, sizeof(messages));
+    for (U32 i = 0; i < count; i++) {
+        FW_ASSERT(data[i] != nullptr);
+        vectors[i].iov_base = const_cast<U8*>(data[i]);
+        vectors[i].iov_len = sizes[i];
+        messages[i].msg_hdr.msg_name = &this->m_state->m_addr_send;
+        messages[i].msg_hdr.msg_namelen = sizeof(this->m_state->m_addr_send);
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+    }
+    // Attempt to send out the datagrams and retry as necessary
+    for (U32 i = 0; (i < SOCKET_MAX_ITERATIONS) && (total < count); i++) {
+        errno = 0;
+        I32 sent = static_cast<I32>(::sendmmsg(socketDescriptor.fd, messages + total, count - total,
+                                               SOCKET_IP_SEND_FLAGS));
+        // Error is EINTR or timeout just try again
+        if (((sent == -1) && (errno == EINTR)) || (sent == 0)) {
+            continue;
+        }
+        // Error bad file descriptor is a close along with reset
+        else if ((sent == -1) && ((errno == EBADF) || (errno == ECONNRESET))) {
+            count = total;
+            return SOCK_DISCONNECTED;
+        }
+        // Error returned, and it wasn't an interrupt nor a disconnect
+        else if (sent == -1) {
+            count = total;
+            return SOCK_SEND_ERROR;
+        }
+        total += static_cast<U32>(sent);
+    }
+#else
+    // One datagram per call where sendmmsg is unavailable
+    for (; total < count; total++) {
+        SocketIpStatus status = this->send(socketDescriptor, data[total], sizes[total]);
+        if (status != SOCK_SUCCESS) {
+            count = total;
+            return status;
+        }
+    }
+#endif
+    // Failed to retry enough to send all datagrams
+    if (total < count) {
+        count = total;
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+    return SOCK_SUCCESS;
+}
+
 }  // namespace Drv
@@ -68,9 +68,11 @@ class UdpSocket : public IpSocket {
      *
      * \param hostname: socket uses for incoming transmissions. Must be of form x.x.x.x
      * \param port: port socket uses for incoming transmissions.
+     * \param recv_buffer_size: SO_RCVBUF size in bytes, 0 keeps the OS default. Default: SOCKET_UDP_RECV_BUFFER_SIZE
      * \return status of configure
      */
-    SocketIpStatus configureRecv(const char* hostname, const U16 port);
+    SocketIpStatus configureRecv(const char* hostname, const U16 port,
+                                 const U32 recv_buffer_size = SOCKET_UDP_RECV_BUFFER_SIZE);
 
     /**
      * \brief get the port being received on
@@ -82,6 +84,37 @@ class UdpSocket : public IpSocket {
      */
     U16 getRecvPort();
 
+    /**
+     * \brief receive a batch of datagrams
+     *
+     * Fills up to count buffers with one datagram each. Blocks for the first datagram, subject to the receive timeout,
+     * then takes the datagrams already queued without blocking. On Linux the batch is received with a single
+     * recvmmsg call, other platforms receive one datagram per call.
+     *
+     * \param socketDescriptor: descriptor to recv from
+     * \param data: buffers to fill
+     * \param sizes: (input/output) capacity of each buffer, set to the size of the datagram received into it
+     * \param count: (input/output) number of buffers, at most SOCKET_UDP_BATCH_SIZE. Set to the datagrams received.
+     * \return status of the receive, SOCK_SUCCESS when at least one datagram was received
+     */
+    SocketIpStatus recvBatch(const SocketDescriptor& socketDescriptor, U8* const* const data, U32* const sizes,
+                             U32& count);
+
+    /**
+     * \brief send a batch of datagrams
+     *
+     * Sends each buffer as one datagram to the address configured with configureSend. On Linux the batch is sent with
+     * sendmmsg, retried as send does until every datagram is out, other platforms send one datagram per call.
+     *
+     * \param socketDescriptor: descriptor to send to
+     * \param data: datagrams to send
+     * \param sizes: size of each datagram
+     * \param count: (input/output) number of datagrams, at most SOCKET_UDP_BATCH_SIZE. Set to the datagrams sent.
+     * \return status of the send, SOCK_SUCCESS when all datagrams were sent
+     */
+    SocketIpStatus sendBatch(const SocketDescriptor& socketDescriptor, const U8* const* const data,
+                             const U32* const sizes, U32& count);
+
   PROTECTED:
 
     /**
@@ -112,9 +145,18 @@ class UdpSocket : public IpSocket {
      * \return: size of data received, or -1 on error.
      */
     I32 recvProtocol(const SocketDescriptor& socketDescriptor, U8* const data, const U32 size) override;
+    /**
+     * \brief Protocol specific implementation of a gathered send, addressed as sendProtocol
+     * \param socketDescriptor: descriptor to send to
+     * \param message: message holding the data segments to send as one datagram
+     * \param flags: flags to send with, in addition to SOCKET_IP_SEND_FLAGS
+     * \return: size of data sent, or -1 on error.
+     */
+    I32 sendvProtocol(const SocketDescriptor& socketDescriptor, struct msghdr& message, const U32 flags) override;
   private:
     SocketState* m_state; //!< State storage
     U16 m_recv_port;  //!< IP address port used
+    U32 m_recv_buffer_size;  //!< SO_RCVBUF size, 0 for the OS default
     char m_recv_hostname[SOCKET_MAX_HOSTNAME_SIZE];  //!< Hostname to supply
 };
 }  // namespace Drv
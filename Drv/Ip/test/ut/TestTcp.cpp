@@ -9,6 +9,11 @@
 #include <Os/Console.hpp>
 #include <Fw/Logger/Logger.hpp>
 #include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+#include <Os/RawTime.hpp>
+#include <Os/Task.hpp>
+#include <Fw/Types/String.hpp>
+#include <sys/socket.h>
+#include <cstring>
 
 Os::Console logger;
 
@@ -55,6 +60,74 @@ void test_with_loop(U32 iterations) {
     server.terminate(server_fd);
 }
 
+void open_pair(Drv::TcpServerSocket& server, Drv::TcpClientSocket& client, Drv::SocketDescriptor& server_fd,
+               Drv::SocketDescriptor& client_fd) {
+    server.configure("127.0.0.1", 0, 0, 100);
+    ASSERT_EQ(server.startup(server_fd), Drv::SOCK_SUCCESS);
+    client.configure("127.0.0.1", server.getListenPort(), 0, 100);
+    ASSERT_EQ(client.open(client_fd), Drv::SOCK_SUCCESS);
+    ASSERT_EQ(server.open(server_fd), Drv::SOCK_SUCCESS);
+    Drv::Test::force_recv_timeout(server_fd.fd, server);
+}
+
+void close_pair(Drv::TcpServerSocket& server, Drv::TcpClientSocket& client, Drv::SocketDescriptor& server_fd,
+                Drv::SocketDescriptor& client_fd) {
+    client.close(client_fd);
+    server.close(server_fd);
+    server.terminate(server_fd);
+}
+
+void test_sendv(U32 zero_copy_threshold) {
+    Drv::TcpServerSocket server;
+    Drv::TcpClientSocket client;
+    Drv::SocketDescriptor server_fd;
+    Drv::SocketDescriptor client_fd;
+    client.setZeroCopyThreshold(zero_copy_threshold);
+    open_pair(server, client, server_fd, client_fd);
+
+    const U32 sizes[] = {1, 100, 1024, 64 * 1024};
+    static U8 sent[12 + 64 * 1024 + 4];
+    static U8 received[sizeof(sent)];
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(sizes); i++) {
+        Drv::Test::fill_random_data(sent, 12 + sizes[i] + 4);
+        // Header, payload and trailer, with an empty segment skipped
+        Drv::SocketSegment segments[4];
+        segments[0].data = sent;
+        segments[0].size = 12;
+        segments[1].data = nullptr;
+        segments[1].size = 0;
+        segments[2].data = sent + 12;
+        segments[2].size = sizes[i];
+        segments[3].data = sent + 12 + sizes[i];
+        segments[3].size = 4;
+        ASSERT_EQ(client.sendv(client_fd, segments, 4), Drv::SOCK_SUCCESS);
+        Drv::Test::receive_all(server, server_fd, received, 12 + sizes[i] + 4);
+        Drv::Test::validate_random_data(sent, received, 12 + sizes[i] + 4);
+    }
+    close_pair(server, client, server_fd, client_fd);
+}
+
+namespace {
+
+struct Drain {
+    PlatformIntType fd;
+    U64 expected;
+};
+
+//! Read the server side until the expected bytes have arrived
+void drainServer(void* argument) {
+    Drain& drain = *static_cast<Drain*>(argument);
+    static U8 data[256 * 1024];
+    U64 received = 0;
+    while (received < drain.expected) {
+        const ssize_t size = ::recv(drain.fd, data, sizeof(data), 0);
+        if (size > 0) {
+            received += static_cast<U64>(size);
+        }
+    }
+}
+
+}  // namespace
 
 TEST(Nominal, TestNominalTcp) {
     test_with_loop(1);
@@ -64,6 +137,80 @@ TEST(Nominal, TestMultipleTcp) {
     test_with_loop(100);
 }
 
+TEST(Segments, TestSendvTcp) {
+    test_sendv(0);
+}
+
+TEST(Segments, TestSendvZeroCopyTcp) {
+    // Falls back to copying where zero copy is not supported
+    test_sendv(16 * 1024);
+}
+
+// Frames/s and payload bandwidth sending 12 B header + payload + 4 B trailer frames over loopback, either copied into
+// an allocated frame buffer and sent, gathered from the segments, or gathered without copying to the kernel.
+// Disabled by default; run with --gtest_also_run_disabled_tests.
+TEST(Segments, DISABLED_FrameRate) {
+    const U32 HEADER = 12;
+    const U32 TRAILER = 4;
+    const U32 BYTES = 256 * 1024 * 1024;
+    const U32 sizes[] = {64, 256, 1024, 4096, 16384, 65536};
+    const char* const modes[] = {"copy", "sendv", "zerocopy"};
+    static U8 payload[65536];
+    U8 header[HEADER] = {};
+    U8 trailer[TRAILER] = {};
+    Drv::Test::fill_random_data(payload, sizeof(payload));
+    for (U32 mode = 0; mode < FW_NUM_ARRAY_ELEMENTS(modes); mode++) {
+        for (U32 index = 0; index < FW_NUM_ARRAY_ELEMENTS(sizes); index++) {
+            const U32 size = sizes[index];
+            const U32 frames = (BYTES / size < 100000) ? BYTES / size : 100000;
+            Drv::TcpServerSocket server;
+            Drv::TcpClientSocket client;
+            Drv::SocketDescriptor server_fd;
+            Drv::SocketDescriptor client_fd;
+            client.setZeroCopyThreshold((mode == 2) ? 1 : 0);
+            open_pair(server, client, server_fd, client_fd);
+
+            Drain drain;
+            drain.fd = server_fd.fd;
+            drain.expected = static_cast<U64>(frames) * (HEADER + size + TRAILER);
+            Os::Task reader;
+            Os::Task::Arguments arguments(Fw::String("Reader"), drainServer, &drain);
+            ASSERT_EQ(reader.start(arguments), Os::Task::OP_OK);
+            Os::RawTime start;
+            Os::RawTime end;
+            (void)start.now();
+            for (U32 frame = 0; frame < frames; frame++) {
+                if (mode == 0) {
+                    // Assembled as a framer allocating and filling a frame buffer
+                    U8* const buffer = new U8[HEADER + size + TRAILER];
+                    ::memcpy(buffer, header, HEADER);
+                    ::memcpy(buffer + HEADER, payload, size);
+                    ::memcpy(buffer + HEADER + size, trailer, TRAILER);
+                    ASSERT_EQ(client.send(client_fd, buffer, HEADER + size + TRAILER), Drv::SOCK_SUCCESS);
+                    delete[] buffer;
+                } else {
+                    Drv::SocketSegment segments[3];
+                    segments[0].data = header;
+                    segments[0].size = HEADER;
+                    segments[1].data = payload;
+                    segments[1].size = size;
+                    segments[2].data = trailer;
+                    segments[2].size = TRAILER;
+                    ASSERT_EQ(client.sendv(client_fd, segments, 3), Drv::SOCK_SUCCESS);
+                }
+            }
+            ASSERT_EQ(reader.join(), Os::Task::OP_OK);
+            (void)end.now();
+            U32 usec = 0;
+            ASSERT_EQ(end.getDiffUsec(start, usec), Os::RawTime::OP_OK);
+            printf("%-8s %6u B payload: %9.0f frames/s %8.1f MB/s payload\n", modes[mode], size,
+                   static_cast<F64>(frames) * 1000000.0 / static_cast<F64>(usec),
+                   static_cast<F64>(frames) * static_cast<F64>(size) / static_cast<F64>(usec));
+            close_pair(server, client, server_fd, client_fd);
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
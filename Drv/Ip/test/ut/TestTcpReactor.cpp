@@ -0,0 +1,288 @@
+// ======================================================================
+// \title  TestTcpReactor.cpp
+// \brief  tests of the multi-client TcpServerReactor
+// ======================================================================
+#include <gtest/gtest.h>
+#include <Drv/Ip/TcpClientSocket.hpp>
+#include <Drv/Ip/TcpServerReactor.hpp>
+#include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+#include <Fw/Types/MallocAllocator.hpp>
+#include <Fw/Types/String.hpp>
+#include <Os/Console.hpp>
+#include <Os/RawTime.hpp>
+#include <atomic>
+#include <poll.h>
+#include <sys/socket.h>
+
+Os::Console logger;
+
+namespace {
+
+const U32 MAX_TEST_CLIENTS = 64;
+
+//! Reactor echoing the data read from each client back to that client
+class EchoReactor : public Drv::TcpServerReactor {
+  public:
+    EchoReactor() : m_connects(0), m_received(0) {}
+
+    Fw::Buffer getBuffer() override { return Fw::Buffer(m_storage, sizeof(m_storage)); }
+
+    void sendBuffer(Fw::Buffer buffer, Drv::SocketIpStatus status, U32 clientId) override {
+        if (status == Drv::SOCK_SUCCESS) {
+            m_received += buffer.getSize();
+            // The client reads its echo, so the queue always has room
+            EXPECT_EQ(this->send(buffer.getData(), buffer.getSize(), clientId), Drv::SOCK_SUCCESS);
+        }
+    }
+
+    void connected(U32 clientId) override {
+        m_ids[m_connects.load() % MAX_TEST_CLIENTS] = clientId;
+        m_connects++;
+    }
+
+    U8 m_storage[1024];
+    U32 m_ids[MAX_TEST_CLIENTS];
+    std::atomic<U32> m_connects;
+    std::atomic<U32> m_received;
+};
+
+//! Start a reactor with a queue of queue_size bytes per client and connect clients to it
+void start(EchoReactor& reactor, Fw::MallocAllocator& allocator, Drv::TcpClientSocket* clients,
+           Drv::SocketDescriptor* fds, U32 count, FwSizeType queue_size = SOCKET_REACTOR_QUEUE_SIZE) {
+    ASSERT_EQ(reactor.configure("127.0.0.1", 0, 0, allocator, queue_size), Drv::SOCK_SUCCESS);
+    ASSERT_EQ(reactor.start(Fw::String("Reactor")), Drv::SOCK_SUCCESS);
+    for (U32 i = 0; i < count; i++) {
+        clients[i].configure("127.0.0.1", reactor.getListenPort(), 0, 100);
+        ASSERT_EQ(clients[i].open(fds[i]), Drv::SOCK_SUCCESS);
+        // Connected in order so the ids line up with the clients
+        while (reactor.m_connects.load() != (i + 1)) {
+            (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+        }
+        Drv::Test::force_recv_timeout(fds[i].fd, clients[i]);
+    }
+    ASSERT_EQ(reactor.getClientCount(), count);
+}
+
+void stop(EchoReactor& reactor, Drv::TcpClientSocket* clients, Drv::SocketDescriptor* fds, U32 count) {
+    reactor.stop();
+    ASSERT_EQ(reactor.join(), Os::Task::OP_OK);
+    reactor.cleanup();
+    for (U32 i = 0; i < count; i++) {
+        clients[i].close(fds[i]);
+    }
+}
+
+//! Bytes available to read from a client without blocking
+U32 available(Drv::SocketDescriptor& fd) {
+    U8 data[1024];
+    const ssize_t size = ::recv(fd.fd, data, sizeof(data), MSG_DONTWAIT | MSG_PEEK);
+    return (size > 0) ? static_cast<U32>(size) : 0;
+}
+
+}  // namespace
+
+TEST(Reactor, Broadcast) {
+    Fw::MallocAllocator allocator;
+    EchoReactor reactor;
+    Drv::TcpClientSocket clients[3];
+    Drv::SocketDescriptor fds[3];
+    start(reactor, allocator, clients, fds, 3);
+
+    U8 sent[256];
+    Drv::Test::fill_random_data(sent, sizeof(sent));
+    ASSERT_EQ(reactor.send(sent, sizeof(sent)), Drv::SOCK_SUCCESS);
+    for (U32 i = 0; i < 3; i++) {
+        U8 received[sizeof(sent)];
+        Drv::Test::receive_all(clients[i], fds[i], received, sizeof(received));
+        Drv::Test::validate_random_data(sent, received, sizeof(sent));
+    }
+    stop(reactor, clients, fds, 3);
+}
+
+TEST(Reactor, RouteToClient) {
+    Fw::MallocAllocator allocator;
+    EchoReactor reactor;
+    Drv::TcpClientSocket clients[3];
+    Drv::SocketDescriptor fds[3];
+    start(reactor, allocator, clients, fds, 3);
+
+    U8 sent[100];
+    Drv::Test::fill_random_data(sent, sizeof(sent));
+    ASSERT_EQ(reactor.send(sent, sizeof(sent), reactor.m_ids[1]), Drv::SOCK_SUCCESS);
+    U8 received[sizeof(sent)];
+    Drv::Test::receive_all(clients[1], fds[1], received, sizeof(received));
+    Drv::Test::validate_random_data(sent, received, sizeof(sent));
+    (void)Os::Task::delay(Fw::TimeInterval(0, 10000));
+    ASSERT_EQ(available(fds[0]), 0u);
+    ASSERT_EQ(available(fds[2]), 0u);
+
+    // Data read from a client is routed back to it by the echo
+    ASSERT_EQ(clients[2].send(fds[2], sent, sizeof(sent)), Drv::SOCK_SUCCESS);
+    Drv::Test::receive_all(clients[2], fds[2], received, sizeof(received));
+    Drv::Test::validate_random_data(sent, received, sizeof(sent));
+    ASSERT_EQ(available(fds[0]), 0u);
+    stop(reactor, clients, fds, 3);
+}
+
+TEST(Reactor, Backpressure) {
+    const FwSizeType QUEUE = 4096;
+    Fw::MallocAllocator allocator;
+    EchoReactor reactor;
+    Drv::TcpClientSocket clients[2];
+    Drv::SocketDescriptor fds[2];
+    start(reactor, allocator, clients, fds, 2, QUEUE);
+    // Shrink the socket buffers so the client that does not read fills its queue quickly
+    int small = 4096;
+    (void)::setsockopt(fds[0].fd, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+
+    U8 sent[1024];
+    Drv::Test::fill_random_data(sent, sizeof(sent));
+    ASSERT_EQ(reactor.send(sent, QUEUE + 1), Drv::SOCK_SEND_ERROR);
+    U32 queued = 0;
+    Drv::SocketIpStatus status = Drv::SOCK_SUCCESS;
+    for (U32 attempt = 0; (attempt < 100000) && (status == Drv::SOCK_SUCCESS); attempt++) {
+        status = reactor.send(sent, sizeof(sent));
+        queued += (status == Drv::SOCK_SUCCESS) ? 1 : 0;
+    }
+    // Neither client was sent the refused data
+    ASSERT_EQ(status, Drv::SOCK_INTERRUPTED_TRY_AGAIN);
+    ASSERT_EQ(reactor.getBackpressureCount(), 1u);
+
+    // Once the clients have read their data the send goes through
+    for (U32 i = 0; i < 2; i++) {
+        for (U32 message = 0; message < queued; message++) {
+            U8 received[sizeof(sent)];
+            Drv::Test::receive_all(clients[i], fds[i], received, sizeof(received));
+            Drv::Test::validate_random_data(sent, received, sizeof(sent));
+        }
+    }
+    while (reactor.send(sent, sizeof(sent)) != Drv::SOCK_SUCCESS) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    stop(reactor, clients, fds, 2);
+}
+
+TEST(Reactor, Disconnect) {
+    Fw::MallocAllocator allocator;
+    EchoReactor reactor;
+    Drv::TcpClientSocket clients[2];
+    Drv::SocketDescriptor fds[2];
+    start(reactor, allocator, clients, fds, 2);
+    const U32 gone = reactor.m_ids[0];
+    clients[0].close(fds[0]);
+    while (reactor.getClientCount() != 1) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    U8 sent[10] = {};
+    ASSERT_EQ(reactor.send(sent, sizeof(sent), gone), Drv::SOCK_DISCONNECTED);
+
+    // A new client takes the free entry under a new id
+    Drv::TcpClientSocket again;
+    Drv::SocketDescriptor again_fd;
+    again.configure("127.0.0.1", reactor.getListenPort(), 0, 100);
+    ASSERT_EQ(again.open(again_fd), Drv::SOCK_SUCCESS);
+    while (reactor.getClientCount() != 2) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    ASSERT_EQ(reactor.send(sent, sizeof(sent), gone), Drv::SOCK_DISCONNECTED);
+    again.close(again_fd);
+    stop(reactor, clients + 1, fds + 1, 1);
+}
+
+namespace {
+
+struct Drain {
+    Drv::SocketDescriptor* fds;
+    U32 count;
+    U64 expected;
+    std::atomic<U64> total;
+};
+
+//! Read every client until each has received the expected bytes
+void drainClients(void* argument) {
+    Drain& drain = *static_cast<Drain*>(argument);
+    struct pollfd polled[MAX_TEST_CLIENTS];
+    U64 received[MAX_TEST_CLIENTS] = {};
+    for (U32 i = 0; i < drain.count; i++) {
+        polled[i].fd = drain.fds[i].fd;
+        polled[i].events = POLLIN;
+    }
+    U8 data[64 * 1024];
+    U32 done = 0;
+    while (done < drain.count) {
+        (void)::poll(polled, drain.count, 100);
+        for (U32 i = 0; i < drain.count; i++) {
+            if ((polled[i].revents & POLLIN) && (received[i] < drain.expected)) {
+                const ssize_t size = ::recv(polled[i].fd, data, sizeof(data), MSG_DONTWAIT);
+                if (size > 0) {
+                    received[i] += static_cast<U64>(size);
+                    drain.total += static_cast<U64>(size);
+                    done += (received[i] >= drain.expected) ? 1 : 0;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+// Aggregate broadcast throughput and echo round trip latency with 1, 8 and 64 loopback clients.
+// Disabled by default; run with --gtest_also_run_disabled_tests.
+TEST(Reactor, DISABLED_Throughput) {
+    const U32 counts[] = {1, 8, 64};
+    const U32 MESSAGES = 4000;
+    const U32 PINGS = 200;
+    for (U32 index = 0; index < FW_NUM_ARRAY_ELEMENTS(counts); index++) {
+        const U32 count = counts[index];
+        Fw::MallocAllocator allocator;
+        EchoReactor reactor;
+        static Drv::TcpClientSocket clients[MAX_TEST_CLIENTS];
+        static Drv::SocketDescriptor fds[MAX_TEST_CLIENTS];
+        start(reactor, allocator, clients, fds, count);
+
+        // Echo round trip on each client in turn
+        U8 ping[64] = {};
+        Os::RawTime start_time;
+        Os::RawTime end_time;
+        U32 usec = 0;
+        (void)start_time.now();
+        for (U32 round = 0; round < PINGS; round++) {
+            for (U32 i = 0; i < count; i++) {
+                ASSERT_EQ(clients[i].send(fds[i], ping, sizeof(ping)), Drv::SOCK_SUCCESS);
+                Drv::Test::receive_all(clients[i], fds[i], ping, sizeof(ping));
+            }
+        }
+        (void)end_time.now();
+        ASSERT_EQ(end_time.getDiffUsec(start_time, usec), Os::RawTime::OP_OK);
+        const F64 latency = static_cast<F64>(usec) / (PINGS * count);
+
+        // Broadcast of 1 KiB messages while one task drains every client
+        U8 message[1024] = {};
+        Drain drain;
+        drain.fds = fds;
+        drain.count = count;
+        drain.expected = static_cast<U64>(MESSAGES) * sizeof(message);
+        drain.total = 0;
+        Os::Task reader;
+        Os::Task::Arguments arguments(Fw::String("Reader"), drainClients, &drain);
+        ASSERT_EQ(reader.start(arguments), Os::Task::OP_OK);
+        (void)start_time.now();
+        for (U32 sent = 0; sent < MESSAGES;) {
+            if (reactor.send(message, sizeof(message)) == Drv::SOCK_SUCCESS) {
+                sent++;
+            }
+        }
+        ASSERT_EQ(reader.join(), Os::Task::OP_OK);
+        (void)end_time.now();
+        ASSERT_EQ(end_time.getDiffUsec(start_time, usec), Os::RawTime::OP_OK);
+        printf("%2u clients: echo round trip %7.1f usec, broadcast %8.1f MB/s aggregate, %u refused sends\n", count,
+               latency, static_cast<F64>(drain.total.load()) / static_cast<F64>(usec),
+               reactor.getBackpressureCount());
+        stop(reactor, clients, fds, count);
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
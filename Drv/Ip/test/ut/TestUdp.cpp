@@ -8,6 +8,9 @@
 #include <Fw/Logger/Logger.hpp>
 #include <Drv/Ip/test/ut/PortSelector.hpp>
 #include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+#include <Os/RawTime.hpp>
+#include <STest/Pick/Pick.hpp>
+#include <sys/socket.h>
 
 Os::Console logger;
 
@@ -62,6 +65,111 @@ void test_with_loop(U32 iterations, bool duplex) {
     }
 }
 
+//! Open a receiving and a sending socket on loopback, the receiver with the given SO_RCVBUF size
+bool open_pair(Drv::UdpSocket& sender, Drv::UdpSocket& receiver, Drv::SocketDescriptor& sender_fd,
+               Drv::SocketDescriptor& receiver_fd, U32 recv_buffer_size = SOCKET_UDP_RECV_BUFFER_SIZE) {
+    U16 port = Drv::Test::get_free_port(true);
+    EXPECT_NE(0, port);
+    receiver.configureRecv("127.0.0.1", port, recv_buffer_size);
+    EXPECT_EQ(receiver.open(receiver_fd), Drv::SOCK_SUCCESS);
+    sender.configureSend("127.0.0.1", receiver.getRecvPort(), 0, 100);
+    sender.configureRecv("127.0.0.1", 0);
+    EXPECT_EQ(sender.open(sender_fd), Drv::SOCK_SUCCESS);
+    Drv::Test::force_recv_timeout(receiver_fd.fd, receiver);
+    return (receiver_fd.fd != -1) && (sender_fd.fd != -1);
+}
+
+void test_batch(U32 datagrams) {
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    Drv::SocketDescriptor sender_fd;
+    Drv::SocketDescriptor receiver_fd;
+    ASSERT_TRUE(open_pair(sender, receiver, sender_fd, receiver_fd));
+
+    U8 sent[SOCKET_UDP_BATCH_SIZE][256];
+    const U8* send_data[SOCKET_UDP_BATCH_SIZE];
+    U32 send_sizes[SOCKET_UDP_BATCH_SIZE];
+    for (U32 i = 0; i < datagrams; i++) {
+        send_sizes[i] = STest::Pick::lowerUpper(1, sizeof(sent[i]));
+        Drv::Test::fill_random_data(sent[i], send_sizes[i]);
+        send_data[i] = sent[i];
+    }
+    U32 count = datagrams;
+    ASSERT_EQ(sender.sendBatch(sender_fd, send_data, send_sizes, count), Drv::SOCK_SUCCESS);
+    ASSERT_EQ(count, datagrams);
+
+    // Datagrams come back in order, each in its own buffer
+    U8 received[SOCKET_UDP_BATCH_SIZE][256];
+    U8* recv_data[SOCKET_UDP_BATCH_SIZE];
+    U32 recv_sizes[SOCKET_UDP_BATCH_SIZE];
+    U32 total = 0;
+    while (total < datagrams) {
+        count = SOCKET_UDP_BATCH_SIZE;
+        for (U32 i = 0; i < count; i++) {
+            recv_data[i] = received[i];
+            recv_sizes[i] = sizeof(received[i]);
+        }
+        ASSERT_EQ(receiver.recvBatch(receiver_fd, recv_data, recv_sizes, count), Drv::SOCK_SUCCESS);
+        ASSERT_GT(count, 0u);
+        for (U32 i = 0; i < count; i++, total++) {
+            ASSERT_LT(total, datagrams);
+            ASSERT_EQ(recv_sizes[i], send_sizes[total]);
+            Drv::Test::validate_random_data(received[i], sent[total], recv_sizes[i]);
+        }
+    }
+    // Nothing left, the receive times out
+    count = 1;
+    recv_sizes[0] = sizeof(received[0]);
+    ASSERT_EQ(receiver.recvBatch(receiver_fd, recv_data, recv_sizes, count), Drv::SOCK_NO_DATA_AVAILABLE);
+    ASSERT_EQ(count, 0u);
+    sender.close(sender_fd);
+    receiver.close(receiver_fd);
+}
+
+//! Packets per second through loopback moving one datagram per call, or SOCKET_UDP_BATCH_SIZE per batched call
+F64 packet_rate(U32 datagram_size, bool batched) {
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    Drv::SocketDescriptor sender_fd;
+    Drv::SocketDescriptor receiver_fd;
+    // Room for a full batch in flight
+    EXPECT_TRUE(open_pair(sender, receiver, sender_fd, receiver_fd, 1024 * 1024));
+    static U8 storage[SOCKET_UDP_BATCH_SIZE][1500];
+    U8* data[SOCKET_UDP_BATCH_SIZE];
+    U32 sizes[SOCKET_UDP_BATCH_SIZE];
+    const U32 ROUNDS = 20000;
+    Os::RawTime start;
+    Os::RawTime end;
+    (void)start.now();
+    for (U32 round = 0; round < ROUNDS; round++) {
+        for (U32 i = 0; i < SOCKET_UDP_BATCH_SIZE; i++) {
+            data[i] = storage[i];
+            sizes[i] = datagram_size;
+        }
+        if (batched) {
+            U32 count = SOCKET_UDP_BATCH_SIZE;
+            EXPECT_EQ(sender.sendBatch(sender_fd, data, sizes, count), Drv::SOCK_SUCCESS);
+            for (U32 total = 0; total < SOCKET_UDP_BATCH_SIZE; total += count) {
+                count = SOCKET_UDP_BATCH_SIZE - total;
+                EXPECT_EQ(receiver.recvBatch(receiver_fd, data + total, sizes + total, count), Drv::SOCK_SUCCESS);
+            }
+        } else {
+            for (U32 i = 0; i < SOCKET_UDP_BATCH_SIZE; i++) {
+                EXPECT_EQ(sender.send(sender_fd, data[i], sizes[i]), Drv::SOCK_SUCCESS);
+            }
+            for (U32 i = 0; i < SOCKET_UDP_BATCH_SIZE; i++) {
+                EXPECT_EQ(receiver.recv(receiver_fd, data[i], sizes[i]), Drv::SOCK_SUCCESS);
+            }
+        }
+    }
+    (void)end.now();
+    U32 usec = 0;
+    EXPECT_EQ(end.getDiffUsec(start, usec), Os::RawTime::OP_OK);
+    sender.close(sender_fd);
+    receiver.close(receiver_fd);
+    return (static_cast<F64>(ROUNDS) * SOCKET_UDP_BATCH_SIZE * 1000000.0) / static_cast<F64>(usec);
+}
+
 TEST(Nominal, TestNominalUdp) {
     test_with_loop(1, false);
 }
@@ -78,6 +186,41 @@ TEST(SingleSide, TestSingleSideMultipleUdp) {
     test_with_loop(100, true);
 }
 
+TEST(Batch, TestBatchUdp) {
+    test_batch(SOCKET_UDP_BATCH_SIZE);
+}
+
+TEST(Batch, TestPartialBatchUdp) {
+    test_batch(3);
+}
+
+TEST(Batch, TestRecvBufferSize) {
+    Drv::UdpSocket sender;
+    Drv::UdpSocket receiver;
+    Drv::SocketDescriptor sender_fd;
+    Drv::SocketDescriptor receiver_fd;
+    const U32 REQUESTED = 64 * 1024;
+    ASSERT_TRUE(open_pair(sender, receiver, sender_fd, receiver_fd, REQUESTED));
+    int size = 0;
+    socklen_t length = sizeof(size);
+    ASSERT_EQ(::getsockopt(receiver_fd.fd, SOL_SOCKET, SO_RCVBUF, &size, &length), 0);
+    ASSERT_GE(static_cast<U32>(size), REQUESTED);
+    sender.close(sender_fd);
+    receiver.close(receiver_fd);
+}
+
+// Loopback packet rate for 64 B and 1400 B datagrams, one datagram per syscall versus recvmmsg/sendmmsg batches.
+// Disabled by default; run with --gtest_also_run_disabled_tests.
+TEST(Batch, DISABLED_PacketRate) {
+    const U32 sizes[] = {64, 1400};
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(sizes); i++) {
+        const F64 single = packet_rate(sizes[i], false);
+        const F64 batched = packet_rate(sizes[i], true);
+        printf("%4u B datagrams: per datagram %10.0f packets/s, batches of %d %10.0f packets/s\n", sizes[i], single,
+               SOCKET_UDP_BATCH_SIZE, batched);
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
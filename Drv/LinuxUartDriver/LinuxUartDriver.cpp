@@ -17,8 +17,15 @@
 #include "Fw/Types/BasicTypes.hpp"
 
 #include <fcntl.h>
+#include <poll.h>
 #include <termios.h>
 #include <cerrno>
+#include <cstring>
+
+#ifdef TGT_OS_TYPE_LINUX
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#endif
 
 //#include <cstdlib>
 //#include <cstdio>
@@ -27,12 +34,59 @@
 
 namespace Drv {
 
+namespace {
+
+//! Wait for the polled descriptors to be readable or for the timeout to pass. A negative timeout waits forever.
+int pollRead(struct pollfd* fds, nfds_t count, I64 timeoutMicroseconds) {
+#ifdef TGT_OS_TYPE_LINUX
+    struct timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(timeoutMicroseconds / 1000000);
+    timeout.tv_nsec = static_cast<long>((timeoutMicroseconds % 1000000) * 1000);
+    return ::ppoll(fds, count, (timeoutMicroseconds < 0) ? nullptr : &timeout, nullptr);
+#else
+    // Rounded up to never wake before a buffer is due
+    return ::poll(fds, count, (timeoutMicroseconds < 0) ? -1 : static_cast<int>((timeoutMicroseconds + 999) / 1000));
+#endif
+}
+
+//! Microseconds passed since the given time
+U32 elapsedSince(const Os::RawTime& since) {
+    Os::RawTime now;
+    U32 elapsed = 0;
+    if ((now.now() != Os::RawTime::OP_OK) || (now.getDiffUsec(since, elapsed) != Os::RawTime::OP_OK)) {
+        elapsed = 0;
+    }
+    return elapsed;
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // Construction, initialization, and destruction
 // ----------------------------------------------------------------------
 
 LinuxUartDriver ::LinuxUartDriver(const char* const compName)
-    : LinuxUartDriverComponentBase(compName), m_fd(-1), m_allocationSize(0),  m_device("NOT_EXIST"), m_quitReadThread(false) {
+    : LinuxUartDriverComponentBase(compName),
+      m_fd(-1),
+      m_allocationSize(0),
+      m_device("NOT_EXIST"),
+      m_flushBytes(0),
+      m_flushMicroseconds(0),
+      m_bytesSent(0),
+      m_bytesRecv(0),
+      m_buffersRecv(0),
+      m_lastBytesSent(0),
+      m_lastBytesRecv(0),
+      m_overruns(0),
+      m_hasLastRun(false),
+      m_quitReadThread(false) {
+    this->m_wakeFds[0] = -1;
+    this->m_wakeFds[1] = -1;
+}
+
+void LinuxUartDriver ::configureReadFlush(U32 flushBytes, U32 flushMicroseconds) {
+    this->m_flushBytes = flushBytes;
+    this->m_flushMicroseconds = flushMicroseconds;
 }
 
 bool LinuxUartDriver::open(const char* const device,
@@ -69,7 +123,7 @@ bool LinuxUartDriver::open(const char* const device,
 
     this->m_fd = fd;
 
-    // Configure blocking reads
+    // Configure non-blocking reads, the read thread polls for data
     struct termios cfg;
 
     stat = tcgetattr(fd, &cfg);
@@ -98,9 +152,11 @@ bool LinuxUartDriver::open(const char* const device,
      If MIN = 0 and TIME = 0, read will be satisfied immediately. The number of characters currently available, or the
      number of characters requested will be returned. According to Antonino (see contributions), you could issue a
      fcntl(fd, F_SETFL, FNDELAY); before reading to get the same result.
+
+     Writes remain blocking as the descriptor itself is not set non-blocking.
      */
     cfg.c_cc[VMIN] = 0;
-    cfg.c_cc[VTIME] = 10;  // 1 sec timeout on no-data
+    cfg.c_cc[VTIME] = 0;  // return what is available, poll waits for data
 
     stat = tcsetattr(fd, TCSANOW, &cfg);
     if (-1 == stat) {
@@ -308,6 +364,11 @@ LinuxUartDriver ::~LinuxUartDriver() {
 
         (void)close(this->m_fd);
     }
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(this->m_wakeFds); i++) {
+        if (this->m_wakeFds[i] != -1) {
+            (void)close(this->m_wakeFds[i]);
+        }
+    }
 }
 
 // ----------------------------------------------------------------------
@@ -328,6 +389,8 @@ Drv::SendStatus LinuxUartDriver ::send_handler(const NATIVE_INT_TYPE portNum, Fw
           Fw::LogStringArg _arg = this->m_device;
           this->log_WARNING_HI_WriteError(_arg, stat);
           status = Drv::SendStatus::SEND_ERROR;
+        } else {
+          this->m_bytesSent += static_cast<U32>(stat);
         }
     }
     // Deallocate when necessary
@@ -337,55 +400,137 @@ Drv::SendStatus LinuxUartDriver ::send_handler(const NATIVE_INT_TYPE portNum, Fw
     return status;
 }
 
+void LinuxUartDriver ::run_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+    const U32 sent = this->m_bytesSent.load();
+    const U32 received = this->m_bytesRecv.load();
+    Os::RawTime now;
+    (void)now.now();
+    U32 elapsedUsec = 0;
+    if (this->m_hasLastRun && (now.getDiffUsec(this->m_lastRun, elapsedUsec) == Os::RawTime::OP_OK) &&
+        (elapsedUsec > 0)) {
+        this->tlmWrite_SendRate(static_cast<F32>(sent - this->m_lastBytesSent) * 1000000.0f /
+                                static_cast<F32>(elapsedUsec));
+        this->tlmWrite_RecvRate(static_cast<F32>(received - this->m_lastBytesRecv) * 1000000.0f /
+                                static_cast<F32>(elapsedUsec));
+    }
+    this->m_lastRun = now;
+    this->m_hasLastRun = true;
+    this->m_lastBytesSent = sent;
+    this->m_lastBytesRecv = received;
+
+    this->tlmWrite_BytesSent(sent);
+    this->tlmWrite_BytesRecv(received);
+    this->tlmWrite_BuffersRecv(this->m_buffersRecv.load());
+
+    // Overruns in the UART itself and in the serial driver's buffer, as counted by the serial driver
+    U32 overruns = this->m_overruns;
+#ifdef TGT_OS_TYPE_LINUX
+    struct serial_icounter_struct counts;
+    if ((this->m_fd != -1) && (ioctl(this->m_fd, TIOCGICOUNT, &counts) == 0)) {
+        overruns = static_cast<U32>(counts.overrun) + static_cast<U32>(counts.buf_overrun);
+    }
+#endif
+    if (overruns != this->m_overruns) {
+        Fw::LogStringArg _arg = this->m_device;
+        this->log_WARNING_HI_RecvOverrun(_arg, overruns - this->m_overruns);
+        this->m_overruns = overruns;
+    }
+    this->tlmWrite_Overruns(overruns);
+}
+
 void LinuxUartDriver ::serialReadTaskEntry(void* ptr) {
     FW_ASSERT(ptr != nullptr);
-    Drv::RecvStatus status = RecvStatus::RECV_ERROR;  // added by m.chase 03.06.2017
     LinuxUartDriver* comp = reinterpret_cast<LinuxUartDriver*>(ptr);
-    while (!comp->m_quitReadThread) {
-        Fw::Buffer buff = comp->allocate_out(0,comp->m_allocationSize);
+    comp->readLoop();
+}
 
-        // On failed allocation, error and deallocate
+void LinuxUartDriver ::readLoop() {
+    Fw::Buffer buff;
+    U32 filled = 0;
+    Os::RawTime first;  // time the first byte of the buffer was read
+    while (!this->m_quitReadThread) {
         if (buff.getData() == nullptr) {
-            Fw::LogStringArg _arg = comp->m_device;
-            comp->log_WARNING_HI_NoBuffers(_arg);
-            status = RecvStatus::RECV_ERROR;
-            comp->recv_out(0, buff, status);
+            buff = this->allocate_out(0, this->m_allocationSize);
+
+            // On failed allocation, error and deallocate
+            if (buff.getData() == nullptr) {
+                Fw::LogStringArg _arg = this->m_device;
+                this->log_WARNING_HI_NoBuffers(_arg);
+                this->recv_out(0, buff, RecvStatus::RECV_ERROR);
+                // to avoid spinning, wait 50 ms
+                Os::Task::delay(Fw::TimeInterval(0, 50000));
+                continue;
+            }
+            filled = 0;
+        }
+
+        // Wait for data, and with bytes already gathered only until the buffer is due to be sent out
+        I64 timeout = -1;
+        if (filled > 0) {
+            const U32 elapsed = elapsedSince(first);
+            timeout = (elapsed >= this->m_flushMicroseconds) ? 0 : (this->m_flushMicroseconds - elapsed);
+        }
+        struct pollfd fds[2];
+        fds[0].fd = this->m_fd;
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        fds[1].fd = this->m_wakeFds[0];
+        fds[1].events = POLLIN;
+        fds[1].revents = 0;
+        int stat = pollRead(fds, FW_NUM_ARRAY_ELEMENTS(fds), timeout);
+
+        // Read what is available into the rest of the buffer
+        if ((stat > 0) && (fds[0].revents != 0)) {
+            stat = static_cast<int>(::read(this->m_fd, buff.getData() + filled, buff.getSize() - filled));
+        } else if ((stat > 0) || ((stat == -1) && (errno == EINTR))) {
+            stat = 0;  // Woken to quit or interrupted, nothing read
+        }
+
+        // On error stat (-1) must mark the read as error, sending out the bytes gathered so far
+        // On normal stat (>0) gather the bytes read
+        // On timeout stat (0) check whether the gathered bytes are due
+        if ((stat == -1) && (errno != EAGAIN)) {
+            Fw::LogStringArg _arg = this->m_device;
+            this->log_WARNING_HI_ReadError(_arg, stat);
+            buff.setSize(filled);
+            this->m_buffersRecv += (filled > 0) ? 1 : 0;
+            this->recv_out(0, buff, (filled > 0) ? RecvStatus::RECV_OK : RecvStatus::RECV_ERROR);
+            buff = Fw::Buffer();
             // to avoid spinning, wait 50 ms
             Os::Task::delay(Fw::TimeInterval(0, 50000));
             continue;
+        } else if (stat > 0) {
+            if (filled == 0) {
+                (void)first.now();
+            }
+            filled += static_cast<U32>(stat);
+            this->m_bytesRecv += static_cast<U32>(stat);
         }
 
-        //          timespec stime;
-        //          (void)clock_gettime(CLOCK_REALTIME,&stime);
-        //          DEBUG_PRINT("<<< Calling dsp_relay_uart_relay_read() at %d %d\n", stime.tv_sec, stime.tv_nsec);
-
-        int stat = 0;
-
-        // Read until something is received or an error occurs. Only loop when
-        // stat == 0 as this is the timeout condition and the read should spin
-        while ((stat == 0) && !comp->m_quitReadThread) {
-            stat = static_cast<int>(::read(comp->m_fd, buff.getData(), buff.getSize()));
+        // Send out a full buffer, one holding enough bytes, or one held long enough
+        if ((filled > 0) &&
+            ((filled == buff.getSize()) || ((this->m_flushBytes > 0) && (filled >= this->m_flushBytes)) ||
+             (elapsedSince(first) >= this->m_flushMicroseconds))) {
+            buff.setSize(filled);
+            this->m_buffersRecv++;
+            this->recv_out(0, buff, RecvStatus::RECV_OK);
+            buff = Fw::Buffer();
         }
-        buff.setSize(0);
-
-        // On error stat (-1) must mark the read as error
-        // On normal stat (>0) pass a recv ok
-        // On timeout stat (0) and m_quitReadThread, error to return the buffer
-        if (stat == -1) {
-            Fw::LogStringArg _arg = comp->m_device;
-            comp->log_WARNING_HI_ReadError(_arg, stat);
-            status = RecvStatus::RECV_ERROR;
-        } else if (stat > 0) {
-            buff.setSize(static_cast<U32>(stat));
-            status = RecvStatus::RECV_OK;  // added by m.chase 03.06.2017
-        } else {
-            status = RecvStatus::RECV_ERROR; // Simply to return the buffer
-        }
-        comp->recv_out(0, buff, status);  // added by m.chase 03.06.2017
+    }
+    // Send out the bytes gathered or simply return the buffer
+    if (buff.getData() != nullptr) {
+        buff.setSize(filled);
+        this->m_buffersRecv += (filled > 0) ? 1 : 0;
+        this->recv_out(0, buff, (filled > 0) ? RecvStatus::RECV_OK : RecvStatus::RECV_ERROR);
     }
 }
 
 void LinuxUartDriver ::start(Os::Task::ParamType priority, Os::Task::ParamType stackSize, Os::Task::ParamType cpuAffinity) {
+    // Pipe waking the read thread when it is quit
+    if (this->m_wakeFds[0] == -1) {
+        const int stat = ::pipe(this->m_wakeFds);
+        FW_ASSERT(stat == 0, errno);
+    }
     Os::TaskString task("SerReader");
     Os::Task::Arguments arguments(task, serialReadTaskEntry, this, priority, stackSize, cpuAffinity);
     Os::Task::Status stat = this->m_readTask.start(arguments);
@@ -394,6 +539,10 @@ void LinuxUartDriver ::start(Os::Task::ParamType priority, Os::Task::ParamType s
 
 void LinuxUartDriver ::quitReadThread() {
     this->m_quitReadThread = true;
+    if (this->m_wakeFds[1] != -1) {
+        const U8 wake = 0;
+        (void)::write(this->m_wakeFds[1], &wake, sizeof(wake));
+    }
 }
 
 Os::Task::Status LinuxUartDriver ::join() {
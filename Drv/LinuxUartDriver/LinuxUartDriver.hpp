@@ -15,9 +15,11 @@
 
 #include <Drv/LinuxUartDriver/LinuxUartDriverComponentAc.hpp>
 #include <Os/Mutex.hpp>
+#include <Os/RawTime.hpp>
 #include <Os/Task.hpp>
 
 #include <termios.h>
+#include <atomic>
 
 namespace Drv {
 
@@ -69,6 +71,13 @@ class LinuxUartDriver : public LinuxUartDriverComponentBase {
     // Open device with specified baud and flow control.
     bool open(const char* const device, UartBaudRate baud, UartFlowControl fc, UartParity parity, U32 allocationSize);
 
+    //! Configure how received bytes are gathered into buffers before being sent out the recv port.
+    //!
+    //! Bytes are read into the same buffer until it holds flushBytes bytes, it is full, or flushMicroseconds have
+    //! passed since its first byte was read, bounding the latency added to the first byte. The defaults of 0 send out
+    //! every read as it completes. Must be called before start.
+    void configureReadFlush(U32 flushBytes, U32 flushMicroseconds);
+
     //! start the serial poll thread.
     //! buffSize is the max receive buffer size
     //!
@@ -96,6 +105,12 @@ class LinuxUartDriver : public LinuxUartDriverComponentBase {
     Drv::SendStatus send_handler(NATIVE_INT_TYPE portNum, /*!< The port number*/
                                  Fw::Buffer& serBuffer);
 
+    //! Handler implementation for run
+    //!
+    void run_handler(NATIVE_INT_TYPE portNum, /*!< The port number*/
+                     U32 context /*!< The call order*/
+    );
+
 
     NATIVE_INT_TYPE m_fd;  //!< file descriptor returned for I/O device
     U32 m_allocationSize; //!< size of allocation request to memory manager
@@ -104,8 +119,23 @@ class LinuxUartDriver : public LinuxUartDriverComponentBase {
     //! This method will be called by the new thread to wait for input on the serial port.
     static void serialReadTaskEntry(void* ptr);
 
+    //! Read the serial port, gathering the bytes into buffers, until the thread is quit
+    void readLoop();
+
     Os::Task m_readTask;  //!< task instance for thread to read serial port
 
+    U32 m_flushBytes;  //!< bytes gathered before a buffer is sent out, 0 for the whole buffer
+    U32 m_flushMicroseconds;  //!< time after the first byte of a buffer it is sent out
+    NATIVE_INT_TYPE m_wakeFds[2];  //!< pipe waking the read thread to quit
+
+    std::atomic<U32> m_bytesSent;  //!< bytes written to the device
+    std::atomic<U32> m_bytesRecv;  //!< bytes read from the device
+    std::atomic<U32> m_buffersRecv;  //!< buffers sent out the recv port
+    U32 m_lastBytesSent;  //!< bytes written as of the previous run
+    U32 m_lastBytesRecv;  //!< bytes read as of the previous run
+    U32 m_overruns;  //!< overruns reported as of the previous run
+    Os::RawTime m_lastRun;  //!< time of the previous run
+    bool m_hasLastRun;  //!< the rates have a previous run to compare against
 
     bool m_quitReadThread;  //!< flag to quit thread
 };
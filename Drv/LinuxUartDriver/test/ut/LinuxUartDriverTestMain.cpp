@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "LinuxUartDriverTester.hpp"
+
+TEST(Nominal, UartEachRead) {
+    Drv::LinuxUartDriverTester tester;
+    tester.test_each_read();
+}
+
+TEST(Nominal, UartSendTelemetry) {
+    Drv::LinuxUartDriverTester tester;
+    tester.test_send_telemetry();
+}
+
+TEST(Aggregation, UartFlushBytes) {
+    Drv::LinuxUartDriverTester tester;
+    tester.test_flush_bytes();
+}
+
+TEST(Aggregation, UartFlushTime) {
+    Drv::LinuxUartDriverTester tester;
+    tester.test_flush_time();
+}
+
+// Buffers sent out per second over a pty paced at each baud rate, sending out every read versus gathering reads for
+// up to 1 ms. A pty does not itself limit the rate so the writer paces the bytes as the line would.
+// Disabled by default; run with --gtest_also_run_disabled_tests.
+TEST(Aggregation, DISABLED_Throughput) {
+    struct Rate {
+        Drv::LinuxUartDriver::UartBaudRate baud;
+        U32 bitsPerSecond;
+    };
+    const Rate rates[] = {
+        {Drv::LinuxUartDriver::BAUD_115K, 115200},
+        {Drv::LinuxUartDriver::BAUD_230K, 230400},
+#ifdef TGT_OS_TYPE_LINUX
+        {Drv::LinuxUartDriver::BAUD_921K, 921600},
+        {Drv::LinuxUartDriver::BAUD_2000K, 2000000},
+#ifdef B4000000
+        {Drv::LinuxUartDriver::BAUD_4000K, 4000000},
+#endif
+#endif
+    };
+    for (U32 i = 0; i < FW_NUM_ARRAY_ELEMENTS(rates); i++) {
+        {
+            Drv::LinuxUartDriverTester tester;
+            tester.benchmark_throughput(rates[i].baud, rates[i].bitsPerSecond, 0, 0);
+        }
+        {
+            Drv::LinuxUartDriverTester tester;
+            tester.benchmark_throughput(rates[i].baud, rates[i].bitsPerSecond, RECV_BUFFER_SIZE, 1000);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
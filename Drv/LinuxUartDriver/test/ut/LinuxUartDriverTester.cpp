@@ -0,0 +1,262 @@
+// ======================================================================
+// \title  LinuxUartDriverTester.cpp
+// \brief  cpp file for LinuxUartDriverTester of LinuxUartDriver
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#include "LinuxUartDriverTester.hpp"
+#include <Os/Console.hpp>
+#include <Os/RawTime.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+Os::Console logger;
+
+namespace Drv {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+LinuxUartDriverTester ::LinuxUartDriverTester()
+    : LinuxUartDriverGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("LinuxUartDriver"),
+      m_master(-1),
+      m_errors(0) {
+    ::memset(this->m_device, 0, sizeof(this->m_device));
+    this->initComponents();
+    this->connectPorts();
+}
+
+LinuxUartDriverTester ::~LinuxUartDriverTester() {
+    if (this->m_master != -1) {
+        (void)::close(this->m_master);
+    }
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void LinuxUartDriverTester ::test_each_read() {
+    this->open_pty(LinuxUartDriver::BAUD_115K);
+    const U8 data[] = "0123456789";
+    for (U32 i = 0; i < 3; i++) {
+        this->write_pty(data, 10);
+        ASSERT_TRUE(this->wait_on_bytes(10 * (i + 1), 1000));
+    }
+    this->close_pty();
+    // Each write was read apart and sent out as read
+    ASSERT_EQ(this->m_sizes.size(), 3u);
+    for (U32 i = 0; i < 3; i++) {
+        ASSERT_EQ(this->m_sizes[i], 10u);
+        ASSERT_EQ(::memcmp(&this->m_received[10 * i], data, 10), 0);
+    }
+}
+
+void LinuxUartDriverTester ::test_flush_bytes() {
+    this->component.configureReadFlush(100, 100000);
+    this->open_pty(LinuxUartDriver::BAUD_115K);
+    U8 data[250];
+    for (U32 i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<U8>(i);
+    }
+    for (U32 i = 0; i < sizeof(data); i += 10) {
+        this->write_pty(data + i, 10);
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    // The last bytes wait out the flush time
+    ASSERT_TRUE(this->wait_on_bytes(sizeof(data), 3000));
+    this->close_pty();
+    ASSERT_EQ(::memcmp(this->m_received.data(), data, sizeof(data)), 0);
+    ASSERT_LE(this->m_sizes.size(), 3u);
+    for (U32 i = 0; i + 1 < this->m_sizes.size(); i++) {
+        ASSERT_GE(this->m_sizes[i], 100u);
+    }
+}
+
+void LinuxUartDriverTester ::test_flush_time() {
+    const U32 FLUSH_US = 20000;
+    this->component.configureReadFlush(RECV_BUFFER_SIZE, FLUSH_US);
+    this->open_pty(LinuxUartDriver::BAUD_115K);
+    const U8 data[] = "01234";
+    Os::RawTime start;
+    (void)start.now();
+    this->write_pty(data, 5);
+    ASSERT_TRUE(this->wait_on_bytes(5, 1000));
+    Os::RawTime end;
+    (void)end.now();
+    U32 elapsed = 0;
+    ASSERT_EQ(end.getDiffUsec(start, elapsed), Os::RawTime::OP_OK);
+    this->close_pty();
+    // Held for the flush time, not for the buffer to fill
+    ASSERT_GE(elapsed, FLUSH_US - 1000);
+    ASSERT_LT(elapsed, 500000u);
+    ASSERT_EQ(this->m_sizes.size(), 1u);
+    ASSERT_EQ(this->m_sizes[0], 5u);
+}
+
+void LinuxUartDriverTester ::test_send_telemetry() {
+    this->open_pty(LinuxUartDriver::BAUD_115K);
+    U8 data[64];
+    for (U32 i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<U8>(i);
+    }
+    Fw::Buffer buffer(data, sizeof(data));
+    ASSERT_EQ(this->invoke_to_send(0, buffer), SendStatus::SEND_OK);
+    ASSERT_from_deallocate_SIZE(1);
+
+    U8 sent[sizeof(data)];
+    U32 total = 0;
+    while (total < sizeof(sent)) {
+        const ssize_t size = ::read(this->m_master, sent + total, sizeof(sent) - total);
+        ASSERT_GT(size, 0);
+        total += static_cast<U32>(size);
+    }
+    ASSERT_EQ(::memcmp(sent, data, sizeof(data)), 0);
+    this->write_pty(data, 16);
+    ASSERT_TRUE(this->wait_on_bytes(16, 1000));
+
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_BytesSent_SIZE(1);
+    ASSERT_TLM_BytesSent(0, 64);
+    ASSERT_TLM_BytesRecv(0, 16);
+    ASSERT_TLM_BuffersRecv(0, this->m_sizes.size());
+    // A pty does not count overruns
+    ASSERT_TLM_Overruns(0, 0);
+    ASSERT_EVENTS_RecvOverrun_SIZE(0);
+    // Rates need a previous run
+    ASSERT_TLM_SendRate_SIZE(0);
+    (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_SendRate_SIZE(1);
+    ASSERT_TLM_RecvRate_SIZE(1);
+    this->close_pty();
+}
+
+void LinuxUartDriverTester ::benchmark_throughput(LinuxUartDriver::UartBaudRate baud, U32 bitsPerSecond,
+                                                  U32 flushBytes, U32 flushMicroseconds) {
+    const U32 DURATION_US = 1000000;
+    const U32 bytesPerSecond = bitsPerSecond / 10; // 8N1 framing
+    const U32 expected = static_cast<U32>(static_cast<U64>(bytesPerSecond) * DURATION_US / 1000000);
+    this->component.configureReadFlush(flushBytes, flushMicroseconds);
+    this->open_pty(baud);
+
+    // Write as fast as the line would carry the bytes
+    static U8 data[4096];
+    Os::RawTime start;
+    (void)start.now();
+    U32 written = 0;
+    while (written < expected) {
+        Os::RawTime now;
+        (void)now.now();
+        U32 elapsed = 0;
+        (void)now.getDiffUsec(start, elapsed);
+        U32 due = static_cast<U32>(static_cast<U64>(bytesPerSecond) * elapsed / 1000000);
+        due = (due > expected) ? expected : due;
+        while (written < due) {
+            const U32 chunk = ((due - written) < sizeof(data)) ? (due - written) : sizeof(data);
+            this->write_pty(data, chunk);
+            written += chunk;
+        }
+        (void)Os::Task::delay(Fw::TimeInterval(0, 100));
+    }
+    ASSERT_TRUE(this->wait_on_bytes(expected, 5000));
+    Os::RawTime end;
+    (void)end.now();
+    U32 elapsed = 0;
+    ASSERT_EQ(end.getDiffUsec(start, elapsed), Os::RawTime::OP_OK);
+    this->close_pty();
+    const F64 buffers = static_cast<F64>(this->m_sizes.size());
+    printf("%8u baud, flush %4u B / %5u us: %8.0f B/s %8.0f buffers/s %7.1f B/buffer\n", bitsPerSecond, flushBytes,
+           flushMicroseconds, static_cast<F64>(expected) * 1000000.0 / static_cast<F64>(elapsed),
+           buffers * 1000000.0 / static_cast<F64>(elapsed), static_cast<F64>(expected) / buffers);
+}
+
+// ----------------------------------------------------------------------
+// Helpers
+// ----------------------------------------------------------------------
+
+void LinuxUartDriverTester ::open_pty(LinuxUartDriver::UartBaudRate baud) {
+    this->m_master = ::posix_openpt(O_RDWR | O_NOCTTY);
+    ASSERT_NE(this->m_master, -1) << "Failed to open pty: " << strerror(errno);
+    ASSERT_EQ(::grantpt(this->m_master), 0);
+    ASSERT_EQ(::unlockpt(this->m_master), 0);
+    const char* name = ::ptsname(this->m_master);
+    ASSERT_NE(name, nullptr);
+    (void)::strncpy(this->m_device, name, sizeof(this->m_device) - 1);
+    ASSERT_TRUE(this->component.open(this->m_device, baud, LinuxUartDriver::NO_FLOW, LinuxUartDriver::PARITY_NONE,
+                                     RECV_BUFFER_SIZE));
+    this->component.start();
+}
+
+void LinuxUartDriverTester ::close_pty() {
+    this->component.quitReadThread();
+    ASSERT_EQ(this->component.join(), Os::Task::OP_OK);
+    ASSERT_EQ(this->m_errors, 0u);
+}
+
+void LinuxUartDriverTester ::write_pty(const U8* data, U32 size) {
+    U32 total = 0;
+    while (total < size) {
+        const ssize_t written = ::write(this->m_master, data + total, size - total);
+        ASSERT_GT(written, 0) << "Failed to write pty: " << strerror(errno);
+        total += static_cast<U32>(written);
+    }
+}
+
+bool LinuxUartDriverTester ::wait_on_bytes(U32 count, U32 timeout_ms) {
+    for (U32 i = 0; i < timeout_ms; i++) {
+        {
+            Os::ScopeLock lock(this->m_lock);
+            if (this->m_received.size() >= count) {
+                return true;
+            }
+        }
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    return false;
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+void LinuxUartDriverTester ::from_recv_handler(const NATIVE_INT_TYPE portNum,
+                                               Fw::Buffer& recvBuffer,
+                                               const RecvStatus& recvStatus) {
+    // Called from the read thread, the port history is left to the test thread
+    {
+        Os::ScopeLock lock(this->m_lock);
+        if (recvStatus == RecvStatus::RECV_OK) {
+            this->m_received.insert(this->m_received.end(), recvBuffer.getData(),
+                                    recvBuffer.getData() + recvBuffer.getSize());
+            this->m_sizes.push_back(recvBuffer.getSize());
+        } else if (recvBuffer.getSize() != 0) {
+            this->m_errors++;
+        }
+    }
+    delete[] recvBuffer.getData();
+}
+
+void LinuxUartDriverTester ::from_ready_handler(const NATIVE_INT_TYPE portNum) {
+    this->pushFromPortEntry_ready();
+}
+
+Fw::Buffer LinuxUartDriverTester ::from_allocate_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    return Fw::Buffer(new U8[size], size);
+}
+
+void LinuxUartDriverTester ::from_deallocate_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->pushFromPortEntry_deallocate(fwBuffer);
+}
+
+}  // end namespace Drv
@@ -0,0 +1,151 @@
+// ======================================================================
+// \title  LinuxUartDriver/test/ut/Tester.hpp
+// \brief  hpp file for LinuxUartDriver test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "LinuxUartDriverGTestBase.hpp"
+#include "Drv/LinuxUartDriver/LinuxUartDriver.hpp"
+#include "Os/Mutex.hpp"
+#include <vector>
+
+#define RECV_BUFFER_SIZE 4096
+
+namespace Drv {
+
+  class LinuxUartDriverTester :
+    public LinuxUartDriverGTestBase
+  {
+      // Maximum size of histories storing events, telemetry, and port outputs
+      static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 1000;
+      // Instance ID supplied to the component instance under test
+      static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object LinuxUartDriverTester
+      //!
+      LinuxUartDriverTester();
+
+      //! Destroy object LinuxUartDriverTester
+      //!
+      ~LinuxUartDriverTester();
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Tests
+      // ----------------------------------------------------------------------
+
+      //! Test every read sent out as it completes
+      //!
+      void test_each_read();
+
+      //! Test reads gathered until enough bytes are held
+      //!
+      void test_flush_bytes();
+
+      //! Test gathered reads sent out once held long enough
+      //!
+      void test_flush_time();
+
+      //! Test sending and the byte count telemetry
+      //!
+      void test_send_telemetry();
+
+      //! Measure buffers and bytes received with the line paced at a baud rate
+      //!
+      //! \param baud: rate to open the device at
+      //! \param bitsPerSecond: rate the line is paced at
+      //! \param flushBytes: bytes gathered before sending out a buffer
+      //! \param flushMicroseconds: time after its first byte a buffer is sent out
+      void benchmark_throughput(LinuxUartDriver::UartBaudRate baud, U32 bitsPerSecond, U32 flushBytes,
+                                U32 flushMicroseconds);
+
+      // Helpers
+      void open_pty(LinuxUartDriver::UartBaudRate baud);
+      void close_pty();
+      void write_pty(const U8* data, U32 size);
+      bool wait_on_bytes(U32 count, U32 timeout_ms);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Handlers for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for from_recv
+      //!
+      void from_recv_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &recvBuffer,
+          const RecvStatus &recvStatus
+      );
+
+      //! Handler for from_ready
+      //!
+      void from_ready_handler(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Handler for from_allocate
+      //!
+      Fw::Buffer from_allocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size
+      );
+
+      //! Handler for from_deallocate
+      //!
+      void from_deallocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Connect ports
+      //!
+      void connectPorts();
+
+      //! Initialize components
+      //!
+      void initComponents();
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      LinuxUartDriver component;
+      NATIVE_INT_TYPE m_master; //!< master side of the pty the component reads
+      char m_device[64]; //!< name of the pty slave
+      Os::Mutex m_lock; //!< protects the received data, filled by the read thread
+      std::vector<U8> m_received; //!< bytes received
+      std::vector<U32> m_sizes; //!< size of each buffer received
+      U32 m_errors; //!< buffers returned with an error status
+
+  };
+
+} // end namespace Drv
+
+#endif
@@ -89,4 +89,17 @@ Drv::SendStatus TcpClientComponentImpl::send_handler(const NATIVE_INT_TYPE portN
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus TcpClientComponentImpl::sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                                             Fw::Buffer& header,
+                                                             Fw::Buffer& payload,
+                                                             Fw::Buffer& trailer) {
+    Drv::SocketIpStatus status = this->sendSegments(header, payload, trailer);
+    if (status == SOCK_INTERRUPTED_TRY_AGAIN) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
 }  // end namespace Drv
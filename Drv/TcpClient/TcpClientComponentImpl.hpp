@@ -127,6 +127,23 @@ class TcpClientComponentImpl : public TcpClientComponentBase, public SocketCompo
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send data gathered from a header, a payload and a trailer out of the TcpClient
+     *
+     * The buffers are sent as one transmission without being copied together and are not deallocated, ownership
+     * stays with the caller. Statuses are returned as for the send port.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: data sent first
+     * \param payload: data sent after the header
+     * \param trailer: data sent last
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                         Fw::Buffer& header,
+                                         Fw::Buffer& payload,
+                                         Fw::Buffer& trailer);
+
     Drv::TcpClientSocket m_socket; //!< Socket implementation
 
     // Member variable to store the buffer size
@@ -0,0 +1,17 @@
+// ======================================================================
+// TcpMultiServer.hpp
+// Standardization header for TcpMultiServer
+// ======================================================================
+
+#ifndef Drv_TcpMultiServer_HPP
+#define Drv_TcpMultiServer_HPP
+
+#include "Drv/TcpMultiServer/TcpMultiServerComponentImpl.hpp"
+
+namespace Drv {
+
+  typedef TcpMultiServerComponentImpl TcpMultiServer;
+
+}
+
+#endif
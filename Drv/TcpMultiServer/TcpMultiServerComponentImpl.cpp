@@ -0,0 +1,104 @@
+// ======================================================================
+// \title  TcpMultiServerComponentImpl.cpp
+// \brief  cpp file for TcpMultiServerComponentImpl component implementation class
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <limits>
+#include <Drv/TcpMultiServer/TcpMultiServerComponentImpl.hpp>
+#include <FpConfig.hpp>
+#include "Fw/Types/Assert.hpp"
+
+namespace Drv {
+
+// ----------------------------------------------------------------------
+// Construction, initialization, and destruction
+// ----------------------------------------------------------------------
+
+TcpMultiServerComponentImpl::TcpMultiServerComponentImpl(const char* const compName)
+    : TcpMultiServerComponentBase(compName), m_allocation_size(0) {}
+
+TcpMultiServerComponentImpl::~TcpMultiServerComponentImpl() {}
+
+SocketIpStatus TcpMultiServerComponentImpl::configure(const char* hostname,
+                                                      const U16 port,
+                                                      NATIVE_UINT_TYPE allocationId,
+                                                      Fw::MemAllocator& allocator,
+                                                      const FwSizeType queue_size,
+                                                      FwSizeType buffer_size) {
+    // Check that ensures the configured buffer size fits within the limits fixed-width type, U32
+    FW_ASSERT(buffer_size <= std::numeric_limits<U32>::max(), static_cast<FwAssertArgType>(buffer_size));
+    m_allocation_size = buffer_size;
+    return TcpServerReactor::configure(hostname, port, allocationId, allocator, queue_size);
+}
+
+// ----------------------------------------------------------------------
+// Implementations for reactor virtual methods
+// ----------------------------------------------------------------------
+
+Fw::Buffer TcpMultiServerComponentImpl::getBuffer() {
+    return allocate_out(0, static_cast<U32>(m_allocation_size));
+}
+
+void TcpMultiServerComponentImpl::sendBuffer(Fw::Buffer buffer, SocketIpStatus status, U32 clientId) {
+    Drv::RecvStatus recvStatus = RecvStatus::RECV_ERROR;
+    if (status == SOCK_SUCCESS) {
+        recvStatus = RecvStatus::RECV_OK;
+    }
+    else if (status == SOCK_NO_DATA_AVAILABLE) {
+        recvStatus = RecvStatus::RECV_NO_DATA;
+    }
+    else {
+        recvStatus = RecvStatus::RECV_ERROR;
+    }
+    if (isConnected_recvFrom_OutputPort(0)) {
+        this->recvFrom_out(0, buffer, recvStatus, clientId);
+    } else {
+        this->recv_out(0, buffer, recvStatus);
+    }
+}
+
+void TcpMultiServerComponentImpl::connected(U32 clientId) {
+    if (isConnected_ready_OutputPort(0)) {
+        this->ready_out(0);
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+Drv::SendStatus TcpMultiServerComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    return this->sendStatus(this->send(fwBuffer.getData(), fwBuffer.getSize()), fwBuffer);
+}
+
+Drv::SendStatus TcpMultiServerComponentImpl::sendTo_handler(const NATIVE_INT_TYPE portNum,
+                                                            Fw::Buffer& sendBuffer,
+                                                            U32 clientId) {
+    FW_ASSERT(clientId != BROADCAST);
+    SocketIpStatus status = this->send(sendBuffer.getData(), sendBuffer.getSize(), clientId);
+    // A client that has gone does not come back, retrying cannot succeed
+    if (status == SOCK_DISCONNECTED) {
+        status = SOCK_SEND_ERROR;
+    }
+    return this->sendStatus(status, sendBuffer);
+}
+
+Drv::SendStatus TcpMultiServerComponentImpl::sendStatus(SocketIpStatus status, Fw::Buffer& fwBuffer) {
+    // Only deallocate buffer when the caller is not asked to retry
+    if ((status == SOCK_INTERRUPTED_TRY_AGAIN) || (status == SOCK_DISCONNECTED)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        deallocate_out(0, fwBuffer);
+        return SendStatus::SEND_ERROR;
+    }
+    deallocate_out(0, fwBuffer);
+    return SendStatus::SEND_OK;
+}
+
+}  // end namespace Drv
@@ -0,0 +1,131 @@
+// ======================================================================
+// \title  TcpMultiServerComponentImpl.hpp
+// \brief  hpp file for TcpMultiServerComponentImpl component implementation class
+//
+// \copyright
+// Copyright 2009-2020, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TcpMultiServerComponentImpl_HPP
+#define TcpMultiServerComponentImpl_HPP
+
+#include <IpCfg.hpp>
+#include <Drv/Ip/TcpServerReactor.hpp>
+#include "Drv/TcpMultiServer/TcpMultiServerComponentAc.hpp"
+
+namespace Drv {
+
+class TcpMultiServerComponentImpl : public TcpMultiServerComponentBase, public TcpServerReactor {
+  public:
+    // ----------------------------------------------------------------------
+    // Construction, initialization, and destruction
+    // ----------------------------------------------------------------------
+
+    /**
+     * \brief construct the TcpMultiServer component.
+     * \param compName: name of this component
+     */
+    TcpMultiServerComponentImpl(const char* const compName);
+
+    /**
+     * \brief Destroy the component
+     */
+    ~TcpMultiServerComponentImpl();
+
+    // ----------------------------------------------------------------------
+    // Helper methods to start and stop the server
+    // ----------------------------------------------------------------------
+
+    /**
+     * \brief Configures the TcpMultiServer settings but does not start listening
+     *
+     * Configures the address clients connect to and allocates the per-client send queues. Listening starts, and clients
+     * are accepted, once the reactor task is started with `start`. Note: hostname must be a dot-notation IP address of
+     * the form "x.x.x.x". DNS translation is left up to the user.
+     *
+     * \param hostname: ip address to listen on in the form x.x.x.x
+     * \param port: port to listen on, 0 for any free port
+     * \param allocationId: identifier used when dealing with the Fw::MemAllocator
+     * \param allocator: Fw::MemAllocator used to acquire the client queues
+     * \param queue_size: bytes of outgoing data queued per client. Defaults to: SOCKET_REACTOR_QUEUE_SIZE
+     * \param buffer_size: size of the buffer to be allocated for received data. Defaults to 1024.
+     * \return status of the configure
+     */
+    SocketIpStatus configure(const char* hostname,
+                             const U16 port,
+                             NATIVE_UINT_TYPE allocationId,
+                             Fw::MemAllocator& allocator,
+                             const FwSizeType queue_size = SOCKET_REACTOR_QUEUE_SIZE,
+                             FwSizeType buffer_size = 1024);
+
+  PROTECTED:
+    // ----------------------------------------------------------------------
+    // Implementations for reactor virtual methods
+    // ----------------------------------------------------------------------
+
+    /**
+     * \brief returns a buffer to fill with data read from a client
+     * \return Fw::Buffer allocated from the allocate port
+     */
+    Fw::Buffer getBuffer() override;
+
+    /**
+     * \brief sends out a buffer filled with data read from a client
+     *
+     * Data goes out the recvFrom port when it is connected, carrying the client it came from, and out the recv port
+     * otherwise.
+     *
+     * \param buffer: buffer gotten by getBuffer, sized to the data read
+     * \param status: status of the read
+     * \param clientId: client the data was read from
+     */
+    void sendBuffer(Fw::Buffer buffer, SocketIpStatus status, U32 clientId) override;
+
+    /**
+     * \brief called when a client has connected, signals ready
+     * \param clientId: id of the new client
+     */
+    void connected(U32 clientId) override;
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    /**
+     * \brief Send data to every connected client
+     *
+     * The data is queued for each client and written by the reactor task. SEND_RETRY is returned when the queue of a
+     * client cannot hold the data, and when no client is connected, in which case the buffer is kept by the caller.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param fwBuffer: buffer containing data to be sent
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) override;
+
+    /**
+     * \brief Send data to one client
+     *
+     * As send but for the one client. SEND_ERROR is returned when the client has disconnected as a retry cannot
+     * succeed.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param sendBuffer: buffer containing data to be sent
+     * \param clientId: client to send to
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendTo_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& sendBuffer, U32 clientId) override;
+
+    //! Convert the status of a reactor send, deallocating the buffer unless the caller is asked to retry
+    Drv::SendStatus sendStatus(SocketIpStatus status, Fw::Buffer& fwBuffer);
+
+    FwSizeType m_allocation_size; //!< Member variable to store the buffer size
+};
+
+}  // end namespace Drv
+
+#endif // end TcpMultiServerComponentImpl
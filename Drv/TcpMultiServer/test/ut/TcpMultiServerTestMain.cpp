@@ -0,0 +1,25 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "TcpMultiServerTester.hpp"
+
+TEST(Nominal, TcpMultiServerBroadcast) {
+    Drv::TcpMultiServerTester tester;
+    tester.test_broadcast();
+}
+
+TEST(Nominal, TcpMultiServerRouting) {
+    Drv::TcpMultiServerTester tester;
+    tester.test_routing();
+}
+
+TEST(Reconnect, TcpMultiServerDisconnect) {
+    Drv::TcpMultiServerTester tester;
+    tester.test_disconnect();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,189 @@
+// ======================================================================
+// \title  TcpMultiServerTester.cpp
+// \brief  cpp file for TcpMultiServerTester for TcpMultiServer
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+#include "TcpMultiServerTester.hpp"
+#include "Os/Console.hpp"
+#include <Drv/Ip/test/ut/SocketTestHelper.hpp>
+
+Os::Console logger;
+
+namespace Drv {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TcpMultiServerTester ::TcpMultiServerTester()
+    : TcpMultiServerGTestBase("Tester", MAX_HISTORY_SIZE),
+      component("TcpMultiServer"),
+      m_data_buffer(m_data_storage, 0),
+      m_received(0),
+      m_last_client(0) {
+    this->initComponents();
+    this->connectPorts();
+    ::memset(m_data_storage, 0, sizeof(m_data_storage));
+}
+
+TcpMultiServerTester ::~TcpMultiServerTester() {}
+
+// ----------------------------------------------------------------------
+// Helpers
+// ----------------------------------------------------------------------
+
+void TcpMultiServerTester ::start_clients() {
+    ASSERT_EQ(this->component.configure("127.0.0.1", 0, 0, m_allocator), Drv::SOCK_SUCCESS);
+    ASSERT_EQ(this->component.start(Os::TaskString("reactor")), Drv::SOCK_SUCCESS);
+    for (U32 i = 0; i < TEST_CLIENTS; i++) {
+        m_clients[i].configure("127.0.0.1", this->component.getListenPort(), 0, 100);
+        ASSERT_EQ(m_clients[i].open(m_client_fds[i]), Drv::SOCK_SUCCESS);
+        Drv::Test::force_recv_timeout(m_client_fds[i].fd, m_clients[i]);
+    }
+    this->wait_on_count(TEST_CLIENTS);
+}
+
+void TcpMultiServerTester ::stop_clients() {
+    this->component.stop();
+    ASSERT_EQ(this->component.join(), Os::Task::OP_OK);
+    this->component.cleanup();
+    for (U32 i = 0; i < TEST_CLIENTS; i++) {
+        m_clients[i].close(m_client_fds[i]);
+    }
+}
+
+void TcpMultiServerTester ::wait_on_count(U32 count) {
+    for (U32 i = 0; (i < 1000) && (this->component.getClientCount() != count); i++) {
+        Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    ASSERT_EQ(this->component.getClientCount(), count);
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TcpMultiServerTester ::test_broadcast() {
+    this->start_clients();
+    m_data_buffer.setSize(sizeof(m_data_storage));
+    const U32 size = Drv::Test::fill_random_buffer(m_data_buffer);
+    ASSERT_EQ(invoke_to_send(0, m_data_buffer), SendStatus::SEND_OK);
+    ASSERT_from_deallocate_SIZE(1);
+    for (U32 i = 0; i < TEST_CLIENTS; i++) {
+        U8 buffer[sizeof(m_data_storage)] = {};
+        Drv::Test::receive_all(m_clients[i], m_client_fds[i], buffer, size);
+        Drv::Test::validate_random_data(m_data_buffer.getData(), buffer, size);
+    }
+    ASSERT_from_ready_SIZE(TEST_CLIENTS);
+    this->stop_clients();
+}
+
+void TcpMultiServerTester ::test_routing() {
+    this->start_clients();
+    U32 ids[TEST_CLIENTS];
+    m_data_buffer.setSize(sizeof(m_data_storage));
+    U32 size = Drv::Test::fill_random_buffer(m_data_buffer);
+    // Learn each client's id from the data it sends
+    for (U32 i = 0; i < TEST_CLIENTS; i++) {
+        const U32 received = m_received;
+        ASSERT_EQ(m_clients[i].send(m_client_fds[i], m_data_buffer.getData(), size), Drv::SOCK_SUCCESS);
+        while (m_received == received) {
+            Os::Task::delay(Fw::TimeInterval(0, 1000));
+        }
+        ids[i] = m_last_client;
+    }
+    ASSERT_NE(ids[0], ids[1]);
+    ASSERT_NE(ids[1], ids[2]);
+    ASSERT_from_recv_SIZE(0);
+
+    // Reply to the second client only
+    m_data_buffer.setSize(sizeof(m_data_storage));
+    size = Drv::Test::fill_random_buffer(m_data_buffer);
+    ASSERT_EQ(invoke_to_sendTo(0, m_data_buffer, ids[1]), SendStatus::SEND_OK);
+    U8 buffer[sizeof(m_data_storage)] = {};
+    Drv::Test::receive_all(m_clients[1], m_client_fds[1], buffer, size);
+    Drv::Test::validate_random_buffer(m_data_buffer, buffer);
+    Os::Task::delay(Fw::TimeInterval(0, 10000));
+    U32 pending = sizeof(buffer);
+    ASSERT_EQ(m_clients[0].recv(m_client_fds[0], buffer, pending), Drv::SOCK_NO_DATA_AVAILABLE);
+    pending = sizeof(buffer);
+    ASSERT_EQ(m_clients[2].recv(m_client_fds[2], buffer, pending), Drv::SOCK_NO_DATA_AVAILABLE);
+    this->stop_clients();
+}
+
+void TcpMultiServerTester ::test_disconnect() {
+    this->start_clients();
+    m_data_buffer.setSize(sizeof(m_data_storage));
+    const U32 size = Drv::Test::fill_random_buffer(m_data_buffer);
+    ASSERT_EQ(m_clients[0].send(m_client_fds[0], m_data_buffer.getData(), size), Drv::SOCK_SUCCESS);
+    while (m_received == 0) {
+        Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    const U32 gone = m_last_client;
+    m_clients[0].close(m_client_fds[0]);
+    this->wait_on_count(TEST_CLIENTS - 1);
+
+    // The buffer is returned when the client can never be sent to
+    this->clearFromPortHistory();
+    ASSERT_EQ(invoke_to_sendTo(0, m_data_buffer, gone), SendStatus::SEND_ERROR);
+    ASSERT_from_deallocate_SIZE(1);
+    ASSERT_EQ(invoke_to_send(0, m_data_buffer), SendStatus::SEND_OK);
+
+    this->component.stop();
+    ASSERT_EQ(this->component.join(), Os::Task::OP_OK);
+    this->component.cleanup();
+    for (U32 i = 1; i < TEST_CLIENTS; i++) {
+        m_clients[i].close(m_client_fds[i]);
+    }
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+void TcpMultiServerTester ::from_recv_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& recvBuffer, const RecvStatus& recvStatus) {
+    this->pushFromPortEntry_recv(recvBuffer, recvStatus);
+    delete[] recvBuffer.getData();
+}
+
+void TcpMultiServerTester ::from_recvFrom_handler(const NATIVE_INT_TYPE portNum,
+                                                  Fw::Buffer& recvBuffer,
+                                                  const RecvStatus& recvStatus,
+                                                  U32 clientId) {
+    if (recvStatus == RecvStatus::RECV_OK) {
+        EXPECT_EQ(m_data_buffer.getSize(), recvBuffer.getSize()) << "Invalid transmission size";
+        Drv::Test::validate_random_data(m_data_buffer.getData(), recvBuffer.getData(), recvBuffer.getSize());
+        m_last_client = clientId;
+        m_received++;
+    }
+    delete[] recvBuffer.getData();
+}
+
+void TcpMultiServerTester ::from_ready_handler(const NATIVE_INT_TYPE portNum) {
+    this->pushFromPortEntry_ready();
+}
+
+Fw::Buffer TcpMultiServerTester ::
+    from_allocate_handler(
+        const NATIVE_INT_TYPE portNum,
+        U32 size
+    )
+  {
+    Fw::Buffer buffer(new U8[size], size);
+    return buffer;
+  }
+
+  void TcpMultiServerTester ::
+    from_deallocate_handler(
+        const NATIVE_INT_TYPE portNum,
+        Fw::Buffer &fwBuffer
+    )
+  {
+    this->pushFromPortEntry_deallocate(fwBuffer);
+  }
+}  // end namespace Drv
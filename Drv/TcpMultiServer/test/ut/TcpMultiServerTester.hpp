@@ -0,0 +1,149 @@
+// ======================================================================
+// \title  TcpMultiServer/test/ut/Tester.hpp
+// \brief  hpp file for TcpMultiServer test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "TcpMultiServerGTestBase.hpp"
+#include "Drv/TcpMultiServer/TcpMultiServerComponentImpl.hpp"
+#include "Drv/Ip/TcpClientSocket.hpp"
+#include "Fw/Types/MallocAllocator.hpp"
+#include <atomic>
+
+#define SEND_DATA_BUFFER_SIZE 1024
+#define TEST_CLIENTS 3
+
+namespace Drv {
+
+  class TcpMultiServerTester :
+    public TcpMultiServerGTestBase
+  {
+      // Maximum size of histories storing events, telemetry, and port outputs
+      static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 1000;
+      // Instance ID supplied to the component instance under test
+      static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
+
+      // ----------------------------------------------------------------------
+      // Construction and destruction
+      // ----------------------------------------------------------------------
+
+    public:
+
+      //! Construct object TcpMultiServerTester
+      //!
+      TcpMultiServerTester();
+
+      //! Destroy object TcpMultiServerTester
+      //!
+      ~TcpMultiServerTester();
+
+    public:
+
+      // ----------------------------------------------------------------------
+      // Tests
+      // ----------------------------------------------------------------------
+
+      //! Test sending to every client
+      //!
+      void test_broadcast();
+
+      //! Test sending to one client and receiving from each client
+      //!
+      void test_routing();
+
+      //! Test sending to a client that has disconnected
+      //!
+      void test_disconnect();
+
+      // Helpers
+      void start_clients();
+      void stop_clients();
+      void wait_on_count(U32 count);
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Handlers for typed from ports
+      // ----------------------------------------------------------------------
+
+      //! Handler for from_recv
+      //!
+      void from_recv_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &recvBuffer,
+          const RecvStatus &recvStatus
+      );
+
+      //! Handler for from_recvFrom
+      //!
+      void from_recvFrom_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &recvBuffer,
+          const RecvStatus &recvStatus,
+          U32 clientId
+      );
+
+      //! Handler for from_ready
+      //!
+      void from_ready_handler(
+          const NATIVE_INT_TYPE portNum /*!< The port number*/
+      );
+
+      //! Handler for from_allocate
+      //!
+      Fw::Buffer from_allocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          U32 size
+      );
+
+      //! Handler for from_deallocate
+      //!
+      void from_deallocate_handler(
+          const NATIVE_INT_TYPE portNum, /*!< The port number*/
+          Fw::Buffer &fwBuffer
+      );
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Helper methods
+      // ----------------------------------------------------------------------
+
+      //! Connect ports
+      //!
+      void connectPorts();
+
+      //! Initialize components
+      //!
+      void initComponents();
+
+    private:
+
+      // ----------------------------------------------------------------------
+      // Variables
+      // ----------------------------------------------------------------------
+
+      //! The component under test
+      //!
+      TcpMultiServerComponentImpl component;
+      Fw::MallocAllocator m_allocator;
+      Fw::Buffer m_data_buffer;
+      U8 m_data_storage[SEND_DATA_BUFFER_SIZE];
+      Drv::TcpClientSocket m_clients[TEST_CLIENTS];
+      Drv::SocketDescriptor m_client_fds[TEST_CLIENTS];
+      std::atomic<U32> m_received;
+      std::atomic<U32> m_last_client;
+
+  };
+
+} // end namespace Drv
+
+#endif
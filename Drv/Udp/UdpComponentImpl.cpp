@@ -14,7 +14,9 @@
 #include <Drv/Udp/UdpComponentImpl.hpp>
 #include <IpCfg.hpp>
 #include <FpConfig.hpp>
+#include "Fw/Logger/Logger.hpp"
 #include "Fw/Types/Assert.hpp"
+#include <cerrno>
 
 
 namespace Drv {
@@ -24,20 +26,26 @@ namespace Drv {
 // ----------------------------------------------------------------------
 
 UdpComponentImpl::UdpComponentImpl(const char* const compName)
-    : UdpComponentBase(compName) {}
+    : UdpComponentBase(compName), m_batch_size(1), m_send_batch_size(1), m_send_count(0) {}
 
 SocketIpStatus UdpComponentImpl::configureSend(const char* hostname,
                                                  const U16 port,
                                                  const U32 send_timeout_seconds,
-                                                 const U32 send_timeout_microseconds) {
+                                                 const U32 send_timeout_microseconds,
+                                                 const U32 batch_size) {
+    FW_ASSERT((batch_size > 0) && (batch_size <= SOCKET_UDP_BATCH_SIZE), static_cast<FwAssertArgType>(batch_size));
+    m_send_batch_size = batch_size;
     return m_socket.configureSend(hostname, port, send_timeout_seconds, send_timeout_microseconds);
 }
 
-SocketIpStatus UdpComponentImpl::configureRecv(const char* hostname, const U16 port, FwSizeType buffer_size) {
+SocketIpStatus UdpComponentImpl::configureRecv(const char* hostname, const U16 port, FwSizeType buffer_size,
+                                               const U32 batch_size, const U32 recv_buffer_size) {
     FW_ASSERT(buffer_size <= std::numeric_limits<U32>::max(), static_cast<FwAssertArgType>(buffer_size));
+    FW_ASSERT((batch_size > 0) && (batch_size <= SOCKET_UDP_BATCH_SIZE), static_cast<FwAssertArgType>(batch_size));
     m_allocation_size = buffer_size; // Store the buffer size
+    m_batch_size = batch_size;
 
-    return m_socket.configureRecv(hostname, port);
+    return m_socket.configureRecv(hostname, port, recv_buffer_size);
 }
 
 UdpComponentImpl::~UdpComponentImpl() {}
@@ -54,6 +62,74 @@ IpSocket& UdpComponentImpl::getSocketHandler() {
     return m_socket;
 }
 
+void UdpComponentImpl::readLoop() {
+    this->SocketComponentHelper::readLoop();
+    // Read task is done with the buffers it holds
+    for (U32 i = 0; i < SOCKET_UDP_BATCH_SIZE; i++) {
+        if (this->m_batch[i].getData() != nullptr) {
+            this->deallocate_out(0, this->m_batch[i]);
+            this->m_batch[i] = Fw::Buffer();
+        }
+    }
+}
+
+SocketIpStatus UdpComponentImpl::readSocket() {
+    U8* data[SOCKET_UDP_BATCH_SIZE];
+    U32 sizes[SOCKET_UDP_BATCH_SIZE];
+    // Top up the batch, buffers left unfilled by the previous read are used first
+    U32 count = 0;
+    for (; count < this->m_batch_size; count++) {
+        if (this->m_batch[count].getData() == nullptr) {
+            this->m_batch[count] = this->getBuffer();
+        }
+        if (this->m_batch[count].getData() == nullptr) {
+            break;
+        }
+        this->m_batch[count].setSize(static_cast<U32>(m_allocation_size));
+        data[count] = this->m_batch[count].getData();
+        sizes[count] = this->m_batch[count].getSize();
+    }
+    if (count == 0) {
+        // Allocator exhausted, skip this read and retry once buffers have been returned
+        Fw::Logger::log("[WARNING] Failed to allocate a buffer to recv into\n");
+        (void)Os::Task::delay(SOCKET_RETRY_INTERVAL);
+        return SOCK_INTERRUPTED_TRY_AGAIN;
+    }
+
+    SocketIpStatus status = SOCK_DISCONNECTED;
+    this->m_lock.lock();
+    SocketDescriptor descriptor = this->m_descriptor;
+    this->m_lock.unlock();
+    // Check for previously disconnected socket
+    if (descriptor.fd != -1) {
+        // recv blocks, so it may have been a while since its done an isOpened check
+        status = this->m_socket.recvBatch(descriptor, data, sizes, count);
+    }
+    if (status != SOCK_SUCCESS) {
+        if ((status != SOCK_INTERRUPTED_TRY_AGAIN) && (status != SOCK_NO_DATA_AVAILABLE)) {
+            Fw::Logger::log("[WARNING] Failed to recv from port with status %d and errno %d\n", status, errno);
+            this->close();
+        }
+        // Report the status with an empty buffer as a single receive would
+        Fw::Buffer buffer = this->m_batch[0];
+        buffer.setSize(0);
+        this->shiftBatch(1);
+        this->sendBuffer(buffer, status);
+        return status;
+    }
+    // Send out received datagrams, in order
+    Fw::Buffer buffers[SOCKET_UDP_BATCH_SIZE];
+    for (U32 i = 0; i < count; i++) {
+        buffers[i] = this->m_batch[i];
+        buffers[i].setSize(sizes[i]);
+    }
+    this->shiftBatch(count);
+    for (U32 i = 0; i < count; i++) {
+        this->sendBuffer(buffers[i], status);
+    }
+    return status;
+}
+
 Fw::Buffer UdpComponentImpl::getBuffer() {
     return allocate_out(0, static_cast<U32>(m_allocation_size));
 }
@@ -83,6 +159,15 @@ void UdpComponentImpl::connected() {
 // ----------------------------------------------------------------------
 
 Drv::SendStatus UdpComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    if (this->m_send_batch_size > 1) {
+        // Hold the datagram until the batch is full or schedIn is called
+        FW_ASSERT(this->m_send_count < this->m_send_batch_size, static_cast<FwAssertArgType>(this->m_send_count));
+        this->m_send_batch[this->m_send_count++] = fwBuffer;
+        if (this->m_send_count < this->m_send_batch_size) {
+            return SendStatus::SEND_OK;
+        }
+        return this->flushSend();
+    }
     Drv::SocketIpStatus status = send(fwBuffer.getData(), fwBuffer.getSize());
     // Always return the buffer
     deallocate_out(0, fwBuffer);
@@ -94,4 +179,77 @@ Drv::SendStatus UdpComponentImpl::send_handler(const NATIVE_INT_TYPE portNum, Fw
     return SendStatus::SEND_OK;
 }
 
+Drv::SendStatus UdpComponentImpl::sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                                       Fw::Buffer& header,
+                                                       Fw::Buffer& payload,
+                                                       Fw::Buffer& trailer) {
+    // Keep datagrams in the order they were passed in
+    (void)this->flushSend();
+    Drv::SocketIpStatus status = this->sendSegments(header, payload, trailer);
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
+void UdpComponentImpl::schedIn_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+    (void)this->flushSend();
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+Drv::SendStatus UdpComponentImpl::flushSend() {
+    if (this->m_send_count == 0) {
+        return SendStatus::SEND_OK;
+    }
+    const U8* data[SOCKET_UDP_BATCH_SIZE];
+    U32 sizes[SOCKET_UDP_BATCH_SIZE];
+    for (U32 i = 0; i < this->m_send_count; i++) {
+        data[i] = this->m_send_batch[i].getData();
+        sizes[i] = this->m_send_batch[i].getSize();
+    }
+    SocketIpStatus status = SOCK_SUCCESS;
+    this->m_lock.lock();
+    SocketDescriptor descriptor = this->m_descriptor;
+    this->m_lock.unlock();
+    // Prevent transmission before connection, or after a disconnect
+    if (descriptor.fd == -1) {
+        status = this->reconnect();
+        // Refresh local copy after reconnect
+        this->m_lock.lock();
+        descriptor = this->m_descriptor;
+        this->m_lock.unlock();
+    }
+    if (status == SOCK_SUCCESS) {
+        U32 count = this->m_send_count;
+        status = this->m_socket.sendBatch(descriptor, data, sizes, count);
+        if (status == SOCK_DISCONNECTED) {
+            this->close();
+        }
+    }
+    // Always return the buffers, datagrams that were not sent are dropped
+    for (U32 i = 0; i < this->m_send_count; i++) {
+        this->deallocate_out(0, this->m_send_batch[i]);
+        this->m_send_batch[i] = Fw::Buffer();
+    }
+    this->m_send_count = 0;
+    if ((status == SOCK_DISCONNECTED) || (status == SOCK_INTERRUPTED_TRY_AGAIN)) {
+        return SendStatus::SEND_RETRY;
+    } else if (status != SOCK_SUCCESS) {
+        return SendStatus::SEND_ERROR;
+    }
+    return SendStatus::SEND_OK;
+}
+
+void UdpComponentImpl::shiftBatch(const U32 used) {
+    FW_ASSERT(used <= SOCKET_UDP_BATCH_SIZE, static_cast<FwAssertArgType>(used));
+    for (U32 i = 0; i < SOCKET_UDP_BATCH_SIZE; i++) {
+        this->m_batch[i] = ((i + used) < SOCKET_UDP_BATCH_SIZE) ? this->m_batch[i + used] : Fw::Buffer();
+    }
+}
+
 }  // end namespace Drv
@@ -49,17 +49,22 @@ class UdpComponentImpl : public UdpComponentBase, public SocketComponentHelper {
      * Note: hostname must be a dot-notation IP address of the form "x.x.x.x". DNS translation is left up
      * to the user.
      *
+     * With a batch_size above 1, buffers passed to the send port are held and sent together once batch_size of them
+     * are waiting or the schedIn port is called, whichever comes first.
+     *
      * \param hostname: ip address of remote tcp server in the form x.x.x.x
      * \param port: port of remote tcp server
      * \param send_timeout_seconds: send timeout seconds component. Defaults to: SOCKET_TIMEOUT_SECONDS
      * \param send_timeout_microseconds: send timeout microseconds component. Must be less than 1000000. Defaults to:
      * SOCKET_TIMEOUT_MICROSECONDS
+     * \param batch_size: datagrams sent together, 1 to SOCKET_UDP_BATCH_SIZE. Defaults to: 1
      * \return status of the configure
      */
     SocketIpStatus configureSend(const char* hostname,
                                  const U16 port,
                                  const U32 send_timeout_seconds = SOCKET_SEND_TIMEOUT_SECONDS,
-                                 const U32 send_timeout_microseconds = SOCKET_SEND_TIMEOUT_MICROSECONDS);
+                                 const U32 send_timeout_microseconds = SOCKET_SEND_TIMEOUT_MICROSECONDS,
+                                 const U32 batch_size = 1);
 
     /**
      * \brief Configures the Udp receive settings but does not open the connection
@@ -68,12 +73,21 @@ class UdpComponentImpl : public UdpComponentBase, public SocketComponentHelper {
      * source. This call should be performed on system startup before recv or send are called. Note: hostname must be a
      * dot-notation IP address of the form "x.x.x.x". DNS translation is left up to the user.
      *
+     * Each read of the socket receives up to batch_size datagrams in one call, each into its own allocated buffer.
+     * Buffers left unfilled by a read are kept for the next one, so up to batch_size buffers are held from the
+     * allocator while the socket is open.
+     *
      * \param hostname: ip address of remote tcp server in the form x.x.x.x
      * \param port: port of remote tcp server
      * \param buffer_size: size of the buffer to be allocated. Defaults to 1024.
+     * \param batch_size: maximum datagrams received per read, 1 to SOCKET_UDP_BATCH_SIZE. Defaults to: 1
+     * \param recv_buffer_size: SO_RCVBUF size in bytes, 0 keeps the OS default. Defaults to:
+     * SOCKET_UDP_RECV_BUFFER_SIZE
      *  \return status of the configure
      */
-    SocketIpStatus configureRecv(const char* hostname, const U16 port, FwSizeType buffer_size = 1024);
+    SocketIpStatus configureRecv(const char* hostname, const U16 port, FwSizeType buffer_size = 1024,
+                                 const U32 batch_size = 1,
+                                 const U32 recv_buffer_size = SOCKET_UDP_RECV_BUFFER_SIZE);
 
     /**
      * \brief get the port being received on
@@ -91,6 +105,18 @@ PROTECTED:
     // Implementations for socket read task virtual methods
     // ----------------------------------------------------------------------
 
+    /**
+     * \brief receive off the UDP socket, returning the held buffers once the loop exits
+     */
+    void readLoop() override;
+
+    /**
+     * \brief receive a batch of datagrams and send each out in its own buffer
+     *
+     * \return status of the receive
+     */
+    SocketIpStatus readSocket() override;
+
     /**
      * \brief returns a reference to the socket handler
      *
@@ -149,9 +175,58 @@ PROTECTED:
      */
     Drv::SendStatus send_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer);
 
+    /**
+     * \brief Send data gathered from a header, a payload and a trailer out of the Udp
+     *
+     * The buffers are sent as one transmission without being copied together and are not deallocated, ownership
+     * stays with the caller. Statuses are returned as for the send port.
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param header: data sent first
+     * \param payload: data sent after the header
+     * \param trailer: data sent last
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus sendSegments_handler(const NATIVE_INT_TYPE portNum,
+                                         Fw::Buffer& header,
+                                         Fw::Buffer& payload,
+                                         Fw::Buffer& trailer);
+
+    /**
+     * \brief Send the datagrams held by a batched send
+     *
+     * \param portNum: fprime port number of the incoming port call
+     * \param context: the call order
+     */
+    void schedIn_handler(const NATIVE_INT_TYPE portNum, U32 context);
+
+    /**
+     * \brief send the held datagrams with one batched send and return their buffers
+     *
+     * \return SEND_OK on success, SEND_RETRY when critical data should be retried and SEND_ERROR upon error
+     */
+    Drv::SendStatus flushSend();
+
+    /**
+     * \brief drop the first used buffers of the batch, moving the unfilled ones to the front
+     *
+     * \param used: number of buffers handed off
+     */
+    void shiftBatch(const U32 used);
+
     Drv::UdpSocket m_socket; //!< Socket implementation
 
     FwSizeType m_allocation_size; //!< Member variable to store the buffer size
+
+    U32 m_batch_size; //!< Maximum datagrams received per read
+
+    Fw::Buffer m_batch[SOCKET_UDP_BATCH_SIZE]; //!< Allocated buffers for the next read, filled in order
+
+    U32 m_send_batch_size; //!< Datagrams sent together
+
+    U32 m_send_count; //!< Number of datagrams held in m_send_batch
+
+    Fw::Buffer m_send_batch[SOCKET_UDP_BATCH_SIZE]; //!< Datagrams held until the batch is sent, in order
 };
 
 }  // end namespace Drv
@@ -14,6 +14,16 @@ TEST(Nominal, UdpBasicReceiveThread) {
     tester.test_receive_thread();
 }
 
+TEST(Nominal, UdpBatchReceive) {
+    Drv::UdpTester tester;
+    tester.test_batch();
+}
+
+TEST(Nominal, UdpBatchSend) {
+    Drv::UdpTester tester;
+    tester.test_batch_sends();
+}
+
 TEST(Reconnect, UdpMultiMessaging) {
     Drv::UdpTester tester;
     tester.test_multiple_messaging();
@@ -115,6 +115,85 @@ void UdpTester::test_with_loop(U32 iterations, bool recv_thread) {
     ASSERT_from_ready_SIZE(iterations);
 }
 
+void UdpTester::test_batch_receive() {
+    const U32 BATCH = 4;
+    const U32 DATAGRAMS = 10;
+    U16 port = Drv::Test::get_free_port(true);
+    ASSERT_NE(0, port);
+    this->component.configureRecv("127.0.0.1", port, sizeof(m_data_storage), BATCH);
+    ASSERT_EQ(this->component.open(), Drv::SOCK_SUCCESS);
+    Drv::Test::force_recv_timeout(this->component.m_descriptor.fd, this->component.getSocketHandler());
+
+    Drv::UdpSocket udp2;
+    Drv::SocketDescriptor udp2_fd;
+    udp2.configureSend("127.0.0.1", this->component.getRecvPort(), 0, 100);
+    udp2.configureRecv("127.0.0.1", 0);
+    ASSERT_EQ(udp2.open(udp2_fd), Drv::SOCK_SUCCESS);
+    for (U32 i = 0; i < DATAGRAMS; i++) {
+        m_data_buffer.setSize(sizeof(m_data_storage));
+        (void)Drv::Test::fill_random_buffer(m_data_buffer);
+        ASSERT_EQ(udp2.send(udp2_fd, m_data_buffer.getData(), m_data_buffer.getSize()), Drv::SOCK_SUCCESS);
+        ASSERT_EQ(this->component.readSocket(), Drv::SOCK_SUCCESS);
+        ASSERT_from_recv_SIZE(i + 1);
+        ASSERT_EQ(this->fromPortHistory_recv->at(i).recvStatus, RecvStatus::RECV_OK);
+        // The first read fills the batch, later reads only replace the buffer handed off
+        ASSERT_from_allocate_SIZE(BATCH + i);
+    }
+    // Unfilled buffers are kept for the next read rather than returned
+    ASSERT_from_deallocate_SIZE(0);
+    ASSERT_EQ(this->component.readSocket(), Drv::SOCK_NO_DATA_AVAILABLE);
+    ASSERT_from_recv_SIZE(DATAGRAMS + 1);
+    this->component.close();
+    udp2.close(udp2_fd);
+}
+
+void UdpTester::test_batch_send() {
+    const U32 BATCH = 4;
+    const U32 DATAGRAMS = BATCH + 1;
+    U16 port = Drv::Test::get_free_port(true);
+    ASSERT_NE(0, port);
+    Drv::UdpSocket udp2;
+    Drv::SocketDescriptor udp2_fd;
+    udp2.configureRecv("127.0.0.1", port);
+    ASSERT_EQ(udp2.open(udp2_fd), Drv::SOCK_SUCCESS);
+    Drv::Test::force_recv_timeout(udp2_fd.fd, udp2);
+    this->component.configureSend("127.0.0.1", port, 0, 100, BATCH);
+    ASSERT_EQ(this->component.open(), Drv::SOCK_SUCCESS);
+
+    U8 data[DATAGRAMS][8];
+    Fw::Buffer buffers[DATAGRAMS];
+    for (U32 i = 0; i < DATAGRAMS; i++) {
+        memset(data[i], static_cast<int>(i), sizeof(data[i]));
+        buffers[i].set(data[i], sizeof(data[i]));
+    }
+    U8 received[sizeof(data[0])];
+    U32 size = sizeof(received);
+
+    // Datagrams are held until the batch is full
+    for (U32 i = 0; i < (BATCH - 1); i++) {
+        ASSERT_EQ(invoke_to_send(0, buffers[i]), SendStatus::SEND_OK);
+    }
+    ASSERT_from_deallocate_SIZE(0);
+    ASSERT_EQ(udp2.recv(udp2_fd, received, size), Drv::SOCK_NO_DATA_AVAILABLE);
+    ASSERT_EQ(invoke_to_send(0, buffers[BATCH - 1]), SendStatus::SEND_OK);
+    ASSERT_from_deallocate_SIZE(BATCH);
+
+    // A partial batch is sent by schedIn
+    ASSERT_EQ(invoke_to_send(0, buffers[BATCH]), SendStatus::SEND_OK);
+    ASSERT_from_deallocate_SIZE(BATCH);
+    invoke_to_schedIn(0, 0);
+    ASSERT_from_deallocate_SIZE(DATAGRAMS);
+
+    for (U32 i = 0; i < DATAGRAMS; i++) {
+        size = sizeof(received);
+        ASSERT_EQ(udp2.recv(udp2_fd, received, size), Drv::SOCK_SUCCESS);
+        ASSERT_EQ(size, sizeof(received));
+        ASSERT_EQ(received[0], i);
+    }
+    this->component.close();
+    udp2.close(udp2_fd);
+}
+
 bool UdpTester::wait_on_change(Drv::IpSocket &socket, bool open, U32 iterations) {
     for (U32 i = 0; i < iterations; i++) {
         if (open == this->component.isOpened()) {
@@ -156,6 +235,14 @@ void UdpTester ::test_advanced_reconnect() {
     test_with_loop(10, true); // Up to 10 * RECONNECT_MS
 }
 
+void UdpTester ::test_batch() {
+    test_batch_receive();
+}
+
+void UdpTester ::test_batch_sends() {
+    test_batch_send();
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -69,9 +69,21 @@ namespace Drv {
       //!
       void test_advanced_reconnect();
 
+      //! Test receiving several datagrams per read
+      //!
+      void test_batch();
+
+      //! Test sending several datagrams per call
+      //!
+      void test_batch_sends();
+
       // Helpers
       void test_with_loop(U32 iterations, bool recv_thread=false);
 
+      void test_batch_receive();
+
+      void test_batch_send();
+
       bool wait_on_change(Drv::IpSocket &socket, bool open, U32 iterations);
 
     private:
@@ -94,8 +94,8 @@ void Tester::productRecvIn_Container1_SUCCESS() {
                                              DpTest::ContainerPriority::Container1, this->container1Buffer, buffer,
                                              expectedNumElts);
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         U32 elt;
@@ -127,8 +127,8 @@ void Tester::productRecvIn_Container2_SUCCESS() {
                                              DpTest::ContainerPriority::Container2, this->container2Buffer, buffer,
                                              expectedNumElts);
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         DpTest_Data elt;
@@ -164,8 +164,8 @@ void Tester::productRecvIn_Container3_SUCCESS() {
                                              expectedNumElts);
 
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         auto status = serialRepr.deserialize(id);
@@ -208,8 +208,8 @@ void Tester::productRecvIn_Container4_SUCCESS() {
                                              expectedNumElts);
 
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         auto status = serialRepr.deserialize(id);
@@ -252,8 +252,8 @@ void Tester::productRecvIn_Container5_SUCCESS() {
                                              expectedNumElts);
 
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         auto status = serialRepr.deserialize(id);
@@ -295,8 +295,8 @@ void Tester::productRecvIn_Container6_SUCCESS() {
                                              DpTest::ContainerPriority::Container6, this->container6Buffer, buffer,
                                              expectedNumElts);
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         Fw::String elt;
@@ -335,8 +335,8 @@ void Tester::productRecvIn_Container7_SUCCESS() {
                                              DpTest::ContainerPriority::Container7, this->container7Buffer, buffer,
                                              expectedNumElts);
     // Check the data
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
-    Fw::TestUtil::DpContainerHeader::checkDeserialAtOffset(serialRepr, Fw::DpContainer::DATA_OFFSET);
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getDeserializer();
+    ASSERT_EQ(serialRepr.moveDeserToOffset(Fw::DpContainer::DATA_OFFSET), Fw::FW_SERIALIZE_OK);
     for (FwSizeType i = 0; i < expectedNumElts; ++i) {
         FwDpIdType id;
         auto status = serialRepr.deserialize(id);
@@ -419,8 +419,7 @@ void Tester::productRecvIn_InvokeAndCheckHeader(FwDpIdType id,
     Fw::DpContainer::Header::UserData userData;
     memset(&userData[0], 0, sizeof userData);
     // Check the history entry
-    // This sets the output buffer and sets the deserialization pointer
-    // to the start of the data payload
+    // This sets the output buffer
     ASSERT_PRODUCT_SEND(0, globalId, priority, timeTag, 0, userData, dpState, expectedDataSize, outputBuffer);
 }
 
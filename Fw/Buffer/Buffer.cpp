@@ -21,32 +21,42 @@
 namespace Fw {
 
 Buffer::Buffer(): Serializable(),
+#if FW_BUFFER_SERIALIZE_REPR
     m_serialize_repr(),
+#endif
     m_bufferData(nullptr),
     m_size(0),
     m_context(0xFFFFFFFF)
 {}
 
 Buffer::Buffer(const Buffer& src) : Serializable(),
+#if FW_BUFFER_SERIALIZE_REPR
     m_serialize_repr(),
+#endif
     m_bufferData(src.m_bufferData),
     m_size(src.m_size),
     m_context(src.m_context)
 {
+#if FW_BUFFER_SERIALIZE_REPR
     if(src.m_bufferData != nullptr){
         this->m_serialize_repr.setExtBuffer(src.m_bufferData, src.m_size);
     }
+#endif
 }
 
 Buffer::Buffer(U8* data, U32 size, U32 context) : Serializable(),
+#if FW_BUFFER_SERIALIZE_REPR
     m_serialize_repr(),
+#endif
     m_bufferData(data),
     m_size(size),
     m_context(context)
 {
+#if FW_BUFFER_SERIALIZE_REPR
     if(m_bufferData != nullptr){
         this->m_serialize_repr.setExtBuffer(this->m_bufferData, this->m_size);
     }
+#endif
 }
 
 Buffer& Buffer::operator=(const Buffer& src) {
@@ -79,16 +89,20 @@ U32 Buffer::getContext() const {
 
 void Buffer::setData(U8* const data) {
     this->m_bufferData = data;
+#if FW_BUFFER_SERIALIZE_REPR
     if (m_bufferData != nullptr) {
         this->m_serialize_repr.setExtBuffer(this->m_bufferData, this->m_size);
     }
+#endif
 }
 
 void Buffer::setSize(const U32 size) {
     this->m_size = size;
+#if FW_BUFFER_SERIALIZE_REPR
     if (m_bufferData != nullptr) {
         this->m_serialize_repr.setExtBuffer(this->m_bufferData, this->m_size);
     }
+#endif
 }
 
 void Buffer::setContext(const U32 context) {
@@ -98,16 +112,37 @@ void Buffer::setContext(const U32 context) {
 void Buffer::set(U8* const data, const U32 size, const U32 context) {
     this->m_bufferData = data;
     this->m_size = size;
+#if FW_BUFFER_SERIALIZE_REPR
     if (m_bufferData != nullptr) {
         this->m_serialize_repr.setExtBuffer(this->m_bufferData, this->m_size);
     }
+#endif
     this->m_context = context;
 }
 
-Fw::SerializeBufferBase& Buffer::getSerializeRepr() {
-    return m_serialize_repr;
+ExternalSerializeBufferWithMemberCopy Buffer::getSerializer() {
+    if (this->m_bufferData == nullptr) {
+        return ExternalSerializeBufferWithMemberCopy();
+    }
+    return ExternalSerializeBufferWithMemberCopy(this->m_bufferData, this->m_size);
+}
+
+ExternalSerializeBufferWithMemberCopy Buffer::getDeserializer() {
+    if (this->m_bufferData == nullptr) {
+        return ExternalSerializeBufferWithMemberCopy();
+    }
+    ExternalSerializeBufferWithMemberCopy deserializer(this->m_bufferData, this->m_size);
+    const SerializeStatus status = deserializer.setBuffLen(this->m_size);
+    FW_ASSERT(status == FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    return deserializer;
 }
 
+#if FW_BUFFER_SERIALIZE_REPR
+SerializeBufferBase& Buffer::getSerializeRepr() {
+    return this->m_serialize_repr;
+}
+#endif
+
 Fw::SerializeStatus Buffer::serialize(Fw::SerializeBufferBase& buffer) const {
     Fw::SerializeStatus stat;
 #if FW_SERIALIZATION_TYPE_ID
@@ -162,9 +197,11 @@ Fw::SerializeStatus Buffer::deserialize(Fw::SerializeBufferBase& buffer) {
         return stat;
     }
 
+#if FW_BUFFER_SERIALIZE_REPR
     if (this->m_bufferData != nullptr) {
         this->m_serialize_repr.setExtBuffer(this->m_bufferData, this->m_size);
     }
+#endif
     return stat;
 }
 
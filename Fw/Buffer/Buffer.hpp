@@ -38,7 +38,9 @@ namespace Fw {
 //! Fw::Buffer also comes with functions to return a representation of the data as a SerializeBufferBase. These two
 //! functions allow easy access to the data as if it were a serialize or deserialize buffer. This can aid in writing and
 //! reading the wrapped data whereas the standard serialize and deserialize methods treat the data as a pointer to
-//! prevent excessive copying.
+//! prevent excessive copying. These representations are built when asked for rather than stored, so by default
+//! Fw::Buffer is just the pointer, size, and context copied through every queue and port. Setting
+//! FW_BUFFER_SERIALIZE_REPR adds the stored representation returned by getSerializeRepr().
 //!
 class Buffer : public Fw::Serializable {
 
@@ -85,13 +87,33 @@ public:
     // Serialization functions
     // ----------------------------------------------------------------------
 
+    //! Returns a serialize buffer wrapping the data, setup for serializing to it
+    //!
+    //! Returns by value a serialize buffer backed by the wrapped data and reset for serializing other types of data
+    //! to the wrapped buffer. The returned object holds the serialization state, so it should be kept for as long as
+    //! serialization continues. It is only valid for as long as the wrapped data is.
+    //! \return serialize buffer backed by the wrapped data, empty when this buffer is invalid
+    ExternalSerializeBufferWithMemberCopy getSerializer();
+
+    //! Returns a serialize buffer wrapping the data, setup for deserializing from it
+    //!
+    //! Returns by value a serialize buffer backed by the wrapped data with getSize() bytes available for deserializing
+    //! from the wrapped buffer. The returned object holds the deserialization state, so it should be kept for as long
+    //! as deserialization continues. It is only valid for as long as the wrapped data is.
+    //! \return serialize buffer backed by the wrapped data, empty when this buffer is invalid
+    ExternalSerializeBufferWithMemberCopy getDeserializer();
+
+#if FW_BUFFER_SERIALIZE_REPR
     //! Returns a SerializeBufferBase representation of the wrapped data for serializing
     //!
     //! Returns a SerializeBufferBase representation of the wrapped data allowing for serializing other types of data
     //! to the wrapped buffer. Once obtained the user should call one of two functions: `sbb.resetSer();` to setup for
-    //! serialization, or `sbb.setBuffLen(buffer.getSize());` to setup for deserializing.
+    //! serialization, or `sbb.setBuffLen(buffer.getSize());` to setup for deserializing. The representation is held by
+    //! this buffer and keeps its state between calls. Setting the data or size, copying, or deserializing the buffer
+    //! resets it. Prefer getSerializer() and getDeserializer() in new code.
     //! \return representation of the wrapped data to aid in serializing to it
     SerializeBufferBase& getSerializeRepr();
+#endif
 
     //! Serializes this buffer to a SerializeBufferBase
     //!
@@ -164,7 +186,9 @@ public:
 #endif
 
 PRIVATE:
-    Fw::ExternalSerializeBuffer m_serialize_repr; //<! Representation for serialization and deserialization functions
+#if FW_BUFFER_SERIALIZE_REPR
+    Fw::ExternalSerializeBuffer m_serialize_repr; //<! Representation for getSerializeRepr()
+#endif
     U8* m_bufferData; //<! data - A pointer to the data
     U32 m_size; //<! size - The data size in bytes
     U32 m_context; //!< Creation context for disposal
@@ -4,6 +4,8 @@
 #include "Fw/Buffer/Buffer.hpp"
 #include <FpConfig.hpp>
 #include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
 
 
 void test_basic() {
@@ -76,30 +78,82 @@ void test_representations() {
     buffer.setContext(1234);
 
     // Test serialization and that it stops before overflowing
-    Fw::SerializeBufferBase& sbb = buffer.getSerializeRepr();
-    sbb.resetSer();
+    Fw::ExternalSerializeBufferWithMemberCopy sbb = buffer.getSerializer();
     for (U32 i = 0; i < sizeof(data)/4; i++) {
         ASSERT_EQ(sbb.serialize(i), Fw::FW_SERIALIZE_OK);
     }
     Fw::SerializeStatus stat = sbb.serialize(100);
     ASSERT_NE(stat, Fw::FW_SERIALIZE_OK);
 
-    // And that another call to repr resets it
-    sbb.resetSer();
-    ASSERT_EQ(sbb.serialize(0), Fw::FW_SERIALIZE_OK);
+    // And that another serializer starts over
+    Fw::ExternalSerializeBufferWithMemberCopy sbb2 = buffer.getSerializer();
+    ASSERT_EQ(sbb2.getBuffLength(), 0);
+    ASSERT_EQ(sbb2.serialize(0), Fw::FW_SERIALIZE_OK);
 
     // Now deserialize all the things
     U32 out;
+    Fw::ExternalSerializeBufferWithMemberCopy dbb = buffer.getDeserializer();
+    ASSERT_EQ(dbb.getBuffLeft(), buffer.getSize());
+    ASSERT_EQ(dbb.deserialize(out), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(0, out);
+    for (U32 i = 1; i < sizeof(data)/4; i++) {
+        ASSERT_EQ(dbb.deserialize(out), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(i, out);
+    }
+    ASSERT_NE(dbb.deserialize(out), Fw::FW_SERIALIZE_OK);
+
+    // Copies carry the deserialization state along
+    Fw::ExternalSerializeBufferWithMemberCopy dbb2 = buffer.getDeserializer();
+    ASSERT_EQ(dbb2.deserialize(out), Fw::FW_SERIALIZE_OK);
+    Fw::ExternalSerializeBufferWithMemberCopy dbb3(dbb2);
+    ASSERT_EQ(dbb3.getBuffLeft(), buffer.getSize() - sizeof(U32));
+    ASSERT_EQ(dbb3.deserialize(out), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(1, out);
+    // As does assignment
+    Fw::ExternalSerializeBufferWithMemberCopy dbb4;
+    dbb4 = dbb2;
+    ASSERT_EQ(dbb4.getBuffLeft(), buffer.getSize() - sizeof(U32));
+    ASSERT_EQ(dbb4.deserialize(out), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(1, out);
+
+    // An invalid buffer gives empty representations
+    Fw::Buffer invalid;
+    ASSERT_EQ(invalid.getSerializer().getBuffCapacity(), 0);
+    ASSERT_EQ(invalid.getDeserializer().getBuffLeft(), 0);
+}
+
+#if FW_BUFFER_SERIALIZE_REPR
+void test_serialize_repr() {
+    U8 data[100];
+    Fw::Buffer buffer;
+    buffer.setData(data);
+    buffer.setSize(sizeof(data));
+
+    // Serialize through the representation, it keeps its state between calls
+    Fw::SerializeBufferBase& sbb = buffer.getSerializeRepr();
+    sbb.resetSer();
+    for (U32 i = 0; i < sizeof(data)/4; i++) {
+        ASSERT_EQ(buffer.getSerializeRepr().serialize(i), Fw::FW_SERIALIZE_OK);
+    }
+    ASSERT_NE(sbb.serialize(100), Fw::FW_SERIALIZE_OK);
+
+    // Deserialize all the things
+    U32 out;
     sbb.setBuffLen(buffer.getSize());
     for (U32 i = 0; i < sizeof(data)/4; i++) {
-        ASSERT_EQ(sbb.deserialize(out), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(buffer.getSerializeRepr().deserialize(out), Fw::FW_SERIALIZE_OK);
         ASSERT_EQ(i, out);
     }
     ASSERT_NE(sbb.deserialize(out), Fw::FW_SERIALIZE_OK);
-    sbb.setBuffLen(buffer.getSize());
-    ASSERT_EQ(sbb.deserialize(out), Fw::FW_SERIALIZE_OK);
-    ASSERT_EQ(0, out);
+
+    // Changing the wrapped data rebuilds the representation
+    buffer.setSize(sizeof(data) / 2);
+    ASSERT_EQ(buffer.getSerializeRepr().getBuffCapacity(), sizeof(data) / 2);
+    ASSERT_EQ(buffer.getSerializeRepr().getBuffLength(), 0);
+    Fw::Buffer invalid;
+    ASSERT_EQ(invalid.getSerializeRepr().getBuffCapacity(), 0);
 }
+#endif
 
 void test_serialization() {
     U8 data[100];
@@ -118,9 +172,9 @@ void test_serialization() {
     externalSerializeBuffer.deserialize(buffer_new);
     ASSERT_EQ(buffer_new, buffer);
 
-    // Make sure internal ExternalSerializeBuffer is reinitialized
-    ASSERT_EQ(buffer_new.m_serialize_repr.m_buff,data);
-    ASSERT_EQ(buffer_new.m_serialize_repr.m_buffSize,sizeof(data));
+    // Make sure representations wrap the deserialized data
+    ASSERT_EQ(buffer_new.getSerializer().getBuffAddr(), data);
+    ASSERT_EQ(buffer_new.getDeserializer().getBuffLength(), sizeof(data));
 }
 
 
@@ -132,10 +186,54 @@ TEST(Nominal, Representations) {
     test_representations();
 }
 
+#if FW_BUFFER_SERIALIZE_REPR
+TEST(Nominal, SerializeRepr) {
+    test_serialize_repr();
+}
+#endif
+
 TEST(Nominal, Serialization) {
     test_serialization();
 }
 
+// Size of Fw::Buffer and the time taken to move buffers as queues and ports do: copied in and out of an array of
+// buffers as BufferAccumulator and BufferManager hold them, and serialized through a message as async ports send them.
+// Disabled by default; run with --gtest_also_run_disabled_tests.
+TEST(Performance, DISABLED_CopyThroughput) {
+    const U32 DEPTH = 1024;
+    const U32 ITERATIONS = 10000000;
+    static U8 data[DEPTH];
+    static Fw::Buffer queue[DEPTH];
+    printf("sizeof(Fw::Buffer): %zu B, %u entry queue: %zu B\n", sizeof(Fw::Buffer), DEPTH, sizeof(queue));
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    U64 check = 0;
+    for (U32 i = 0; i < ITERATIONS; i++) {
+        queue[i % DEPTH] = Fw::Buffer(data + (i % DEPTH), i % DEPTH, i);
+        const Fw::Buffer out(queue[(i + DEPTH / 2) % DEPTH]);
+        check += out.getSize();
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    printf("queue copy: %.2f ns/buffer (%llu)\n",
+           static_cast<F64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / ITERATIONS,
+           static_cast<unsigned long long>(check));
+
+    U8 message[Fw::Buffer::SERIALIZED_SIZE + sizeof(U32)];
+    Fw::ExternalSerializeBuffer serializer(message, sizeof(message));
+    start = std::chrono::steady_clock::now();
+    for (U32 i = 0; i < ITERATIONS; i++) {
+        const Fw::Buffer in(data + (i % DEPTH), i % DEPTH, i);
+        serializer.resetSer();
+        ASSERT_EQ(serializer.serialize(in), Fw::FW_SERIALIZE_OK);
+        Fw::Buffer out;
+        ASSERT_EQ(serializer.deserialize(out), Fw::FW_SERIALIZE_OK);
+        check += out.getSize();
+    }
+    end = std::chrono::steady_clock::now();
+    printf("port serialize: %.2f ns/buffer (%llu)\n",
+           static_cast<F64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / ITERATIONS,
+           static_cast<unsigned long long>(check));
+}
 
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
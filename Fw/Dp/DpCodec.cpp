@@ -0,0 +1,387 @@
+// ======================================================================
+// \title  DpCodec.cpp
+// \brief  cpp file for DpCodec
+// ======================================================================
+
+#include <cstring>
+
+#include "Fw/Dp/DpCodec.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace Fw {
+
+namespace {
+
+//! The shortest LZ4 match
+constexpr FwSizeType MIN_MATCH = 4;
+//! The number of bytes at the end of a block that are always literals
+constexpr FwSizeType LAST_LITERALS = 5;
+//! The number of bytes at the end of a block in which no match may start
+constexpr FwSizeType MATCH_FIND_LIMIT = 12;
+//! The largest LZ4 match offset
+constexpr FwSizeType MAX_OFFSET = 65535;
+//! The length nibble that is continued in extra length bytes
+constexpr FwSizeType RUN_MASK = 15;
+
+U32 read32(const U8* data) {
+    U32 value;
+    (void)::memcpy(&value, data, sizeof value);
+    return value;
+}
+
+U32 hash32(U32 sequence, U32 hashLog) {
+    return (sequence * 2654435761U) >> (32 - hashLog);
+}
+
+//! Write the extra length bytes of a length of at least RUN_MASK
+U8* writeLength(U8* out, FwSizeType length) {
+    length -= RUN_MASK;
+    while (length >= 255) {
+        *out++ = 255;
+        length -= 255;
+    }
+    *out++ = static_cast<U8>(length);
+    return out;
+}
+
+//! Read the extra length bytes of a length nibble
+bool readLength(const U8* block, FwSizeType blockSize, FwSizeType& offset, FwSizeType& length) {
+    if (length == RUN_MASK) {
+        U8 extra = 255;
+        while (extra == 255) {
+            if (offset >= blockSize) {
+                return false;
+            }
+            extra = block[offset++];
+            length += extra;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Constructor
+// ----------------------------------------------------------------------
+
+DpCodec::DpCodec() {
+    (void)::memset(this->m_hashTable, 0, sizeof this->m_hashTable);
+}
+
+// ----------------------------------------------------------------------
+// Public member functions
+// ----------------------------------------------------------------------
+
+FwSizeType DpCodec::encodeChunk(const U8* data, FwSizeType size, U8 filterWidth, U8* encoded) {
+    FW_ASSERT(data != nullptr);
+    FW_ASSERT(encoded != nullptr);
+    FW_ASSERT(size <= DP_COMPRESSION_CHUNK_SIZE, static_cast<FwAssertArgType>(size));
+    FW_ASSERT(isValidFilterWidth(filterWidth), static_cast<FwAssertArgType>(filterWidth));
+    const U8* input = data;
+    if (filterWidth != 0) {
+        filter(data, size, filterWidth, this->m_scratch);
+        input = this->m_scratch;
+    }
+    // Only keep the block when it is smaller than the data
+    FwSizeType blockSize = 0;
+    if (size > 0) {
+        blockSize = this->compressBlock(input, size, &encoded[CHUNK_HEADER_SIZE], size - 1);
+    }
+    U32 header = static_cast<U32>(blockSize);
+    if (blockSize == 0) {
+        // Store the unfiltered data, so that decoding is a copy
+        (void)::memcpy(&encoded[CHUNK_HEADER_SIZE], data, size);
+        blockSize = size;
+        header = static_cast<U32>(size) | CHUNK_STORED;
+    }
+    Fw::ExternalSerializeBuffer serialRepr(encoded, CHUNK_HEADER_SIZE);
+    const Fw::SerializeStatus status = serialRepr.serialize(header);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    return CHUNK_HEADER_SIZE + blockSize;
+}
+
+Fw::SerializeStatus DpCodec::decode(const U8* compressed,
+                                    FwSizeType compressedSize,
+                                    U8* data,
+                                    FwSizeType dataCapacity,
+                                    FwSizeType& dataSize) {
+    FW_ASSERT(compressed != nullptr);
+    FW_ASSERT(data != nullptr);
+    dataSize = 0;
+    if (compressedSize < Preamble::SIZE) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    // Deserialize the preamble
+    Fw::ExternalSerializeBuffer serialRepr(const_cast<U8*>(compressed), Preamble::SIZE);
+    Fw::SerializeStatus status = serialRepr.setBuffLen(Preamble::SIZE);
+    U8 codec = 0;
+    U8 filterWidth = 0;
+    U32 chunkSize = 0;
+    FwSizeType size = 0;
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = serialRepr.deserialize(codec);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = serialRepr.deserialize(filterWidth);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = serialRepr.deserialize(chunkSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = serialRepr.deserializeSize(size);
+    }
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return status;
+    }
+    if ((codec != CODEC_LZ4_BLOCK) || not isValidFilterWidth(filterWidth) || (chunkSize == 0)) {
+        return Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    if ((chunkSize > DP_COMPRESSION_CHUNK_SIZE) || (size > dataCapacity)) {
+        return Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    // Decode the chunks
+    FwSizeType offset = Preamble::SIZE;
+    for (FwSizeType dataOffset = 0; dataOffset < size; dataOffset += chunkSize) {
+        const FwSizeType chunk = FW_MIN(static_cast<FwSizeType>(chunkSize), size - dataOffset);
+        if (compressedSize - offset < CHUNK_HEADER_SIZE) {
+            return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+        }
+        Fw::ExternalSerializeBuffer headerRepr(const_cast<U8*>(&compressed[offset]), CHUNK_HEADER_SIZE);
+        status = headerRepr.setBuffLen(CHUNK_HEADER_SIZE);
+        U32 header = 0;
+        if (status == Fw::FW_SERIALIZE_OK) {
+            status = headerRepr.deserialize(header);
+        }
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return status;
+        }
+        offset += CHUNK_HEADER_SIZE;
+        const FwSizeType blockSize = header & ~CHUNK_STORED;
+        if (blockSize > compressedSize - offset) {
+            return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+        }
+        if ((header & CHUNK_STORED) != 0) {
+            if (blockSize != chunk) {
+                return Fw::FW_DESERIALIZE_FORMAT_ERROR;
+            }
+            (void)::memcpy(&data[dataOffset], &compressed[offset], chunk);
+        } else {
+            U8* const block = (filterWidth != 0) ? this->m_scratch : &data[dataOffset];
+            if (not decompressBlock(&compressed[offset], blockSize, block, chunk)) {
+                return Fw::FW_DESERIALIZE_FORMAT_ERROR;
+            }
+            if (filterWidth != 0) {
+                unfilter(this->m_scratch, chunk, filterWidth, &data[dataOffset]);
+            }
+        }
+        offset += blockSize;
+    }
+    if (offset != compressedSize) {
+        return Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+    }
+    dataSize = size;
+    return Fw::FW_SERIALIZE_OK;
+}
+
+// ----------------------------------------------------------------------
+// Public static functions
+// ----------------------------------------------------------------------
+
+void DpCodec::serializePreamble(U8* preamble, U8 filterWidth, FwSizeType chunkSize, FwSizeType dataSize) {
+    FW_ASSERT(preamble != nullptr);
+    Fw::ExternalSerializeBuffer serialRepr(preamble, Preamble::SIZE);
+    Fw::SerializeStatus status = serialRepr.serialize(static_cast<U8>(CODEC_LZ4_BLOCK));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    status = serialRepr.serialize(filterWidth);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    status = serialRepr.serialize(static_cast<U32>(chunkSize));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    status = serialRepr.serializeSize(dataSize);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+}
+
+// ----------------------------------------------------------------------
+// Private static functions
+// ----------------------------------------------------------------------
+
+void DpCodec::filter(const U8* data, FwSizeType size, U8 width, U8* filtered) {
+    const FwSizeType count = size / width;
+    const U64 mask = (width == MAX_FILTER_WIDTH) ? ~static_cast<U64>(0) : ((static_cast<U64>(1) << (8 * width)) - 1);
+    U64 previous = 0;
+    for (FwSizeType element = 0; element < count; element++) {
+        const U8* const bytes = &data[element * width];
+        U64 value = 0;
+        for (U8 byte = 0; byte < width; byte++) {
+            value = (value << 8) | bytes[byte];
+        }
+        U64 delta = (value - previous) & mask;
+        previous = value;
+        // Zigzag the difference so that small negative differences have zero upper bytes
+        const U64 sign = ((delta >> (8 * width - 1)) & 1) != 0 ? mask : 0;
+        delta = ((delta << 1) & mask) ^ sign;
+        // Byte plane 0 holds the most significant bytes
+        for (U8 byte = width; byte > 0; byte--) {
+            filtered[(byte - 1) * count + element] = static_cast<U8>(delta);
+            delta >>= 8;
+        }
+    }
+    // Bytes past the last whole element are kept as is
+    const FwSizeType done = count * width;
+    (void)::memcpy(&filtered[done], &data[done], size - done);
+}
+
+void DpCodec::unfilter(const U8* filtered, FwSizeType size, U8 width, U8* data) {
+    const FwSizeType count = size / width;
+    const U64 mask = (width == MAX_FILTER_WIDTH) ? ~static_cast<U64>(0) : ((static_cast<U64>(1) << (8 * width)) - 1);
+    U64 previous = 0;
+    for (FwSizeType element = 0; element < count; element++) {
+        U64 delta = 0;
+        for (U8 byte = 0; byte < width; byte++) {
+            delta = (delta << 8) | filtered[byte * count + element];
+        }
+        delta = (delta >> 1) ^ (((delta & 1) != 0) ? mask : 0);
+        U64 value = (previous + delta) & mask;
+        previous = value;
+        U8* const bytes = &data[element * width];
+        for (U8 byte = width; byte > 0; byte--) {
+            bytes[byte - 1] = static_cast<U8>(value);
+            value >>= 8;
+        }
+    }
+    const FwSizeType done = count * width;
+    (void)::memcpy(&data[done], &filtered[done], size - done);
+}
+
+bool DpCodec::decompressBlock(const U8* block, FwSizeType blockSize, U8* data, FwSizeType size) {
+    FwSizeType in = 0;
+    FwSizeType out = 0;
+    while (true) {
+        if (in >= blockSize) {
+            return false;
+        }
+        const U8 token = block[in++];
+        // Copy the literals
+        FwSizeType literals = token >> 4;
+        if (not readLength(block, blockSize, in, literals)) {
+            return false;
+        }
+        if ((literals > blockSize - in) || (literals > size - out)) {
+            return false;
+        }
+        (void)::memcpy(&data[out], &block[in], literals);
+        in += literals;
+        out += literals;
+        // The last sequence has no match
+        if (in == blockSize) {
+            break;
+        }
+        // Copy the match
+        if (blockSize - in < 2) {
+            return false;
+        }
+        const FwSizeType offset = static_cast<FwSizeType>(block[in]) | (static_cast<FwSizeType>(block[in + 1]) << 8);
+        in += 2;
+        FwSizeType length = token & RUN_MASK;
+        if (not readLength(block, blockSize, in, length)) {
+            return false;
+        }
+        length += MIN_MATCH;
+        if ((offset == 0) || (offset > out) || (length > size - out)) {
+            return false;
+        }
+        const U8* match = &data[out - offset];
+        if (offset >= length) {
+            (void)::memcpy(&data[out], match, length);
+        } else {
+            // Overlapping matches repeat the last offset bytes
+            for (FwSizeType byte = 0; byte < length; byte++) {
+                data[out + byte] = match[byte];
+            }
+        }
+        out += length;
+    }
+    return out == size;
+}
+
+// ----------------------------------------------------------------------
+// Private member functions
+// ----------------------------------------------------------------------
+
+FwSizeType DpCodec::compressBlock(const U8* data, FwSizeType size, U8* block, FwSizeType capacity) {
+    FwSizeType anchor = 0;
+    FwSizeType out = 0;
+    if (size > MATCH_FIND_LIMIT) {
+        (void)::memset(this->m_hashTable, 0, sizeof this->m_hashTable);
+        const FwSizeType matchLimit = size - LAST_LITERALS;
+        const FwSizeType findLimit = size - MATCH_FIND_LIMIT;
+        FwSizeType in = 1;
+        while (in < findLimit) {
+            const U32 sequence = read32(&data[in]);
+            const U32 hash = hash32(sequence, HASH_LOG);
+            FwSizeType candidate = this->m_hashTable[hash];
+            this->m_hashTable[hash] = static_cast<U16>(in);
+            if ((in - candidate > MAX_OFFSET) || (read32(&data[candidate]) != sequence)) {
+                // Skip faster through data that does not match
+                in += 1 + ((in - anchor) >> 6);
+                continue;
+            }
+            // Extend the match backwards over the pending literals
+            FwSizeType start = in;
+            while ((start > anchor) && (candidate > 0) && (data[start - 1] == data[candidate - 1])) {
+                start--;
+                candidate--;
+            }
+            // Extend the match forwards
+            FwSizeType end = in + MIN_MATCH;
+            while ((end < matchLimit) && (data[end] == data[candidate + end - start])) {
+                end++;
+            }
+            const FwSizeType literals = start - anchor;
+            const FwSizeType length = end - start - MIN_MATCH;
+            // Token, literal length bytes, literals, offset, match length bytes
+            const FwSizeType needed = 1 + (literals / 255 + 1) + literals + 2 + (length / 255 + 1);
+            if (needed > capacity - out) {
+                return 0;
+            }
+            U8* token = &block[out];
+            U8* cursor = token + 1;
+            *token = static_cast<U8>(FW_MIN(literals, RUN_MASK) << 4);
+            if (literals >= RUN_MASK) {
+                cursor = writeLength(cursor, literals);
+            }
+            (void)::memcpy(cursor, &data[anchor], literals);
+            cursor += literals;
+            const FwSizeType offset = start - candidate;
+            *cursor++ = static_cast<U8>(offset);
+            *cursor++ = static_cast<U8>(offset >> 8);
+            *token = static_cast<U8>(*token | FW_MIN(length, RUN_MASK));
+            if (length >= RUN_MASK) {
+                cursor = writeLength(cursor, length);
+            }
+            out = static_cast<FwSizeType>(cursor - block);
+            anchor = end;
+            in = end;
+            // Index a position inside the match for the next search
+            if (in < findLimit) {
+                this->m_hashTable[hash32(read32(&data[in - 2]), HASH_LOG)] = static_cast<U16>(in - 2);
+            }
+        }
+    }
+    // The last sequence holds the remaining literals
+    const FwSizeType literals = size - anchor;
+    const FwSizeType needed = 1 + (literals / 255 + 1) + literals;
+    if (needed > capacity - out) {
+        return 0;
+    }
+    U8* cursor = &block[out];
+    *cursor++ = static_cast<U8>(FW_MIN(literals, RUN_MASK) << 4);
+    if (literals >= RUN_MASK) {
+        cursor = writeLength(cursor, literals);
+    }
+    (void)::memcpy(cursor, &data[anchor], literals);
+    cursor += literals;
+    return static_cast<FwSizeType>(cursor - block);
+}
+
+}  // end namespace Fw
@@ -0,0 +1,162 @@
+// ======================================================================
+// \title  DpCodec.hpp
+// \brief  hpp file for DpCodec
+// ======================================================================
+
+#ifndef Fw_DpCodec_HPP
+#define Fw_DpCodec_HPP
+
+#include "Fw/Types/Serializable.hpp"
+#include "config/DpCfg.hpp"
+
+namespace Fw {
+
+//! Compression of data product container data
+//!
+//! Compressed data starts with a preamble, followed by the data compressed in
+//! independent chunks of at most the chunk size given in the preamble. Each
+//! chunk starts with a chunk header holding the size of the encoded chunk.
+//! An encoded chunk is either an LZ4 block, or the chunk data stored as is
+//! when it does not compress.
+//!
+//! Before compression a chunk may pass through a filter that suits arrays of
+//! numbers: it replaces each big-endian integer of the filter width by its
+//! zigzag-encoded difference from the previous one, then shuffles the bytes so
+//! that bytes of equal significance are adjacent. A filter width of zero
+//! disables the filter.
+class DpCodec {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants and Types
+    // ----------------------------------------------------------------------
+
+    //! The codec identifiers
+    enum Codec : U8 {
+        //! Chunks are LZ4 blocks
+        CODEC_LZ4_BLOCK = 1
+    };
+
+    //! The compressed data preamble
+    struct Preamble {
+        //! The offset for the codec field
+        static constexpr FwSizeType CODEC_OFFSET = 0;
+        //! The offset for the filter width field
+        static constexpr FwSizeType FILTER_WIDTH_OFFSET = CODEC_OFFSET + sizeof(U8);
+        //! The offset for the chunk size field
+        static constexpr FwSizeType CHUNK_SIZE_OFFSET = FILTER_WIDTH_OFFSET + sizeof(U8);
+        //! The offset for the uncompressed data size field
+        static constexpr FwSizeType DATA_SIZE_OFFSET = CHUNK_SIZE_OFFSET + sizeof(U32);
+        //! The preamble size
+        static constexpr FwSizeType SIZE = DATA_SIZE_OFFSET + sizeof(FwSizeStoreType);
+    };
+
+    //! The chunk header size
+    static constexpr FwSizeType CHUNK_HEADER_SIZE = sizeof(U32);
+    //! The bit of the chunk header marking a chunk stored without compression
+    static constexpr U32 CHUNK_STORED = 0x80000000;
+    //! The largest filter width
+    static constexpr U8 MAX_FILTER_WIDTH = 8;
+
+    static_assert(DP_COMPRESSION_CHUNK_SIZE > 0, "chunk size must be positive");
+    static_assert(DP_COMPRESSION_CHUNK_SIZE <= 65536, "chunk size must fit LZ4 match offsets");
+
+  public:
+    // ----------------------------------------------------------------------
+    // Constructors and destructors
+    // ----------------------------------------------------------------------
+
+    //! Constructor
+    DpCodec();
+
+    //! Destructor
+    ~DpCodec() {}
+
+  public:
+    // ----------------------------------------------------------------------
+    // Public member functions
+    // ----------------------------------------------------------------------
+
+    //! Encode one chunk of at most DP_COMPRESSION_CHUNK_SIZE bytes
+    //! \return The encoded size, including the chunk header
+    FwSizeType encodeChunk(const U8* data,   //!< The chunk data
+                           FwSizeType size,  //!< The chunk size
+                           U8 filterWidth,   //!< The filter width
+                           U8* encoded       //!< The encoded chunk, holding getMaxEncodedChunkSize(size) bytes
+    );
+
+    //! Decode compressed data
+    //! Chunks larger than DP_COMPRESSION_CHUNK_SIZE are refused
+    //! \return The serialize status
+    Fw::SerializeStatus decode(const U8* compressed,        //!< The compressed data, starting with the preamble
+                               FwSizeType compressedSize,   //!< The compressed data size
+                               U8* data,                    //!< The decoded data
+                               FwSizeType dataCapacity,     //!< The capacity of the decoded data
+                               FwSizeType& dataSize         //!< The decoded data size (output)
+    );
+
+  public:
+    // ----------------------------------------------------------------------
+    // Public static functions
+    // ----------------------------------------------------------------------
+
+    //! Get the largest encoded size of a chunk, reached when the chunk is stored
+    static constexpr FwSizeType getMaxEncodedChunkSize(FwSizeType size  //!< The chunk size
+    ) {
+        return CHUNK_HEADER_SIZE + size;
+    }
+
+    //! Check that a filter width is supported
+    static bool isValidFilterWidth(U8 filterWidth  //!< The filter width
+    ) {
+        return (filterWidth == 0) || (filterWidth == 1) || (filterWidth == 2) || (filterWidth == 4) ||
+               (filterWidth == MAX_FILTER_WIDTH);
+    }
+
+    //! Serialize the preamble
+    static void serializePreamble(U8* preamble,          //!< The preamble, holding Preamble::SIZE bytes
+                                  U8 filterWidth,        //!< The filter width
+                                  FwSizeType chunkSize,  //!< The chunk size
+                                  FwSizeType dataSize    //!< The uncompressed data size
+    );
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private static functions
+    // ----------------------------------------------------------------------
+
+    //! Apply the filter
+    static void filter(const U8* data, FwSizeType size, U8 width, U8* filtered);
+
+    //! Reverse the filter
+    static void unfilter(const U8* filtered, FwSizeType size, U8 width, U8* data);
+
+    //! Decompress an LZ4 block that decodes to exactly size bytes
+    //! \return True if the block is well formed
+    static bool decompressBlock(const U8* block, FwSizeType blockSize, U8* data, FwSizeType size);
+
+    // ----------------------------------------------------------------------
+    // Private member functions
+    // ----------------------------------------------------------------------
+
+    //! Compress data into an LZ4 block
+    //! \return The block size, or zero when the block does not fit in capacity
+    FwSizeType compressBlock(const U8* data, FwSizeType size, U8* block, FwSizeType capacity);
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private member variables
+    // ----------------------------------------------------------------------
+
+    //! The log2 of the number of match finder entries
+    static constexpr U32 HASH_LOG = 12;
+
+    //! The match finder, the last chunk offset of each hashed four byte sequence
+    U16 m_hashTable[1 << HASH_LOG];
+
+    //! The filtered chunk
+    U8 m_scratch[DP_COMPRESSION_CHUNK_SIZE];
+};
+
+}  // end namespace Fw
+
+#endif
@@ -17,7 +17,17 @@ namespace Fw {
 // ----------------------------------------------------------------------
 
 DpContainer::DpContainer(FwDpIdType id, const Fw::Buffer& buffer)
-    : m_id(id), m_priority(0), m_timeTag(), m_procTypes(0), m_dpState(), m_dataSize(0), m_buffer(), m_dataBuffer() {
+    : m_id(id),
+      m_priority(0),
+      m_timeTag(),
+      m_procTypes(0),
+      m_dpState(),
+      m_flags(0),
+      m_dataSize(0),
+      m_dataHash(),
+      m_hashedDataSize(0),
+      m_buffer(),
+      m_dataBuffer() {
     // Initialize the user data field
     this->initUserDataField();
     // Set the packet buffer
@@ -26,7 +36,16 @@ DpContainer::DpContainer(FwDpIdType id, const Fw::Buffer& buffer)
 }
 
 DpContainer::DpContainer()
-    : m_id(0), m_priority(0), m_timeTag(), m_procTypes(0), m_dataSize(0), m_buffer(), m_dataBuffer() {
+    : m_id(0),
+      m_priority(0),
+      m_timeTag(),
+      m_procTypes(0),
+      m_flags(0),
+      m_dataSize(0),
+      m_dataHash(),
+      m_hashedDataSize(0),
+      m_buffer(),
+      m_dataBuffer() {
     // Initialize the user data field
     this->initUserDataField();
 }
@@ -37,13 +56,9 @@ DpContainer::DpContainer()
 
 Fw::SerializeStatus DpContainer::deserializeHeader() {
     FW_ASSERT(this->m_buffer.isValid());
-    Fw::SerializeBufferBase& serializeRepr = this->m_buffer.getSerializeRepr();
-    // Set buffer length
-    Fw::SerializeStatus status = serializeRepr.setBuffLen(this->m_buffer.getSize());
-    // Reset deserialization
-    if (status == Fw::FW_SERIALIZE_OK) {
-        status = serializeRepr.moveDeserToOffset(Header::PACKET_DESCRIPTOR_OFFSET);
-    }
+    Fw::ExternalSerializeBufferWithMemberCopy serializeRepr = this->m_buffer.getDeserializer();
+    // Move deserialization to the packet descriptor
+    Fw::SerializeStatus status = serializeRepr.moveDeserToOffset(Header::PACKET_DESCRIPTOR_OFFSET);
     // Deserialize the packet type
     if (status == Fw::FW_SERIALIZE_OK) {
         FwPacketDescriptorType packetDescriptor;
@@ -81,18 +96,23 @@ Fw::SerializeStatus DpContainer::deserializeHeader() {
     if (status == Fw::FW_SERIALIZE_OK) {
         status = serializeRepr.deserialize(this->m_dpState);
     }
+    // Deserialize the flags, if the header has them
+    this->m_flags = 0;
+    if ((status == Fw::FW_SERIALIZE_OK) and DP_CONTAINER_HEADER_FLAGS) {
+        status = serializeRepr.deserialize(this->m_flags);
+    }
     // Deserialize the data size
     if (status == Fw::FW_SERIALIZE_OK) {
         status = serializeRepr.deserializeSize(this->m_dataSize);
     }
+    // The data in the buffer is not the data in the running hash
+    this->resetDataHash();
     return status;
 }
 
 void DpContainer::serializeHeader() {
     FW_ASSERT(this->m_buffer.isValid());
-    Fw::SerializeBufferBase& serializeRepr = this->m_buffer.getSerializeRepr();
-    // Reset serialization
-    serializeRepr.resetSer();
+    Fw::ExternalSerializeBufferWithMemberCopy serializeRepr = this->m_buffer.getSerializer();
     // Serialize the packet type
     Fw::SerializeStatus status =
         serializeRepr.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_DP));
@@ -116,6 +136,13 @@ void DpContainer::serializeHeader() {
     // Serialize the data product state
     status = serializeRepr.serialize(this->m_dpState);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    // Serialize the flags, if the header has them
+    if (DP_CONTAINER_HEADER_FLAGS) {
+        status = serializeRepr.serialize(this->m_flags);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    } else {
+        FW_ASSERT(this->m_flags == 0, static_cast<FwAssertArgType>(this->m_flags));
+    }
     // Serialize the data size
     status = serializeRepr.serializeSize(this->m_dataSize);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
@@ -144,6 +171,8 @@ void DpContainer::setBuffer(const Buffer& buffer) {
     this->m_dataBuffer.setExtBuffer(dataAddr, static_cast<Fw::Serializable::SizeType>(dataCapacity));
     // Reset the data size
     this->m_dataSize = 0;
+    // Reset the running data hash
+    this->resetDataHash();
 }
 
 Utils::HashBuffer DpContainer::getHeaderHash() const {
@@ -221,8 +250,43 @@ void DpContainer::setDataHash(Utils::HashBuffer hash) {
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
 }
 
+void DpContainer::hashData() {
+    (void)this->hashData(this->m_dataSize);
+}
+
+FwSizeType DpContainer::hashData(FwSizeType maxSize) {
+    // Restart the running hash if the data has shrunk below it
+    if (this->m_hashedDataSize > this->m_dataSize) {
+        this->resetDataHash();
+    }
+    const FwSizeType dataSize = this->m_dataSize;
+    const FwSizeType bufferSize = this->m_buffer.getSize();
+    FW_ASSERT(DATA_OFFSET + dataSize <= bufferSize, static_cast<FwAssertArgType>(DATA_OFFSET + dataSize),
+              static_cast<FwAssertArgType>(bufferSize));
+    FwSizeType size = dataSize - this->m_hashedDataSize;
+    if (size > maxSize) {
+        size = maxSize;
+    }
+    if (size > 0) {
+        const U8* const dataAddr = &this->m_buffer.getData()[DATA_OFFSET];
+        this->m_dataHash.update(&dataAddr[this->m_hashedDataSize], static_cast<NATIVE_INT_TYPE>(size));
+        this->m_hashedDataSize += size;
+    }
+    return dataSize - this->m_hashedDataSize;
+}
+
+void DpContainer::resetDataHash() {
+    this->m_dataHash.init();
+    this->m_hashedDataSize = 0;
+}
+
 void DpContainer::updateDataHash() {
-    this->setDataHash(this->computeDataHash());
+    this->hashData();
+    // Finalize a copy, so that the running hash can continue with more data
+    Utils::Hash hash = this->m_dataHash;
+    Utils::HashBuffer computedHash;
+    hash.final(computedHash);
+    this->setDataHash(computedHash);
 }
 
 Success::T DpContainer::checkDataHash(Utils::HashBuffer& storedHash, Utils::HashBuffer& computedHash) const {
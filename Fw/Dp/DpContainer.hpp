@@ -12,6 +12,7 @@
 #include "Fw/Time/Time.hpp"
 #include "Fw/Types/SuccessEnumAc.hpp"
 #include "Utils/Hash/Hash.hpp"
+#include "config/DpCfg.hpp"
 #include "config/FppConstantsAc.hpp"
 #include "config/ProcTypeEnumAc.hpp"
 
@@ -42,8 +43,12 @@ class DpContainer {
         static constexpr FwSizeType USER_DATA_OFFSET = PROC_TYPES_OFFSET + sizeof(DpCfg::ProcType::SerialType);
         //! The offset of the data product state field
         static constexpr FwSizeType DP_STATE_OFFSET = USER_DATA_OFFSET + DpCfg::CONTAINER_USER_DATA_SIZE;
+        //! The offset for the flags field
+        static constexpr FwSizeType FLAGS_OFFSET = DP_STATE_OFFSET + DpState::SERIALIZED_SIZE;
+        //! The size of the flags field, which is present only if DP_CONTAINER_HEADER_FLAGS is set
+        static constexpr FwSizeType FLAGS_SIZE = DP_CONTAINER_HEADER_FLAGS ? sizeof(U8) : 0;
         //! The offset for the data size field
-        static constexpr FwSizeType DATA_SIZE_OFFSET = DP_STATE_OFFSET + DpState::SERIALIZED_SIZE;
+        static constexpr FwSizeType DATA_SIZE_OFFSET = FLAGS_OFFSET + FLAGS_SIZE;
         //! The header size
         static constexpr FwSizeType SIZE = DATA_SIZE_OFFSET + sizeof(FwSizeStoreType);
     };
@@ -52,6 +57,12 @@ class DpContainer {
     static constexpr FwSizeType HEADER_HASH_OFFSET = Header::SIZE;
     //! The data offset
     static constexpr FwSizeType DATA_OFFSET = HEADER_HASH_OFFSET + HASH_DIGEST_LENGTH;
+    //! The bits of the flags field
+    enum Flag : U8 {
+        //! The data is compressed with Fw::DpCodec
+        FLAG_COMPRESSED = 0x01
+    };
+
     //! The minimum packet size
     //! Reserve space for the header, the header hash, and the data hash
     //! This is also the number of non-data bytes in the packet
@@ -119,6 +130,10 @@ class DpContainer {
     //! Get the data product state
     DpState getDpState() const { return this->m_dpState; }
 
+    //! Get the flags
+    //! \return The flags, a bit mask of Flag values
+    U8 getFlags() const { return this->m_flags; }
+
     //! Deserialize the header from the packet buffer
     //! Buffer must be valid, and its size must be at least MIN_PACKET_SIZE
     //! Before calling this function, you should call checkHeaderHash() to
@@ -160,6 +175,13 @@ class DpContainer {
         this->m_dpState = dpState;
     }
 
+    //! Set the flags
+    //! Flags other than 0 need DP_CONTAINER_HEADER_FLAGS, so that serializeHeader can store them
+    void setFlags(U8 flags  //!< The flags, a bit mask of Flag values
+    ) {
+        this->m_flags = flags;
+    }
+
     //! Set the data size
     void setDataSize(FwSizeType dataSize  //!< The data size
     ) {
@@ -175,6 +197,7 @@ class DpContainer {
         this->m_buffer = Fw::Buffer();
         this->m_dataBuffer.clear();
         this->m_dataSize = 0;
+        this->resetDataHash();
     }
 
     //! Get the stored header hash
@@ -215,7 +238,25 @@ class DpContainer {
     void setDataHash(Utils::HashBuffer hash  //!< The hash
     );
 
+    //! Update the running data hash with all data not yet hashed
+    //! The generated serializeRecord functions do not call this function. Producers
+    //! must call it between records so that updateDataHash has little data left to
+    //! hash when the container is sent
+    void hashData();
+
+    //! Update the running data hash with at most maxSize bytes of data not yet hashed
+    //! Producers may call this function from idle time to spread the hashing cost
+    //! \return The number of data bytes still to hash
+    FwSizeType hashData(FwSizeType maxSize  //!< The maximum number of bytes to hash
+    );
+
+    //! Restart the running data hash from the start of the data
+    //! Call this function after changing data that has already been hashed
+    void resetDataHash();
+
     //! Update the data hash
+    //! Completes the running data hash, so the cost depends only on the data
+    //! serialized since the last call to hashData
     void updateDataHash();
 
     //! Check the data hash
@@ -271,9 +312,18 @@ class DpContainer {
     //! The data product state
     DpState m_dpState;
 
+    //! The flags
+    U8 m_flags;
+
     //! The data size
     FwSizeType m_dataSize;
 
+    //! The running hash of the first m_hashedDataSize bytes of data
+    Utils::Hash m_dataHash;
+
+    //! The number of data bytes in the running hash
+    FwSizeType m_hashedDataSize;
+
     //! The packet buffer
     Buffer m_buffer;
 
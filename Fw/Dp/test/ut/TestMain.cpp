@@ -2,11 +2,15 @@
 // TestMain.cpp
 // ----------------------------------------------------------------------
 
+#include <chrono>
+#include <cstdio>
 #include <cstring>
 #include <limits>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include "Fw/Dp/DpCodec.hpp"
 #include "Fw/Dp/DpContainer.hpp"
 #include "Fw/Dp/test/util/DpContainerHeader.hpp"
 #include "Fw/Test/UnitTest.hpp"
@@ -45,6 +49,11 @@ void checkHeader(FwDpIdType id, Fw::Buffer& buffer, DpContainer& container) {
     // Set the DP state
     const DpState dpState(static_cast<DpState::T>(STest::Pick::startLength(0, DpState::NUM_CONSTANTS)));
     container.setDpState(dpState);
+    // Set the flags, if the header has them
+    const U8 flags = DP_CONTAINER_HEADER_FLAGS
+                         ? static_cast<U8>(STest::Pick::lowerUpper(0, 1) * DpContainer::FLAG_COMPRESSED)
+                         : 0;
+    container.setFlags(flags);
     // Set the data size
     container.setDataSize(DATA_SIZE);
     // Test serialization: Serialize the header
@@ -56,11 +65,13 @@ void checkHeader(FwDpIdType id, Fw::Buffer& buffer, DpContainer& container) {
     header.deserialize(__FILE__, __LINE__, buffer);
     // Check the deserialized header fields
     header.check(__FILE__, __LINE__, buffer, id, priority, timeTag, procTypes, userData, dpState, DATA_SIZE);
+    ASSERT_EQ(header.m_flags, flags);
     // Test deserialization: Deserialize the header into a new container
     DpContainer deserContainer;
     deserContainer.setBuffer(container.getBuffer());
     const Fw::SerializeStatus serialStatus = deserContainer.deserializeHeader();
     ASSERT_EQ(serialStatus, Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(deserContainer.getFlags(), flags);
     // Clear out the header in the buffer
     FW_ASSERT(buffer.isValid());
     ::memset(buffer.getData(), 0, DpContainer::Header::SIZE);
@@ -164,7 +175,7 @@ TEST(Header, BadPacketDescriptor) {
     // Create a buffer
     Fw::Buffer buffer(bufferData, sizeof bufferData);
     // Set the packet descriptor to a bad value
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getSerializer();
     const FwPacketDescriptorType badPacketDescriptor = Fw::ComPacket::FW_PACKET_DP + 1;
     Fw::SerializeStatus status = serialRepr.serialize(badPacketDescriptor);
     ASSERT_EQ(status, Fw::FW_SERIALIZE_OK);
@@ -177,6 +188,235 @@ TEST(Header, BadPacketDescriptor) {
     ASSERT_EQ(serialStatus, Fw::FW_SERIALIZE_FORMAT_ERROR);
 }
 
+//! Serialize a record of recordSize random bytes into the container, as a generated container does
+void serializeRecord(DpContainer& container, FwSizeType recordSize) {
+    for (FwSizeType i = 0; i < recordSize; i++) {
+        const Fw::SerializeStatus status = container.m_dataBuffer.serialize(static_cast<U8>(STest::Pick::any()));
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    }
+    container.setDataSize(container.m_dataBuffer.getBuffLength());
+}
+
+TEST(DataHash, Incremental) {
+    COMMENT("Hash the data in pieces as records are serialized");
+    Fw::Buffer buffer(bufferData, sizeof bufferData);
+    DpContainer container(0, buffer);
+    Utils::HashBuffer storedHash;
+    Utils::HashBuffer computedHash;
+    // Hash after some records, and part of the data after others
+    while (container.getDataSize() < DATA_SIZE) {
+        const FwSizeType recordSize = STest::Pick::lowerUpper(1, 10);
+        serializeRecord(container, FW_MIN(recordSize, DATA_SIZE - container.getDataSize()));
+        if (STest::Pick::lowerUpper(0, 1) == 0) {
+            const FwSizeType maxSize = STest::Pick::lowerUpper(0, 10);
+            const FwSizeType remaining = container.hashData(maxSize);
+            ASSERT_EQ(remaining, container.getDataSize() - container.m_hashedDataSize);
+            ASSERT_LE(container.m_hashedDataSize, container.getDataSize());
+        }
+    }
+    container.updateDataHash();
+    ASSERT_EQ(container.m_hashedDataSize, DATA_SIZE);
+    ASSERT_EQ(container.checkDataHash(storedHash, computedHash), Fw::Success::SUCCESS);
+    // The running hash continues after the update
+    container.m_dataBuffer.resetSer();
+    container.setDataSize(0);
+    serializeRecord(container, DATA_SIZE / 2);
+    container.updateDataHash();
+    ASSERT_EQ(container.checkDataHash(storedHash, computedHash), Fw::Success::SUCCESS);
+    serializeRecord(container, DATA_SIZE - DATA_SIZE / 2);
+    container.updateDataHash();
+    ASSERT_EQ(container.checkDataHash(storedHash, computedHash), Fw::Success::SUCCESS);
+    // Changing hashed data requires a reset
+    bufferData[DpContainer::DATA_OFFSET] ^= 0xFF;
+    container.updateDataHash();
+    ASSERT_EQ(container.checkDataHash(storedHash, computedHash), Fw::Success::FAILURE);
+    container.resetDataHash();
+    container.updateDataHash();
+    ASSERT_EQ(container.checkDataHash(storedHash, computedHash), Fw::Success::SUCCESS);
+    // Deserializing the header restarts the hash
+    container.serializeHeader();
+    bufferData[DpContainer::DATA_OFFSET] ^= 0xFF;
+    ASSERT_EQ(container.deserializeHeader(), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(container.m_hashedDataSize, 0);
+    container.updateDataHash();
+    ASSERT_EQ(container.checkDataHash(storedHash, computedHash), Fw::Success::SUCCESS);
+}
+
+TEST(DataHash, DISABLED_SendLatency) {
+    COMMENT("Benchmark the data hash update at send time for large containers");
+    const FwSizeType RECORD_SIZE = 4096;
+    for (FwSizeType dataSize = 64 * 1024; dataSize <= 64 * 1024 * 1024; dataSize *= 4) {
+        std::vector<U8> storage(DpContainer::getPacketSizeForDataSize(dataSize));
+        for (U8& byte : storage) {
+            byte = static_cast<U8>(STest::Pick::any());
+        }
+        Fw::Buffer buffer(storage.data(), static_cast<Fw::Buffer::SizeType>(storage.size()));
+        DpContainer container(0, buffer);
+        // Hash everything at send time
+        container.setDataSize(dataSize);
+        auto start = std::chrono::steady_clock::now();
+        container.updateDataHash();
+        const F64 fullSeconds = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+        const Utils::HashBuffer fullHash = container.getDataHash();
+        // Hash after each record, as a producer filling the container would
+        container.resetDataHash();
+        F64 recordSeconds = 0;
+        for (FwSizeType size = RECORD_SIZE; size <= dataSize; size += RECORD_SIZE) {
+            container.setDataSize(size);
+            start = std::chrono::steady_clock::now();
+            container.hashData();
+            recordSeconds += std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+        }
+        start = std::chrono::steady_clock::now();
+        container.updateDataHash();
+        const F64 sendSeconds = std::chrono::duration<F64>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(container.getDataHash(), fullHash);
+        ::printf("data size %8" PRI_FwSizeType " KB: full hash at send %10.1f us, incremental send %6.2f us"
+                 " (%.2f us per %" PRI_FwSizeType " byte record)\n",
+                 dataSize / 1024, fullSeconds * 1e6, sendSeconds * 1e6,
+                 recordSeconds * 1e6 * RECORD_SIZE / static_cast<F64>(dataSize), RECORD_SIZE);
+    }
+}
+
+constexpr FwSizeType CODEC_DATA_SIZE = 3 * DP_COMPRESSION_CHUNK_SIZE + 100;
+constexpr FwSizeType CODEC_NUM_CHUNKS = (CODEC_DATA_SIZE + DP_COMPRESSION_CHUNK_SIZE - 1) / DP_COMPRESSION_CHUNK_SIZE;
+constexpr FwSizeType CODEC_ENCODED_SIZE =
+    DpCodec::Preamble::SIZE + CODEC_NUM_CHUNKS * DpCodec::CHUNK_HEADER_SIZE + CODEC_DATA_SIZE;
+U8 codecData[CODEC_DATA_SIZE];
+U8 codecEncoded[CODEC_ENCODED_SIZE];
+U8 codecDecoded[CODEC_DATA_SIZE];
+DpCodec codec;
+
+//! Fill with synthetic sensor data: big-endian U32 samples of a slowly drifting signal with a little noise
+void fillWithSensorData(U8* data, FwSizeType size) {
+    I32 sample = 1 << 20;
+    FwSizeType i = 0;
+    for (; i + sizeof(U32) <= size; i += sizeof(U32)) {
+        sample += static_cast<I32>(STest::Pick::lowerUpper(0, 8)) - 4;
+        const U32 value = static_cast<U32>(sample);
+        data[i] = static_cast<U8>(value >> 24);
+        data[i + 1] = static_cast<U8>(value >> 16);
+        data[i + 2] = static_cast<U8>(value >> 8);
+        data[i + 3] = static_cast<U8>(value);
+    }
+    for (; i < size; i++) {
+        data[i] = static_cast<U8>(STest::Pick::any());
+    }
+}
+
+//! Encode data the way DpWriter does: the preamble, then one chunk at a time
+FwSizeType encode(const U8* data, FwSizeType size, U8 filterWidth) {
+    DpCodec::serializePreamble(codecEncoded, filterWidth, DP_COMPRESSION_CHUNK_SIZE, size);
+    FwSizeType encodedSize = DpCodec::Preamble::SIZE;
+    for (FwSizeType offset = 0; offset < size; offset += DP_COMPRESSION_CHUNK_SIZE) {
+        const FwSizeType chunk = FW_MIN(DP_COMPRESSION_CHUNK_SIZE, size - offset);
+        encodedSize += codec.encodeChunk(&data[offset], chunk, filterWidth, &codecEncoded[encodedSize]);
+        FW_ASSERT(encodedSize <= sizeof codecEncoded);
+    }
+    return encodedSize;
+}
+
+//! Encode and decode data, check the round trip and return the encoded size
+FwSizeType checkRoundTrip(const U8* data, FwSizeType size, U8 filterWidth) {
+    const FwSizeType encodedSize = encode(data, size, filterWidth);
+    FwSizeType decodedSize = 0;
+    ::memset(codecDecoded, 0, sizeof codecDecoded);
+    const Fw::SerializeStatus status =
+        codec.decode(codecEncoded, encodedSize, codecDecoded, sizeof codecDecoded, decodedSize);
+    EXPECT_EQ(status, Fw::FW_SERIALIZE_OK);
+    EXPECT_EQ(decodedSize, size);
+    EXPECT_EQ(::memcmp(data, codecDecoded, size), 0);
+    return encodedSize;
+}
+
+TEST(Codec, SensorData) {
+    COMMENT("Compress synthetic sensor data with each filter width");
+    fillWithSensorData(codecData, sizeof codecData);
+    const U8 filterWidths[] = {0, 1, 2, 4, 8};
+    for (const U8 filterWidth : filterWidths) {
+        const FwSizeType encodedSize = checkRoundTrip(codecData, sizeof codecData, filterWidth);
+        ASSERT_LT(encodedSize, sizeof codecData);
+    }
+    // The filter matching the sample width compresses best
+    ASSERT_LT(checkRoundTrip(codecData, sizeof codecData, 4), checkRoundTrip(codecData, sizeof codecData, 0));
+}
+
+TEST(Codec, Incompressible) {
+    COMMENT("Random data is stored without compression");
+    for (U8& data : codecData) {
+        data = static_cast<U8>(STest::Pick::any());
+    }
+    const FwSizeType encodedSize = checkRoundTrip(codecData, sizeof codecData, 2);
+    ASSERT_EQ(encodedSize, sizeof codecEncoded);
+}
+
+TEST(Codec, Sizes) {
+    COMMENT("Round trip every short size and long runs");
+    for (FwSizeType size = 0; size < 300; size++) {
+        for (FwSizeType i = 0; i < size; i++) {
+            codecData[i] = static_cast<U8>(STest::Pick::lowerUpper(0, 2));
+        }
+        checkRoundTrip(codecData, size, static_cast<U8>(STest::Pick::lowerUpper(0, 1)));
+    }
+    ::memset(codecData, 0x5A, sizeof codecData);
+    const FwSizeType encodedSize = checkRoundTrip(codecData, sizeof codecData, 0);
+    ASSERT_LT(encodedSize, sizeof codecData / 100);
+}
+
+TEST(Codec, Corrupt) {
+    COMMENT("Decoding refuses malformed input");
+    fillWithSensorData(codecData, sizeof codecData);
+    const FwSizeType encodedSize = encode(codecData, sizeof codecData, 4);
+    FwSizeType decodedSize = 0;
+    // Truncated
+    ASSERT_NE(codec.decode(codecEncoded, encodedSize - 1, codecDecoded, sizeof codecDecoded, decodedSize),
+              Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(decodedSize, 0);
+    // Too small to decode into
+    ASSERT_EQ(codec.decode(codecEncoded, encodedSize, codecDecoded, sizeof codecDecoded - 1, decodedSize),
+              Fw::FW_DESERIALIZE_SIZE_MISMATCH);
+    // Unknown codec
+    codecEncoded[DpCodec::Preamble::CODEC_OFFSET]++;
+    ASSERT_EQ(codec.decode(codecEncoded, encodedSize, codecDecoded, sizeof codecDecoded, decodedSize),
+              Fw::FW_DESERIALIZE_FORMAT_ERROR);
+    codecEncoded[DpCodec::Preamble::CODEC_OFFSET]--;
+    // Damaged blocks never decode out of bounds
+    for (U32 trial = 0; trial < 1000; trial++) {
+        const FwSizeType offset = STest::Pick::startLength(DpCodec::Preamble::SIZE, encodedSize - DpCodec::Preamble::SIZE);
+        const U8 saved = codecEncoded[offset];
+        codecEncoded[offset] = static_cast<U8>(STest::Pick::any());
+        (void)codec.decode(codecEncoded, encodedSize, codecDecoded, sizeof codecDecoded, decodedSize);
+        codecEncoded[offset] = saved;
+    }
+}
+
+TEST(Codec, DISABLED_Throughput) {
+    COMMENT("Benchmark compression of synthetic sensor data");
+    fillWithSensorData(codecData, sizeof codecData);
+    const U32 ITERATIONS = 2000;
+    const U8 filterWidths[] = {0, 2, 4};
+    for (const U8 filterWidth : filterWidths) {
+        FwSizeType encodedSize = 0;
+        const auto encodeStart = std::chrono::steady_clock::now();
+        for (U32 iteration = 0; iteration < ITERATIONS; iteration++) {
+            encodedSize = encode(codecData, sizeof codecData, filterWidth);
+        }
+        const auto encodeEnd = std::chrono::steady_clock::now();
+        FwSizeType decodedSize = 0;
+        for (U32 iteration = 0; iteration < ITERATIONS; iteration++) {
+            ASSERT_EQ(codec.decode(codecEncoded, encodedSize, codecDecoded, sizeof codecDecoded, decodedSize),
+                      Fw::FW_SERIALIZE_OK);
+        }
+        const auto decodeEnd = std::chrono::steady_clock::now();
+        const F64 megabytes = static_cast<F64>(sizeof codecData) * ITERATIONS / 1e6;
+        const F64 encodeSeconds = std::chrono::duration<F64>(encodeEnd - encodeStart).count();
+        const F64 decodeSeconds = std::chrono::duration<F64>(decodeEnd - encodeEnd).count();
+        ::printf("filter width %u: ratio %.2f, encode %.1f MB/s, decode %.1f MB/s\n", filterWidth,
+                 static_cast<F64>(sizeof codecData) / static_cast<F64>(encodedSize), megabytes / encodeSeconds,
+                 megabytes / decodeSeconds);
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     STest::Random::seed();
@@ -27,19 +27,15 @@ namespace TestUtil {
 
 //! A container packet header for testing
 struct DpContainerHeader {
-    DpContainerHeader() : m_id(0), m_priority(0), m_timeTag(), m_procTypes(0), m_dpState(), m_dataSize(0) {}
+    DpContainerHeader() : m_id(0), m_priority(0), m_timeTag(), m_procTypes(0), m_dpState(), m_flags(0), m_dataSize(0) {}
 
-    //! Move the buffer deserialization to the specified offset
-    static void moveDeserToOffset(const char* const file,  //!< The call site file name
-                                  const U32 line,          //!< The call site line number
-                                  Buffer& buffer,          //!< The buffer
-                                  FwSizeType offset        //!< The offset
+    //! Move the deserialization of a packet buffer to the specified offset
+    static void moveDeserToOffset(const char* const file,               //!< The call site file name
+                                  const U32 line,                       //!< The call site line number
+                                  Fw::SerializeBufferBase& serializeRepr,  //!< The packet buffer deserializer
+                                  FwSizeType offset                     //!< The offset
     ) {
-        Fw::SerializeBufferBase& serializeRepr = buffer.getSerializeRepr();
-        // Reset deserialization
-        Fw::SerializeStatus status = serializeRepr.setBuffLen(buffer.getSize());
-        DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
-        status = serializeRepr.moveDeserToOffset(offset);
+        const Fw::SerializeStatus status = serializeRepr.moveDeserToOffset(offset);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
     }
 
@@ -50,43 +46,50 @@ struct DpContainerHeader {
                      const U32 line,          //!< The call site line number
                      Fw::Buffer& buffer       //!< The packet buffer
     ) {
-        Fw::SerializeBufferBase& serializeRepr = buffer.getSerializeRepr();
+        Fw::ExternalSerializeBufferWithMemberCopy serializeRepr = buffer.getDeserializer();
         // Deserialize the packet descriptor
         FwPacketDescriptorType packetDescriptor = Fw::ComPacket::FW_PACKET_UNKNOWN;
         // Deserialize the packet descriptor
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::PACKET_DESCRIPTOR_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::PACKET_DESCRIPTOR_OFFSET);
         Fw::SerializeStatus status = serializeRepr.deserialize(packetDescriptor);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         DP_CONTAINER_HEADER_ASSERT_EQ(packetDescriptor, Fw::ComPacket::FW_PACKET_DP);
         // Deserialize the container id
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::ID_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::ID_OFFSET);
         status = serializeRepr.deserialize(this->m_id);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         // Deserialize the priority
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::PRIORITY_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::PRIORITY_OFFSET);
         status = serializeRepr.deserialize(this->m_priority);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         // Deserialize the time tag
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::TIME_TAG_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::TIME_TAG_OFFSET);
         status = serializeRepr.deserialize(this->m_timeTag);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         // Deserialize the processing type
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::PROC_TYPES_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::PROC_TYPES_OFFSET);
         status = serializeRepr.deserialize(this->m_procTypes);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         // Deserialize the user data
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::USER_DATA_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::USER_DATA_OFFSET);
         NATIVE_UINT_TYPE size = sizeof this->m_userData;
         const bool omitLength = true;
         status = serializeRepr.deserialize(this->m_userData, size, omitLength);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         DP_CONTAINER_HEADER_ASSERT_EQ(size, sizeof this->m_userData);
         // Deserialize the data product state
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::DP_STATE_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::DP_STATE_OFFSET);
         status = serializeRepr.deserialize(this->m_dpState);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
+        // Deserialize the flags, if the header has them
+        this->m_flags = 0;
+        if (DP_CONTAINER_HEADER_FLAGS) {
+            DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::FLAGS_OFFSET);
+            status = serializeRepr.deserialize(this->m_flags);
+            DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
+        }
         // Deserialize the data size
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::Header::DATA_SIZE_OFFSET);
+        DpContainerHeader::moveDeserToOffset(file, line, serializeRepr, DpContainer::Header::DATA_SIZE_OFFSET);
         status = serializeRepr.deserializeSize(this->m_dataSize);
         DP_CONTAINER_HEADER_ASSERT_EQ(status, FW_SERIALIZE_OK);
         // After deserializing time, the deserialization index should be at
@@ -96,8 +99,6 @@ struct DpContainerHeader {
         checkHeaderHash(file, line, buffer);
         // Check the data hash
         this->checkDataHash(file, line, buffer);
-        // Move the deserialization pointer to the data offset
-        DpContainerHeader::moveDeserToOffset(file, line, buffer, DpContainer::DATA_OFFSET);
     }
 
     //! Check the header hash
@@ -189,6 +190,9 @@ struct DpContainerHeader {
     //! The data product state
     DpState m_dpState;
 
+    //! The flags
+    U8 m_flags;
+
     //! The data size
     FwSizeType m_dataSize;
 };
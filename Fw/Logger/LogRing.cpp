@@ -0,0 +1,473 @@
+/**
+ * File: LogRing.cpp
+ * Description: Deferred formatting of log messages
+ */
+#include <Fw/Logger/LogRing.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+namespace Fw {
+
+namespace {
+
+//! The format of a message formatted by the caller
+const char* const STRING_FORMAT = "%s";
+
+//! The longest conversion specification deferred, from the % to the conversion character
+const FwSizeType MAX_SPECIFICATION = 16;
+
+//! The length modifier of a conversion
+enum Length { LENGTH_NONE, LENGTH_HH, LENGTH_H, LENGTH_L, LENGTH_LL, LENGTH_J, LENGTH_Z, LENGTH_T, LENGTH_BIG_L };
+
+//! A conversion specification of a format
+struct Conversion {
+    const char* start;       //!< The %
+    const char* end;         //!< Past the conversion character
+    bool widthArgument;      //!< Whether the width is an argument
+    bool precisionArgument;  //!< Whether the precision is an argument
+    Length length;           //!< The length modifier
+    char type;               //!< The conversion character
+};
+
+bool isDigit(char c) {
+    return (c >= '0') and (c <= '9');
+}
+
+//! Parse the conversion specification starting at a %, other than %%
+//! \return true if the conversion can be deferred
+bool parseConversion(const char* percent, Conversion& conversion) {
+    const char* c = percent + 1;
+    conversion.start = percent;
+    conversion.widthArgument = false;
+    conversion.precisionArgument = false;
+    conversion.length = LENGTH_NONE;
+    while ((*c == '-') or (*c == '+') or (*c == ' ') or (*c == '#') or (*c == '0')) {
+        c++;
+    }
+    if (*c == '*') {
+        conversion.widthArgument = true;
+        c++;
+    } else {
+        while (isDigit(*c)) {
+            c++;
+        }
+    }
+    if (*c == '.') {
+        c++;
+        if (*c == '*') {
+            conversion.precisionArgument = true;
+            c++;
+        } else {
+            while (isDigit(*c)) {
+                c++;
+            }
+        }
+    }
+    switch (*c) {
+        case 'h':
+            c++;
+            conversion.length = LENGTH_H;
+            if (*c == 'h') {
+                c++;
+                conversion.length = LENGTH_HH;
+            }
+            break;
+        case 'l':
+            c++;
+            conversion.length = LENGTH_L;
+            if (*c == 'l') {
+                c++;
+                conversion.length = LENGTH_LL;
+            }
+            break;
+        case 'j':
+            c++;
+            conversion.length = LENGTH_J;
+            break;
+        case 'z':
+            c++;
+            conversion.length = LENGTH_Z;
+            break;
+        case 't':
+            c++;
+            conversion.length = LENGTH_T;
+            break;
+        case 'L':
+            c++;
+            conversion.length = LENGTH_BIG_L;
+            break;
+        default:
+            break;
+    }
+    conversion.type = *c;
+    conversion.end = c + 1;
+    switch (conversion.type) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        case 'p':
+            break;
+        // wide characters and strings are not copied
+        case 'c':
+        case 's':
+            if (conversion.length != LENGTH_NONE) {
+                return false;
+            }
+            break;
+        // including %n and the end of the format
+        default:
+            return false;
+    }
+    return static_cast<FwSizeType>(conversion.end - conversion.start) <= MAX_SPECIFICATION;
+}
+
+//! Read a signed integer argument
+I64 readSigned(Length length, va_list* args) {
+    switch (length) {
+        case LENGTH_L:
+            return va_arg(*args, long);
+        case LENGTH_LL:
+            return va_arg(*args, long long);
+        case LENGTH_J:
+            return va_arg(*args, intmax_t);
+        case LENGTH_Z:
+            return va_arg(*args, std::make_signed<size_t>::type);
+        case LENGTH_T:
+            return va_arg(*args, ptrdiff_t);
+        default:
+            return va_arg(*args, int);
+    }
+}
+
+//! Read an unsigned integer argument
+U64 readUnsigned(Length length, va_list* args) {
+    switch (length) {
+        case LENGTH_L:
+            return va_arg(*args, unsigned long);
+        case LENGTH_LL:
+            return va_arg(*args, unsigned long long);
+        case LENGTH_J:
+            return va_arg(*args, uintmax_t);
+        case LENGTH_Z:
+            return va_arg(*args, size_t);
+        case LENGTH_T:
+            return va_arg(*args, std::make_unsigned<ptrdiff_t>::type);
+        default:
+            return va_arg(*args, unsigned int);
+    }
+}
+
+//! Format one argument with its conversion specification
+int formatSigned(char* buffer, size_t size, const char* specification, Length length, U64 value) {
+    const I64 signedValue = static_cast<I64>(value);
+    switch (length) {
+        case LENGTH_L:
+            return snprintf(buffer, size, specification, static_cast<long>(signedValue));
+        case LENGTH_LL:
+            return snprintf(buffer, size, specification, static_cast<long long>(signedValue));
+        case LENGTH_J:
+            return snprintf(buffer, size, specification, static_cast<intmax_t>(signedValue));
+        case LENGTH_Z:
+            return snprintf(buffer, size, specification, static_cast<std::make_signed<size_t>::type>(signedValue));
+        case LENGTH_T:
+            return snprintf(buffer, size, specification, static_cast<ptrdiff_t>(signedValue));
+        default:
+            return snprintf(buffer, size, specification, static_cast<int>(signedValue));
+    }
+}
+
+//! Format one argument with its conversion specification
+int formatUnsigned(char* buffer, size_t size, const char* specification, Length length, U64 value) {
+    switch (length) {
+        case LENGTH_L:
+            return snprintf(buffer, size, specification, static_cast<unsigned long>(value));
+        case LENGTH_LL:
+            return snprintf(buffer, size, specification, static_cast<unsigned long long>(value));
+        case LENGTH_J:
+            return snprintf(buffer, size, specification, static_cast<uintmax_t>(value));
+        case LENGTH_Z:
+            return snprintf(buffer, size, specification, static_cast<size_t>(value));
+        case LENGTH_T:
+            return snprintf(buffer, size, specification, static_cast<std::make_unsigned<ptrdiff_t>::type>(value));
+        default:
+            return snprintf(buffer, size, specification, static_cast<unsigned int>(value));
+    }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Record
+// ----------------------------------------------------------------------
+
+LogRing::Record::Record() : m_format(STRING_FORMAT), m_numArguments(1), m_arguments(), m_stringSize(1), m_strings() {
+    this->m_arguments[0].integer = 0;
+}
+
+U64 LogRing::Record::getInteger(FwSizeType index) const {
+    FW_ASSERT(index < this->m_numArguments, static_cast<FwAssertArgType>(index));
+    return this->m_arguments[index].integer;
+}
+
+const char* LogRing::Record::getString(FwSizeType index) const {
+    const U64 offset = this->getInteger(index);
+    FW_ASSERT(offset < STRING_SIZE, static_cast<FwAssertArgType>(offset));
+    return &this->m_strings[offset];
+}
+
+bool LogRing::Record::captureString(const char* string) {
+    if (this->m_stringSize == STRING_SIZE) {
+        return false;
+    }
+    if (string == nullptr) {
+        string = "(null)";
+    }
+    const FwSizeType length = strnlen(string, STRING_SIZE - this->m_stringSize - 1);
+    (void)memcpy(&this->m_strings[this->m_stringSize], string, length);
+    this->m_strings[this->m_stringSize + length] = 0;
+    this->m_arguments[this->m_numArguments].integer = this->m_stringSize;
+    this->m_stringSize += length + 1;
+    return true;
+}
+
+bool LogRing::Record::capture(const char* format, va_list* args) {
+    this->m_format = format;
+    this->m_numArguments = 0;
+    this->m_stringSize = 0;
+    for (const char* c = strchr(format, '%'); c != nullptr; c = strchr(c, '%')) {
+        if (c[1] == '%') {
+            c += 2;
+            continue;
+        }
+        Conversion conversion;
+        if (not parseConversion(c, conversion)) {
+            return false;
+        }
+        const FwSizeType numArguments = 1 + (conversion.widthArgument ? 1 : 0) + (conversion.precisionArgument ? 1 : 0);
+        if (this->m_numArguments + numArguments > MAX_ARGUMENTS) {
+            return false;
+        }
+        if (conversion.widthArgument) {
+            this->m_arguments[this->m_numArguments++].integer = static_cast<U64>(static_cast<I64>(va_arg(*args, int)));
+        }
+        if (conversion.precisionArgument) {
+            this->m_arguments[this->m_numArguments++].integer = static_cast<U64>(static_cast<I64>(va_arg(*args, int)));
+        }
+        Argument& argument = this->m_arguments[this->m_numArguments];
+        switch (conversion.type) {
+            case 'd':
+            case 'i':
+                argument.integer = static_cast<U64>(readSigned(conversion.length, args));
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                argument.integer = readUnsigned(conversion.length, args);
+                break;
+            case 'c':
+                argument.integer = static_cast<U64>(static_cast<I64>(va_arg(*args, int)));
+                break;
+            case 'p':
+                argument.pointer = va_arg(*args, const void*);
+                break;
+            case 's':
+                if (not this->captureString(va_arg(*args, const char*))) {
+                    return false;
+                }
+                break;
+            default:
+                // floating point conversions, long double kept as F64
+                argument.real = (conversion.length == LENGTH_BIG_L) ? static_cast<F64>(va_arg(*args, long double))
+                                                                    : va_arg(*args, double);
+                break;
+        }
+        this->m_numArguments++;
+        c = conversion.end;
+    }
+    return true;
+}
+
+FwSizeType LogRing::Record::format(char* buffer, FwSizeType size) const {
+    FW_ASSERT(buffer != nullptr);
+    FW_ASSERT(size > 0);
+    FwSizeType length = 0;
+    FwSizeType index = 0;
+    const char* c = this->m_format;
+    while ((*c != 0) and (length + 1 < size)) {
+        if (*c != '%') {
+            buffer[length++] = *c++;
+            continue;
+        }
+        if (c[1] == '%') {
+            buffer[length++] = '%';
+            c += 2;
+            continue;
+        }
+        Conversion conversion;
+        const bool valid = parseConversion(c, conversion);
+        FW_ASSERT(valid);
+        // the specification, with the width and precision arguments written in
+        char specification[MAX_SPECIFICATION + 2 * 12];
+        FwSizeType specificationLength = 0;
+        for (const char* s = conversion.start; s < conversion.end; s++) {
+            if (*s != '*') {
+                specification[specificationLength++] = *s;
+                continue;
+            }
+            FW_ASSERT(index < this->m_numArguments, static_cast<FwAssertArgType>(index));
+            const int value = static_cast<int>(static_cast<I64>(this->m_arguments[index++].integer));
+            // a negative precision is taken as if the precision were omitted
+            if ((s > conversion.start) and (s[-1] == '.') and (value < 0)) {
+                specificationLength--;
+                continue;
+            }
+            specificationLength += static_cast<FwSizeType>(
+                snprintf(&specification[specificationLength], sizeof(specification) - specificationLength, "%d", value));
+        }
+        specification[specificationLength] = 0;
+
+        FW_ASSERT(index < this->m_numArguments, static_cast<FwAssertArgType>(index));
+        const Argument& argument = this->m_arguments[index++];
+        char* const out = &buffer[length];
+        const size_t available = static_cast<size_t>(size - length);
+        int written = 0;
+        switch (conversion.type) {
+            case 'd':
+            case 'i':
+                written = formatSigned(out, available, specification, conversion.length, argument.integer);
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                written = formatUnsigned(out, available, specification, conversion.length, argument.integer);
+                break;
+            case 'c':
+                written = snprintf(out, available, specification, static_cast<int>(static_cast<I64>(argument.integer)));
+                break;
+            case 'p':
+                written = snprintf(out, available, specification, argument.pointer);
+                break;
+            case 's':
+                written = snprintf(out, available, specification, this->getString(index - 1));
+                break;
+            default:
+                written = (conversion.length == LENGTH_BIG_L)
+                              ? snprintf(out, available, specification, static_cast<long double>(argument.real))
+                              : snprintf(out, available, specification, argument.real);
+                break;
+        }
+        if (written > 0) {
+            length += FW_MIN(static_cast<FwSizeType>(written), available - 1);
+        }
+        c = conversion.end;
+    }
+    buffer[length] = 0;
+    return length;
+}
+
+// ----------------------------------------------------------------------
+// LogRing
+// ----------------------------------------------------------------------
+
+LogRing::LogRing() : m_pushPosition(0), m_popPosition(0), m_notified(false), m_drops(0), m_listener(nullptr) {
+    for (FwSizeType i = 0; i < SIZE; i++) {
+        this->m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+void LogRing::setListener(Listener* listener) {
+    this->m_listener = listener;
+}
+
+bool LogRing::push(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    const bool pushed = this->vpush(format, args);
+    va_end(args);
+    return pushed;
+}
+
+bool LogRing::vpush(const char* format, va_list args) {
+    FW_ASSERT(format != nullptr);
+    // claim the slot at the push position, unless the consumer has not popped it yet
+    FwSizeType position = this->m_pushPosition.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+        slot = &this->m_slots[position & (SIZE - 1)];
+        const FwSizeType sequence = slot->sequence.load(std::memory_order_acquire);
+        const FwSignedSizeType difference = static_cast<FwSignedSizeType>(sequence - position);
+        if (difference == 0) {
+            if (this->m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            this->m_drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            position = this->m_pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    va_list copy;
+    va_copy(copy, args);
+    const bool captured = slot->record.capture(format, &copy);
+    va_end(copy);
+    if (not captured) {
+        Record& record = slot->record;
+        va_copy(copy, args);
+        (void)vsnprintf(record.m_strings, sizeof(record.m_strings), format, copy);
+        va_end(copy);
+        record.m_format = STRING_FORMAT;
+        record.m_numArguments = 1;
+        record.m_arguments[0].integer = 0;
+        record.m_stringSize = strlen(record.m_strings) + 1;
+    }
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    // pairs with the fence of beginDrain(): either the consumer pops this message, or this push notifies it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if ((this->m_listener != nullptr) and (not this->m_notified.load(std::memory_order_relaxed)) and
+        (not this->m_notified.exchange(true))) {
+        this->m_listener->logRingReady();
+    }
+    return true;
+}
+
+void LogRing::beginDrain() {
+    this->m_notified.store(false, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+bool LogRing::pop(Record& record) {
+    Slot& slot = this->m_slots[this->m_popPosition & (SIZE - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != this->m_popPosition + 1) {
+        return false;
+    }
+    record = slot.record;
+    slot.sequence.store(this->m_popPosition + SIZE, std::memory_order_release);
+    this->m_popPosition++;
+    return true;
+}
+
+U32 LogRing::getDrops() const {
+    return this->m_drops.load(std::memory_order_relaxed);
+}
+
+}  // namespace Fw
@@ -0,0 +1,153 @@
+/**
+ * File: LogRing.hpp
+ * Description: Deferred formatting of log messages
+ *
+ * A log ring holds log messages as a format pointer and the raw arguments, so that the thread logging a message only
+ * copies its arguments and the thread draining the ring pays for the formatting.
+ */
+#ifndef Fw_LogRing_hpp_
+#define Fw_LogRing_hpp_
+#include <FpConfig.hpp>
+#include <atomic>
+#include <cstdarg>
+
+namespace Fw {
+
+//! \brief lock-free ring of log messages formatted by the consumer
+//!
+//! Any number of threads push messages and one thread pops them. A push claims a slot with a compare-and-swap of the
+//! push position, copies the format pointer and the arguments into it, and publishes it by its sequence number (a
+//! bounded multiple-producer queue after D. Vyukov). When the ring is full the message is dropped and counted.
+//!
+//! The format pointer is kept, so the format must outlive the message: a string literal. The arguments are read as
+//! the conversions of the format request them. The strings of %s conversions are copied, truncated to the string
+//! space of the slot. A message with more arguments than a slot holds, or with a conversion that cannot be deferred
+//! (%n, %ls, %lc), is formatted by the caller and pushed as a string.
+//!
+//! The consumer registers a listener, notified when a push finds the consumer idle. The consumer calls beginDrain()
+//! and then pops until the ring is empty, so that one notification covers all the messages pushed in the meantime.
+class LogRing {
+  public:
+    enum {
+        SIZE = FW_LOG_RING_SIZE,                    //!< Number of messages in the ring
+        MAX_ARGUMENTS = FW_LOG_RING_MAX_ARGUMENTS,  //!< Number of arguments of a message
+        STRING_SIZE = FW_LOG_RING_STRING_SIZE,      //!< Size of the string arguments of a message
+    };
+
+    static_assert((SIZE > 1) and ((SIZE & (SIZE - 1)) == 0), "FW_LOG_RING_SIZE must be a power of two");
+    static_assert(STRING_SIZE > 0, "FW_LOG_RING_STRING_SIZE must hold the string terminator");
+
+    //! An argument of a message
+    union Argument {
+        U64 integer;          //!< An integer conversion, or the offset of a string in the string space
+        F64 real;             //!< A floating point conversion
+        const void* pointer;  //!< A %p conversion
+    };
+
+    //! A message, its format and its arguments
+    class Record {
+        friend class LogRing;
+
+      public:
+        Record();
+
+        //! \brief get the format of the message
+        const char* getFormat() const { return this->m_format; }
+
+        //! \brief get the number of arguments of the message
+        FwSizeType getNumArguments() const { return this->m_numArguments; }
+
+        //! \brief get an integer argument
+        U64 getInteger(FwSizeType index) const;
+
+        //! \brief get a string argument
+        const char* getString(FwSizeType index) const;
+
+        //! \brief format the message
+        //!
+        //! Formats the message as snprintf would have formatted it with the same arguments, truncated to the buffer.
+        //! \param buffer: the buffer
+        //! \param size: the size of the buffer, including the terminator
+        //! \return the length of the message in the buffer
+        FwSizeType format(char* buffer, FwSizeType size) const;
+
+      private:
+        //! \brief copy the arguments of a format
+        //! \return true if the arguments were copied, false if the message cannot be deferred
+        bool capture(const char* format, va_list* args);
+
+        //! \brief copy a string argument
+        bool captureString(const char* string);
+
+        const char* m_format;                   //!< The format
+        FwSizeType m_numArguments;              //!< The number of arguments
+        Argument m_arguments[MAX_ARGUMENTS];    //!< The arguments
+        FwSizeType m_stringSize;                //!< The size of the string space in use
+        char m_strings[STRING_SIZE];            //!< The copies of the string arguments
+    };
+
+    //! Notified of messages to drain
+    class Listener {
+      public:
+        virtual ~Listener() = default;
+
+        //! \brief a message was pushed while the consumer was idle
+        //!
+        //! Called by the thread pushing the message. The consumer must call beginDrain() and drain the ring.
+        virtual void logRingReady() = 0;
+    };
+
+    LogRing();
+
+    //! \brief set the listener of the ring
+    //!
+    //! Called before messages are pushed.
+    //! \param listener: the listener, or nullptr
+    void setListener(Listener* listener);
+
+    //! \brief push a message
+    //!
+    //! \param format: the format, which must outlive the message
+    //! \param ...: the arguments
+    //! \return true if the message was pushed, false if the ring was full
+    bool push(const char* format, ...);
+
+    //! \brief push a message with a va_list
+    //!
+    //! \param format: the format, which must outlive the message
+    //! \param args: the arguments
+    //! \return true if the message was pushed, false if the ring was full
+    bool vpush(const char* format, va_list args);
+
+    //! \brief start draining the ring
+    //!
+    //! Messages pushed from here on notify the listener again.
+    void beginDrain();
+
+    //! \brief pop a message, called by the consumer
+    //!
+    //! \param record: the message
+    //! \return true if a message was popped, false if the ring was empty
+    bool pop(Record& record);
+
+    //! \brief get the number of messages dropped because the ring was full
+    U32 getDrops() const;
+
+  private:
+    //! A message and the sequence number publishing it
+    struct Slot {
+        std::atomic<FwSizeType> sequence;  //!< The push position that may claim the slot, plus one once pushed
+        Record record;                     //!< The message
+    };
+
+    Slot m_slots[SIZE];                        //!< The messages
+    std::atomic<FwSizeType> m_pushPosition;    //!< The position of the next push
+    FwSizeType m_popPosition;                  //!< The position of the next pop, used by the consumer only
+    std::atomic<bool> m_notified;              //!< Whether the listener was notified since the last beginDrain()
+    std::atomic<U32> m_drops;                  //!< The number of dropped messages
+    Listener* m_listener;                      //!< The listener
+};
+
+}  // namespace Fw
+
+#endif
@@ -17,12 +17,21 @@ namespace Fw {
 
 // Initial logger is NULL
 Logger* Logger::s_current_logger = nullptr;
+// Initial ring is NULL, formatting in the caller
+std::atomic<LogRing*> Logger::s_ring(nullptr);
 
 void Logger::log(const char* format, ...) {
-    Fw::String formatted_string;
-    // Forward the variable arguments to the vformat format implementation
     va_list args;
     va_start(args, format);
+    // Deferred formatting copies the arguments for the consumer of the ring
+    LogRing* const ring = Logger::s_ring.load();
+    if (ring != nullptr) {
+        (void)ring->vpush(format, args);
+        va_end(args);
+        return;
+    }
+    Fw::String formatted_string;
+    // Forward the variable arguments to the vformat format implementation
     formatted_string.vformat(format, args);
     va_end(args);
     Logger::log(formatted_string);
@@ -38,4 +47,12 @@ void Logger::registerLogger(Logger* logger) {
     Logger::s_current_logger = logger;
 }
 
+void Logger::registerRing(LogRing* ring) {
+    Logger::s_ring.store(ring);
+}
+
+LogRing* Logger::getRing() {
+    return Logger::s_ring.load();
+}
+
 }  // End namespace Fw
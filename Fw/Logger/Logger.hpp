@@ -10,7 +10,9 @@
 #define Fw_Logger_hpp_
 #include <FpConfig.hpp>
 #include <Fw/Deprecate.hpp>
+#include <Fw/Logger/LogRing.hpp>
 #include <Fw/Types/StringBase.hpp>
+#include <atomic>
 
 // Unit testing predeclaration hook
 namespace LoggerRules {
@@ -43,6 +45,22 @@ class Logger {
     //! \param logger: logger to register as the system logger
     static void registerLogger(Logger* logger);
 
+    //! \brief defer the formatting of log messages to the consumer of a ring
+    //!
+    //! While a ring is registered, log(format, ...) pushes the format pointer and the arguments into the ring and
+    //! returns; the consumer of the ring formats the message and passes it to log(message). The format must then
+    //! outlive the call, as string literals do. Messages are dropped while the ring is full.
+    //!
+    //! The fatal and assert handlers register nullptr before logging, so that their messages are formatted and
+    //! written by the caller, since the thread draining the ring may not run again.
+    //! \param ring: the ring, or nullptr to format in the caller
+    static void registerRing(LogRing* ring);
+
+    //! \brief get the registered ring
+    //!
+    //! \return the ring, or nullptr
+    static LogRing* getRing();
+
     //! Virtual destructor
     virtual ~Logger() = default;
 
@@ -56,6 +74,7 @@ class Logger {
 
   private:
     static Logger* s_current_logger;  //!< Static logger to use when calling Fw::Logger::log function
+    static std::atomic<LogRing*> s_ring;  //!< Ring deferring the formatting of Fw::Logger::log calls
 };
 }  // namespace Fw
 
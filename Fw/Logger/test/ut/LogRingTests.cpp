@@ -0,0 +1,334 @@
+/**
+ * LogRingTests.cpp:
+ *
+ * Tests of the deferred formatting of Fw::LogRing and of Fw::Logger with a registered ring.
+ */
+#include <gtest/gtest.h>
+#include <Fw/Logger/LogRing.hpp>
+#include <Fw/Logger/test/ut/FakeLogger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+//! Pop one message and format it
+std::string popMessage(Fw::LogRing& ring) {
+    Fw::LogRing::Record record;
+    EXPECT_TRUE(ring.pop(record));
+    char buffer[FW_FIXED_LENGTH_STRING_SIZE];
+    (void)record.format(buffer, sizeof(buffer));
+    return std::string(buffer);
+}
+
+//! Push a message and check that it formats as snprintf does
+template <typename... Args>
+void checkFormat(const char* format, Args... args) {
+    Fw::LogRing ring;
+    ASSERT_TRUE(ring.push(format, args...));
+    char expected[FW_FIXED_LENGTH_STRING_SIZE];
+    (void)snprintf(expected, sizeof(expected), format, args...);
+    ASSERT_EQ(popMessage(ring), std::string(expected)) << format;
+}
+
+//! Counts the notifications of a ring
+class CountingListener : public Fw::LogRing::Listener {
+  public:
+    CountingListener() : m_count(0) {}
+    void logRingReady() override { this->m_count++; }
+    U32 m_count;
+};
+
+//! Wakes a consumer thread, as the queue of an active component would
+class WakingListener : public Fw::LogRing::Listener {
+  public:
+    WakingListener() : m_ready(false) {}
+    void logRingReady() override {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_ready = true;
+        this->m_condition.notify_one();
+    }
+    //! Wait for a notification, or a timeout
+    void wait() {
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        this->m_condition.wait_for(lock, std::chrono::milliseconds(10), [this]() { return this->m_ready; });
+        this->m_ready = false;
+    }
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_ready;
+};
+
+//! Writes messages to a file, as a console logger would
+class FileLogger : public Fw::Logger {
+  public:
+    FileLogger() : m_file(fopen("/dev/null", "w")) {}
+    ~FileLogger() { (void)fclose(this->m_file); }
+    void writeMessage(const Fw::StringBase& message) override {
+        (void)fwrite(message.toChar(), 1, message.length(), this->m_file);
+    }
+    FILE* m_file;
+};
+
+}  // namespace
+
+TEST(LogRingTests, Conversions) {
+    checkFormat("no arguments");
+    checkFormat("percent %% sign");
+    checkFormat("%d %i %u %x %X %o", -5, 42, 7u, 0xbeefu, 0xcafeu, 8u);
+    checkFormat("%hhd %hd %ld %lld %jd %zd %td", 300, -70000, -5L, -6LL, static_cast<intmax_t>(-7),
+                static_cast<ssize_t>(-8), static_cast<ptrdiff_t>(-9));
+    checkFormat("%hhu %hu %lu %llu %ju %zu %tx", 300u, 70000u, 5UL, 6ULL, static_cast<uintmax_t>(7), sizeof(int),
+                static_cast<ptrdiff_t>(9));
+    checkFormat("%lld %llu", static_cast<long long>(-9223372036854775807LL), 18446744073709551615ULL);
+    checkFormat("%f %.3e %g %10.2f %-8.1f| %a", 3.25, 1234.5678, 0.0001, -2.5, 7.75, 1.0);
+    checkFormat("%Lf", static_cast<long double>(2.5));
+    checkFormat("%c%c%c", 'a', 'b', 'c');
+    checkFormat("[%5s] [%-5s] [%.2s]", "ab", "cd", "efgh");
+    checkFormat("[%*d] [%-*d] [%.*f] [%*.*f]", 6, 42, 6, 42, 2, 3.14159, 8, 3, 2.71828);
+    checkFormat("[%.*d]", -1, 42);
+    checkFormat("%+d % d %#x %05d", 5, 6, 255u, 42);
+    const int local = 0;
+    checkFormat("%p", static_cast<const void*>(&local));
+    checkFormat("%s", static_cast<const char*>(nullptr));
+}
+
+TEST(LogRingTests, CopiesStrings) {
+    Fw::LogRing ring;
+    char name[16];
+    (void)strcpy(name, "first");
+    ASSERT_TRUE(ring.push("name %s value %d", name, 1));
+    (void)strcpy(name, "second");
+    ASSERT_TRUE(ring.push("name %s value %d", name, 2));
+    ASSERT_EQ(popMessage(ring), "name first value 1");
+    ASSERT_EQ(popMessage(ring), "name second value 2");
+
+    // strings are truncated to the string space
+    std::string longString(Fw::LogRing::STRING_SIZE + 10, 'x');
+    ASSERT_TRUE(ring.push("%s", longString.c_str()));
+    ASSERT_EQ(popMessage(ring), std::string(Fw::LogRing::STRING_SIZE - 1, 'x'));
+}
+
+TEST(LogRingTests, FormatsInCaller) {
+    Fw::LogRing ring;
+    // more arguments than a slot holds
+    ASSERT_TRUE(ring.push("%d %d %d %d %d %d %d %d %d %d", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10));
+    // conversions that cannot be deferred
+    ASSERT_TRUE(ring.push("%ls %d", L"wide", 5));
+    // strings filling the string space
+    std::string half(Fw::LogRing::STRING_SIZE / 2, 'y');
+    ASSERT_TRUE(ring.push("%s%s%s", half.c_str(), half.c_str(), "z"));
+
+    Fw::LogRing::Record record;
+    ASSERT_TRUE(ring.pop(record));
+    ASSERT_STREQ(record.getFormat(), "%s");
+    char buffer[FW_FIXED_LENGTH_STRING_SIZE];
+    (void)record.format(buffer, sizeof(buffer));
+    ASSERT_STREQ(buffer, "1 2 3 4 5 6 7 8 9 10");
+    ASSERT_EQ(popMessage(ring), "wide 5");
+    ASSERT_EQ(popMessage(ring), (half + half).substr(0, Fw::LogRing::STRING_SIZE - 1));
+}
+
+TEST(LogRingTests, TruncatesToBuffer) {
+    Fw::LogRing ring;
+    ASSERT_TRUE(ring.push("value %d and %s", 123456, "more"));
+    Fw::LogRing::Record record;
+    ASSERT_TRUE(ring.pop(record));
+    char buffer[10];
+    ASSERT_EQ(record.format(buffer, sizeof(buffer)), 9u);
+    ASSERT_STREQ(buffer, "value 123");
+    ASSERT_EQ(record.getInteger(0), 123456u);
+    ASSERT_STREQ(record.getString(1), "more");
+}
+
+TEST(LogRingTests, DropsWhenFull) {
+    Fw::LogRing ring;
+    for (U32 i = 0; i < Fw::LogRing::SIZE; i++) {
+        ASSERT_TRUE(ring.push("message %" PRIu32, i));
+    }
+    ASSERT_FALSE(ring.push("dropped"));
+    ASSERT_FALSE(ring.push("dropped"));
+    ASSERT_EQ(ring.getDrops(), 2u);
+    ASSERT_EQ(popMessage(ring), "message 0");
+    ASSERT_TRUE(ring.push("after"));
+    for (U32 i = 1; i < Fw::LogRing::SIZE; i++) {
+        char expected[32];
+        (void)snprintf(expected, sizeof(expected), "message %" PRIu32, i);
+        ASSERT_EQ(popMessage(ring), expected);
+    }
+    ASSERT_EQ(popMessage(ring), "after");
+    Fw::LogRing::Record record;
+    ASSERT_FALSE(ring.pop(record));
+}
+
+TEST(LogRingTests, NotifiesOncePerDrain) {
+    Fw::LogRing ring;
+    CountingListener listener;
+    ring.setListener(&listener);
+    ASSERT_TRUE(ring.push("one"));
+    ASSERT_TRUE(ring.push("two"));
+    ASSERT_EQ(listener.m_count, 1u);
+    ring.beginDrain();
+    ASSERT_EQ(popMessage(ring), "one");
+    ASSERT_TRUE(ring.push("three"));
+    ASSERT_EQ(listener.m_count, 2u);
+    ASSERT_EQ(popMessage(ring), "two");
+    ASSERT_EQ(popMessage(ring), "three");
+}
+
+TEST(LogRingTests, ConcurrentProducers) {
+    const U32 PRODUCERS = 8;
+    const U32 MESSAGES = 20000;
+    Fw::LogRing ring;
+    WakingListener listener;
+    ring.setListener(&listener);
+
+    // producers retry messages dropped while the ring is full
+    std::vector<std::thread> producers;
+    std::atomic<U32> retries(0);
+    for (U32 producer = 0; producer < PRODUCERS; producer++) {
+        producers.emplace_back([&ring, &retries, producer]() {
+            for (U32 message = 0; message < MESSAGES; message++) {
+                while (not ring.push("producer %" PRIu32 " message %" PRIu32 " %s", producer, message, "text")) {
+                    retries++;
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // each producer's messages arrive in order
+    std::vector<U32> next(PRODUCERS, 0);
+    U32 received = 0;
+    while (received < PRODUCERS * MESSAGES) {
+        listener.wait();
+        ring.beginDrain();
+        Fw::LogRing::Record record;
+        while (ring.pop(record)) {
+            const U32 producer = static_cast<U32>(record.getInteger(0));
+            ASSERT_LT(producer, PRODUCERS);
+            ASSERT_EQ(record.getInteger(1), next[producer]);
+            ASSERT_STREQ(record.getString(2), "text");
+            next[producer]++;
+            received++;
+        }
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+    ASSERT_EQ(ring.getDrops(), retries.load());
+}
+
+TEST(LogRingTests, DeferredLogger) {
+    MockLogging::FakeLogger logger;
+    Fw::Logger::registerLogger(&logger);
+    Fw::LogRing ring;
+    Fw::Logger::registerRing(&ring);
+    ASSERT_EQ(Fw::Logger::getRing(), &ring);
+
+    Fw::Logger::log("deferred %d %s\n", 42, "message");
+    // nothing is written until the consumer drains the ring
+    ASSERT_EQ(logger.m_last, "");
+    Fw::LogRing::Record record;
+    ASSERT_TRUE(ring.pop(record));
+    char buffer[FW_FIXED_LENGTH_STRING_SIZE];
+    (void)record.format(buffer, sizeof(buffer));
+    Fw::Logger::log(Fw::String(buffer));
+    logger.check("deferred 42 message\n");
+
+    Fw::Logger::registerRing(nullptr);
+    Fw::Logger::log("direct %d\n", 7);
+    logger.check("direct 7\n");
+    ASSERT_FALSE(ring.pop(record));
+    Fw::Logger::registerLogger(nullptr);
+}
+
+TEST(LogRingTests, DISABLED_CallerLatency) {
+    // 100000 Fw::Logger::log calls a second from 8 threads, for one second, formatting in the caller or deferred
+    const U32 THREADS = 8;
+    const U32 RATE = 100000;
+    const U32 CALLS = RATE / THREADS;
+    const std::chrono::nanoseconds PERIOD(1000000000LL * THREADS / RATE);
+
+    FileLogger logger;
+    Fw::Logger::registerLogger(&logger);
+    for (bool deferred : {false, true}) {
+        Fw::LogRing ring;
+        WakingListener listener;
+        ring.setListener(&listener);
+        bool done = false;
+        std::thread consumer;
+        if (deferred) {
+            Fw::Logger::registerRing(&ring);
+            consumer = std::thread([&ring, &listener, &done]() {
+                char buffer[FW_FIXED_LENGTH_STRING_SIZE];
+                Fw::LogRing::Record record;
+                while (true) {
+                    listener.wait();
+                    ring.beginDrain();
+                    while (ring.pop(record)) {
+                        (void)record.format(buffer, sizeof(buffer));
+                        Fw::Logger::log(Fw::String(buffer));
+                    }
+                    std::lock_guard<std::mutex> lock(listener.m_mutex);
+                    if (done) {
+                        break;
+                    }
+                }
+            });
+        }
+
+        std::vector<std::vector<U32>> latencies(THREADS);
+        std::vector<std::thread> producers;
+        for (U32 thread = 0; thread < THREADS; thread++) {
+            producers.emplace_back([&latencies, thread, THREADS, CALLS, PERIOD]() {
+                std::vector<U32>& mine = latencies[thread];
+                mine.reserve(CALLS);
+                auto next = std::chrono::steady_clock::now() + PERIOD * thread / THREADS;
+                for (U32 call = 0; call < CALLS; call++) {
+                    std::this_thread::sleep_until(next);
+                    next += PERIOD;
+                    const auto start = std::chrono::steady_clock::now();
+                    Fw::Logger::log("Command %s opcode 0x%" PRIx32 " sequence %" PRIu32 " took %.3f ms\n",
+                                    "SEND_FILE", 0x501u + thread, call, 1.25 * call);
+                    mine.push_back(static_cast<U32>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start)
+                            .count()));
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        if (deferred) {
+            {
+                std::lock_guard<std::mutex> lock(listener.m_mutex);
+                done = true;
+            }
+            listener.logRingReady();
+            consumer.join();
+            Fw::Logger::registerRing(nullptr);
+        }
+
+        std::vector<U32> all;
+        for (const std::vector<U32>& mine : latencies) {
+            all.insert(all.end(), mine.begin(), mine.end());
+        }
+        std::sort(all.begin(), all.end());
+        U64 total = 0;
+        for (U32 latency : all) {
+            total += latency;
+        }
+        printf("%s: %zu calls, mean %" PRIu64 " ns, median %" PRIu32 " ns, p99 %" PRIu32 " ns, p99.9 %" PRIu32
+               " ns, max %" PRIu32 " ns, %" PRIu32 " dropped\n",
+               deferred ? "deferred" : "in caller", all.size(), total / all.size(), all[all.size() / 2],
+               all[all.size() * 99 / 100], all[all.size() * 999 / 1000], all.back(), ring.getDrops());
+    }
+    Fw::Logger::registerLogger(nullptr);
+}
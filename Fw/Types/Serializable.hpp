@@ -252,18 +252,24 @@ class ExternalSerializeBufferWithDataCopy final : public ExternalSerializeBuffer
 //! Use this when the object esb1 on the left-hand side of an assignment esb1 = esb2
 //! has an invalid buffer, and you want to move the buffer of esb2 into it.
 //! In this case there should usually be no more uses of esb2 after the assignment.
+//! Copy construction and assignment also carry over the serialization state, so the buffer may be returned by value.
 class ExternalSerializeBufferWithMemberCopy final : public ExternalSerializeBuffer {
   public:
     ExternalSerializeBufferWithMemberCopy(U8* buffPtr, Serializable::SizeType size)
         : ExternalSerializeBuffer(buffPtr, size) {}
     ExternalSerializeBufferWithMemberCopy() : ExternalSerializeBuffer() {}
     ~ExternalSerializeBufferWithMemberCopy() {}
-    explicit ExternalSerializeBufferWithMemberCopy(const ExternalSerializeBufferWithMemberCopy& src)
-        : ExternalSerializeBuffer(src.m_buff, src.m_buffSize) {}
+    ExternalSerializeBufferWithMemberCopy(const ExternalSerializeBufferWithMemberCopy& src)
+        : ExternalSerializeBuffer(src.m_buff, src.m_buffSize) {
+        (void)this->setBuffLen(src.getBuffLength());
+        (void)this->deserializeSkip(src.getBuffLength() - src.getBuffLeft());
+    }
     ExternalSerializeBufferWithMemberCopy& operator=(const ExternalSerializeBufferWithMemberCopy& src) {
         // Ward against self-assignment
         if (this != &src) {
             this->setExtBuffer(src.m_buff, src.m_buffSize);
+            (void)this->setBuffLen(src.getBuffLength());
+            (void)this->deserializeSkip(src.getBuffLength() - src.getBuffLeft());
         }
         return *this;
     }
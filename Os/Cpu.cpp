@@ -32,6 +32,22 @@ Cpu::Status Cpu::_getTicks(Ticks& ticks, FwSizeType cpu_index) {
     return this->m_delegate._getTicks(ticks, cpu_index);
 }
 
+Cpu::Status Cpu::_getAllTicks(Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<CpuInterface*>(&this->m_handle_storage[0]));
+    FW_ASSERT((ticks != nullptr) || (capacity == 0));
+    return this->m_delegate._getAllTicks(ticks, capacity, cpu_count);
+}
+
+Cpu::Status Cpu::_getTaskTicks(Ticks& ticks, Os::Task& task) {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<CpuInterface*>(&this->m_handle_storage[0]));
+    return this->m_delegate._getTaskTicks(ticks, task);
+}
+
+Cpu::Status Cpu::_getTaskSwitches(TaskSwitches& switches, Os::Task& task) {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<CpuInterface*>(&this->m_handle_storage[0]));
+    return this->m_delegate._getTaskSwitches(switches, task);
+}
+
 CpuHandle* Cpu::getHandle() {
     FW_ASSERT(&this->m_delegate == reinterpret_cast<CpuInterface*>(&this->m_handle_storage[0]));
     return this->m_delegate.getHandle();
@@ -44,4 +60,16 @@ Cpu::Status Cpu::getCount(FwSizeType& cpu_count) {
 Cpu::Status Cpu::getTicks(Ticks& ticks, FwSizeType cpu_index) {
     return Cpu::getSingleton()._getTicks(ticks, cpu_index);
 }
+
+Cpu::Status Cpu::getAllTicks(Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) {
+    return Cpu::getSingleton()._getAllTicks(ticks, capacity, cpu_count);
+}
+
+Cpu::Status Cpu::getTaskTicks(Ticks& ticks, Os::Task& task) {
+    return Cpu::getSingleton()._getTaskTicks(ticks, task);
+}
+
+Cpu::Status Cpu::getTaskSwitches(TaskSwitches& switches, Os::Task& task) {
+    return Cpu::getSingleton()._getTaskSwitches(switches, task);
+}
 }
@@ -3,6 +3,7 @@
 // \brief common function definitions for Os::Cpu
 // ======================================================================
 #include "Os/Os.hpp"
+#include "Os/Task.hpp"
 
 #ifndef OS_CPU_HPP_
 #define OS_CPU_HPP_
@@ -18,6 +19,12 @@ class CpuInterface {
     using Status = Os::Generic::Status;
     using Ticks = Os::Generic::UsedTotal;
 
+    //! \brief accumulated context switches of a task
+    struct TaskSwitches {
+        FwSizeType voluntary;    //!< switches where the task blocked or yielded
+        FwSizeType involuntary;  //!< switches where the task was preempted
+    };
+
     //! Default constructor
     CpuInterface() = default;
     //! Default destructor
@@ -48,6 +55,40 @@ class CpuInterface {
     //!
     virtual Status _getTicks(Ticks& ticks, FwSizeType cpu_index) = 0;
 
+    //! \brief Get the CPU tick information for all CPUs from a single sample
+    //!
+    //! Fills ticks[i] for each CPU i below both capacity and the CPU count. Sampling all CPUs at once is cheaper
+    //! than calling getTicks per CPU and keeps the CPUs consistent with each other.
+    //!
+    //! \param ticks: (output) array filled with the tick information of each CPU
+    //! \param capacity: number of entries in ticks
+    //! \param cpu_count: (output) number of CPUs in the sample, may exceed capacity
+    //! \return:  ERROR when error occurs, OK otherwise.
+    //!
+    virtual Status _getAllTicks(Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) = 0;
+
+    //! \brief Get the CPU tick information of a started task
+    //!
+    //! Used holds the processor time consumed by the task, total the elapsed time in the same units. As with
+    //! getTicks the values accumulate and the caller differences samples, giving the share of a single CPU.
+    //!
+    //! \param ticks: (output) filled with the tick information for the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    virtual Status _getTaskTicks(Ticks& ticks, Os::Task& task) = 0;
+
+    //! \brief Get the context switch counts of a started task
+    //!
+    //! Counts accumulate over the life of the task. Many involuntary switches indicate a task that is starved of the
+    //! CPU, many voluntary switches a task that blocks often.
+    //!
+    //! \param switches: (output) filled with the context switch counts of the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    virtual Status _getTaskSwitches(TaskSwitches& switches, Os::Task& task) = 0;
+
     //! \brief return the underlying cpu handle (implementation specific).
     //! \return internal task handle representation
     virtual CpuHandle* getHandle() = 0;
@@ -110,6 +151,37 @@ class Cpu final : public CpuInterface {
     //!
     Status _getTicks(Ticks& ticks, FwSizeType cpu_index) override;
 
+    //! \brief Get the CPU tick information for all CPUs from a single sample
+    //!
+    //! This method wraps delegates to the underlying implementation.
+    //!
+    //! \param ticks: (output) array filled with the tick information of each CPU
+    //! \param capacity: number of entries in ticks
+    //! \param cpu_count: (output) number of CPUs in the sample, may exceed capacity
+    //! \return:  ERROR when error occurs, OK otherwise.
+    //!
+    Status _getAllTicks(Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) override;
+
+    //! \brief Get the CPU tick information of a started task
+    //!
+    //! This method wraps delegates to the underlying implementation.
+    //!
+    //! \param ticks: (output) filled with the tick information for the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    Status _getTaskTicks(Ticks& ticks, Os::Task& task) override;
+
+    //! \brief Get the context switch counts of a started task
+    //!
+    //! This method wraps delegates to the underlying implementation.
+    //!
+    //! \param switches: (output) filled with the context switch counts of the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    Status _getTaskSwitches(TaskSwitches& switches, Os::Task& task) override;
+
     //! \brief return the underlying cpu handle (implementation specific).
     //! \return internal task handle representation
     CpuHandle* getHandle() override;
@@ -140,6 +212,37 @@ class Cpu final : public CpuInterface {
     //!
     static Status getTicks(Ticks& ticks, FwSizeType cpu_index);
 
+    //! \brief Get the CPU tick information for all CPUs from a single sample
+    //!
+    //! This method wraps a singleton implementation.
+    //!
+    //! \param ticks: (output) array filled with the tick information of each CPU
+    //! \param capacity: number of entries in ticks
+    //! \param cpu_count: (output) number of CPUs in the sample, may exceed capacity
+    //! \return:  ERROR when error occurs, OK otherwise.
+    //!
+    static Status getAllTicks(Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count);
+
+    //! \brief Get the CPU tick information of a started task
+    //!
+    //! This method wraps a singleton implementation.
+    //!
+    //! \param ticks: (output) filled with the tick information for the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    static Status getTaskTicks(Ticks& ticks, Os::Task& task);
+
+    //! \brief Get the context switch counts of a started task
+    //!
+    //! This method wraps a singleton implementation.
+    //!
+    //! \param switches: (output) filled with the context switch counts of the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    static Status getTaskSwitches(TaskSwitches& switches, Os::Task& task);
+
   private:
 
     // This section is used to store the implementation-defined file handle. To Os::File and fprime, this type is
@@ -9,6 +9,7 @@
 #include <mach/mach_init.h>
 #include <mach/mach_types.h>
 #include <mach/message.h>
+#include <mach/vm_map.h>
 
 namespace Os {
 namespace Darwin {
@@ -84,6 +85,40 @@ CpuInterface::Status DarwinCpu::_getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_
     return Status::ERROR;
 }
 
+CpuInterface::Status DarwinCpu::_getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) {
+    processor_cpu_load_info_t cpu_load_info;
+    if (KERN_SUCCESS != cpu_data_helper(cpu_load_info, cpu_count)) {
+        cpu_count = 0;
+        return Status::ERROR;
+    }
+    for (FwSizeType cpu_index = 0; (cpu_index < cpu_count) && (cpu_index < capacity); cpu_index++) {
+        const processor_cpu_load_info& per_cpu_info = cpu_load_info[cpu_index];
+        ticks[cpu_index].total = 0;
+        for (FwSizeType i = 0; i < CPU_STATE_MAX; i++) {
+            ticks[cpu_index].total += per_cpu_info.cpu_ticks[i];
+        }
+        ticks[cpu_index].used = ticks[cpu_index].total - per_cpu_info.cpu_ticks[CPU_STATE_IDLE];
+    }
+    // host_processor_info allocates the sample in the caller's address space
+    (void)vm_deallocate(mach_task_self(), reinterpret_cast<vm_address_t>(cpu_load_info),
+                        static_cast<vm_size_t>(cpu_count * sizeof(processor_cpu_load_info)));
+    return Status::OP_OK;
+}
+
+CpuInterface::Status DarwinCpu::_getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) {
+    // Per-thread accounting is not implemented on Darwin
+    ticks.total = 1;
+    ticks.used = 1;
+    return Status::ERROR;
+}
+
+CpuInterface::Status DarwinCpu::_getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) {
+    // Per-thread accounting is not implemented on Darwin
+    switches.voluntary = 0;
+    switches.involuntary = 0;
+    return Status::ERROR;
+}
+
 CpuHandle* DarwinCpu::getHandle() {
     return &this->m_handle;
 }
@@ -62,6 +62,31 @@ class DarwinCpu : public CpuInterface {
     //!
     Status _getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_index) override;
 
+    //! \brief Get the CPU tick information for all CPUs from a single sample
+    //!
+    //! \param ticks: (output) array filled with the tick information of each CPU
+    //! \param capacity: number of entries in ticks
+    //! \param cpu_count: (output) number of CPUs in the sample, may exceed capacity
+    //! \return:  ERROR when error occurs, OK otherwise.
+    //!
+    Status _getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) override;
+
+    //! \brief Get the CPU tick information of a started task
+    //!
+    //! \param ticks: (output) filled with the tick information for the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    Status _getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) override;
+
+    //! \brief Get the context switch counts of a started task
+    //!
+    //! \param switches: (output) filled with the context switch counts of the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    Status _getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) override;
+
     //! \brief returns the raw console handle
     //!
     //! Gets the raw console handle from the implementation. Note: users must include the implementation specific
@@ -181,6 +181,20 @@ File::Status File::write(const U8* buffer, FwSignedSizeType &size, File::WaitTyp
     return this->m_delegate.write(buffer, size, wait);
 }
 
+File::Status File::copyFrom(FileInterface& source, FwSignedSizeType size) {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<FileInterface*>(&this->m_handle_storage[0]));
+    FW_ASSERT(&source != this);
+    FW_ASSERT(size >= 0);
+    FW_ASSERT(this->m_mode < Mode::MAX_OPEN_MODE);
+    // Check that the file is open before attempting operation
+    if (OPEN_NO_MODE == this->m_mode) {
+        return File::Status::NOT_OPENED;
+    } else if (OPEN_READ == this->m_mode) {
+        return File::Status::INVALID_MODE;
+    }
+    return this->m_delegate.copyFrom(source, size);
+}
+
 FileHandle* File::getHandle() {
     FW_ASSERT(&this->m_delegate == reinterpret_cast<FileInterface*>(&this->m_handle_storage[0]));
     return this->m_delegate.getHandle();
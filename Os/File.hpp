@@ -176,6 +176,21 @@ namespace Os {
             //!
             virtual Status write(const U8* buffer, FwSignedSizeType &size, WaitType wait) = 0;
 
+            //! \brief copy data from another open file into this file using an implementation-specific fast path
+            //!
+            //! Copy `size` bytes from the current position of `source` to this file, advancing both file pointers.
+            //! `source` is a file of this same implementation, as are all files of a build. Implementations without
+            //! a fast path return `NOT_SUPPORTED` without touching either file, and callers then copy the data with
+            //! `read` and `write`.
+            //!
+            //! It is invalid to pass a negative `size`.
+            //!
+            //! \param source: file to copy data from, open for reading
+            //! \param size: number of bytes to copy
+            //! \return OP_OK on success, NOT_SUPPORTED without a fast path, otherwise error status
+            //!
+            virtual Status copyFrom(FileInterface& source, FwSignedSizeType size) = 0;
+
             //! \brief returns the raw file handle
             //!
             //! Gets the raw file handle from the implementation. Note: users must include the implementation specific
@@ -424,6 +439,23 @@ namespace Os {
         //!
         Status write(const U8* buffer, FwSignedSizeType &size, WaitType wait) override;
 
+        //! \brief copy data from another open file into this file using an implementation-specific fast path
+        //!
+        //! Copy `size` bytes from the current position of `source` to this file, advancing both file pointers.
+        //! Implementations without a fast path return `NOT_SUPPORTED` without touching either file, and callers then
+        //! copy the data with `read` and `write`. Delegates to the chosen implementation's `copyFrom` function.
+        //!
+        //! This file must be open for writing and `source` open for reading. The CRC state of neither file is
+        //! updated.
+        //!
+        //! It is invalid to pass a negative `size`.
+        //!
+        //! \param source: file to copy data from, open for reading
+        //! \param size: number of bytes to copy
+        //! \return OP_OK on success, NOT_SUPPORTED without a fast path, otherwise error status
+        //!
+        Status copyFrom(FileInterface& source, FwSignedSizeType size) override;
+
         //! \brief returns the raw file handle
         //!
         //! Gets the raw file handle from the implementation. Note: users must include the implementation specific
@@ -285,8 +285,15 @@ FileSystem::Status FileSystem::handleDirectoryError(Directory::Status dirStatus)
 
 FileSystem::Status FileSystem::copyFileData(File& source, File& destination, FwSignedSizeType size) {
     static_assert(FILE_SYSTEM_FILE_CHUNK_SIZE != 0, "FILE_SYSTEM_FILE_CHUNK_SIZE must be >0");
+    // Use the file implementation fast path when it has one
+    File::Status file_status = destination.copyFrom(source, size);
+    if (file_status == File::OP_OK) {
+        return FileSystem::OP_OK;
+    } else if (file_status != File::NOT_SUPPORTED) {
+        return FileSystem::handleFileError(file_status);
+    }
+
     U8 fileBuffer[FILE_SYSTEM_FILE_CHUNK_SIZE];
-    File::Status file_status;
 
     FwSignedSizeType copiedSize = 0;
     FwSignedSizeType chunkSize = FILE_SYSTEM_FILE_CHUNK_SIZE;
@@ -296,8 +296,8 @@ class FileSystem final : public FileSystemInterface {
     
     //! \brief Append the source file to the destination file
     //!
-    //! This function opens both files, and iteratively reads the source by chunks and writes
-    //! chunks to the destination.
+    //! This function opens both files and copies the source to the end of the destination, using
+    //! the Os::File fast path when available and chunked reads and writes otherwise.
     //! If the destination file does not exist and createMissingDest is true, a new file is created.
     //!
     //! It is invalid to pass `nullptr` as either the source or destination path.
@@ -310,8 +310,8 @@ class FileSystem final : public FileSystemInterface {
     
     //! \brief Copy a file from the source path to the destination path
     //!
-    //! This function opens both files, and iteratively reads the source by chunks and writes
-    //! chunks to the destination.
+    //! This function opens both files and copies the source to the destination, using the
+    //! Os::File fast path when available and chunked reads and writes otherwise.
     //!
     //! It is invalid to pass `nullptr` as either the source or destination path.
     //!
@@ -365,6 +365,9 @@ class FileSystem final : public FileSystemInterface {
     //! file to the destination file (replaces/appends to end/etc. depending
     //! on destination file mode).
     //!
+    //! The Os::File fast path (File::copyFrom) is tried first. When it is not
+    //! supported the data is copied in chunks through Os::File.
+    //!
     //! Files must already be open and will remain open after this function
     //! completes.
     //!
@@ -5,7 +5,8 @@
 //         popped off the heap are guaranteed to be in order of decreasing
 //         "value" (max removed first). Items of equal "value" will be
 //         popped off in FIFO order. The performance of both push and pop
-//         is O(log(n)).
+//         is O(log(n)), or O(1) while the values fit in the priority
+//         buckets enabled by FW_QUEUE_PRIORITY_BUCKETS.
 //
 // \copyright
 // Copyright 2009-2015, by the California Institute of Technology.
@@ -20,6 +21,7 @@
 #include "Fw/Types/Assert.hpp"
 
 #include <cstdio>
+#include <limits>
 #include <new>
 
 // Macros for traversing the heap:
@@ -27,22 +29,58 @@
 #define RCHILD(x) (2 * x + 2)
 #define PARENT(x) ((x - 1) / 2)
 
+// Marks the end of a bucket or free list:
+#define NO_NODE (std::numeric_limits<FwSizeType>::max())
+
 namespace Types {
 
+#if FW_QUEUE_PRIORITY_BUCKETS
+static_assert(MaxHeap::BUCKET_LEVELS == 32, "Bucket bitmask is 32 bits wide");
+
+// Index of the highest set bit of a non-zero mask:
+static inline FwSizeType highestLevel(U32 levels) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<FwSizeType>(31 - __builtin_clz(levels));
+#else
+    FwSizeType level = 0;
+    while (levels >>= 1) {
+        level++;
+    }
+    return level;
+#endif
+}
+#endif
+
 MaxHeap::MaxHeap() {
     // Initialize the heap:
     this->m_capacity = 0;
     this->m_heap = nullptr;
     this->m_size = 0;
     this->m_order = 0;
+#if FW_QUEUE_PRIORITY_BUCKETS
+    // Initialize the priority buckets:
+    this->m_nodes = nullptr;
+    this->m_free = NO_NODE;
+    this->m_buckets = nullptr;
+    this->m_levels = 0;
+    this->m_base = 0;
+    this->m_bucketed = false;
+    this->m_allowBuckets = false;
+#endif
 }
 
 MaxHeap::~MaxHeap() {
     delete[] this->m_heap;
     this->m_heap = nullptr;
+#if FW_QUEUE_PRIORITY_BUCKETS
+    delete[] this->m_nodes;
+    this->m_nodes = nullptr;
+    delete[] this->m_buckets;
+    this->m_buckets = nullptr;
+#endif
 }
 
-bool MaxHeap::create(FwSizeType capacity) {
+bool MaxHeap::create(FwSizeType capacity, Mode mode) {
     FW_ASSERT(this->m_heap == nullptr);
     // Loop bounds will overflow if capacity set to the max allowable value
     FW_ASSERT(capacity < std::numeric_limits<FwSizeType>::max());
@@ -50,6 +88,35 @@ bool MaxHeap::create(FwSizeType capacity) {
     if (nullptr == this->m_heap) {
         return false;
     }
+#if FW_QUEUE_PRIORITY_BUCKETS
+    if (mode == AUTOMATIC) {
+        this->m_nodes = new (std::nothrow) BucketNode[capacity];
+        this->m_buckets = new (std::nothrow) Bucket[BUCKET_LEVELS];
+        if ((nullptr == this->m_nodes) || (nullptr == this->m_buckets)) {
+            delete[] this->m_heap;
+            this->m_heap = nullptr;
+            delete[] this->m_nodes;
+            this->m_nodes = nullptr;
+            delete[] this->m_buckets;
+            this->m_buckets = nullptr;
+            return false;
+        }
+        for (FwSizeType level = 0; level < BUCKET_LEVELS; level++) {
+            this->m_buckets[level].head = NO_NODE;
+            this->m_buckets[level].tail = NO_NODE;
+        }
+        // Chain all nodes into the free list:
+        for (FwSizeType i = 0; i < capacity; i++) {
+            this->m_nodes[i].next = (i + 1 < capacity) ? (i + 1) : NO_NODE;
+        }
+        this->m_free = (capacity > 0) ? 0 : NO_NODE;
+        this->m_allowBuckets = true;
+        this->m_bucketed = true;
+    }
+#else
+    // Without priority buckets, the binary heap is always used
+    (void)mode;
+#endif
     this->m_capacity = capacity;
     return true;
 }
@@ -60,6 +127,133 @@ bool MaxHeap::push(FwQueuePriorityType value, FwSizeType id) {
         return false;
     }
 
+#if FW_QUEUE_PRIORITY_BUCKETS
+    if (this->m_bucketed) {
+        // An empty heap can move its window to any value:
+        if (this->m_size == 0) {
+            this->rebase(value);
+        }
+        if (this->inWindow(value)) {
+            this->pushBucket(value, id);
+            ++this->m_size;
+            return true;
+        }
+        // Value does not fit, fall back to the binary heap:
+        this->moveBucketsToHeap();
+    }
+#endif
+    this->pushHeap(value, id);
+    return true;
+}
+
+bool MaxHeap::pop(FwQueuePriorityType& value, FwSizeType& id) {
+    // If there is nothing in the heap then
+    // return false:
+    if (this->isEmpty()) {
+        return false;
+    }
+
+#if FW_QUEUE_PRIORITY_BUCKETS
+    if (this->m_bucketed) {
+        this->popBucket(value, id);
+        --this->m_size;
+        return true;
+    }
+#endif
+    this->popHeap(value, id);
+#if FW_QUEUE_PRIORITY_BUCKETS
+    // Once drained, go back to the priority buckets:
+    if ((this->m_size == 0) && this->m_allowBuckets) {
+        this->m_bucketed = true;
+    }
+#endif
+    return true;
+}
+
+#if FW_QUEUE_PRIORITY_BUCKETS
+
+bool MaxHeap::inWindow(FwQueuePriorityType value) const {
+    // The window is placed so that the upper bound does not overflow:
+    return (value >= this->m_base) &&
+           (value <= static_cast<FwQueuePriorityType>(this->m_base + static_cast<FwQueuePriorityType>(BUCKET_LEVELS - 1)));
+}
+
+void MaxHeap::rebase(FwQueuePriorityType value) {
+    FW_ASSERT(this->m_levels == 0);
+    const FwQueuePriorityType half = static_cast<FwQueuePriorityType>(BUCKET_LEVELS / 2);
+    const FwQueuePriorityType top = static_cast<FwQueuePriorityType>(BUCKET_LEVELS - 1);
+    if (value < static_cast<FwQueuePriorityType>(std::numeric_limits<FwQueuePriorityType>::min() + half)) {
+        this->m_base = std::numeric_limits<FwQueuePriorityType>::min();
+    } else if (value > static_cast<FwQueuePriorityType>(std::numeric_limits<FwQueuePriorityType>::max() - top)) {
+        this->m_base = static_cast<FwQueuePriorityType>(std::numeric_limits<FwQueuePriorityType>::max() - top);
+    } else {
+        this->m_base = static_cast<FwQueuePriorityType>(value - half);
+    }
+}
+
+void MaxHeap::pushBucket(FwQueuePriorityType value, FwSizeType id) {
+    const FwSizeType level = static_cast<FwSizeType>(value - this->m_base);
+    FW_ASSERT(level < BUCKET_LEVELS, static_cast<FwAssertArgType>(level));
+    // Take a node from the free list, which cannot be empty when not full:
+    const FwSizeType node = this->m_free;
+    FW_ASSERT(node < this->m_capacity, static_cast<FwAssertArgType>(node));
+    this->m_free = this->m_nodes[node].next;
+
+    // Append to the end of the bucket to keep it FIFO:
+    this->m_nodes[node].id = id;
+    this->m_nodes[node].next = NO_NODE;
+    if (this->m_buckets[level].tail == NO_NODE) {
+        this->m_buckets[level].head = node;
+        this->m_levels |= (static_cast<U32>(1) << level);
+    } else {
+        this->m_nodes[this->m_buckets[level].tail].next = node;
+    }
+    this->m_buckets[level].tail = node;
+}
+
+void MaxHeap::popBucket(FwQueuePriorityType& value, FwSizeType& id) {
+    FW_ASSERT(this->m_levels != 0);
+    const FwSizeType level = highestLevel(this->m_levels);
+    const FwSizeType node = this->m_buckets[level].head;
+    FW_ASSERT(node < this->m_capacity, static_cast<FwAssertArgType>(node));
+
+    value = static_cast<FwQueuePriorityType>(this->m_base + static_cast<FwQueuePriorityType>(level));
+    id = this->m_nodes[node].id;
+
+    // Unlink the node and return it to the free list:
+    this->m_buckets[level].head = this->m_nodes[node].next;
+    if (this->m_buckets[level].head == NO_NODE) {
+        this->m_buckets[level].tail = NO_NODE;
+        this->m_levels &= ~(static_cast<U32>(1) << level);
+    }
+    this->m_nodes[node].next = this->m_free;
+    this->m_free = node;
+}
+
+void MaxHeap::moveBucketsToHeap() {
+    const FwSizeType count = this->m_size;
+    this->m_size = 0;
+    this->m_bucketed = false;
+    // Each bucket is walked oldest first, so the heap order keeps it FIFO:
+    for (FwSizeType level = 0; level < BUCKET_LEVELS; level++) {
+        FwSizeType node = this->m_buckets[level].head;
+        while (node != NO_NODE) {
+            const FwSizeType next = this->m_nodes[node].next;
+            this->pushHeap(static_cast<FwQueuePriorityType>(this->m_base + static_cast<FwQueuePriorityType>(level)),
+                           this->m_nodes[node].id);
+            this->m_nodes[node].next = this->m_free;
+            this->m_free = node;
+            node = next;
+        }
+        this->m_buckets[level].head = NO_NODE;
+        this->m_buckets[level].tail = NO_NODE;
+    }
+    this->m_levels = 0;
+    FW_ASSERT(this->m_size == count, static_cast<FwAssertArgType>(this->m_size), static_cast<FwAssertArgType>(count));
+}
+#endif
+
+void MaxHeap::pushHeap(FwQueuePriorityType value, FwSizeType id) {
     // Heap indexes:
     FwSizeType parent;
     FwSizeType index = this->m_size;
@@ -99,16 +293,9 @@ bool MaxHeap::push(FwQueuePriorityType value, FwSizeType id) {
 
     ++this->m_size;
     ++this->m_order;
-    return true;
 }
 
-bool MaxHeap::pop(FwQueuePriorityType& value, FwSizeType& id) {
-    // If there is nothing in the heap then
-    // return false:
-    if (this->isEmpty()) {
-        return false;
-    }
-
+void MaxHeap::popHeap(FwQueuePriorityType& value, FwSizeType& id) {
     // Set the return values to the top (max) of
     // the heap:
     value = this->m_heap[0].value;
@@ -127,7 +314,6 @@ bool MaxHeap::pop(FwQueuePriorityType& value, FwSizeType& id) {
     // need to reorganize the heap to restore it's
     // heapy-ness.
     this->heapify();
-    return true;
 }
 
 // Is the heap full:
@@ -24,9 +24,26 @@ namespace Types {
 //! be popped off the heap first. Items of equal value will be popped
 //! off in FIFO order. Insertion and deletion from the heap are both
 //! O(log(n)) time.
+//!
+//! Most queues only see a handful of distinct priorities. While every
+//! stored value falls within a window of BUCKET_LEVELS consecutive
+//! priorities, items are kept in one FIFO list per priority and a
+//! bitmask of non-empty priorities, making insertion and deletion O(1).
+//! Pushing a value outside the window moves the items to the binary
+//! heap, which is used until the heap is next empty. The priority
+//! buckets are compiled in only if FW_QUEUE_PRIORITY_BUCKETS is set.
 //! \warning allocates memory on the heap
 class MaxHeap {
   public:
+    //! Number of consecutive priorities handled by the bucketed mode
+    static const FwSizeType BUCKET_LEVELS = 32;
+
+    //! Selection of the storage used for the items
+    enum Mode {
+        AUTOMATIC,  //!< use priority buckets while the values fit, if FW_QUEUE_PRIORITY_BUCKETS is set
+        HEAP_ONLY   //!< always use the binary heap
+    };
+
     //! \brief MaxHeap constructor
     //!
     //! Create a max heap object
@@ -43,8 +60,9 @@ class MaxHeap {
     //! \warning allocates memory on the heap
     //!
     //! \param capacity the maximum number of elements to store in the heap
+    //! \param mode selection of the storage used for the items
     //!
-    bool create(FwSizeType capacity);
+    bool create(FwSizeType capacity, Mode mode = AUTOMATIC);
     //! \brief Push an item onto the heap.
     //!
     //! The item will be put into the heap according to its value. The
@@ -86,6 +104,22 @@ class MaxHeap {
 
   private:
     // Private functions:
+    // Push an item onto the binary heap:
+    void pushHeap(FwQueuePriorityType value, FwSizeType id);
+    // Pop an item from the binary heap:
+    void popHeap(FwQueuePriorityType& value, FwSizeType& id);
+#if FW_QUEUE_PRIORITY_BUCKETS
+    // Is the value within the priority bucket window:
+    bool inWindow(FwQueuePriorityType value) const;
+    // Center the priority bucket window on a value:
+    void rebase(FwQueuePriorityType value);
+    // Push an item onto its priority bucket:
+    void pushBucket(FwQueuePriorityType value, FwSizeType id);
+    // Pop an item from the highest non-empty priority bucket:
+    void popBucket(FwQueuePriorityType& value, FwSizeType& id);
+    // Move all items from the priority buckets to the binary heap:
+    void moveBucketsToHeap();
+#endif
     // Ensure the heap meets the heap property:
     void heapify();
     // Swap two elements on the heap:
@@ -100,11 +134,35 @@ class MaxHeap {
         FwSizeType id;              // unique id for this node
     };
 
+#if FW_QUEUE_PRIORITY_BUCKETS
+    // The data structure for an item in a priority bucket:
+    struct BucketNode {
+        FwSizeType id;    // unique id for this node
+        FwSizeType next;  // next node in the bucket or free list
+    };
+
+    // The data structure for a priority bucket:
+    struct Bucket {
+        FwSizeType head;  // oldest node of the bucket
+        FwSizeType tail;  // newest node of the bucket
+    };
+#endif
+
     // Private members:
     Node* m_heap;           // the heap itself
     FwSizeType m_size;      // the current size of the heap
     FwSizeType m_order;     // the current count of heap pushes
     FwSizeType m_capacity;  // the maximum capacity of the heap
+
+#if FW_QUEUE_PRIORITY_BUCKETS
+    BucketNode* m_nodes;                  // node storage for the priority buckets
+    FwSizeType m_free;                    // first free node
+    Bucket* m_buckets;                    // the priority buckets, allocated to keep queue handles small
+    U32 m_levels;                         // bitmask of non-empty priority buckets
+    FwQueuePriorityType m_base;           // priority of the lowest bucket
+    bool m_bucketed;                      // are items currently stored in the priority buckets
+    bool m_allowBuckets;                  // may the priority buckets be used
+#endif
 };
 
 }  // namespace Types
@@ -1,6 +1,8 @@
 #include "Os/Generic/Types/MaxHeap.hpp"
 #include <gtest/gtest.h>
+#include <chrono>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 
 
@@ -213,6 +215,96 @@ TEST(Nominal, PushPop) {
     printf("Passed.\n");
 }
 
+TEST(Nominal, BucketFallback) {
+    // A heap starting with close priorities must keep FIFO order when a
+    // far away priority forces it off the priority buckets
+    Types::MaxHeap heap;
+    ASSERT_TRUE(heap.create(DEPTH));
+    FwQueuePriorityType value;
+    FwSizeType id;
+
+    ASSERT_TRUE(heap.push(1, 10));
+    ASSERT_TRUE(heap.push(2, 20));
+    ASSERT_TRUE(heap.push(1, 11));
+    ASSERT_TRUE(heap.push(1000, 30));
+    ASSERT_TRUE(heap.push(1, 12));
+    ASSERT_FALSE(heap.push(1, 13));
+
+    const FwQueuePriorityType values[DEPTH] = {1000, 2, 1, 1, 1};
+    const FwSizeType ids[DEPTH] = {30, 20, 10, 11, 12};
+    for (FwSizeType ii = 0; ii < DEPTH; ++ii) {
+        ASSERT_TRUE(heap.pop(value, id));
+        ASSERT_EQ(value, values[ii]);
+        ASSERT_EQ(id, ids[ii]);
+    }
+    ASSERT_FALSE(heap.pop(value, id));
+
+    // Once drained, a new window is chosen around the next push
+    ASSERT_TRUE(heap.push(5000, 1));
+    ASSERT_TRUE(heap.push(5010, 2));
+    ASSERT_TRUE(heap.pop(value, id));
+    ASSERT_EQ(value, 5010);
+    ASSERT_EQ(id, 2u);
+}
+
+TEST(Random, MatchesHeapOnly) {
+    // Compare the automatic mode against the binary heap with a mix of
+    // narrow and wide priority ranges
+    const FwSizeType depth = 257;
+    Types::MaxHeap automatic;
+    Types::MaxHeap reference;
+    ASSERT_TRUE(automatic.create(depth));
+    ASSERT_TRUE(reference.create(depth, Types::MaxHeap::HEAP_ONLY));
+    srand(0);
+    FwSizeType next = 0;
+    for (U32 iteration = 0; iteration < 200000; iteration++) {
+        const bool wide = ((iteration / 10000) % 3) == 2;
+        if ((rand() % 2) == 0) {
+            const FwQueuePriorityType priority = static_cast<FwQueuePriorityType>(wide ? (rand() % 1000) : (rand() % 8));
+            ASSERT_EQ(automatic.push(priority, next), reference.push(priority, next));
+            next++;
+        } else {
+            FwQueuePriorityType value1 = 0;
+            FwQueuePriorityType value2 = 0;
+            FwSizeType id1 = 0;
+            FwSizeType id2 = 0;
+            const bool popped = reference.pop(value2, id2);
+            ASSERT_EQ(automatic.pop(value1, id1), popped);
+            if (popped) {
+                ASSERT_EQ(value1, value2);
+                ASSERT_EQ(id1, id2);
+            }
+        }
+        ASSERT_EQ(automatic.getSize(), reference.getSize());
+    }
+}
+
+// Push/pop cost of both modes, run with --gtest_also_run_disabled_tests
+TEST(Benchmark, DISABLED_PushPop) {
+    const U32 rounds = 20;
+    for (FwSizeType depth = 16; depth <= 65536; depth *= 4) {
+        for (U32 mode = 0; mode < 2; mode++) {
+            Types::MaxHeap heap;
+            ASSERT_TRUE(heap.create(depth, (mode == 0) ? Types::MaxHeap::HEAP_ONLY : Types::MaxHeap::AUTOMATIC));
+            FwQueuePriorityType value;
+            FwSizeType id;
+            const auto start = std::chrono::steady_clock::now();
+            for (U32 round = 0; round < rounds; round++) {
+                // fill to depth with 8 distinct priorities, then drain
+                for (FwSizeType ii = 0; ii < depth; ++ii) {
+                    heap.push(static_cast<FwQueuePriorityType>(ii % 8), ii);
+                }
+                while (heap.pop(value, id)) {
+                }
+            }
+            const auto end = std::chrono::steady_clock::now();
+            const F64 nanoseconds = static_cast<F64>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            printf("depth %6lu %-9s %8.1f ns per push/pop\n", static_cast<unsigned long>(depth),
+                   (mode == 0) ? "heap" : "buckets", nanoseconds / static_cast<F64>(depth * rounds));
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
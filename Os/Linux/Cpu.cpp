@@ -4,9 +4,11 @@
 // ======================================================================
 #include <Os/Linux/Cpu.hpp>
 #include <Fw/Types/Assert.hpp>
-#include <Fw/Types/StringUtils.hpp>
-#include <Os/File.hpp>
+#include <sys/times.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <cerrno>
+#include <cstdio>
 #include <cstring>
 namespace Os {
 namespace Linux {
@@ -19,61 +21,233 @@ namespace Cpu {
 // cpu1 74237 650 24059 2109680 2995 2447 667 93 0 0
 // cpu2 69388 630 22033 2115177 4428 2424 649 378 0 0
 // cpu3 59199 209 20462 2127387 3981 2363 1024 108 0 0
-// ...
+// intr ...
+//
+// Offline CPUs have no line, so the CPU index is taken from the line and not from its position.
 
 // Needed format, and compliant with kernel < 2.5
 enum ProcCpuMeasures {
-    CPU_NUMBER = 0,
-    USER = 1,
-    NICE = 2,
-    SYSTEM = 3,
-    IDLE = 4,
-    MAX_CPU_TICK_TYPES = 8
+    USER = 0,
+    NICE = 1,
+    SYSTEM = 2,
+    IDLE = 3,
+    MAX_CPU_TICK_TYPES = 4
 };
 
+// Proc FS /proc/self/task/<tid>/stat fields following the ")" closing the command name, which may contain spaces
+enum ProcTaskMeasures {
+    UTIME = 11,
+    STIME = 12,
+    MAX_TASK_TICK_TYPES = 13
+};
 
-using ProcCpuData = FwSizeType[ProcCpuMeasures::MAX_CPU_TICK_TYPES];
 constexpr FwSizeType LINE_SIZE = 255; // log10(max(U64)) * 11 fields (kernel 2.6.33) = 220. Round to 256 - 1 (\0)
+constexpr FwSizeType READ_CHUNK_SIZE = 4096;
+constexpr char PROC_STAT_PATH[] = "/proc/stat";
+
+//! \brief parse an unsigned decimal number, skipping leading blanks
+//!
+//! \param cursor: position to parse from, moved past the number
+//! \param end: end of the parsed region
+//! \param value: (output) parsed number
+//! \return true when a number was found
+bool parse_number(const char*& cursor, const char* end, FwSizeType& value) {
+    while ((cursor < end) && ((*cursor == ' ') || (*cursor == '\t'))) {
+        cursor++;
+    }
+    if ((cursor == end) || (*cursor < '0') || (*cursor > '9')) {
+        return false;
+    }
+    value = 0;
+    while ((cursor < end) && (*cursor >= '0') && (*cursor <= '9')) {
+        value = value * 10 + static_cast<FwSizeType>(*cursor - '0');
+        cursor++;
+    }
+    return true;
+}
 
-CpuInterface::Status getCpuData(FwSizeType cpu_index, ProcCpuData data) {
-    Os::File file;
-    // Open the procfs file
-    constexpr char PROC_STAT_PATH[] = "/proc/stat";
-    if (file.open(PROC_STAT_PATH, Os::File::Mode::OPEN_READ) != Os::File::Status::OP_OK) {
-
-        return CpuInterface::Status::ERROR;
-    }
-    char proc_stat_line[LINE_SIZE + 1];
-    // File starts with cpu line, then individual CPUs.
-    for (FwSizeType i = 0; i < cpu_index + 2; i++) {
-        FwSignedSizeType read_size = sizeof proc_stat_line - 1;
-        Os::File::Status file_status = file.readline(reinterpret_cast<U8*>(proc_stat_line), read_size,
-                                                     Os::File::WaitType::NO_WAIT);
-        proc_stat_line[read_size + 1] = '\0'; // Null terminate
-        if (file_status != Os::File::Status::OP_OK) {
-            return CpuInterface::Status::ERROR;
+//! \brief read a whole (small) file into a buffer with a single pread
+//!
+//! \return number of bytes read, or -1 on error
+ssize_t read_small_file(PlatformIntType fd, char* buffer, FwSizeType size) {
+    ssize_t read_size = 0;
+    do {
+        read_size = ::pread(fd, buffer, size, 0);
+    } while ((read_size < 0) && (errno == EINTR));
+    return read_size;
+}
+
+LinuxCpu::LinuxCpu() {
+    // Opened eagerly so the first sample does not pay for the open. Failure is retried on the next sample.
+    (void)this->getStatFd();
+}
+
+LinuxCpu::~LinuxCpu() {
+    if (this->m_handle.m_stat_fd != LinuxCpuHandle::INVALID_FILE_DESCRIPTOR) {
+        (void)::close(this->m_handle.m_stat_fd);
+        this->m_handle.m_stat_fd = LinuxCpuHandle::INVALID_FILE_DESCRIPTOR;
+    }
+}
+
+PlatformIntType LinuxCpu::getStatFd() {
+    if (this->m_handle.m_stat_fd == LinuxCpuHandle::INVALID_FILE_DESCRIPTOR) {
+        this->m_handle.m_stat_fd = ::open(PROC_STAT_PATH, O_RDONLY | O_CLOEXEC);
+    }
+    return this->m_handle.m_stat_fd;
+}
+
+CpuInterface::Status LinuxCpu::parseStat(PlatformIntType fd, Os::Cpu::Ticks* ticks, FwSizeType first_index,
+                                         FwSizeType capacity, FwSizeType& cpu_count) {
+    // Chunk plus room for a partial line carried over from the previous chunk
+    char buffer[READ_CHUNK_SIZE + LINE_SIZE];
+    FwSizeType carried = 0;
+    off_t offset = 0;
+    bool found = false;
+    bool done = false;
+    cpu_count = 0;
+    while (true) {
+        ssize_t read_size = 0;
+        do {
+            read_size = ::pread(fd, buffer + carried, READ_CHUNK_SIZE, offset);
+        } while ((read_size < 0) && (errno == EINTR));
+        if (read_size < 0) {
+            return Status::ERROR;
+        }
+        offset += read_size;
+        // End of file terminates the last line
+        const bool end_of_file = (read_size == 0);
+        const char* const end = buffer + carried + read_size;
+        const char* line = buffer;
+        while (not done) {
+            const char* line_end = static_cast<const char*>(::memchr(line, '\n', static_cast<size_t>(end - line)));
+            if (line_end == nullptr) {
+                if (end_of_file and (line != end)) {
+                    line_end = end;
+                } else {
+                    break;
+                }
+            }
+            // The cpu lines come first, parsing stops at the first other line
+            if ((line_end - line < 3) || (::strncmp(line, "cpu", 3) != 0)) {
+                done = true;
+                break;
+            }
+            const char* cursor = line + 3;
+            FwSizeType cpu_index = 0;
+            // "cpu " is the aggregate of all CPUs
+            if ((cursor < line_end) && (*cursor >= '0') && (*cursor <= '9') &&
+                parse_number(cursor, line_end, cpu_index)) {
+                FwSizeType data[ProcCpuMeasures::MAX_CPU_TICK_TYPES];
+                FwSizeType measure = 0;
+                for (; measure < ProcCpuMeasures::MAX_CPU_TICK_TYPES; measure++) {
+                    if (not parse_number(cursor, line_end, data[measure])) {
+                        break;
+                    }
+                }
+                if (measure != ProcCpuMeasures::MAX_CPU_TICK_TYPES) {
+                    return Status::ERROR;
+                }
+                if ((cpu_index >= first_index) && ((cpu_index - first_index) < capacity)) {
+                    Os::Cpu::Ticks& cpu_ticks = ticks[cpu_index - first_index];
+                    cpu_ticks.used = data[ProcCpuMeasures::USER] + data[ProcCpuMeasures::NICE] +
+                                     data[ProcCpuMeasures::SYSTEM];
+                    cpu_ticks.total = cpu_ticks.used + data[ProcCpuMeasures::IDLE];
+                }
+                cpu_count = FW_MAX(cpu_count, cpu_index + 1);
+                found = true;
+            }
+            line = line_end + 1;
+            if (line_end == end) {
+                break;
+            }
         }
-        // Make sure we've not strayed passed the cpu section
-        if (::strncmp(proc_stat_line, "cpu", 3) != 0) {
-            return CpuInterface::Status::ERROR;
+        if (done or end_of_file) {
+            break;
         }
+        // Carry the partial line to the front of the buffer
+        carried = static_cast<FwSizeType>(FW_MAX(end - line, 0));
+        if (carried > LINE_SIZE) {
+            return Status::ERROR;
+        }
+        ::memmove(buffer, line, carried);
+    }
+    return found ? Status::OP_OK : Status::ERROR;
+}
+
+CpuInterface::Status LinuxCpu::parseTaskStat(PlatformIntType fd, FwSizeType& used) {
+    // Command name is at most 16 characters, the whole file fits well within the buffer
+    char buffer[1024];
+    const ssize_t read_size = read_small_file(fd, buffer, sizeof buffer);
+    if (read_size <= 0) {
+        return Status::ERROR;
+    }
+    const char* const end = buffer + read_size;
+    const char* cursor = end;
+    while ((cursor > buffer) && (*(cursor - 1) != ')')) {
+        cursor--;
+    }
+    if (cursor == buffer) {
+        return Status::ERROR;
     }
-    char* token_start = proc_stat_line + 3; // Length of "cpu"
-    for (FwSizeType i = 0; i < ProcCpuMeasures::MAX_CPU_TICK_TYPES; i++) {
-        FwSizeType token = 0;
-        Fw::StringUtils::StringToNumberStatus status = Fw::StringUtils::string_to_number(
-            token_start, static_cast<FwSizeType>(sizeof proc_stat_line) - static_cast<FwSizeType>(token_start - proc_stat_line), token, &token_start);
-        // Check conversion success
-        if (status != Fw::StringUtils::StringToNumberStatus::SUCCESSFUL_CONVERSION) {
-            return CpuInterface::Status::ERROR;
+    FwSizeType data[ProcTaskMeasures::MAX_TASK_TICK_TYPES] = {};
+    // Field zero, the state, is a character
+    while ((cursor < end) && (*cursor == ' ')) {
+        cursor++;
+    }
+    while ((cursor < end) && (*cursor != ' ')) {
+        cursor++;
+    }
+    for (FwSizeType measure = 1; measure < ProcTaskMeasures::MAX_TASK_TICK_TYPES; measure++) {
+        // Fields before utime may be negative, skip the sign
+        while ((cursor < end) && ((*cursor == ' ') || (*cursor == '-'))) {
+            cursor++;
+        }
+        if (not parse_number(cursor, end, data[measure])) {
+            return Status::ERROR;
         }
-        data[i] = token;
-        // Check cpu index is correct
-        if (i == ProcCpuMeasures::CPU_NUMBER and data[i] != cpu_index) {
-            return CpuInterface::Status::ERROR;
+    }
+    used = data[ProcTaskMeasures::UTIME] + data[ProcTaskMeasures::STIME];
+    return Status::OP_OK;
+}
+
+CpuInterface::Status LinuxCpu::parseTaskStatus(PlatformIntType fd, Os::Cpu::TaskSwitches& switches) {
+    constexpr char VOLUNTARY[] = "voluntary_ctxt_switches:";
+    constexpr char INVOLUNTARY[] = "nonvoluntary_ctxt_switches:";
+    char buffer[4096];
+    const ssize_t read_size = read_small_file(fd, buffer, sizeof buffer);
+    if (read_size <= 0) {
+        return Status::ERROR;
+    }
+    const char* const end = buffer + read_size;
+    bool found_voluntary = false;
+    bool found_involuntary = false;
+    for (const char* line = buffer; line < end;) {
+        const char* line_end = static_cast<const char*>(::memchr(line, '\n', static_cast<size_t>(end - line)));
+        line_end = (line_end == nullptr) ? end : line_end;
+        const FwSizeType length = static_cast<FwSizeType>(line_end - line);
+        const char* cursor = nullptr;
+        if ((length > sizeof VOLUNTARY - 1) && (::strncmp(line, VOLUNTARY, sizeof VOLUNTARY - 1) == 0)) {
+            cursor = line + sizeof VOLUNTARY - 1;
+            found_voluntary = parse_number(cursor, line_end, switches.voluntary);
+        } else if ((length > sizeof INVOLUNTARY - 1) && (::strncmp(line, INVOLUNTARY, sizeof INVOLUNTARY - 1) == 0)) {
+            cursor = line + sizeof INVOLUNTARY - 1;
+            found_involuntary = parse_number(cursor, line_end, switches.involuntary);
         }
+        line = line_end + 1;
+    }
+    return (found_voluntary and found_involuntary) ? Status::OP_OK : Status::ERROR;
+}
+
+PlatformIntType LinuxCpu::openTaskFile(Os::Task& task, const char* name) {
+    // Task implementations that cannot report a kernel thread id return -1
+    const PlatformIntType thread_id = task.getThreadId();
+    if (thread_id <= 0) {
+        return LinuxCpuHandle::INVALID_FILE_DESCRIPTOR;
     }
-    return CpuInterface::Status::OP_OK;
+    char path[64];
+    (void)::snprintf(path, sizeof path, "/proc/self/task/%d/%s", thread_id, name);
+    const PlatformIntType fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    return (fd < 0) ? LinuxCpuHandle::INVALID_FILE_DESCRIPTOR : fd;
 }
 
 CpuInterface::Status LinuxCpu::_getCount(FwSizeType& cpu_count) {
@@ -87,18 +261,63 @@ CpuInterface::Status LinuxCpu::_getCount(FwSizeType& cpu_count) {
 }
 
 CpuInterface::Status LinuxCpu::_getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_index) {
-    FwSizeType count = 0;
-    CpuInterface::Status status = this->_getCount(count);
-    if (status != CpuInterface::Status::OP_OK) {
+    const PlatformIntType fd = this->getStatFd();
+    if (fd == LinuxCpuHandle::INVALID_FILE_DESCRIPTOR) {
+        return Status::ERROR;
+    }
+    FwSizeType cpu_count = 0;
+    ticks.used = 0;
+    ticks.total = 0;
+    Status status = LinuxCpu::parseStat(fd, &ticks, cpu_index, 1, cpu_count);
+    // Offline or out of range CPU
+    if ((status == Status::OP_OK) && ((cpu_index >= cpu_count) || (ticks.total == 0))) {
+        status = Status::ERROR;
+    }
+    return status;
+}
+
+CpuInterface::Status LinuxCpu::_getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) {
+    cpu_count = 0;
+    const PlatformIntType fd = this->getStatFd();
+    if (fd == LinuxCpuHandle::INVALID_FILE_DESCRIPTOR) {
+        return Status::ERROR;
+    }
+    for (FwSizeType cpu_index = 0; cpu_index < capacity; cpu_index++) {
+        ticks[cpu_index].used = 0;
+        ticks[cpu_index].total = 0;
+    }
+    return LinuxCpu::parseStat(fd, ticks, 0, capacity, cpu_count);
+}
+
+CpuInterface::Status LinuxCpu::_getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) {
+    const PlatformIntType fd = LinuxCpu::openTaskFile(task, "stat");
+    if (fd == LinuxCpuHandle::INVALID_FILE_DESCRIPTOR) {
+        return Status::ERROR;
+    }
+    FwSizeType used = 0;
+    const Status status = LinuxCpu::parseTaskStat(fd, used);
+    (void)::close(fd);
+    if (status != Status::OP_OK) {
         return status;
-    } else if (cpu_index >= count) {
-        return CpuInterface::Status::ERROR;
     }
-    ProcCpuData cpu_data = {0, 0, 0, 0, 0, 0, 0, 0};
-    status = getCpuData(cpu_index, cpu_data);
-    ticks.used = cpu_data[ProcCpuMeasures::USER] + cpu_data[ProcCpuMeasures::NICE] + cpu_data[ProcCpuMeasures::SYSTEM];
-    ticks.total = ticks.used + cpu_data[ProcCpuMeasures::IDLE];
+    // Wall clock in the same clock ticks as the thread times, relative to an arbitrary start
+    struct tms unused;
+    const clock_t now = ::times(&unused);
+    if (now == static_cast<clock_t>(-1)) {
+        return Status::ERROR;
+    }
+    ticks.used = used;
+    ticks.total = static_cast<FwSizeType>(now);
+    return Status::OP_OK;
+}
 
+CpuInterface::Status LinuxCpu::_getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) {
+    const PlatformIntType fd = LinuxCpu::openTaskFile(task, "status");
+    if (fd == LinuxCpuHandle::INVALID_FILE_DESCRIPTOR) {
+        return Status::ERROR;
+    }
+    const Status status = LinuxCpu::parseTaskStatus(fd, switches);
+    (void)::close(fd);
     return status;
 }
 
@@ -11,9 +11,14 @@ namespace Os {
 namespace Linux {
 namespace Cpu {
 
-//! CpuHandle class definition for stub implementations.
+//! CpuHandle class definition for Linux implementations.
 //!
-struct LinuxCpuHandle : public CpuHandle {};
+struct LinuxCpuHandle : public CpuHandle {
+    static constexpr PlatformIntType INVALID_FILE_DESCRIPTOR = -1;
+
+    //! /proc/stat descriptor kept open between samples, read with pread
+    PlatformIntType m_stat_fd = INVALID_FILE_DESCRIPTOR;
+};
 
 //! \brief stub implementation of Os::CpuInterface
 //!
@@ -23,7 +28,7 @@ class LinuxCpu : public CpuInterface {
   public:
     //! \brief constructor
     //!
-    LinuxCpu() = default;
+    LinuxCpu();
 
     //! \brief copy constructor
     LinuxCpu(const LinuxCpu& other) = delete;
@@ -33,7 +38,7 @@ class LinuxCpu : public CpuInterface {
 
     //! \brief destructor
     //!
-    ~LinuxCpu() override = default;
+    ~LinuxCpu() override;
 
     // ------------------------------------
     // Functions overrides
@@ -62,6 +67,31 @@ class LinuxCpu : public CpuInterface {
     //!
     Status _getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_index) override;
 
+    //! \brief Get the CPU tick information for all CPUs from a single sample
+    //!
+    //! \param ticks: (output) array filled with the tick information of each CPU
+    //! \param capacity: number of entries in ticks
+    //! \param cpu_count: (output) number of CPUs in the sample, may exceed capacity
+    //! \return:  ERROR when error occurs, OK otherwise.
+    //!
+    Status _getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) override;
+
+    //! \brief Get the CPU tick information of a started task
+    //!
+    //! \param ticks: (output) filled with the tick information for the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    Status _getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) override;
+
+    //! \brief Get the context switch counts of a started task
+    //!
+    //! \param switches: (output) filled with the context switch counts of the task
+    //! \param task: started task to read
+    //! \return:  ERROR when error occurs or the task is not running, OK otherwise.
+    //!
+    Status _getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) override;
+
     //! \brief returns the raw console handle
     //!
     //! Gets the raw console handle from the implementation. Note: users must include the implementation specific
@@ -70,6 +100,50 @@ class LinuxCpu : public CpuInterface {
     //! \return raw console handle
     //!
     CpuHandle *getHandle() override;
+
+  PRIVATE:
+    //! \brief parse the cpu lines of a /proc/stat style file in a single pass
+    //!
+    //! Reads the file from offset zero with pread, so the descriptor may be reused across samples. Ticks of CPU N are
+    //! stored in ticks[N - first_index] when that entry exists.
+    //!
+    //! \param fd: open descriptor of the stat file
+    //! \param ticks: (output) array filled with tick information of CPUs first_index to first_index + capacity - 1
+    //! \param first_index: index of the CPU stored in ticks[0]
+    //! \param capacity: number of entries in ticks
+    //! \param cpu_count: (output) one more than the highest CPU index in the file
+    //! \return: OP_OK when at least one CPU line was parsed, ERROR otherwise
+    //!
+    static Status parseStat(PlatformIntType fd, Os::Cpu::Ticks* ticks, FwSizeType first_index, FwSizeType capacity,
+                            FwSizeType& cpu_count);
+
+    //! \brief parse a /proc/<pid>/task/<tid>/stat style file
+    //!
+    //! \param fd: open descriptor of the stat file
+    //! \param used: (output) user plus system ticks of the thread
+    //! \return: OP_OK on success, ERROR otherwise
+    //!
+    static Status parseTaskStat(PlatformIntType fd, FwSizeType& used);
+
+    //! \brief parse a /proc/<pid>/task/<tid>/status style file for the context switch counts
+    //!
+    //! \param fd: open descriptor of the status file
+    //! \param switches: (output) voluntary and involuntary context switches of the thread
+    //! \return: OP_OK on success, ERROR otherwise
+    //!
+    static Status parseTaskStatus(PlatformIntType fd, Os::Cpu::TaskSwitches& switches);
+
+    //! \brief open a file of the /proc/self/task directory of a started task
+    //!
+    //! \param task: started task
+    //! \param name: name of the file within the task directory
+    //! \return: open descriptor, or INVALID_FILE_DESCRIPTOR when the task is not running
+    //!
+    static PlatformIntType openTaskFile(Os::Task& task, const char* name);
+
+    //! \brief get the /proc/stat descriptor, opening it when needed
+    PlatformIntType getStatFd();
+
   private:
     //! File handle for PosixFile
     LinuxCpuHandle m_handle;
@@ -3,8 +3,216 @@
 // \brief tests using Linux implementation for Os::Cpu interface testing
 // ======================================================================
 #include <gtest/gtest.h>
+#include "Os/Linux/Cpu.hpp"
+#include "Os/Os.hpp"
+#include "Os/RawTime.hpp"
+#include "Os/Task.hpp"
+#include "Fw/Types/String.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace {
+
+//! Write a synthetic /proc/stat with the given CPUs and return an open descriptor to it
+PlatformIntType writeStat(const char* path, FwSizeType cpus, FwSizeType skipped = 0xFFFFFFFF) {
+    FILE* file = ::fopen(path, "w");
+    EXPECT_NE(file, nullptr);
+    ::fprintf(file, "cpu  270288 1598 88660 8470416 15185 9775 2990 867 0 0\n");
+    for (FwSizeType i = 0; i < cpus; i++) {
+        if (i != skipped) {
+            ::fprintf(file, "cpu%lu %lu 1 %lu 2118172 3779 2540 648 287 0 0\n", static_cast<unsigned long>(i),
+                      static_cast<unsigned long>(1000 + i), static_cast<unsigned long>(100 * i));
+        }
+    }
+    ::fprintf(file, "intr 20015372 9 0 0 0 0 0 0 0 0 0 0 0 0 0\nctxt 40225163\nbtime 1728000000\n");
+    ::fclose(file);
+    PlatformIntType fd = ::open(path, O_RDONLY);
+    EXPECT_GE(fd, 0);
+    return fd;
+}
+
+//! Per-CPU /proc/stat read as done before the single pass parse: reopen and read lines up to the CPU
+bool legacyTicks(const char* path, FwSizeType cpu_index, Os::Cpu::Ticks& ticks) {
+    Os::File file;
+    if (file.open(path, Os::File::Mode::OPEN_READ) != Os::File::Status::OP_OK) {
+        return false;
+    }
+    char line[256];
+    for (FwSizeType i = 0; i < cpu_index + 2; i++) {
+        FwSignedSizeType size = sizeof line - 1;
+        if (file.readline(reinterpret_cast<U8*>(line), size, Os::File::WaitType::NO_WAIT) != Os::File::Status::OP_OK) {
+            return false;
+        }
+        line[size] = '\0';
+    }
+    unsigned long index, user, nice, system, idle;
+    if (::sscanf(line, "cpu%lu %lu %lu %lu %lu", &index, &user, &nice, &system, &idle) != 5) {
+        return false;
+    }
+    ticks.used = user + nice + system;
+    ticks.total = ticks.used + idle;
+    return true;
+}
+
+void spin(void* argument) {
+    std::atomic<bool>& running = *static_cast<std::atomic<bool>*>(argument);
+    volatile U64 counter = 0;
+    while (running.load()) {
+        counter = counter + 1;
+    }
+}
+
+void sleeper(void* argument) {
+    std::atomic<bool>& running = *static_cast<std::atomic<bool>*>(argument);
+    while (running.load()) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+}
+
+}  // namespace
+
+TEST(LinuxCpu, ParseStat) {
+    const char path[] = "/tmp/fprime_cpu_stat";
+    // CPU 2 offline
+    PlatformIntType fd = writeStat(path, 4, 2);
+    Os::Cpu::Ticks ticks[8];
+    ::memset(ticks, 0, sizeof ticks);
+    FwSizeType count = 0;
+    ASSERT_EQ(Os::Linux::Cpu::LinuxCpu::parseStat(fd, ticks, 0, 8, count), Os::CpuInterface::Status::OP_OK);
+    ASSERT_EQ(count, 4);
+    ASSERT_EQ(ticks[0].used, 1001);
+    ASSERT_EQ(ticks[0].total, 1001 + 2118172);
+    ASSERT_EQ(ticks[1].used, 1001 + 1 + 100);
+    ASSERT_EQ(ticks[2].total, 0);
+    ASSERT_EQ(ticks[3].used, 1003 + 1 + 300);
+
+    // Window starting past the first CPU
+    Os::Cpu::Ticks one;
+    ASSERT_EQ(Os::Linux::Cpu::LinuxCpu::parseStat(fd, &one, 3, 1, count), Os::CpuInterface::Status::OP_OK);
+    ASSERT_EQ(one.used, 1003 + 1 + 300);
+    (void)::close(fd);
+    (void)::unlink(path);
+}
+
+TEST(LinuxCpu, ParseStatAcrossChunks) {
+    const char path[] = "/tmp/fprime_cpu_stat";
+    const FwSizeType CPUS = 512;
+    PlatformIntType fd = writeStat(path, CPUS);
+    static Os::Cpu::Ticks ticks[CPUS];
+    FwSizeType count = 0;
+    ASSERT_EQ(Os::Linux::Cpu::LinuxCpu::parseStat(fd, ticks, 0, CPUS, count), Os::CpuInterface::Status::OP_OK);
+    ASSERT_EQ(count, CPUS);
+    for (FwSizeType i = 0; i < CPUS; i++) {
+        Os::Cpu::Ticks legacy;
+        ASSERT_TRUE(legacyTicks(path, i, legacy));
+        ASSERT_EQ(ticks[i].used, legacy.used) << "CPU " << i;
+        ASSERT_EQ(ticks[i].total, legacy.total) << "CPU " << i;
+    }
+    (void)::close(fd);
+    (void)::unlink(path);
+}
+
+TEST(LinuxCpu, ParseTaskStat) {
+    const char path[] = "/tmp/fprime_task_stat";
+    FILE* file = ::fopen(path, "w");
+    ASSERT_NE(file, nullptr);
+    // Command names may contain spaces and parentheses
+    ::fprintf(file, "4242 (my (task) 1) R 1 4242 4242 0 -1 4194560 97 0 0 0 1234 567 0 0 20 0 1 0 100 0 0\n");
+    ::fclose(file);
+    PlatformIntType fd = ::open(path, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    FwSizeType used = 0;
+    ASSERT_EQ(Os::Linux::Cpu::LinuxCpu::parseTaskStat(fd, used), Os::CpuInterface::Status::OP_OK);
+    ASSERT_EQ(used, 1234 + 567);
+    (void)::close(fd);
+    (void)::unlink(path);
+}
+
+TEST(LinuxCpu, TaskTicks) {
+    Os::Task task;
+    Os::Cpu::Ticks before;
+    ASSERT_EQ(Os::Cpu::getTaskTicks(before, task), Os::Cpu::Status::ERROR);
+
+    std::atomic<bool> running(true);
+    Os::Task::Arguments arguments(Fw::String("Spinner"), spin, &running);
+    ASSERT_EQ(task.start(arguments), Os::Task::OP_OK);
+    // Wait for the task to record its thread id
+    while (Os::Cpu::getTaskTicks(before, task) != Os::Cpu::Status::OP_OK) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    (void)Os::Task::delay(Fw::TimeInterval(0, 200000));
+    Os::Cpu::Ticks after;
+    ASSERT_EQ(Os::Cpu::getTaskTicks(after, task), Os::Cpu::Status::OP_OK);
+    running = false;
+    ASSERT_EQ(task.join(), Os::Task::OP_OK);
+    ASSERT_GT(after.total, before.total);
+    ASSERT_GT(after.used, before.used);
+    ASSERT_LE(after.used - before.used, after.total - before.total + 1);
+}
+
+TEST(LinuxCpu, TaskSwitches) {
+    Os::Task task;
+    Os::Cpu::TaskSwitches before;
+    ASSERT_EQ(Os::Cpu::getTaskSwitches(before, task), Os::Cpu::Status::ERROR);
+
+    std::atomic<bool> running(true);
+    Os::Task::Arguments arguments(Fw::String("Sleeper"), sleeper, &running);
+    ASSERT_EQ(task.start(arguments), Os::Task::OP_OK);
+    while (Os::Cpu::getTaskSwitches(before, task) != Os::Cpu::Status::OP_OK) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    (void)Os::Task::delay(Fw::TimeInterval(0, 50000));
+    Os::Cpu::TaskSwitches after;
+    ASSERT_EQ(Os::Cpu::getTaskSwitches(after, task), Os::Cpu::Status::OP_OK);
+    running = false;
+    ASSERT_EQ(task.join(), Os::Task::OP_OK);
+    // Each delay blocks the task
+    ASSERT_GT(after.voluntary, before.voluntary);
+    ASSERT_GE(after.involuntary, before.involuntary);
+}
+
+// Cost of one SystemResources CPU cycle on 8, 64 and 256 simulated CPUs: reopening /proc/stat per CPU as before,
+// versus one pread pass over the open file. Disabled by default; run with --gtest_also_run_disabled_tests.
+TEST(LinuxCpu, DISABLED_SampleCost) {
+    const char path[] = "/tmp/fprime_cpu_stat";
+    const FwSizeType cpus[] = {8, 64, 256};
+    const U32 CYCLES = 200;
+    static Os::Cpu::Ticks ticks[256];
+    for (FwSizeType index = 0; index < FW_NUM_ARRAY_ELEMENTS(cpus); index++) {
+        PlatformIntType fd = writeStat(path, cpus[index]);
+        Os::RawTime start;
+        Os::RawTime end;
+        U32 legacyUsec = 0;
+        U32 snapshotUsec = 0;
+        (void)start.now();
+        for (U32 cycle = 0; cycle < CYCLES; cycle++) {
+            for (FwSizeType cpu = 0; cpu < cpus[index]; cpu++) {
+                ASSERT_TRUE(legacyTicks(path, cpu, ticks[cpu]));
+            }
+        }
+        (void)end.now();
+        ASSERT_EQ(end.getDiffUsec(start, legacyUsec), Os::RawTime::OP_OK);
+        (void)start.now();
+        for (U32 cycle = 0; cycle < CYCLES; cycle++) {
+            FwSizeType count = 0;
+            ASSERT_EQ(Os::Linux::Cpu::LinuxCpu::parseStat(fd, ticks, 0, cpus[index], count),
+                      Os::CpuInterface::Status::OP_OK);
+        }
+        (void)end.now();
+        ASSERT_EQ(end.getDiffUsec(start, snapshotUsec), Os::RawTime::OP_OK);
+        printf("%3lu CPUs: per-CPU reopen %9.1f usec/cycle, single pass %7.1f usec/cycle\n",
+               static_cast<unsigned long>(cpus[index]), static_cast<F64>(legacyUsec) / CYCLES,
+               static_cast<F64>(snapshotUsec) / CYCLES);
+        (void)::close(fd);
+    }
+    (void)::unlink(path);
+}
 
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
+    Os::init();
     return RUN_ALL_TESTS();
 }
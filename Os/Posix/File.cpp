@@ -3,9 +3,16 @@
 // \brief posix implementation for Os::File
 // ======================================================================
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <cerrno>
+#include <cstdlib>
 #include <limits>
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#endif
 
 #include <Fw/Types/Assert.hpp>
 #include <Os/File.hpp>
@@ -44,6 +51,115 @@ static_assert(std::numeric_limits<FwSignedSizeType>::min() <= std::numeric_limit
 static_assert(std::numeric_limits<FwSignedSizeType>::min() <= std::numeric_limits<ssize_t>::min(),
               "Minimum value of FwSizeType larger than the minimum value of ssize_t. Configure a larger type.");
 
+namespace {
+
+static_assert(FW_FILE_COPY_BUFFER_SIZE > 0, "FW_FILE_COPY_BUFFER_SIZE must be >0");
+
+//! Alignment of the copy buffer, a page on all supported targets
+constexpr size_t COPY_BUFFER_ALIGNMENT = 4096;
+
+//! Largest single kernel copy request, the Linux per-call limit
+constexpr FwSignedSizeType MAX_KERNEL_COPY = 0x7ffff000;
+
+//! Ways of copying data, tried in order
+enum CopyMethod {
+    COPY_FILE_RANGE,  //!< in-kernel copy that may share extents
+    SEND_FILE,        //!< in-kernel copy through the page cache
+    USER_BUFFER,      //!< read and write through a user space buffer
+};
+
+//! Errors that mean a kernel copy call cannot be used on these files, rather than that the copy failed
+bool isUnsupportedError(int error) {
+    return (error == ENOSYS) || (error == EXDEV) || (error == EINVAL) || (error == EBADF) ||
+           (error == EOPNOTSUPP) || (error == ENOTSUP) || (error == EPERM);
+}
+
+//! Clone the whole source into an empty destination, sharing extents on filesystems that support it
+bool cloneFile(int in, int out, FwSignedSizeType size) {
+#if defined(__linux__) && defined(FICLONE)
+    struct stat in_stat;
+    struct stat out_stat;
+    if ((::fstat(in, &in_stat) != 0) || (::fstat(out, &out_stat) != 0) || !S_ISREG(in_stat.st_mode) ||
+        !S_ISREG(out_stat.st_mode) || (in_stat.st_size != size) || (out_stat.st_size != 0) ||
+        (::lseek(in, 0, SEEK_CUR) != 0)) {
+        return false;
+    }
+    if (::ioctl(out, FICLONE, in) != 0) {
+        return false;
+    }
+    // Leave both offsets where a read and write loop would have left them
+    return (::lseek(in, size, SEEK_SET) == size) && (::lseek(out, size, SEEK_SET) == size);
+#else
+    return false;
+#endif
+}
+
+//! Copy with the kernel copy calls, falling through the methods as they turn out unsupported
+PosixFile::Status kernelCopy(int in, int out, FwSignedSizeType& remaining, CopyMethod& method) {
+#ifdef __linux__
+    // Has the current method copied any data yet
+    bool progressed = false;
+    while ((remaining > 0) && (method != USER_BUFFER)) {
+        const size_t request = static_cast<size_t>(FW_MIN(remaining, MAX_KERNEL_COPY));
+        const ssize_t copied = (method == COPY_FILE_RANGE)
+                                   ? ::copy_file_range(in, nullptr, out, nullptr, request, 0)
+                                   : ::sendfile(out, in, nullptr, request);
+        if (copied > 0) {
+            remaining -= copied;
+            progressed = true;
+        } else if ((copied == 0) && progressed) {
+            // Source ended before the requested size
+            return PosixFile::OTHER_ERROR;
+        } else if (copied == 0) {
+            // Files without a real size (procfs, sysfs) report end of file immediately
+            method = static_cast<CopyMethod>(method + 1);
+        } else if (errno == EINTR) {
+            continue;
+        } else if (isUnsupportedError(errno)) {
+            method = static_cast<CopyMethod>(method + 1);
+            progressed = false;
+        } else {
+            return Os::Posix::errno_to_file_status(errno);
+        }
+    }
+#else
+    method = USER_BUFFER;
+#endif
+    return PosixFile::OP_OK;
+}
+
+//! Copy through a user space buffer, handling short reads and writes
+PosixFile::Status bufferedCopy(int in, int out, FwSignedSizeType remaining, U8* buffer, FwSignedSizeType capacity) {
+    while (remaining > 0) {
+        ssize_t read_size = ::read(in, buffer, static_cast<size_t>(FW_MIN(remaining, capacity)));
+        if (read_size < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return Os::Posix::errno_to_file_status(errno);
+        } else if (read_size == 0) {
+            // Source ended before the requested size
+            return PosixFile::OTHER_ERROR;
+        }
+        ssize_t written = 0;
+        while (written < read_size) {
+            const ssize_t write_size =
+                ::write(out, buffer + written, static_cast<size_t>(read_size - written));
+            if (write_size < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return Os::Posix::errno_to_file_status(errno);
+            }
+            written += write_size;
+        }
+        remaining -= read_size;
+    }
+    return PosixFile::OP_OK;
+}
+
+}  // namespace
+
 //!\brief default copy constructor
 #ifndef TGT_OS_TYPE_VXWORKS
 PosixFile::PosixFile(const PosixFile& other) {
@@ -282,6 +398,55 @@ PosixFile::Status PosixFile::write(const U8* buffer, FwSignedSizeType& size, Pos
     return status;
 }
 
+PosixFile::Status PosixFile::copyFrom(FileInterface& source, FwSignedSizeType size) {
+    FW_ASSERT(size >= 0, static_cast<FwAssertArgType>(size));
+    // All files of a build share one implementation, so the source handle is a posix file handle as well
+    const PosixFileHandle* source_handle = static_cast<PosixFileHandle*>(source.getHandle());
+    FW_ASSERT(source_handle != nullptr);
+    const int in = source_handle->m_file_descriptor;
+    const int out = this->m_handle.m_file_descriptor;
+    if ((in == PosixFileHandle::INVALID_FILE_DESCRIPTOR) || (out == PosixFileHandle::INVALID_FILE_DESCRIPTOR)) {
+        return NOT_OPENED;
+    }
+    if ((size == 0) || cloneFile(in, out, size)) {
+        return OP_OK;
+    }
+#ifdef POSIX_FADV_SEQUENTIAL
+    (void)::posix_fadvise(in, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    // The kernel copy calls reject O_APPEND, so this file is positioned at its end instead while copying
+    const int out_flags = ::fcntl(out, F_GETFL);
+    const bool appending = (out_flags != PosixFileHandle::ERROR_RETURN_VALUE) && ((out_flags & O_APPEND) != 0);
+    if (appending) {
+        if ((::fcntl(out, F_SETFL, out_flags & ~O_APPEND) == PosixFileHandle::ERROR_RETURN_VALUE) ||
+            (::lseek(out, 0, SEEK_END) == PosixFileHandle::ERROR_RETURN_VALUE)) {
+            return Os::Posix::errno_to_file_status(errno);
+        }
+    }
+
+    FwSignedSizeType remaining = size;
+    CopyMethod method = COPY_FILE_RANGE;
+    Status status = kernelCopy(in, out, remaining, method);
+    if ((status == OP_OK) && (remaining > 0)) {
+        void* buffer = nullptr;
+        if (::posix_memalign(&buffer, COPY_BUFFER_ALIGNMENT, FW_FILE_COPY_BUFFER_SIZE) == 0) {
+            status = bufferedCopy(in, out, remaining, static_cast<U8*>(buffer), FW_FILE_COPY_BUFFER_SIZE);
+            ::free(buffer);
+        } else {
+            // No memory for the large buffer, copy in small chunks from the stack
+            U8 chunk[FW_FILE_CHUNK_SIZE];
+            status = bufferedCopy(in, out, remaining, chunk, FW_FILE_CHUNK_SIZE);
+        }
+    }
+
+    if (appending && (::fcntl(out, F_SETFL, out_flags) == PosixFileHandle::ERROR_RETURN_VALUE) && (status == OP_OK)) {
+        status = Os::Posix::errno_to_file_status(errno);
+    }
+    // The files may have been partly copied, so callers must not fall back to their own copy
+    return (status == NOT_SUPPORTED) ? OTHER_ERROR : status;
+}
+
 FileHandle* PosixFile::getHandle() {
     return &this->m_handle;
 }
@@ -175,6 +175,19 @@ class PosixFile : public FileInterface {
     //!
     Status write(const U8* buffer, FwSignedSizeType& size, WaitType wait) override;
 
+    //! \brief copy data from another open file into this file in the kernel where possible
+    //!
+    //! On Linux a whole-file copy into an empty file is first attempted as a reflink (FICLONE), then data is moved
+    //! with copy_file_range and sendfile. A file opened for appending has O_APPEND cleared for the duration of the
+    //! copy since the kernel calls reject it. Whatever the kernel cannot copy is transferred through a
+    //! FW_FILE_COPY_BUFFER_SIZE page-aligned buffer, so this implementation never returns `NOT_SUPPORTED`.
+    //!
+    //! \param source: file to copy data from, open for reading
+    //! \param size: number of bytes to copy
+    //! \return OP_OK on success otherwise error status
+    //!
+    Status copyFrom(FileInterface& source, FwSignedSizeType size) override;
+
     //! \brief returns the raw file handle
     //!
     //! Gets the raw file handle from the implementation. Note: users must include the implementation specific
@@ -7,6 +7,9 @@
 #include <climits>
 #include <cerrno>
 #include <pthread.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #include "Fw/Logger/Logger.hpp"
 #include "Fw/Types/Assert.hpp"
@@ -158,7 +161,12 @@ namespace Task {
         return Posix::posix_status_to_task_status(pthread_status);
     }
 
-    void PosixTask::onStart() {}
+    void PosixTask::onStart() {
+#ifdef __linux__
+        // Recorded for per-thread CPU accounting
+        this->m_handle.m_thread_id.store(static_cast<PlatformIntType>(::syscall(SYS_gettid)));
+#endif
+    }
 
     Os::Task::Status PosixTask::start(const Arguments& arguments) {
         FW_ASSERT(arguments.m_routine != nullptr);
@@ -205,6 +213,10 @@ namespace Task {
         return &this->m_handle;
     }
 
+    PlatformIntType PosixTask::getThreadId() {
+        return this->m_handle.m_thread_id.load();
+    }
+
     // Note: not implemented for Posix threads. Must be manually done using a mutex or other blocking construct as there
     // is no top-level pthreads support for suspend and resume.
     void PosixTask::suspend(Os::Task::SuspensionType suspensionType) {
@@ -28,6 +28,8 @@ namespace Task {
         pthread_t m_task_descriptor;
         //! Is the above descriptor valid
         bool m_is_valid = false;
+        //! Kernel thread id, set by the task itself once running. -1 when unknown.
+        std::atomic<PlatformIntType> m_thread_id{-1};
     };
 
     //! Posix task implementation as driven by pthreads implementation
@@ -103,6 +105,10 @@ namespace Task {
         //! \brief return the underlying task handle (implementation specific)
         //! \return internal task handle representation
         TaskHandle* getHandle() override;
+
+        //! \brief get the kernel thread id recorded by the running task
+        //! \return kernel thread id, or -1 before the task has started
+        PlatformIntType getThreadId() override;
       PRIVATE:
         //! \brief create a configured pthread
         //!
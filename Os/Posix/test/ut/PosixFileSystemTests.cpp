@@ -9,6 +9,9 @@
 #include "STest/Scenario/Scenario.hpp"
 #include "STest/Pick/Pick.hpp"
 #include "Fw/Types/String.hpp"
+#include "Os/RawTime.hpp"
+#include <cstdio>
+#include <cstring>
 
 // ----------------------------------------------------------------------
 // Posix Test Cases
@@ -16,6 +19,202 @@
 
 // All tests are inherited from the common tests in CommonTests.hpp
 
+namespace {
+
+const char* const SOURCE_PATH = "posix_fs_copy_source.bin";
+const char* const DEST_PATH = "posix_fs_copy_dest.bin";
+
+//! Byte expected at an offset of a generated file
+U8 patternByte(FwSignedSizeType offset, U8 seed) {
+    return static_cast<U8>((offset * 31 + seed) & 0xFF);
+}
+
+//! Write a file of the given size filled with the pattern of the seed
+void writePattern(const char* path, FwSignedSizeType size, U8 seed) {
+    static U8 block[64 * 1024];
+    Os::File file;
+    ASSERT_EQ(file.open(path, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE), Os::File::OP_OK);
+    for (FwSignedSizeType offset = 0; offset < size; offset += static_cast<FwSignedSizeType>(sizeof(block))) {
+        FwSignedSizeType chunk = FW_MIN(static_cast<FwSignedSizeType>(sizeof(block)), size - offset);
+        for (FwSignedSizeType index = 0; index < chunk; index++) {
+            block[index] = patternByte(offset + index, seed);
+        }
+        ASSERT_EQ(file.write(block, chunk), Os::File::OP_OK);
+    }
+    file.close();
+}
+
+//! Check that a region of a file holds the pattern of the seed, starting at pattern offset 0
+void checkPattern(const char* path, FwSignedSizeType start, FwSignedSizeType size, U8 seed) {
+    static U8 block[64 * 1024];
+    Os::File file;
+    ASSERT_EQ(file.open(path, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(file.seek(start, Os::File::SeekType::ABSOLUTE), Os::File::OP_OK);
+    for (FwSignedSizeType offset = 0; offset < size; offset += static_cast<FwSignedSizeType>(sizeof(block))) {
+        FwSignedSizeType chunk = FW_MIN(static_cast<FwSignedSizeType>(sizeof(block)), size - offset);
+        ASSERT_EQ(file.read(block, chunk), Os::File::OP_OK);
+        for (FwSignedSizeType index = 0; index < chunk; index++) {
+            ASSERT_EQ(block[index], patternByte(offset + index, seed)) << "at offset " << (start + offset + index);
+        }
+    }
+    file.close();
+}
+
+FwSignedSizeType fileSize(const char* path) {
+    FwSignedSizeType size = -1;
+    EXPECT_EQ(Os::FileSystem::getFileSize(path, size), Os::FileSystem::OP_OK);
+    return size;
+}
+
+}  // namespace
+
+// Copies larger than the copy buffer keep the data intact
+TEST(PosixFileSystem, CopyFileData) {
+    const FwSignedSizeType SIZES[] = {0, 1, FW_FILE_CHUNK_SIZE + 3, 3 * FW_FILE_COPY_BUFFER_SIZE + 17};
+    for (const FwSignedSizeType size : SIZES) {
+        writePattern(SOURCE_PATH, size, 7);
+        (void)Os::FileSystem::removeFile(DEST_PATH);
+        ASSERT_EQ(Os::FileSystem::copyFile(SOURCE_PATH, DEST_PATH), Os::FileSystem::OP_OK);
+        ASSERT_EQ(fileSize(DEST_PATH), size);
+        checkPattern(DEST_PATH, 0, size, 7);
+    }
+    (void)Os::FileSystem::removeFile(SOURCE_PATH);
+    (void)Os::FileSystem::removeFile(DEST_PATH);
+}
+
+// Appending keeps the existing destination data and adds the source after it
+TEST(PosixFileSystem, AppendFileData) {
+    const FwSignedSizeType EXISTING = 1000;
+    const FwSignedSizeType APPENDED = 2 * FW_FILE_COPY_BUFFER_SIZE + 5;
+    writePattern(SOURCE_PATH, APPENDED, 3);
+    writePattern(DEST_PATH, EXISTING, 4);
+    ASSERT_EQ(Os::FileSystem::appendFile(SOURCE_PATH, DEST_PATH), Os::FileSystem::OP_OK);
+    ASSERT_EQ(fileSize(DEST_PATH), EXISTING + APPENDED);
+    checkPattern(DEST_PATH, 0, EXISTING, 4);
+    checkPattern(DEST_PATH, EXISTING, APPENDED, 3);
+
+    // The destination is still opened for appending after the copy
+    Os::File destination;
+    ASSERT_EQ(destination.open(DEST_PATH, Os::File::OPEN_APPEND), Os::File::OP_OK);
+    Os::File source;
+    ASSERT_EQ(source.open(SOURCE_PATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(destination.copyFrom(source, 10), Os::File::OP_OK);
+    U8 tail[] = {0xAB};
+    FwSignedSizeType tail_size = sizeof(tail);
+    ASSERT_EQ(destination.seek(0, Os::File::SeekType::ABSOLUTE), Os::File::OP_OK);
+    ASSERT_EQ(destination.write(tail, tail_size), Os::File::OP_OK);
+    destination.close();
+    source.close();
+    ASSERT_EQ(fileSize(DEST_PATH), EXISTING + APPENDED + 10 + 1);
+    checkPattern(DEST_PATH, EXISTING + APPENDED, 10, 3);
+
+    (void)Os::FileSystem::removeFile(SOURCE_PATH);
+    (void)Os::FileSystem::removeFile(DEST_PATH);
+}
+
+// Copying more than the source holds fails instead of padding the destination
+TEST(PosixFileSystem, CopyFileDataShortSource) {
+    writePattern(SOURCE_PATH, 100, 1);
+    Os::File source;
+    Os::File destination;
+    ASSERT_EQ(source.open(SOURCE_PATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(destination.open(DEST_PATH, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE),
+              Os::File::OP_OK);
+    ASSERT_NE(destination.copyFrom(source, 200), Os::File::OP_OK);
+    source.close();
+    destination.close();
+    (void)Os::FileSystem::removeFile(SOURCE_PATH);
+    (void)Os::FileSystem::removeFile(DEST_PATH);
+}
+
+#ifdef __linux__
+// Files reporting no size, like those in procfs, are copied through the user space buffer
+TEST(PosixFileSystem, CopyFileDataProcfs) {
+    const char* const PROC_PATH = "/proc/version";
+    U8 expected[512];
+    FwSignedSizeType expected_size = sizeof(expected);
+    Os::File source;
+    ASSERT_EQ(source.open(PROC_PATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(source.read(expected, expected_size, Os::File::WaitType::NO_WAIT), Os::File::OP_OK);
+    source.close();
+    ASSERT_GT(expected_size, 0);
+
+    Os::File destination;
+    ASSERT_EQ(source.open(PROC_PATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(destination.open(DEST_PATH, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE),
+              Os::File::OP_OK);
+    ASSERT_EQ(destination.copyFrom(source, expected_size), Os::File::OP_OK);
+    source.close();
+    destination.close();
+
+    U8 copied[sizeof(expected)];
+    FwSignedSizeType copied_size = sizeof(copied);
+    ASSERT_EQ(destination.open(DEST_PATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(destination.read(copied, copied_size), Os::File::OP_OK);
+    destination.close();
+    ASSERT_EQ(copied_size, expected_size);
+    ASSERT_EQ(memcmp(copied, expected, static_cast<size_t>(expected_size)), 0);
+    (void)Os::FileSystem::removeFile(DEST_PATH);
+}
+#endif
+
+// Copy throughput for 1 MB to 4 GB files against the previous chunked read and write loop.
+// Disabled by default as it needs 8 GB of disk; run with --gtest_also_run_disabled_tests.
+TEST(PosixFileSystem, DISABLED_CopyThroughput) {
+    const FwSignedSizeType MB = 1024 * 1024;
+    const FwSignedSizeType SIZES[] = {MB, 16 * MB, 256 * MB, 1024 * MB, 4096 * MB};
+    for (const FwSignedSizeType size : SIZES) {
+        writePattern(SOURCE_PATH, size, 5);
+
+        // Chunked loop as used before the fast path
+        Os::File source;
+        Os::File destination;
+        U8 chunk[FW_FILE_CHUNK_SIZE];
+        Os::RawTime start;
+        Os::RawTime end;
+        ASSERT_EQ(start.now(), Os::RawTime::OP_OK);
+        ASSERT_EQ(source.open(SOURCE_PATH, Os::File::OPEN_READ), Os::File::OP_OK);
+        ASSERT_EQ(destination.open(DEST_PATH, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE),
+                  Os::File::OP_OK);
+        for (FwSignedSizeType copied = 0; copied < size;) {
+            FwSignedSizeType chunk_size = FW_MIN(static_cast<FwSignedSizeType>(sizeof(chunk)), size - copied);
+            ASSERT_EQ(source.read(chunk, chunk_size), Os::File::OP_OK);
+            ASSERT_EQ(destination.write(chunk, chunk_size), Os::File::OP_OK);
+            copied += chunk_size;
+        }
+        source.close();
+        destination.close();
+        ASSERT_EQ(end.now(), Os::RawTime::OP_OK);
+        Fw::TimeInterval chunked;
+        ASSERT_EQ(end.getTimeInterval(start, chunked), Os::RawTime::OP_OK);
+
+        (void)Os::FileSystem::removeFile(DEST_PATH);
+        ASSERT_EQ(start.now(), Os::RawTime::OP_OK);
+        ASSERT_EQ(Os::FileSystem::copyFile(SOURCE_PATH, DEST_PATH), Os::FileSystem::OP_OK);
+        ASSERT_EQ(end.now(), Os::RawTime::OP_OK);
+        Fw::TimeInterval fast;
+        ASSERT_EQ(end.getTimeInterval(start, fast), Os::RawTime::OP_OK);
+
+        ASSERT_EQ(start.now(), Os::RawTime::OP_OK);
+        ASSERT_EQ(Os::FileSystem::appendFile(SOURCE_PATH, DEST_PATH), Os::FileSystem::OP_OK);
+        ASSERT_EQ(end.now(), Os::RawTime::OP_OK);
+        Fw::TimeInterval append;
+        ASSERT_EQ(end.getTimeInterval(start, append), Os::RawTime::OP_OK);
+        ASSERT_EQ(fileSize(DEST_PATH), 2 * size);
+
+        const F64 megabytes = static_cast<F64>(size) / static_cast<F64>(MB);
+        auto rate = [megabytes](const Fw::TimeInterval& interval) {
+            const F64 seconds = static_cast<F64>(interval.getSeconds()) +
+                                static_cast<F64>(interval.getUSeconds()) / 1000000.0;
+            return megabytes / ((seconds > 0.0) ? seconds : 1e-6);
+        };
+        printf("%6.0f MB: chunked %9.1f MB/s, copyFile %9.1f MB/s, appendFile %9.1f MB/s\n", megabytes,
+               rate(chunked), rate(fast), rate(append));
+    }
+    (void)Os::FileSystem::removeFile(SOURCE_PATH);
+    (void)Os::FileSystem::removeFile(DEST_PATH);
+}
+
 int main(int argc, char** argv) {
     STest::Random::seed();
     ::testing::InitGoogleTest(&argc, argv);
@@ -11,9 +11,13 @@ namespace Os {
 FwSizeType Queue::s_queueCount = 0;
 QueueRegistry* Queue::s_queueRegistry = nullptr;
 
-Queue::Queue() : m_name(""), m_depth(0), m_size(0), m_delegate(*QueueInterface::getDelegate(m_handle_storage)) {}
+Queue::Queue() : m_name(""), m_depth(0), m_size(0), m_received(0), m_delegate(*QueueInterface::getDelegate(m_handle_storage)) {}
 
 Queue::~Queue() {
+    // If a registry has been registered and the queue has been created then remove queue from the registry
+    if ((Queue::s_queueRegistry != nullptr) && (this->m_depth > 0)) {
+        Queue::s_queueRegistry->removeQueue(this);
+    }
     m_delegate.~QueueInterface();
 }
 
@@ -71,7 +75,12 @@ QueueInterface::Status Queue::receive(U8* destination,
     else if (capacity < this->getMessageSize()) {
         return QueueInterface::Status::SIZE_MISMATCH;
     }
-    return this->m_delegate.receive(destination, capacity, blockType, actualSize, priority);
+    QueueInterface::Status status = this->m_delegate.receive(destination, capacity, blockType, actualSize, priority);
+    if (status == QueueInterface::Status::OP_OK) {
+        // Only the receiving task writes the count
+        this->m_received.store(this->m_received.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+    return status;
 }
 
 FwSizeType Queue::getMessagesAvailable() const {
@@ -120,6 +129,10 @@ FwSizeType Queue::getMessageSize() const {
     return this->m_size;
 }
 
+FwSizeType Queue::getMessagesReceived() const {
+    return this->m_received.load(std::memory_order_relaxed);
+}
+
 const QueueString& Queue::getName() const {
     return this->m_name;
 }
@@ -129,6 +142,18 @@ FwSizeType Queue::getNumQueues() {
     return Queue::s_queueCount;
 }
 
+void Queue::setRegistry(QueueRegistry* registry) {
+    ScopeLock lock(Queue::getStaticMutex());
+    Queue::s_queueRegistry = registry;
+}
+
+QueueRegistry* Queue::getRegistry() {
+    ScopeLock lock(Queue::getStaticMutex());
+    return Queue::s_queueRegistry;
+}
+
+void QueueRegistry::removeQueue(Queue* queue) {}
+
 Os::Mutex& Queue::getStaticMutex() {
     static Os::Mutex s_mutex;
     return s_mutex;
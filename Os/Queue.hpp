@@ -5,6 +5,7 @@
 #ifndef Os_Queue_hpp_
 #define Os_Queue_hpp_
 
+#include <atomic>
 #include <FpConfig.hpp>
 #include <Fw/Obj/ObjBase.hpp>
 #include <Fw/Types/Serializable.hpp>
@@ -270,6 +271,14 @@ class Queue final : public QueueInterface {
     //! \brief get the queue's name
     const QueueString& getName() const;
 
+    //! \brief get the number of messages received from the queue
+    //!
+    //! Counts successful receive calls since creation. Sampled from another task, the difference between two
+    //! samples gives the dispatch rate of the component owning the queue.
+    //!
+    //! \return number of messages received
+    FwSizeType getMessagesReceived() const;
+
     //! \brief get number of queues system-wide
     static FwSizeType getNumQueues();
 
@@ -280,6 +289,7 @@ class Queue final : public QueueInterface {
     QueueString m_name;                           //!< queue name
     FwSizeType m_depth;                           //!< Queue depth
     FwSizeType m_size;                            //!< Maximum message size
+    std::atomic<FwSizeType> m_received;           //!< Messages received
     static Os::Mutex s_countLock;                 //!< Lock the count
     static FwSizeType s_queueCount;               //!< Count of the number of queues
 
@@ -290,6 +300,11 @@ class Queue final : public QueueInterface {
     //! \param registry: registry to set
     static void setRegistry(QueueRegistry* registry);
 
+    //! \brief get the QueueRegistry tracking queues
+    //!
+    //! \return registry set with setRegistry, nullptr when none is set
+    static QueueRegistry* getRegistry();
+
   private:
     static QueueRegistry* s_queueRegistry;  //!< Queue registry store
 #endif
@@ -318,6 +333,14 @@ class QueueRegistry {
     //!
     //! \param queue: queue being registered
     virtual void registerQueue(Queue* queue) = 0;  //!< method called by queue init() methods to register a new queue
+
+    //! \brief queue removal callback
+    //!
+    //! Called when a created queue is destroyed. Registries keeping the queue must drop it here. Queues created
+    //! before the registry was set are passed in as well. The default implementation does nothing.
+    //!
+    //! \param queue: queue being destroyed
+    virtual void removeQueue(Queue* queue);
 };
 }  // namespace Os
 #endif
@@ -19,6 +19,23 @@ CpuInterface::Status StubCpu::_getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_in
     return Status::ERROR;
 }
 
+CpuInterface::Status StubCpu::_getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) {
+    cpu_count = 0;
+    return Status::ERROR;
+}
+
+CpuInterface::Status StubCpu::_getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) {
+    ticks.total = 1;
+    ticks.used = 1;
+    return Status::ERROR;
+}
+
+CpuInterface::Status StubCpu::_getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) {
+    switches.voluntary = 0;
+    switches.involuntary = 0;
+    return Status::ERROR;
+}
+
 CpuHandle* StubCpu::getHandle() {
     return &this->m_handle;
 }
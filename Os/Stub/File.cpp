@@ -50,6 +50,11 @@ namespace File {
         return status;
     }
 
+    StubFile::Status StubFile::copyFrom(FileInterface &source, FwSignedSizeType size) {
+        Status status = Status::NOT_SUPPORTED;
+        return status;
+    }
+
     FileHandle* StubFile::getHandle() {
         return &this->m_handle;
     }
@@ -128,6 +128,16 @@ class StubFile : public FileInterface {
     //!
     Status write(const U8 *buffer, FwSignedSizeType &size, WaitType wait) override;
 
+    //! \brief copy data from another open file into this file
+    //!
+    //! This implementation does nothing but return NOT_SUPPORTED.
+    //!
+    //! \param source: file to copy data from, open for reading
+    //! \param size: number of bytes to copy
+    //! \return NOT_SUPPORTED
+    //!
+    Status copyFrom(FileInterface &source, FwSignedSizeType size) override;
+
     //! \brief returns the raw file handle
     //!
     //! Gets the raw file handle from the implementation. Note: users must include the implementation specific
@@ -34,6 +34,27 @@ TestCpu::Status TestCpu::_getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_index)
     return  StaticData::data.status_out;
 }
 
+TestCpu::Status TestCpu::_getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) {
+    StaticData::data.lastCalled = StaticData::LastFn::ALL_TICKS_FN;
+    StaticData::data.capacity = capacity;
+    StaticData::data.count = cpu_count;
+    return  StaticData::data.status_out;
+}
+
+TestCpu::Status TestCpu::_getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) {
+    StaticData::data.lastCalled = StaticData::LastFn::TASK_TICKS_FN;
+    StaticData::data.task = &task;
+    StaticData::data.ticks.total = ticks.total;
+    StaticData::data.ticks.used = ticks.used;
+    return  StaticData::data.status_out;
+}
+
+TestCpu::Status TestCpu::_getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) {
+    StaticData::data.lastCalled = StaticData::LastFn::TASK_SWITCHES_FN;
+    StaticData::data.task = &task;
+    return  StaticData::data.status_out;
+}
+
 CpuHandle* TestCpu::getHandle() {
     StaticData::data.lastCalled = StaticData::LastFn::HANDLE_FN;
     return &this->m_handle;
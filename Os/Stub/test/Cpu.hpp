@@ -23,6 +23,9 @@ struct StaticData {
         DESTRUCT_FN,
         COUNT_FN,
         TICKS_FN,
+        ALL_TICKS_FN,
+        TASK_TICKS_FN,
+        TASK_SWITCHES_FN,
         HANDLE_FN
     };
     //! Last function called
@@ -35,6 +38,10 @@ struct StaticData {
 
     //! Ticks test
     Os::Cpu::Ticks ticks;
+    //! All ticks test
+    FwSizeType capacity = 0;
+    //! Task ticks test
+    Os::Task* task = nullptr;
 
     //! Status out
     CpuInterface::Status status_out;
@@ -90,6 +97,15 @@ class TestCpu : public CpuInterface {
     //!
     Status _getTicks(Os::Cpu::Ticks& ticks, FwSizeType cpu_index) override;
 
+    //! \brief Get the CPU tick information for all CPUs from a single sample
+    Status _getAllTicks(Os::Cpu::Ticks* ticks, FwSizeType capacity, FwSizeType& cpu_count) override;
+
+    //! \brief Get the CPU tick information of a started task
+    Status _getTaskTicks(Os::Cpu::Ticks& ticks, Os::Task& task) override;
+
+    //! \brief Get the context switch counts of a started task
+    Status _getTaskSwitches(Os::Cpu::TaskSwitches& switches, Os::Task& task) override;
+
     //! \brief returns the raw console handle
     //!
     //! Gets the raw console handle from the implementation. Note: users must include the implementation specific
@@ -89,6 +89,10 @@ FileInterface::Status TestFile::seek(FwSignedSizeType offset, SeekType seekType)
     StaticData::data.seekOffset = offset;
     StaticData::data.seekType = seekType;
     StaticData::data.lastCalled = StaticData::SEEK_FN;
+    // Move the file pointer, so that writes after a seek land at the offset
+    if (StaticData::data.seekStatus == Os::File::OP_OK) {
+        StaticData::data.pointer = (seekType == SeekType::ABSOLUTE) ? offset : StaticData::data.pointer + offset;
+    }
     return StaticData::data.seekStatus;
 }
 
@@ -129,6 +133,13 @@ FileInterface::Status TestFile::write(const U8* buffer, FwSignedSizeType &size,
     return StaticData::data.writeStatus;
 }
 
+FileInterface::Status TestFile::copyFrom(FileInterface &source, FwSignedSizeType size) {
+    StaticData::data.copyFromSource = &source;
+    StaticData::data.copyFromSize = size;
+    StaticData::data.lastCalled = StaticData::COPY_FROM_FN;
+    return StaticData::data.copyFromStatus;
+}
+
 FileHandle* TestFile::getHandle() {
     return &this->m_handle;
 }
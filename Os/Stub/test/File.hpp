@@ -25,7 +25,8 @@ struct StaticData {
         SEEK_FN,
         FLUSH_FN,
         READ_FN,
-        WRITE_FN
+        WRITE_FN,
+        COPY_FROM_FN
     };
 
     //! Last function called
@@ -56,6 +57,10 @@ struct StaticData {
     FwSignedSizeType writeSize = -1;
     //! Wait of last write call
     Os::File::WaitType  writeWait = Os::File::WaitType::NO_WAIT;
+    //! Source of last copyFrom call
+    const FileInterface *copyFromSource = nullptr;
+    //! Size of last copyFrom call
+    FwSignedSizeType copyFromSize = -1;
 
     //! File pointer
     FwSignedSizeType pointer = 0;
@@ -76,6 +81,8 @@ struct StaticData {
     Os::File::Status readStatus = Os::File::Status::OP_OK;
     //! Status to return from write
     Os::File::Status writeStatus = Os::File::Status::OP_OK;
+    //! Status to return from copyFrom, not set by setNextStatus so that copies go through read and write
+    Os::File::Status copyFromStatus = Os::File::Status::NOT_SUPPORTED;
 
     //! Return of next size call
     FwSignedSizeType sizeResult = -1;
@@ -256,6 +263,16 @@ class TestFile : public FileInterface {
     //!
     Status write(const U8 *buffer, FwSignedSizeType &size, WaitType wait) override;
 
+    //! \brief copy data from another open file into this file
+    //!
+    //! Records the source and size, and returns `copyFromStatus`.
+    //!
+    //! \param source: file to copy data from, open for reading
+    //! \param size: number of bytes to copy
+    //! \return copyFromStatus, NOT_SUPPORTED unless set
+    //!
+    Status copyFrom(FileInterface &source, FwSignedSizeType size) override;
+
     //! \brief returns the raw file handle
     //!
     //! Gets the raw file handle from the implementation. Note: users must include the implementation specific
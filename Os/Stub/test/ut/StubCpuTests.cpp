@@ -49,6 +49,46 @@ TEST(Interface, Ticks) {
     ASSERT_EQ(ticks_copy.used, ticks.used);
 }
 
+TEST(Interface, AllTicks) {
+    Os::Cpu cpu;
+    Os::Cpu::Ticks ticks[4];
+    FwSizeType count = STest::Pick::lowerUpper(0, 10000);
+    FwSizeType count_copy = count;
+    Os::CpuInterface::Status status = Os::CpuInterface::Status::ERROR;
+    Os::Stub::Cpu::Test::StaticData::data.status_out = status;
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.lastCalled, Os::Stub::Cpu::Test::StaticData::CONSTRUCT_FN);
+    ASSERT_EQ(cpu._getAllTicks(ticks, FW_NUM_ARRAY_ELEMENTS(ticks), count), status);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.lastCalled, Os::Stub::Cpu::Test::StaticData::ALL_TICKS_FN);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.capacity, FW_NUM_ARRAY_ELEMENTS(ticks));
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.count, count_copy);
+}
+
+TEST(Interface, TaskTicks) {
+    Os::Cpu cpu;
+    Os::Task task;
+    Os::Cpu::Ticks ticks;
+    ticks.used = STest::Pick::lowerUpper(0, 10000);
+    ticks.total = STest::Pick::lowerUpper(0, 10000);
+    Os::CpuInterface::Status status = Os::CpuInterface::Status::OP_OK;
+    Os::Stub::Cpu::Test::StaticData::data.status_out = status;
+    ASSERT_EQ(cpu._getTaskTicks(ticks, task), status);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.lastCalled, Os::Stub::Cpu::Test::StaticData::TASK_TICKS_FN);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.task, &task);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.ticks.total, ticks.total);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.ticks.used, ticks.used);
+}
+
+TEST(Interface, TaskSwitches) {
+    Os::Cpu cpu;
+    Os::Task task;
+    Os::Cpu::TaskSwitches switches;
+    Os::CpuInterface::Status status = Os::CpuInterface::Status::OP_OK;
+    Os::Stub::Cpu::Test::StaticData::data.status_out = status;
+    ASSERT_EQ(cpu._getTaskSwitches(switches, task), status);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.lastCalled, Os::Stub::Cpu::Test::StaticData::TASK_SWITCHES_FN);
+    ASSERT_EQ(Os::Stub::Cpu::Test::StaticData::data.task, &task);
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -190,6 +190,23 @@ TEST_F(Interface, Write) {
     ASSERT_EQ(Os::Stub::File::Test::StaticData::data.writeWait, Os::File::WaitType::WAIT);
 }
 
+// Ensure that Os::File properly routes copyFrom calls to the implementation `copyFrom` function.
+TEST_F(Interface, CopyFrom) {
+    Os::File source;
+    Os::File destination;
+    Os::Stub::File::Test::StaticData::setNextStatus(Os::File::OP_OK);
+    ASSERT_EQ(source.open("/does/not/matter", Os::File::OPEN_READ, Os::File::OverwriteType::OVERWRITE), Os::File::OP_OK);
+    ASSERT_EQ(destination.copyFrom(source, 3), Os::File::Status::NOT_OPENED);
+    ASSERT_EQ(source.copyFrom(destination, 3), Os::File::Status::INVALID_MODE);
+    ASSERT_EQ(destination.open("/does/not/matter", Os::File::OPEN_WRITE, Os::File::OverwriteType::OVERWRITE), Os::File::OP_OK);
+    Os::Stub::File::Test::StaticData::data.copyFromStatus = Os::File::OTHER_ERROR;
+    ASSERT_EQ(destination.copyFrom(source, 3), Os::File::Status::OTHER_ERROR);
+    ASSERT_EQ(Os::Stub::File::Test::StaticData::data.lastCalled, Os::Stub::File::Test::StaticData::COPY_FROM_FN);
+    ASSERT_EQ(Os::Stub::File::Test::StaticData::data.copyFromSource, &source);
+    ASSERT_EQ(Os::Stub::File::Test::StaticData::data.copyFromSize, 3);
+    Os::Stub::File::Test::StaticData::data.copyFromStatus = Os::File::NOT_SUPPORTED;
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     STest::Random::seed();
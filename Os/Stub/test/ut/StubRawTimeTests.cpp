@@ -65,7 +65,8 @@ TEST_F(Interface, GetTimeInterval) {
 TEST_F(Interface, Serialize) {
     Os::RawTime rawtime;
     Fw::Buffer buffer;
-    ASSERT_EQ(rawtime.serialize(buffer.getSerializeRepr()), Fw::FW_SERIALIZE_OK);
+    Fw::ExternalSerializeBufferWithMemberCopy serializer = buffer.getSerializer();
+    ASSERT_EQ(rawtime.serialize(serializer), Fw::FW_SERIALIZE_OK);
     ASSERT_EQ(StaticData::data.lastCalled, StaticData::LastFn::SERIALIZE_FN);
 }
 
@@ -73,7 +74,8 @@ TEST_F(Interface, Serialize) {
 TEST_F(Interface, Deserialize) {
     Os::RawTime rawtime;
     Fw::Buffer buffer;
-    ASSERT_EQ(rawtime.deserialize(buffer.getSerializeRepr()), Fw::FW_SERIALIZE_OK);
+    Fw::ExternalSerializeBufferWithMemberCopy deserializer = buffer.getDeserializer();
+    ASSERT_EQ(rawtime.deserialize(deserializer), Fw::FW_SERIALIZE_OK);
     ASSERT_EQ(StaticData::data.lastCalled, StaticData::LastFn::DESERIALIZE_FN);
 }
 
@@ -112,6 +112,12 @@ TEST_F(Interface, GetHandle) {
     Os::Task task;
 }
 
+// Ensure that Os::Task falls back to the default thread id when the implementation has none
+TEST_F(Interface, GetThreadId) {
+    Os::Task task;
+    ASSERT_EQ(task.getThreadId(), -1);
+}
+
 // Ensure that Os::Task properly calls the implementation delay
 TEST_F(Interface, Delay) {
     Os::Task task;
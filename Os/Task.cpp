@@ -57,6 +57,10 @@ bool TaskInterface::isCooperative() {
     return false;
 }
 
+PlatformIntType TaskInterface::getThreadId() {
+    return -1;
+}
+
 Task::Task() : m_wrapper(*this), m_handle_storage(), m_delegate(*TaskInterface::getDelegate(m_handle_storage)) {}
 
 Task::~Task() {
@@ -166,11 +170,20 @@ bool Task::isCooperative() {
     return this->m_delegate.isCooperative();
 }
 
+PlatformIntType Task::getThreadId() {
+    FW_ASSERT(&this->m_delegate == reinterpret_cast<TaskInterface*>(&this->m_handle_storage[0]));
+    return this->m_delegate.getThreadId();
+}
+
 FwSizeType Task::getPriority() {
     Os::ScopeLock lock(this->m_lock);
     return this->m_priority;
 }
 
+const TaskString& Task::getName() const {
+    return this->m_name;
+}
+
 TaskHandle* Task::getHandle() {
     FW_ASSERT(&this->m_delegate == reinterpret_cast<TaskInterface*>(&this->m_handle_storage[0]));
     return this->m_delegate.getHandle();
@@ -205,4 +218,8 @@ Task& Task::getSingleton() {
 void Task::registerTaskRegistry(TaskRegistry* registry) {
     Task::s_taskRegistry = registry;
 }
+
+TaskRegistry* Task::getTaskRegistry() {
+    return Task::s_taskRegistry;
+}
 }
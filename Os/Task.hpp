@@ -177,6 +177,15 @@ namespace Os {
             //! \return true when the task expects cooperation, false otherwise
             virtual bool isCooperative();
 
+            //! \brief get the kernel thread id of the running task
+            //!
+            //! Some implementations can report the operating system identifier of the thread running the task, which
+            //! is used by platform services (e.g. per-task CPU statistics) that do not know the task implementation.
+            //! The default implementation returns -1.
+            //!
+            //! \return kernel thread id, or -1 when unknown or not running
+            virtual PlatformIntType getThreadId();
+
             //! \brief return the underlying task handle (implementation specific)
             //! \return internal task handle representation
             virtual TaskHandle* getHandle() = 0;
@@ -330,9 +339,16 @@ namespace Os {
         //! \return true if cooperative, false otherwise
         bool isCooperative() override;
 
+        //! \brief get the kernel thread id of the running task (implementation specific)
+        //! \return kernel thread id, or -1 when unknown or not running
+        PlatformIntType getThreadId() override;
+
         //! \brief get the task priority
         FwSizeType getPriority();
 
+        //! \brief get the name the task was started with
+        const TaskString& getName() const;
+
         //! \brief return the underlying task handle (implementation specific)
         //! \return internal task handle representation
         TaskHandle* getHandle() override;
@@ -348,6 +364,10 @@ namespace Os {
         //!
         static void registerTaskRegistry(TaskRegistry* registry);
 
+        //! \brief get the registered task registry
+        //! \return registry set with registerTaskRegistry, nullptr when none is set
+        static TaskRegistry* getTaskRegistry();
+
         //! \brief get a reference to singleton
         //! \return reference to singleton
         static Task& getSingleton();
@@ -25,3 +25,17 @@ TEST(Basic, Ticks) {
         ASSERT_GE(ticks_output.total, 0) << "No total on CPU: " << i;
     }
 }
+
+TEST(Basic, AllTicks) {
+    FwSizeType count = 0;
+    ASSERT_EQ(Os::Cpu::getCount(count), Os::Cpu::Status::OP_OK);
+
+    Os::Cpu::Ticks ticks_output[1024];
+    FwSizeType sampled = 0;
+    ASSERT_EQ(Os::Cpu::getAllTicks(ticks_output, FW_NUM_ARRAY_ELEMENTS(ticks_output), sampled), Os::Cpu::Status::OP_OK);
+    // Offline CPUs are part of the sample but not of the online count
+    ASSERT_GE(sampled, count);
+    for (FwSizeType i = 0; i < sampled && i < FW_NUM_ARRAY_ELEMENTS(ticks_output); i++) {
+        ASSERT_GE(ticks_output[i].total, ticks_output[i].used) << "Bad ticks on CPU: " << i;
+    }
+}
@@ -246,6 +246,12 @@ Os::File::Status SyntheticFile::size(FwSignedSizeType &size) {
     return Os::File::OP_OK;
 }
 
+Os::File::Status SyntheticFile::copyFrom(FileInterface& source, FwSignedSizeType size) {
+    (void) source;
+    (void) size;
+    return Os::File::Status::NOT_SUPPORTED;
+}
+
 FileHandle* SyntheticFile::getHandle() {
     return this->m_data.get();
 }
@@ -113,6 +113,9 @@ class SyntheticFile : public FileInterface {
     //! \brief size getter
     Os::File::Status size(FwSignedSizeType& size) override;
 
+    //! \brief copies are not supported, so data is copied with read and write
+    Os::File::Status copyFrom(FileInterface& source, FwSignedSizeType size) override;
+
     //! \brief silt data handle
     FileHandle* getHandle() override;
 
@@ -136,7 +136,7 @@ void configureTopology() {
     dpWriter.configure(dpDir);
 
     // Note: Uncomment when using Svc:TlmPacketizer
-    //tlmSend.setPacketList(RefPacketsPkts, RefPacketsIgnore, 1);
+    //tlmSend.setPacketList(RefPacketsPkts, RefPacketsIgnore, 1, RefPacketsScatter);
 }
 
 // Public functions for use in main program are namespaced with deployment name Ref
@@ -117,6 +117,12 @@ namespace Svc {
         if (this->isConnected_PktSend_OutputPort(0)) {
             this->PktSend_out(0, this->m_comBuffer,0);
         }
+
+        if (this->isConnected_LogArchive_OutputPort(0)) {
+            Fw::Time archiveTimeTag = timeTag;
+            Fw::LogBuffer archiveArgs = args;
+            this->LogArchive_out(0, id, archiveTimeTag, severity, archiveArgs);
+        }
     }
 
     void ActiveLoggerImpl::SET_EVENT_FILTER_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, FilterSeverity filterLevel, Enabled filterEnable) {
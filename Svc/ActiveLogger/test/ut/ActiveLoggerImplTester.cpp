@@ -542,6 +542,7 @@ namespace Svc {
         Fw::Time timeTag(TB_NONE,1,2);
 
         this->m_receivedPacket = false;
+        this->clearFromPortHistory();
 
         this->invoke_to_LogRecv(0,id,timeTag,severity,buff);
 
@@ -574,6 +575,11 @@ namespace Svc {
         ASSERT_EQ(readVal, value);
         // packet should be empty
         ASSERT_EQ(this->m_sentPacket.getBuffLeft(),0u);
+        // event should be archived with its severity
+        ASSERT_from_LogArchive_SIZE(1);
+        ASSERT_EQ(this->fromPortHistory_LogArchive->at(0).id,id);
+        ASSERT_EQ(this->fromPortHistory_LogArchive->at(0).severity,severity);
+        ASSERT_TRUE(this->fromPortHistory_LogArchive->at(0).args == buff);
 
     }
 
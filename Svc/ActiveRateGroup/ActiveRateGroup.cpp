@@ -17,6 +17,7 @@
 #include <FpConfig.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Os/Console.hpp>
+#include <limits>
 
 namespace Svc {
 
@@ -27,7 +28,9 @@ namespace Svc {
             m_cycleStarted(false),
             m_numContexts(0),
             m_overrunThrottle(0),
-            m_cycleSlips(0) {
+            m_cycleSlips(0),
+            m_profileEnabled(ACTIVE_RATE_GROUP_PROFILE_DEFAULT_ENABLED) {
+        this->resetProfile();
     }
 
     void ActiveRateGroup::configure( NATIVE_INT_TYPE contexts[], NATIVE_INT_TYPE numContexts) {
@@ -62,9 +65,13 @@ namespace Svc {
         this->m_cycleStarted = false;
 
         // invoke any members of the rate group
-        for (NATIVE_INT_TYPE port = 0; port < this->m_numContexts; port++) {
-            if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
-                this->RateGroupMemberOut_out(port, static_cast<U32>(this->m_contexts[port]));
+        if (this->m_profileEnabled) {
+            this->runProfiledMembers();
+        } else {
+            for (NATIVE_INT_TYPE port = 0; port < this->m_numContexts; port++) {
+                if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
+                    this->RateGroupMemberOut_out(port, static_cast<U32>(this->m_contexts[port]));
+                }
             }
         }
 
@@ -85,6 +92,19 @@ namespace Svc {
         // update cycle telemetry
         this->tlmWrite_RgMaxTime(this->m_maxTime);
 
+        // update member telemetry
+        if (this->m_profileEnabled) {
+            ActiveRateGroupMemberTimes maxTimes;
+            ActiveRateGroupMemberTimes meanTimes;
+            for (NATIVE_INT_TYPE port = 0; port < this->m_numContexts; port++) {
+                const MemberProfile& profile = this->m_profile[port];
+                maxTimes[port] = profile.maxTime;
+                meanTimes[port] = (profile.calls > 0) ? static_cast<U32>(profile.totalTime / profile.calls) : 0;
+            }
+            this->tlmWrite_RgMemberMaxTime(maxTimes);
+            this->tlmWrite_RgMemberMeanTime(meanTimes);
+        }
+
         // check for cycle slip. That will happen if new cycle message has been received
         // which will cause flag will be set again.
         if (this->m_cycleStarted) {
@@ -116,5 +136,93 @@ namespace Svc {
         this->PingOut_out(0,key);
     }
 
+    void ActiveRateGroup::RG_PROFILE_ENABLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::Enabled enable) {
+        this->m_profileEnabled = (enable == Fw::Enabled::ENABLED);
+        this->log_ACTIVITY_HI_RateGroupProfileEnable(enable);
+        this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+    }
+
+    void ActiveRateGroup::RG_PROFILE_DUMP_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+        for (NATIVE_INT_TYPE port = 0; port < this->m_numContexts; port++) {
+            if (not this->isConnected_RateGroupMemberOut_OutputPort(port)) {
+                continue;
+            }
+            const MemberProfile& profile = this->m_profile[port];
+            ActiveRateGroupProfileHistogram histogram;
+            for (U32 bin = 0; bin < ActiveRateGroupProfileHistogram::SIZE; bin++) {
+                histogram[bin] = profile.histogram[bin];
+            }
+            this->log_ACTIVITY_LO_RateGroupMemberProfile(
+                static_cast<U32>(port),
+                profile.calls,
+                (profile.calls > 0) ? profile.minTime : 0,
+                profile.maxTime,
+                (profile.calls > 0) ? static_cast<U32>(profile.totalTime / profile.calls) : 0,
+                histogram);
+        }
+        this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+    }
+
+    void ActiveRateGroup::RG_PROFILE_RESET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+        this->resetProfile();
+        this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
+    }
+
+    void ActiveRateGroup::runProfiledMembers() {
+        // alternate between two timestamps so each member end time is the next member start time
+        Os::RawTime stamps[2];
+        NATIVE_UINT_TYPE current = 0;
+        stamps[current].now();
+
+        for (NATIVE_INT_TYPE port = 0; port < this->m_numContexts; port++) {
+            if (this->isConnected_RateGroupMemberOut_OutputPort(port)) {
+                this->RateGroupMemberOut_out(port, static_cast<U32>(this->m_contexts[port]));
+                const NATIVE_UINT_TYPE next = current ^ 1;
+                stamps[next].now();
+                U32 execTime;
+                // Cast to void as the only possible error is overflow, which caps execTime
+                (void) stamps[next].getDiffUsec(stamps[current], execTime);
+                this->updateProfile(port, execTime);
+                current = next;
+            }
+        }
+    }
+
+    void ActiveRateGroup::updateProfile(NATIVE_INT_TYPE port, U32 execTime) {
+        FW_ASSERT(port < CONNECTION_COUNT_MAX, port);
+        MemberProfile& profile = this->m_profile[port];
+
+        if (execTime < profile.minTime) {
+            profile.minTime = execTime;
+        }
+        if (execTime > profile.maxTime) {
+            profile.maxTime = execTime;
+        }
+        profile.calls++;
+        profile.totalTime += execTime;
+
+        // find the bin: each bin is 2^SHIFT wider than the previous, last bin catches the rest
+        U32 bin = 0;
+        U32 bound = ACTIVE_RATE_GROUP_PROFILE_BIN_BASE_USEC;
+        while ((bin < (ActiveRateGroupProfileHistogram::SIZE - 1)) && (execTime >= bound)) {
+            bound <<= ACTIVE_RATE_GROUP_PROFILE_BIN_SHIFT;
+            bin++;
+        }
+        profile.histogram[bin]++;
+    }
+
+    void ActiveRateGroup::resetProfile() {
+        for (NATIVE_UINT_TYPE port = 0; port < FW_NUM_ARRAY_ELEMENTS(this->m_profile); port++) {
+            MemberProfile& profile = this->m_profile[port];
+            profile.calls = 0;
+            profile.minTime = std::numeric_limits<U32>::max();
+            profile.maxTime = 0;
+            profile.totalTime = 0;
+            for (U32 bin = 0; bin < ActiveRateGroupProfileHistogram::SIZE; bin++) {
+                profile.histogram[bin] = 0;
+            }
+        }
+    }
+
 
 }
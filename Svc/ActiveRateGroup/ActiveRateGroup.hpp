@@ -25,7 +25,8 @@ namespace Svc {
     //! ActiveRateGroup takes an input cycle call to begin the rate group cycle.
     //! It calls each output port in succession and passes the value in the context
     //! array at the index corresponding to the output port number. It keeps track of the execution
-    //! time of the rate group and detects overruns.
+    //! time of the rate group and detects overruns. When profiling is enabled by command it also
+    //! tracks the execution time of each member individually.
     //!
 
     class ActiveRateGroup : public ActiveRateGroupComponentBase {
@@ -90,6 +91,52 @@ namespace Svc {
 
             void PingIn_handler(NATIVE_INT_TYPE portNum, U32 key);
 
+            //!  \brief Profile enable command handler
+            //!
+            //!  Turns per-member execution time profiling on or off
+            //!
+            //!  \param opCode the opcode of the command
+            //!  \param cmdSeq the sequence number of the command
+            //!  \param enable whether or not members are profiled
+
+            void RG_PROFILE_ENABLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::Enabled enable);
+
+            //!  \brief Profile dump command handler
+            //!
+            //!  Emits an event with the accumulated profile of each connected member
+            //!
+            //!  \param opCode the opcode of the command
+            //!  \param cmdSeq the sequence number of the command
+
+            void RG_PROFILE_DUMP_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
+
+            //!  \brief Profile reset command handler
+            //!
+            //!  Clears the accumulated profile of every member
+            //!
+            //!  \param opCode the opcode of the command
+            //!  \param cmdSeq the sequence number of the command
+
+            void RG_PROFILE_RESET_cmdHandler(FwOpcodeType opCode, U32 cmdSeq);
+
+            //!  \brief Invoke members while timing each call
+            //!
+            //!  Same as the unprofiled member loop, but records the execution time of each
+            //!  connected member into its profile entry.
+
+            void runProfiledMembers();
+
+            //!  \brief Record a member execution time
+            //!
+            //!  \param port the member output port number
+            //!  \param execTime the execution time of the member in microseconds
+
+            void updateProfile(NATIVE_INT_TYPE port, U32 execTime);
+
+            //!  \brief Clear all member profile entries
+
+            void resetProfile();
+
             //!  \brief Task preamble
             //!
             //!  This method is called prior to entering the message loop.
@@ -105,6 +152,18 @@ namespace Svc {
             NATIVE_INT_TYPE m_numContexts; //!< Number of contexts passed in by user
             NATIVE_INT_TYPE m_overrunThrottle; //!< throttle value for overrun events
             U32 m_cycleSlips; //!< tracks number of cycle slips
+
+            //! Execution time profile of a single rate group member
+            struct MemberProfile {
+                U32 calls; //!< number of profiled calls
+                U32 minTime; //!< minimum execution time in microseconds
+                U32 maxTime; //!< maximum execution time in microseconds
+                U64 totalTime; //!< sum of execution times in microseconds, used for the mean
+                U32 histogram[ActiveRateGroupProfileHistogram::SIZE]; //!< execution time histogram
+            };
+
+            bool m_profileEnabled; //!< whether members are currently profiled
+            MemberProfile m_profile[CONNECTION_COUNT_MAX]; //!< profile of each member
     };
 
 }
@@ -316,4 +316,81 @@ namespace Svc {
 
     }
 
+    void ActiveRateGroupImplTester::runMemberProfile() {
+
+        TEST_CASE(101.3.1,"Run member profiling");
+
+        const U32 cycles = 5;
+        Os::RawTime time;
+
+        // profiling is off by default, so only the cycle time is reported
+        this->clearTlm();
+        time.now();
+        this->invoke_to_CycleIn(0,time);
+        this->m_impl.doDispatch();
+        ASSERT_TLM_SIZE(1);
+        ASSERT_TLM_RgMemberMaxTime_SIZE(0);
+        ASSERT_TLM_RgMemberMeanTime_SIZE(0);
+
+        // enable profiling
+        this->clearEvents();
+        this->sendCmd_RG_PROFILE_ENABLE(0,10,Fw::Enabled::ENABLED);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_ENABLE,10,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_RateGroupProfileEnable_SIZE(1);
+        ASSERT_EVENTS_RateGroupProfileEnable(0,Fw::Enabled::ENABLED);
+
+        // run some cycles and verify member telemetry is written every cycle
+        this->clearTlm();
+        for (U32 cycle = 0; cycle < cycles; cycle++) {
+            time.now();
+            this->invoke_to_CycleIn(0,time);
+            this->m_impl.doDispatch();
+        }
+        ASSERT_TLM_RgMemberMeanTime_SIZE(cycles);
+        for (NATIVE_UINT_TYPE port = 0; port < Svc::ActiveRateGroupComponentBase::NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS; port++) {
+            ASSERT_EQ(this->m_impl.m_profile[port].calls,cycles);
+            ASSERT_LE(this->m_impl.m_profile[port].minTime,this->m_impl.m_profile[port].maxTime);
+            U32 binTotal = 0;
+            for (U32 bin = 0; bin < ActiveRateGroupProfileHistogram::SIZE; bin++) {
+                binTotal += this->m_impl.m_profile[port].histogram[bin];
+            }
+            ASSERT_EQ(binTotal,cycles);
+        }
+
+        // dump emits one event per connected member
+        this->clearEvents();
+        this->clearHistory();
+        this->sendCmd_RG_PROFILE_DUMP(0,11);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_DUMP,11,Fw::CmdResponse::OK);
+        ASSERT_EVENTS_RateGroupMemberProfile_SIZE(Svc::ActiveRateGroupComponentBase::NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS);
+        ASSERT_EQ(this->eventHistory_RateGroupMemberProfile->at(0).calls,cycles);
+
+        // reset clears the accumulated profile
+        this->clearHistory();
+        this->sendCmd_RG_PROFILE_RESET(0,12);
+        this->m_impl.doDispatch();
+        ASSERT_CMD_RESPONSE_SIZE(1);
+        ASSERT_CMD_RESPONSE(0,ActiveRateGroupComponentBase::OPCODE_RG_PROFILE_RESET,12,Fw::CmdResponse::OK);
+        for (NATIVE_UINT_TYPE port = 0; port < Svc::ActiveRateGroupComponentBase::NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS; port++) {
+            ASSERT_EQ(this->m_impl.m_profile[port].calls,0u);
+            ASSERT_EQ(this->m_impl.m_profile[port].maxTime,0u);
+        }
+
+        // disabling profiling stops the member telemetry
+        this->clearHistory();
+        this->sendCmd_RG_PROFILE_ENABLE(0,13,Fw::Enabled::DISABLED);
+        this->m_impl.doDispatch();
+        ASSERT_EVENTS_RateGroupProfileEnable(0,Fw::Enabled::DISABLED);
+        time.now();
+        this->invoke_to_CycleIn(0,time);
+        this->m_impl.doDispatch();
+        ASSERT_TLM_RgMemberMaxTime_SIZE(0);
+        ASSERT_TLM_RgMemberMeanTime_SIZE(0);
+        ASSERT_EQ(this->m_impl.m_profile[0].calls,0u);
+    }
+
 } /* namespace SvcTest */
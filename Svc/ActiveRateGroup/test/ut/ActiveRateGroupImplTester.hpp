@@ -31,6 +31,7 @@ namespace Svc {
             void runNominal(NATIVE_INT_TYPE contexts[], NATIVE_INT_TYPE numContexts, NATIVE_INT_TYPE instance);
             void runCycleOverrun(NATIVE_INT_TYPE contexts[], NATIVE_INT_TYPE numContexts, NATIVE_INT_TYPE instance);
             void runPingTest();
+            void runMemberProfile();
 
         private:
 
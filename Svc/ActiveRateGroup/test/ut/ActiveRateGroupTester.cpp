@@ -40,6 +40,10 @@ void connectPorts(Svc::ActiveRateGroup& impl, Svc::ActiveRateGroupImplTester& te
     impl.set_PingOut_OutputPort(0,tester.get_from_PingOut(0));
     tester.connect_to_PingIn(0,impl.get_PingIn_InputPort(0));
 
+    tester.connect_to_CmdDisp(0,impl.get_CmdDisp_InputPort(0));
+    impl.set_CmdStatus_OutputPort(0,tester.get_from_CmdStatus(0));
+    impl.set_CmdReg_OutputPort(0,tester.get_from_CmdReg(0));
+
 #if FW_PORT_TRACING
     // Fw::PortBase::setTrace(true);
 #endif
@@ -116,6 +120,24 @@ TEST(ActiveRateGroupTest,PingPort) {
     tester.runPingTest();
 }
 
+TEST(ActiveRateGroupTest,MemberProfile) {
+
+    NATIVE_INT_TYPE contexts[Svc::ActiveRateGroupComponentBase::NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS];
+    for (U32 i = 0; i < Svc::ActiveRateGroupComponentBase::NUM_RATEGROUPMEMBEROUT_OUTPUT_PORTS; i++) {
+        contexts[i] = i + 1;
+    }
+
+    Svc::ActiveRateGroup impl("ActiveRateGroup");
+    impl.configure(contexts,FW_NUM_ARRAY_ELEMENTS(contexts));
+    Svc::ActiveRateGroupImplTester tester(impl);
+
+    tester.init();
+    impl.init(10,0);
+
+    connectPorts(impl,tester);
+    tester.runMemberProfile();
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -6,24 +6,41 @@
 #include <Svc/ActiveTextLogger/ActiveTextLogger.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Fw/Logger/Logger.hpp>
+#include <Fw/Types/String.hpp>
 #include <ctime>
 
 namespace Svc {
 
+    namespace {
+
+        // Format of a deferred log text: id, time base, seconds, microseconds, severity and text.
+        // Deferred log texts are told apart from Fw::Logger messages by this pointer.
+        const char EVENT_FORMAT[] = "%" PRI_FwEventIdType " %d %" PRIu32 " %" PRIu32 " %d %s";
+
+    }
+
+    static_assert(Fw::LogRing::STRING_SIZE >= FW_LOG_TEXT_BUFFER_SIZE,
+                  "a deferred log text must hold the text of the log message");
+
     // ----------------------------------------------------------------------
     // Initialization/Exiting
     // ----------------------------------------------------------------------
 
     ActiveTextLogger::ActiveTextLogger(const char* name) :
         ActiveTextLoggerComponentBase(name),
-        m_log_file()
+        m_log_file(),
+        m_ring(nullptr),
+        m_deferred_fw_logger(false),
+        m_reported_drops(0)
     {
 
     }
 
     ActiveTextLogger::~ActiveTextLogger()
     {
-
+        if (this->m_deferred_fw_logger and (Fw::Logger::getRing() == this->m_ring)) {
+            Fw::Logger::registerRing(nullptr);
+        }
     }
 
     // ----------------------------------------------------------------------
@@ -43,10 +60,128 @@ namespace Svc {
             return;
         }
 
+        // Deferred formatting copies the text with its id, time tag and severity,
+        // to be formatted on the component thread. FATAL texts are formatted here,
+        // as the fatal handler may stop the system before the ring is drained.
+        if ((this->m_ring != nullptr) and (Fw::LogSeverity::FATAL != severity.e)) {
+            (void) this->m_ring->push(EVENT_FORMAT,
+                                     id,
+                                     static_cast<int>(timeTag.getTimeBase()),
+                                     timeTag.getSeconds(),
+                                     timeTag.getUSeconds(),
+                                     static_cast<int>(severity.e),
+                                     text.toChar());
+            return;
+        }
+
         // Format the string here, so that it is done in the task context
-        // of the caller.  Format doc borrowed from PassiveTextLogger.
+        // of the caller.
+        char textStr[FW_INTERNAL_INTERFACE_STRING_MAX_SIZE];
+        if (not format_text(id, timeTag, severity.e, text.toChar(), textStr, sizeof(textStr))) {
+            return;
+        }
+
+        // Call internal interface so that everything else is done on component thread,
+        // this helps ensure consistent ordering of the printed text:
+        Fw::InternalInterfaceString intText(textStr);
+        this->TextQueue_internalInterfaceInvoke(intText);
+    }
+
+    // ----------------------------------------------------------------------
+    // Internal interface handlers
+    // ----------------------------------------------------------------------
+
+    void ActiveTextLogger::TextQueue_internalInterfaceHandler(const Fw::InternalInterfaceString& text)
+    {
+        // Deferred messages logged before the text are written first
+        if (this->m_ring != nullptr) {
+            this->drain_ring();
+        }
+        this->write_text(text);
+    }
+
+    void ActiveTextLogger::TextDrain_internalInterfaceHandler()
+    {
+        FW_ASSERT(this->m_ring != nullptr);
+        this->drain_ring();
+    }
+
+    void ActiveTextLogger::drain_ring()
+    {
+        // Messages pushed from here on send another TextDrain
+        this->m_ring->beginDrain();
+
+        Fw::LogRing::Record record;
+        char textStr[FW_INTERNAL_INTERFACE_STRING_MAX_SIZE];
+        while (this->m_ring->pop(record)) {
+            if (record.getFormat() == EVENT_FORMAT) {
+                const Fw::Time timeTag(static_cast<TimeBase>(record.getInteger(1)),
+                                       static_cast<U32>(record.getInteger(2)),
+                                       static_cast<U32>(record.getInteger(3)));
+                if (format_text(static_cast<FwEventIdType>(record.getInteger(0)),
+                                timeTag,
+                                static_cast<Fw::LogSeverity::T>(record.getInteger(4)),
+                                record.getString(5),
+                                textStr,
+                                sizeof(textStr))) {
+                    this->write_text(Fw::InternalInterfaceString(textStr));
+                }
+            }
+            else {
+                // Fw::Logger messages only go to the console, as when formatted by the caller
+                (void) record.format(textStr, sizeof(textStr));
+                Fw::Logger::log(Fw::String(textStr));
+            }
+        }
+
+        const U32 drops = this->m_ring->getDrops();
+        if (drops != this->m_reported_drops) {
+            (void) snprintf(textStr, sizeof(textStr),
+                            "DROPPED: %" PRIu32 " deferred log messages\n", drops - this->m_reported_drops);
+            this->m_reported_drops = drops;
+            this->write_text(Fw::InternalInterfaceString(textStr));
+        }
+    }
+
+    // ----------------------------------------------------------------------
+    // Helper Methods
+    // ----------------------------------------------------------------------
+
+    bool ActiveTextLogger::set_log_file(const char* fileName, const U32 maxSize, const U32 maxBackups)
+    {
+        FW_ASSERT(fileName != nullptr);
+
+        return this->m_log_file.set_log_file(fileName, maxSize, maxBackups);
+    }
+
+    void ActiveTextLogger::set_deferred_format(Fw::LogRing& ring, const bool fwLogger)
+    {
+        this->m_ring = &ring;
+        this->m_ring->setListener(this);
+        if (fwLogger) {
+            this->m_deferred_fw_logger = true;
+            Fw::Logger::registerRing(this->m_ring);
+        }
+    }
+
+    void ActiveTextLogger::logRingReady()
+    {
+        this->TextDrain_internalInterfaceInvoke();
+    }
+
+    bool ActiveTextLogger::format_text(FwEventIdType id,
+                                       const Fw::Time& timeTag,
+                                       Fw::LogSeverity::T severity,
+                                       const char* text,
+                                       char* textStr,
+                                       FwSizeType size)
+    {
+        FW_ASSERT(text != nullptr);
+        FW_ASSERT(textStr != nullptr);
+
+        // Format doc borrowed from PassiveTextLogger.
         const char *severityString = "UNKNOWN";
-        switch (severity.e) {
+        switch (severity) {
             case Fw::LogSeverity::FATAL:
                 severityString = "FATAL";
                 break;
@@ -74,8 +209,6 @@ namespace Svc {
         }
 
         // TODO: Add calling task id to format string
-        char textStr[FW_INTERNAL_INTERFACE_STRING_MAX_SIZE];
-
         if (timeTag.getTimeBase() == TB_WORKSTATION_TIME) {
 
             time_t t = timeTag.getSeconds();
@@ -84,35 +217,27 @@ namespace Svc {
             // to ensure a successful call
             tm tm;
             if (localtime_r(&t, &tm) == nullptr) {
-                return;
+                return false;
             }
 
             (void) snprintf(textStr,
-                            FW_INTERNAL_INTERFACE_STRING_MAX_SIZE,
+                            size,
                             "EVENT: (%" PRI_FwEventIdType ") (%04d-%02d-%02dT%02d:%02d:%02d.%06" PRIu32 ") %s: %s\n",
                             id, tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday, tm.tm_hour,
                             tm.tm_min,tm.tm_sec,timeTag.getUSeconds(),
-                            severityString,text.toChar());
+                            severityString,text);
         }
         else {
 
             (void) snprintf(textStr,
-                            FW_INTERNAL_INTERFACE_STRING_MAX_SIZE,
+                            size,
                             "EVENT: (%" PRI_FwEventIdType ") (%" PRI_FwTimeBaseStoreType ":%" PRId32 ",%" PRId32 ") %s: %s\n",
-                            id, static_cast<FwTimeBaseStoreType>(timeTag.getTimeBase()),timeTag.getSeconds(),timeTag.getUSeconds(),severityString,text.toChar());
+                            id, static_cast<FwTimeBaseStoreType>(timeTag.getTimeBase()),timeTag.getSeconds(),timeTag.getUSeconds(),severityString,text);
         }
-
-        // Call internal interface so that everything else is done on component thread,
-        // this helps ensure consistent ordering of the printed text:
-        Fw::InternalInterfaceString intText(textStr);
-        this->TextQueue_internalInterfaceInvoke(intText);
+        return true;
     }
 
-    // ----------------------------------------------------------------------
-    // Internal interface handlers
-    // ----------------------------------------------------------------------
-
-    void ActiveTextLogger::TextQueue_internalInterfaceHandler(const Fw::InternalInterfaceString& text)
+    void ActiveTextLogger::write_text(const Fw::StringBase& text)
     {
 
         // Print to console:
@@ -123,16 +248,5 @@ namespace Svc {
 
     }
 
-    // ----------------------------------------------------------------------
-    // Helper Methods
-    // ----------------------------------------------------------------------
-
-    bool ActiveTextLogger::set_log_file(const char* fileName, const U32 maxSize, const U32 maxBackups)
-    {
-        FW_ASSERT(fileName != nullptr);
-
-        return this->m_log_file.set_log_file(fileName, maxSize, maxBackups);
-    }
-
 
 } // namespace Svc
@@ -9,6 +9,7 @@
 
 #include <Svc/ActiveTextLogger/ActiveTextLoggerComponentAc.hpp>
 #include <Svc/ActiveTextLogger/LogFile.hpp>
+#include <Fw/Logger/LogRing.hpp>
 
 
 namespace Svc {
@@ -19,9 +20,10 @@ namespace Svc {
     //! Similarly to the PassiveTextLogger, this component takes log texts
     //! and prints them to the console, but does so from a thread to keep
     //! consistent ordering.  It also provides the option to write the text
-    //! to a file as well.
+    //! to a file as well.  With deferred formatting, log texts and optionally
+    //! Fw::Logger messages are formatted on the thread as well.
 
-    class ActiveTextLogger: public ActiveTextLoggerComponentBase {
+    class ActiveTextLogger: public ActiveTextLoggerComponentBase, public Fw::LogRing::Listener {
 
         public:
 
@@ -51,6 +53,20 @@ namespace Svc {
             //!  \return true if creating the file was successful, false otherwise
             bool set_log_file(const char* fileName, const U32 maxSize, const U32 maxBackups = 10);
 
+            //!  \brief Defer formatting to the component thread
+            //!
+            //!  Log texts are copied with their id, time tag and severity into a
+            //!  lock-free ring and formatted by the component thread, instead of
+            //!  formatted by the caller and queued as a string.  FATAL log texts
+            //!  are still formatted by the caller.  Optionally the Fw::Logger::log
+            //!  calls of all threads are deferred to the same ring, in which case
+            //!  their format strings must be string literals.  Call before the
+            //!  thread is started.
+            //!
+            //!  \param ring The ring, which must outlive the component
+            //!  \param fwLogger Whether to defer the formatting of Fw::Logger::log calls
+            void set_deferred_format(Fw::LogRing& ring, const bool fwLogger);
+
 
         PRIVATE:
 
@@ -76,6 +92,32 @@ namespace Svc {
         // Member Functions
         // ----------------------------------------------------------------------
 
+        //! Format a log text with its id, time tag and severity
+        //!
+        //! \return true if the text was formatted
+        static bool format_text(
+            FwEventIdType id, /*!< Log ID*/
+            const Fw::Time& timeTag, /*!< Time Tag*/
+            Fw::LogSeverity::T severity, /*!< The severity*/
+            const char* text, /*!< Text of log message*/
+            char* textStr, /*!< The formatted text*/
+            FwSizeType size /*!< The size of the formatted text buffer*/
+        );
+
+        //! Write formatted text to the console and the optional file
+        //!
+        void write_text(
+            const Fw::StringBase& text /*!< The formatted text*/
+        );
+
+        //! Format and write the deferred messages
+        //!
+        void drain_ring();
+
+        //! Notification of deferred messages, from the calling thread
+        //!
+        void logRingReady() override;
+
         // ----------------------------------------------------------------------
         // Handlers to implement for typed input ports
         // ----------------------------------------------------------------------
@@ -100,6 +142,10 @@ namespace Svc {
             const Fw::InternalInterfaceString& text /*!< The text string*/
         );
 
+        //! Internal Interface handler for TextDrain
+        //!
+        virtual void TextDrain_internalInterfaceHandler();
+
         // ----------------------------------------------------------------------
         // Member Variables
         // ----------------------------------------------------------------------
@@ -107,6 +153,15 @@ namespace Svc {
         // The optional file to text logs to:
         LogFile m_log_file;
 
+        // The deferred messages, or nullptr when formatting in the caller:
+        Fw::LogRing* m_ring;
+
+        // Whether the Fw::Logger::log calls are deferred:
+        bool m_deferred_fw_logger;
+
+        // The number of dropped deferred messages last reported:
+        U32 m_reported_drops;
+
     };
 
 }
@@ -0,0 +1,25 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "ActiveTextLoggerTester.hpp"
+
+TEST(Nominal, Console) {
+    Svc::ActiveTextLoggerTester tester;
+    tester.run_nominal_test();
+}
+
+TEST(OffNominal, Files) {
+    Svc::ActiveTextLoggerTester tester;
+    tester.run_off_nominal_test();
+}
+
+TEST(Nominal, DeferredFormat) {
+    Svc::ActiveTextLoggerTester tester;
+    tester.run_deferred_test();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
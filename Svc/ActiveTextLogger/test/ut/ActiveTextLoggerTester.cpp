@@ -5,7 +5,9 @@
 
 #include "ActiveTextLoggerTester.hpp"
 #include "Fw/Types/StringUtils.hpp"
+#include "Fw/Logger/Logger.hpp"
 #include <fstream>
+#include <ctime>
 
 
 #define INSTANCE 0
@@ -21,6 +23,7 @@ namespace Svc {
   ActiveTextLoggerTester ::
     ActiveTextLoggerTester() :
       ActiveTextLoggerGTestBase("Tester", MAX_HISTORY_SIZE),
+      ring(),
       component("ActiveTextLogger")
   {
     this->initComponents();
@@ -347,6 +350,97 @@ namespace Svc {
 
   }
 
+  void ActiveTextLoggerTester ::
+  run_deferred_test()
+  {
+      printf("Testing deferred formatting\n");
+
+      this->component.set_deferred_format(this->ring, true);
+      ASSERT_EQ(&this->ring, Fw::Logger::getRing());
+      bool stat = this->component.set_log_file("test_file_deferred",512);
+      ASSERT_TRUE(stat);
+
+      // Log texts and Fw::Logger messages queue a single drain
+      FwEventIdType id = 6;
+      Fw::Time timeTag(TB_NONE,7,10);
+      Fw::LogSeverity severity = Fw::LogSeverity::COMMAND;
+      Fw::TextLogString text("This component is deferred!");
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      Fw::Logger::log("Fw::Logger message %d\n", 5);
+      Fw::Time workstationTime(TB_WORKSTATION_TIME,1700000000,123);
+      Fw::TextLogString workstationText("This component is deferred too!");
+      this->invoke_to_TextLogger(0,id+1,workstationTime,Fw::LogSeverity::ACTIVITY_LO,workstationText);
+      ASSERT_EQ(1U, this->component.m_queue.getMessagesAvailable());
+      ASSERT_EQ(0U, this->component.m_log_file.m_currentFileSize);
+
+      // The component thread formats them
+      this->component.doDispatch();
+      ASSERT_EQ(0U, this->component.m_queue.getMessagesAvailable());
+
+      char expected[2][512];
+      snprintf(expected[0], sizeof(expected[0]),
+              "EVENT: (%d) (%d:%d,%d) %s: %s",
+               id,timeTag.getTimeBase(),timeTag.getSeconds(),timeTag.getUSeconds(),"COMMAND",text.toChar());
+      time_t t = workstationTime.getSeconds();
+      tm tm;
+      ASSERT_NE(nullptr, localtime_r(&t, &tm));
+      snprintf(expected[1], sizeof(expected[1]),
+              "EVENT: (%d) (%04d-%02d-%02dT%02d:%02d:%02d.%06d) %s: %s",
+               id+1,tm.tm_year + 1900,tm.tm_mon + 1,tm.tm_mday,tm.tm_hour,tm.tm_min,tm.tm_sec,
+               workstationTime.getUSeconds(),"ACTIVITY_LO",workstationText.toChar());
+
+      // Fw::Logger messages only go to the console
+      std::ifstream stream("test_file_deferred");
+      U32 lines = 0;
+      while(stream) {
+          char buf[256];
+          stream.getline(buf,256);
+          if (stream) {
+              std::cout << "readLine: " << buf << std::endl;
+              ASSERT_LT(lines, 2U);
+              ASSERT_EQ(0,strcmp(expected[lines],buf));
+              lines++;
+          }
+      }
+      stream.close();
+      ASSERT_EQ(2U, lines);
+
+      // Another message queues another drain
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      ASSERT_EQ(1U, this->component.m_queue.getMessagesAvailable());
+      this->component.doDispatch();
+      ASSERT_EQ(strlen(expected[0]) + strlen(expected[1]) + strlen(expected[0]) + 3,
+                this->component.m_log_file.m_currentFileSize);
+
+      // FATAL texts are formatted by the caller and queued, after the deferred messages logged before them
+      const FwSizeType fileSize = this->component.m_log_file.m_currentFileSize;
+      this->invoke_to_TextLogger(0,id,timeTag,severity,text);
+      Fw::TextLogString fatalText("This component is not deferred!");
+      this->invoke_to_TextLogger(0,id+2,timeTag,Fw::LogSeverity::FATAL,fatalText);
+      ASSERT_EQ(2U, this->component.m_queue.getMessagesAvailable());
+      this->component.doDispatch();
+      this->component.doDispatch();
+      char fatalExpected[512];
+      snprintf(fatalExpected, sizeof(fatalExpected),
+              "EVENT: (%d) (%d:%d,%d) %s: %s",
+               id+2,timeTag.getTimeBase(),timeTag.getSeconds(),timeTag.getUSeconds(),"FATAL",fatalText.toChar());
+      ASSERT_EQ(fileSize + strlen(expected[0]) + strlen(fatalExpected) + 2,
+                this->component.m_log_file.m_currentFileSize);
+      std::ifstream fatalStream("test_file_deferred");
+      char buf[256];
+      for (U32 line = 0; line < 4; line++) {
+          fatalStream.getline(buf,256);
+      }
+      ASSERT_TRUE(fatalStream);
+      ASSERT_EQ(0,strcmp(expected[0],buf));
+      fatalStream.getline(buf,256);
+      ASSERT_TRUE(fatalStream);
+      ASSERT_EQ(0,strcmp(fatalExpected,buf));
+      fatalStream.close();
+
+      remove("test_file_deferred");
+  }
+
   // ----------------------------------------------------------------------
   // Helper methods
   // ----------------------------------------------------------------------
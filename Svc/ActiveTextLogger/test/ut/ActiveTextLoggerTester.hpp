@@ -37,6 +37,7 @@ namespace Svc {
 
       void run_nominal_test();
       void run_off_nominal_test();
+      void run_deferred_test();
 
     private:
 
@@ -58,6 +59,10 @@ namespace Svc {
       // Variables
       // ----------------------------------------------------------------------
 
+      //! The ring of deferred messages, which outlives the component
+      //!
+      Fw::LogRing ring;
+
       //! The component under test
       //!
       ActiveTextLogger component;
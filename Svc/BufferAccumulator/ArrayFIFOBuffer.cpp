@@ -25,8 +25,11 @@ BufferAccumulator::ArrayFIFOBuffer ::ArrayFIFOBuffer()
     : m_elements(nullptr),
       m_capacity(0),
       m_enqueueIndex(0),
+      m_dequeueCache(0),
+      m_highWater(0),
+      m_overflows(0),
       m_dequeueIndex(0),
-      m_size(0)
+      m_enqueueCache(0)
 {
 }
 
@@ -40,6 +43,10 @@ void BufferAccumulator::ArrayFIFOBuffer ::init(Fw::Buffer* const elements,
                                                NATIVE_UINT_TYPE capacity) {
   this->m_elements = elements;
   this->m_capacity = capacity;
+  this->m_enqueueIndex = 0;
+  this->m_dequeueCache = 0;
+  this->m_dequeueIndex = 0;
+  this->m_enqueueCache = 0;
 
   // Construct all elements
   for (NATIVE_UINT_TYPE idx = 0; idx < capacity; idx++) {
@@ -53,19 +60,32 @@ bool BufferAccumulator::ArrayFIFOBuffer ::enqueue(const Fw::Buffer& e) {
     return false;
   }
 
-  bool status;
-  if (this->m_size < this->m_capacity) {
-    // enqueueIndex is unsigned, no need to compare with 0
-    FW_ASSERT(m_enqueueIndex < this->m_capacity, static_cast<FwAssertArgType>(m_enqueueIndex));
-    this->m_elements[this->m_enqueueIndex] = e;
-    this->m_enqueueIndex = (this->m_enqueueIndex + 1) % this->m_capacity;
-    status = true;
-    this->m_size++;
-  } else {
-    status = false;
+  const NATIVE_UINT_TYPE enqueueIndex = this->m_enqueueIndex.load(std::memory_order_relaxed);
+  if (this->distance(enqueueIndex, this->m_dequeueCache) >= this->m_capacity) {
+    // looks full, see whether the consumer has moved on since last checked
+    this->m_dequeueCache = this->m_dequeueIndex.load(std::memory_order_acquire);
+    if (this->distance(enqueueIndex, this->m_dequeueCache) >= this->m_capacity) {
+      this->m_overflows.store(this->m_overflows.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      return false;
+    }
   }
 
-  return status;
+  const NATIVE_UINT_TYPE slot = enqueueIndex % this->m_capacity;
+  this->m_elements[slot] = e;
+  const NATIVE_UINT_TYPE nextIndex = this->next(enqueueIndex);
+  this->m_enqueueIndex.store(nextIndex, std::memory_order_release);
+
+  // the cached dequeue index may be stale and overstate the size, so only a
+  // possible new high water mark pays for reloading it
+  const U32 highWater = this->m_highWater.load(std::memory_order_relaxed);
+  if (this->distance(nextIndex, this->m_dequeueCache) > highWater) {
+    this->m_dequeueCache = this->m_dequeueIndex.load(std::memory_order_acquire);
+    const U32 size = static_cast<U32>(this->distance(nextIndex, this->m_dequeueCache));
+    if (size > highWater) {
+      this->m_highWater.store(size, std::memory_order_relaxed);
+    }
+  }
+  return true;
 }
 
 bool BufferAccumulator::ArrayFIFOBuffer ::dequeue(Fw::Buffer& e) {
@@ -74,29 +94,53 @@ bool BufferAccumulator::ArrayFIFOBuffer ::dequeue(Fw::Buffer& e) {
     return false;
   }
 
-  FW_ASSERT(this->m_elements);
-  bool status;
-
-  if (this->m_size > 0) {
-    // dequeueIndex is unsigned, no need to compare with 0
-    FW_ASSERT(m_dequeueIndex < this->m_capacity, static_cast<FwAssertArgType>(m_dequeueIndex));
-    e = this->m_elements[this->m_dequeueIndex];
-    this->m_dequeueIndex = (this->m_dequeueIndex + 1) % this->m_capacity;
-    this->m_size--;
-    status = true;
-  } else {
-    status = false;
+  const NATIVE_UINT_TYPE dequeueIndex = this->m_dequeueIndex.load(std::memory_order_relaxed);
+  if (dequeueIndex == this->m_enqueueCache) {
+    // looks empty, see whether the producer has moved on since last checked
+    this->m_enqueueCache = this->m_enqueueIndex.load(std::memory_order_acquire);
+    if (dequeueIndex == this->m_enqueueCache) {
+      return false;
+    }
   }
 
-  return status;
+  const NATIVE_UINT_TYPE slot = dequeueIndex % this->m_capacity;
+  e = this->m_elements[slot];
+  this->m_dequeueIndex.store(this->next(dequeueIndex), std::memory_order_release);
+  return true;
 }
 
 U32 BufferAccumulator::ArrayFIFOBuffer ::getSize() const {
-  return this->m_size;
+  // read the dequeue index first so a concurrent enqueue can only grow the result
+  const NATIVE_UINT_TYPE dequeueIndex = this->m_dequeueIndex.load(std::memory_order_acquire);
+  const NATIVE_UINT_TYPE enqueueIndex = this->m_enqueueIndex.load(std::memory_order_acquire);
+  return static_cast<U32>(this->distance(enqueueIndex, dequeueIndex));
 }
 
 U32 BufferAccumulator::ArrayFIFOBuffer ::getCapacity() const {
   return this->m_capacity;
 }
 
+U32 BufferAccumulator::ArrayFIFOBuffer ::getHighWater() const {
+  return this->m_highWater.load(std::memory_order_relaxed);
+}
+
+U32 BufferAccumulator::ArrayFIFOBuffer ::getOverflows() const {
+  return this->m_overflows.load(std::memory_order_relaxed);
+}
+
+// ----------------------------------------------------------------------
+// Private helper methods
+// ----------------------------------------------------------------------
+
+NATIVE_UINT_TYPE BufferAccumulator::ArrayFIFOBuffer ::next(NATIVE_UINT_TYPE index) const {
+  index++;
+  return (index == 2 * this->m_capacity) ? 0 : index;
+}
+
+NATIVE_UINT_TYPE BufferAccumulator::ArrayFIFOBuffer ::distance(NATIVE_UINT_TYPE enqueueIndex,
+                                                               NATIVE_UINT_TYPE dequeueIndex) const {
+  return (enqueueIndex >= dequeueIndex) ? (enqueueIndex - dequeueIndex)
+                                        : (enqueueIndex + 2 * this->m_capacity - dequeueIndex);
+}
+
 }  // namespace Svc
@@ -32,6 +32,8 @@ BufferAccumulator ::
       m_send(false),
       m_waitForBuffer(false),
       m_numWarnings(0u),
+      m_reportedOverflows(0u),
+      m_directFillPending(false),
       m_numDrained(0u),
       m_numToDrain(0u),
       m_opCode(),
@@ -86,7 +88,18 @@ void BufferAccumulator ::bufferSendInFill_handler(const NATIVE_INT_TYPE portNum,
     this->sendStoredBuffer();
   }
 
-  this->tlmWrite_BA_NumQueuedBuffers(this->m_bufferQueue.getSize());
+  this->writeQueueTelemetry();
+}
+
+void BufferAccumulator ::bufferSendInFillDirect_handler(const NATIVE_INT_TYPE portNum,
+                                                        Fw::Buffer& buffer) {
+
+  // runs on the caller's thread: enqueue, then leave draining and reporting
+  // to the component thread with at most one message queued at a time
+  (void) this->m_bufferQueue.enqueue(buffer);
+  if (!this->m_directFillPending.exchange(true)) {
+    this->directFilled_internalInterfaceInvoke();
+  }
 }
 
 void BufferAccumulator ::bufferSendInReturn_handler(
@@ -107,6 +120,35 @@ void BufferAccumulator ::pingIn_handler(const NATIVE_INT_TYPE portNum,
   this->pingOut_out(0, key);
 }
 
+// ----------------------------------------------------------------------
+// Internal interface handler implementations
+// ----------------------------------------------------------------------
+
+void BufferAccumulator ::directFilled_internalInterfaceHandler() {
+
+  // clear first so buffers enqueued from here on send another message. An
+  // exchange rather than a store, so buffers enqueued before the producer last
+  // found the flag set are visible below.
+  (void) this->m_directFillPending.exchange(false);
+
+  const U32 overflows = this->m_bufferQueue.getOverflows();
+  if (overflows != this->m_reportedOverflows) {
+    if (this->m_numWarnings == 0) {
+      this->log_WARNING_HI_BA_QueueFull();
+    }
+    this->m_numWarnings += overflows - this->m_reportedOverflows;
+    this->m_reportedOverflows = overflows;
+  } else if (this->m_numWarnings > 0) {
+    this->log_ACTIVITY_HI_BA_BufferAccepted();
+    this->m_numWarnings = 0;
+  }
+  if (this->m_send) {
+    this->sendStoredBuffer();
+  }
+
+  this->writeQueueTelemetry();
+}
+
 // ----------------------------------------------------------------------
 // Command handler implementations
 // ----------------------------------------------------------------------
@@ -225,7 +267,13 @@ void BufferAccumulator ::sendStoredBuffer() {
     this->cmdResponse_out(this->m_opCode, this->m_cmdSeq, Fw::CmdResponse::OK);
   }
 
+  this->writeQueueTelemetry();
+}
+
+void BufferAccumulator ::writeQueueTelemetry() {
   this->tlmWrite_BA_NumQueuedBuffers(this->m_bufferQueue.getSize());
+  this->tlmWrite_BA_QueueHighWater(this->m_bufferQueue.getHighWater());
+  this->tlmWrite_BA_NumOverflows(this->m_bufferQueue.getOverflows());
 }
 
 }  // namespace Svc
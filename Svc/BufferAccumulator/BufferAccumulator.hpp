@@ -18,6 +18,8 @@
 #include "Os/Queue.hpp"
 #include "Svc/BufferAccumulator/BufferAccumulatorComponentAc.hpp"
 
+#include <atomic>
+
 namespace Svc {
 
     class BufferAccumulator : public BufferAccumulatorComponentBase {
@@ -27,7 +29,12 @@ namespace Svc {
         // Types
         // ----------------------------------------------------------------------
 
-        //! A BufferLogger file
+        //! A single-producer single-consumer ring of buffers
+        //!
+        //! One thread may enqueue while another dequeues without a lock. Each
+        //! side publishes its own index and caches the index of the other
+        //! side, so a run of dequeues reloads the shared enqueue index only
+        //! once the buffers it last saw are used up.
         class ArrayFIFOBuffer {
             public:
                 //! Construct an ArrayFIFOBuffer object
@@ -40,13 +47,13 @@ namespace Svc {
                           NATIVE_UINT_TYPE capacity    //!< The capacity
                         );
 
-                //! Enqueue an index.
+                //! Enqueue an index. Called by the producer only.
                 //! Fails if the queue is full.
                 //! \return Whether the operation succeeded
                 bool enqueue(const Fw::Buffer& e  //!< The element to enqueue
                         );
 
-                //! Dequeue an index.
+                //! Dequeue an index. Called by the consumer only.
                 //! Fails if the queue is empty.
                 bool dequeue(Fw::Buffer& e  //!< The dequeued element
                         );
@@ -59,8 +66,28 @@ namespace Svc {
                 //! \return The capacity
                 U32 getCapacity() const;
 
+                //! Get the largest size the queue has reached
+                //! \return The high water mark
+                U32 getHighWater() const;
+
+                //! Get the number of enqueues that failed on a full queue
+                //! \return The overflow count
+                U32 getOverflows() const;
+
       PRIVATE:
 
+                // ----------------------------------------------------------------------
+                // Private helper methods
+                // ----------------------------------------------------------------------
+
+                //! Advance an index, which runs over twice the capacity so a
+                //! full queue can be told apart from an empty one
+                NATIVE_UINT_TYPE next(NATIVE_UINT_TYPE index) const;
+
+                //! The number of elements between two indices
+                NATIVE_UINT_TYPE distance(NATIVE_UINT_TYPE enqueueIndex,
+                                          NATIVE_UINT_TYPE dequeueIndex) const;
+
                 // ----------------------------------------------------------------------
                 // Private member variables
                 // ----------------------------------------------------------------------
@@ -71,14 +98,26 @@ namespace Svc {
                 //! The capacity of the queue
                 NATIVE_UINT_TYPE m_capacity;
 
-                //! The enqueue index
-                NATIVE_UINT_TYPE m_enqueueIndex;
+                //! The enqueue index, written by the producer
+                std::atomic<NATIVE_UINT_TYPE> m_enqueueIndex;
+
+                //! The producer's copy of the dequeue index
+                NATIVE_UINT_TYPE m_dequeueCache;
+
+                //! The high water mark, written by the producer
+                std::atomic<U32> m_highWater;
+
+                //! The overflow count, written by the producer
+                std::atomic<U32> m_overflows;
+
+                //! Keeps the producer and consumer indices on separate cache lines
+                U8 m_padding[64];
 
-                //! The dequeue index
-                NATIVE_UINT_TYPE m_dequeueIndex;
+                //! The dequeue index, written by the consumer
+                std::atomic<NATIVE_UINT_TYPE> m_dequeueIndex;
 
-                //! The size of the queue
-                NATIVE_UINT_TYPE m_size;
+                //! The consumer's copy of the enqueue index
+                NATIVE_UINT_TYPE m_enqueueCache;
         };  // class ArrayFIFOBuffer
 
         public:
@@ -123,6 +162,12 @@ namespace Svc {
                     const NATIVE_INT_TYPE portNum,  //!< The port number
                     Fw::Buffer& buffer);
 
+        //! Handler implementation for bufferSendInFillDirect
+        //!
+        void bufferSendInFillDirect_handler(
+                const NATIVE_INT_TYPE portNum,  //!< The port number
+                Fw::Buffer& buffer);
+
         //! Handler implementation for bufferSendInReturn
         //!
         void bufferSendInReturn_handler(
@@ -135,6 +180,16 @@ namespace Svc {
                             U32 key  //!< Value to return to pinger
                             );
 
+      PRIVATE:
+
+        // ----------------------------------------------------------------------
+        // Internal interface handler implementations
+        // ----------------------------------------------------------------------
+
+        //! Internal interface handler for directFilled
+        //! Drain and report the buffers enqueued on bufferSendInFillDirect
+        void directFilled_internalInterfaceHandler();
+
       PRIVATE:
 
         // ----------------------------------------------------------------------
@@ -165,6 +220,9 @@ namespace Svc {
         //! Send a stored buffer
         void sendStoredBuffer();
 
+        //! Write the queue telemetry
+        void writeQueueTelemetry();
+
       PRIVATE:
 
         // ----------------------------------------------------------------------
@@ -191,6 +249,12 @@ namespace Svc {
         //! operation
         U32 m_numWarnings;
 
+        //! The overflow count last reported for bufferSendInFillDirect
+        U32 m_reportedOverflows;
+
+        //! Whether a directFilled message is queued and not yet handled
+        std::atomic<bool> m_directFillPending;
+
         //! The number of buffers drained in a partial drain command
         U32 m_numDrained;
 
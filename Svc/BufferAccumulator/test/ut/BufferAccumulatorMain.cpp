@@ -11,6 +11,7 @@
 // ======================================================================
 
 #include "Accumulate.hpp"
+#include "Direct.hpp"
 #include "Drain.hpp"
 #include "Errors.hpp"
 #include "Health.hpp"
@@ -53,6 +54,25 @@ TEST(TestPartialDrain, OK) {
   tester.PartialDrainOK();
 }
 
+// ----------------------------------------------------------------------
+// Test Direct
+// ----------------------------------------------------------------------
+
+TEST(TestDirect, OK) {
+  Svc::Direct::BufferAccumulatorTester tester;
+  tester.OK();
+}
+
+TEST(TestDirect, QueueFull) {
+  Svc::Direct::BufferAccumulatorTester tester;
+  tester.QueueFull();
+}
+
+TEST(TestDirect, DISABLED_Throughput) {
+  Svc::Direct::BufferAccumulatorTester tester;
+  tester.Throughput();
+}
+
 // ----------------------------------------------------------------------
 // Test Health
 // ----------------------------------------------------------------------
@@ -84,6 +84,10 @@ void BufferAccumulatorTester ::connectPorts() {
   this->connect_to_bufferSendInFill(
       0, this->component.get_bufferSendInFill_InputPort(0));
 
+  // bufferSendInFillDirect
+  this->connect_to_bufferSendInFillDirect(
+      0, this->component.get_bufferSendInFillDirect_InputPort(0));
+
   // bufferSendInReturn
   this->connect_to_bufferSendInReturn(
       0, this->component.get_bufferSendInReturn_InputPort(0));
@@ -0,0 +1,168 @@
+// ======================================================================
+// \title  Direct.cpp
+// \brief  Test enqueueing on the caller's thread
+//
+// \copyright
+// Copyright (c) 2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "Direct.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+#include "Fw/Types/MallocAllocator.hpp"
+
+#define BENCHMARK_BUFFERS 100000
+
+namespace Svc {
+
+namespace Direct {
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void BufferAccumulatorTester ::OK() {
+  ASSERT_EQ(BufferAccumulator_OpState::DRAIN, this->component.m_mode.e);
+  Fw::Buffer buffers[MAX_NUM_BUFFERS];
+  U8* data = new U8[10];
+  const U32 size = 10;
+  for (U32 i = 0; i < MAX_NUM_BUFFERS; ++i) {
+    const U32 bufferID = i;
+    Fw::Buffer b(data, size, bufferID);
+    buffers[i] = b;
+    // enqueued at once, sent once the component thread wakes
+    this->invoke_to_bufferSendInFillDirect(0, buffers[i]);
+    ASSERT_EQ(1u, this->component.m_bufferQueue.getSize());
+    ASSERT_from_bufferSendOutDrain_SIZE(i);
+    this->component.doDispatch();
+    ASSERT_from_bufferSendOutDrain_SIZE(i + 1);
+    ASSERT_from_bufferSendOutDrain(i, buffers[i]);
+    this->invoke_to_bufferSendInReturn(0, buffers[i]);
+    this->component.doDispatch();
+    ASSERT_from_bufferSendOutReturn(i, buffers[i]);
+  }
+  ASSERT_EVENTS_SIZE(0);
+
+  // buffers enqueued while waiting on a return are sent on the returns
+  this->clearHistory();
+  for (U32 i = 0; i < MAX_NUM_BUFFERS; ++i) {
+    this->invoke_to_bufferSendInFillDirect(0, buffers[i]);
+  }
+  this->component.doDispatch();
+  ASSERT_from_bufferSendOutDrain_SIZE(1);
+  for (U32 i = 0; i < MAX_NUM_BUFFERS; ++i) {
+    ASSERT_from_bufferSendOutDrain(i, buffers[i]);
+    this->invoke_to_bufferSendInReturn(0, buffers[i]);
+    this->component.doDispatch();
+  }
+  ASSERT_from_bufferSendOutDrain_SIZE(MAX_NUM_BUFFERS);
+  ASSERT_TLM_BA_QueueHighWater(0, MAX_NUM_BUFFERS);
+
+  delete[] data;
+}
+
+void BufferAccumulatorTester ::QueueFull() {
+  U8* data = new U8[10];
+  const U32 size = 10;
+  Fw::Buffer buffer(data, size);
+
+  this->sendCmd_BA_SetMode(0, 0, BufferAccumulator_OpState::ACCUMULATE);
+  this->component.doDispatch();
+  ASSERT_EQ(BufferAccumulator_OpState::ACCUMULATE, this->component.m_mode.e);
+
+  // Overfill the buffer queue; only one message reaches the component queue
+  for (U32 i = 0; i < MAX_NUM_BUFFERS + 2; ++i) {
+    this->invoke_to_bufferSendInFillDirect(0, buffer);
+  }
+  ASSERT_EQ(1U, this->component.m_queue.getMessagesAvailable());
+  this->component.doDispatch();
+  ASSERT_FROM_PORT_HISTORY_SIZE(0);
+  ASSERT_EVENTS_SIZE(1);
+  ASSERT_EVENTS_BA_QueueFull_SIZE(1);
+  ASSERT_TLM_BA_NumQueuedBuffers(0, MAX_NUM_BUFFERS);
+  ASSERT_TLM_BA_QueueHighWater(0, MAX_NUM_BUFFERS);
+  ASSERT_TLM_BA_NumOverflows(0, 2u);
+
+  // Make room and send another buffer
+  this->sendCmd_BA_DrainBuffers(0, 0, 1, BufferAccumulator_BlockMode::BLOCK);
+  this->component.doDispatch();
+  this->invoke_to_bufferSendInReturn(0, buffer);
+  this->component.doDispatch();
+  this->clearHistory();
+  this->invoke_to_bufferSendInFillDirect(0, buffer);
+  this->component.doDispatch();
+  ASSERT_EVENTS_SIZE(1);
+  ASSERT_EVENTS_BA_BufferAccepted_SIZE(1);
+  ASSERT_TLM_BA_NumOverflows(0, 2u);
+
+  delete[] data;
+}
+
+void BufferAccumulatorTester ::Throughput() {
+  Fw::MallocAllocator allocator;
+  this->component.deallocateQueue(allocator);
+  this->component.allocateQueue(0, allocator, BENCHMARK_BUFFERS);
+  U8 data[10];
+  Fw::Buffer buffer(data, sizeof(data));
+
+  for (U32 direct = 0; direct < 2; ++direct) {
+    const char* const path = (direct == 0) ? "bufferSendInFill" : "bufferSendInFillDirect";
+
+    // Accumulate every buffer, then drain them all
+    this->sendCmd_BA_SetMode(0, 0, BufferAccumulator_OpState::ACCUMULATE);
+    this->component.doDispatch();
+    this->clearHistory();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (U32 i = 0; i < BENCHMARK_BUFFERS; ++i) {
+      if (direct == 0) {
+        this->invoke_to_bufferSendInFill(0, buffer);
+        this->component.doDispatch();
+        this->clearHistory();
+      } else {
+        this->invoke_to_bufferSendInFillDirect(0, buffer);
+      }
+    }
+    while (this->component.m_queue.getMessagesAvailable() > 0) {
+      this->component.doDispatch();
+      this->clearHistory();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(BENCHMARK_BUFFERS, this->component.m_bufferQueue.getSize());
+    printf("accumulate %s: %.0f buffers/s\n", path, BENCHMARK_BUFFERS / elapsed.count());
+
+    this->sendCmd_BA_SetMode(0, 0, BufferAccumulator_OpState::DRAIN);
+    this->component.doDispatch();
+    for (U32 i = 0; i < BENCHMARK_BUFFERS; ++i) {
+      this->clearHistory();
+      this->invoke_to_bufferSendInReturn(0, buffer);
+      this->component.doDispatch();
+    }
+    ASSERT_EQ(0u, this->component.m_bufferQueue.getSize());
+
+    // Drain each buffer as it arrives
+    this->clearHistory();
+    start = std::chrono::steady_clock::now();
+    for (U32 i = 0; i < BENCHMARK_BUFFERS; ++i) {
+      if (direct == 0) {
+        this->invoke_to_bufferSendInFill(0, buffer);
+      } else {
+        this->invoke_to_bufferSendInFillDirect(0, buffer);
+      }
+      this->component.doDispatch();
+      this->invoke_to_bufferSendInReturn(0, buffer);
+      this->component.doDispatch();
+      this->clearHistory();
+    }
+    elapsed = std::chrono::steady_clock::now() - start;
+    printf("drain %s: %.0f buffers/s\n", path, BENCHMARK_BUFFERS / elapsed.count());
+  }
+}
+
+}  // namespace Direct
+
+}  // namespace Svc
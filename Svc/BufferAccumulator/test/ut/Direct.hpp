@@ -0,0 +1,41 @@
+// ======================================================================
+// \title  Direct.hpp
+// \brief  Test enqueueing on the caller's thread
+//
+// \copyright
+// Copyright (c) 2017 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef Svc_Direct_HPP
+#define Svc_Direct_HPP
+
+#include "BufferAccumulatorTester.hpp"
+
+namespace Svc {
+
+namespace Direct {
+
+class BufferAccumulatorTester : public Svc::BufferAccumulatorTester {
+ public:
+  // ----------------------------------------------------------------------
+  // Tests
+  // ----------------------------------------------------------------------
+
+  //! Send some buffers through bufferSendInFillDirect
+  void OK(void);
+
+  //! Overflow the queue through bufferSendInFillDirect
+  void QueueFull(void);
+
+  //! Measure buffers/s through bufferSendInFill and bufferSendInFillDirect
+  void Throughput(void);
+};
+
+}  // namespace Direct
+
+}  // namespace Svc
+
+#endif
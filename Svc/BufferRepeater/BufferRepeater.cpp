@@ -29,6 +29,14 @@ void BufferRepeater ::configure(BufferRepeater::BufferRepeaterFailureOption allo
     this->m_allocation_failure_response = allocation_failure_response;
 }
 
+Os::Queue::Status BufferRepeater ::configureQueuedPort(FwIndexType port,
+                                                       const Fw::StringBase& name,
+                                                       FwSizeType depth,
+                                                       FanOutHelper::Policy policy) {
+    FW_ASSERT((port >= 0) && (port < NUM_PORTOUT_OUTPUT_PORTS), port);
+    return this->configurePort(port, name, depth, Fw::Buffer::SERIALIZED_SIZE, policy);
+}
+
 bool BufferRepeater ::check_allocation(FwIndexType index,
                                        const Fw::Buffer& new_allocation,
                                        const Fw::Buffer& incoming_buffer) {
@@ -70,10 +78,43 @@ void BufferRepeater ::portIn_handler(NATIVE_INT_TYPE portNum, /*!< The port numb
                 // Clone the data and send it
                 ::memcpy(new_allocation.getData(), buffer.getData(), buffer.getSize());
                 new_allocation.setSize(buffer.getSize());
-                this->portOut_out(i, new_allocation);
+                if (this->isQueuedPort(i)) {
+                    U8 data[Fw::Buffer::SERIALIZED_SIZE];
+                    Fw::ExternalSerializeBuffer message(data, sizeof(data));
+                    const Fw::SerializeStatus status = new_allocation.serialize(message);
+                    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+                    if (not this->enqueue(i, message)) {
+                        // Dropped on a full queue, the copy is not sent
+                        this->deallocate_out(0, new_allocation);
+                    }
+                } else {
+                    this->portOut_out(i, new_allocation);
+                }
             }
         }
     }
     this->deallocate_out(0, buffer);
 }
+
+void BufferRepeater ::schedIn_handler(NATIVE_INT_TYPE portNum, U32 context) {
+    BufferRepeaterPortCounts lags;
+    BufferRepeaterPortCounts drops;
+    for (FwIndexType i = 0; i < NUM_PORTOUT_OUTPUT_PORTS; i++) {
+        lags[i] = static_cast<U32>(this->getPortLag(i));
+        drops[i] = this->getPortDrops(i);
+    }
+    this->tlmWrite_PortLag(lags);
+    this->tlmWrite_PortDrops(drops);
+}
+
+// ----------------------------------------------------------------------
+// FanOutHelper implementation
+// ----------------------------------------------------------------------
+
+void BufferRepeater ::drainPort(FwIndexType port, Fw::SerializeBufferBase& message) {
+    Fw::Buffer buffer;
+    const Fw::SerializeStatus status = buffer.deserialize(message);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    this->portOut_out(port, buffer);
+}
 }  // end namespace Svc
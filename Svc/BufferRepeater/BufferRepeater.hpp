@@ -14,10 +14,13 @@
 #define BufferRepeater_HPP
 
 #include "Svc/BufferRepeater/BufferRepeaterComponentAc.hpp"
+#include "Svc/FanOut/FanOutHelper.hpp"
 
 namespace Svc {
 
-class BufferRepeater : public BufferRepeaterComponentBase {
+class BufferRepeater : public BufferRepeaterComponentBase, public FanOutHelper {
+    static_assert(NUM_PORTOUT_OUTPUT_PORTS <= FAN_OUT_MAX_PORTS, "FAN_OUT_MAX_PORTS must cover every output port");
+
   public:
     /**
      * Set of responses to failures to allocate a buffer when requested
@@ -47,6 +50,21 @@ class BufferRepeater : public BufferRepeaterComponentBase {
      */
     void configure(BufferRepeaterFailureOption allocation_failure_response);
 
+    /**
+     * Deliver an output port from its own queue and task instead of the caller's thread. The copy for the port is
+     * still allocated and filled on the caller's thread, and is deallocated when the queue drops it. Call before
+     * startPorts.
+     * @param port: output port to queue
+     * @param name: name of the queue and of its task
+     * @param depth: queue depth
+     * @param policy: response to a full queue
+     * @return status of the queue creation
+     */
+    Os::Queue::Status configureQueuedPort(FwIndexType port,
+                                          const Fw::StringBase& name,
+                                          FwSizeType depth,
+                                          FanOutHelper::Policy policy);
+
   private:
     // ----------------------------------------------------------------------
     // Helper functions
@@ -72,6 +90,20 @@ class BufferRepeater : public BufferRepeaterComponentBase {
                         Fw::Buffer& Buffer       /*!< The serialization buffer*/
     );
 
+    //! Handler implementation for schedIn
+    //!
+    void schedIn_handler(NATIVE_INT_TYPE portNum, /*!< The port number*/
+                         U32 context              /*!< The call order*/
+    );
+
+    // ----------------------------------------------------------------------
+    // FanOutHelper implementation
+    // ----------------------------------------------------------------------
+
+    //! Send a queued buffer on its output port
+    //!
+    void drainPort(FwIndexType port, Fw::SerializeBufferBase& message) override;
+
     BufferRepeaterFailureOption m_allocation_failure_response;  //!< Local storage for configured response
 };
 
@@ -24,6 +24,11 @@ TEST(OffNominal, FatalMemoryResponse) {
     tester.testFailure(Svc::BufferRepeater::FATAL_ON_OUT_OF_MEMORY);
 }
 
+TEST(Nominal, TestQueued) {
+    Svc::BufferRepeaterTester tester;
+    tester.testQueued();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -5,9 +5,10 @@
 // ======================================================================
 
 #include "BufferRepeaterTester.hpp"
+#include <Fw/Types/String.hpp>
 
 #define INSTANCE 0
-#define MAX_HISTORY_SIZE 10
+#define MAX_HISTORY_SIZE 30
 
 namespace Svc {
 
@@ -20,7 +21,8 @@ BufferRepeaterTester ::BufferRepeaterTester()
       component("BufferRepeater"),
       m_port_index_history(MAX_HISTORY_SIZE),
       m_initial_buffer(),
-      m_failure(false) {
+      m_failure(false),
+      m_queued(false) {
     this->initComponents();
     this->connectPorts();
 }
@@ -100,6 +102,57 @@ void BufferRepeaterTester ::testFailure(BufferRepeater::BufferRepeaterFailureOpt
     m_initial_buffer.setData(nullptr);
 }
 
+void BufferRepeaterTester ::testQueued() {
+    const FwIndexType queued = 1;
+    const NATIVE_INT_TYPE num_ports = this->component.getNum_portOut_OutputPorts();
+    this->m_queued = true;
+    this->component.configure(BufferRepeater::FATAL_ON_OUT_OF_MEMORY);
+    ASSERT_EQ(this->component.configureQueuedPort(queued, Fw::String("RepeaterQ"), 1, FanOutHelper::DROP),
+              Os::Queue::Status::OP_OK);
+    m_initial_buffer.setSize(1024);
+    m_initial_buffer.setData(new U8[1024]);
+    for (U32 i = 0; i < m_initial_buffer.getSize(); i++) {
+        m_initial_buffer.getData()[i] = static_cast<U8>(i);
+    }
+
+    // The queue holds the copy of the first buffer for the queued port and drops the second
+    invoke_to_portIn(0, m_initial_buffer);
+    invoke_to_portIn(0, m_initial_buffer);
+    ASSERT_EVENTS_AllocationHardFailure_SIZE(0);
+    // The other ports are called on the caller's thread
+    ASSERT_from_portOut_SIZE(2 * (num_ports - 1));
+    // The dropped copy is deallocated along with the initial buffers
+    ASSERT_from_deallocate_SIZE(3);
+    ASSERT_NE(fromPortHistory_deallocate->at(1).fwBuffer.getData(), m_initial_buffer.getData());
+
+    this->invoke_to_schedIn(0, 0);
+    BufferRepeaterPortCounts lags;
+    BufferRepeaterPortCounts drops;
+    for (FwIndexType i = 0; i < BufferRepeaterPortCounts::SIZE; i++) {
+        lags[i] = (i == queued) ? 1 : 0;
+        drops[i] = (i == queued) ? 1 : 0;
+    }
+    ASSERT_TLM_PortLag_SIZE(1);
+    ASSERT_TLM_PortLag(0, lags);
+    ASSERT_TLM_PortDrops_SIZE(1);
+    ASSERT_TLM_PortDrops(0, drops);
+
+    // Stopping delivers the queued copy
+    this->component.startPorts();
+    this->component.stopPorts();
+    this->component.joinPorts();
+    ASSERT_from_portOut_SIZE(2 * num_ports - 1);
+    ASSERT_EQ(this->m_port_index_history.at(2 * num_ports - 2), queued);
+    for (NATIVE_INT_TYPE i = 0; i < 2 * num_ports - 1; i++) {
+        Fw::Buffer buffer_under_test = this->fromPortHistory_portOut->at(i).fwBuffer;
+        ASSERT_EQ(buffer_under_test.getSize(), m_initial_buffer.getSize());
+        ASSERT_EQ(::memcmp(buffer_under_test.getData(), m_initial_buffer.getData(), m_initial_buffer.getSize()), 0);
+        delete[] buffer_under_test.getData();
+    }
+    delete[] m_initial_buffer.getData();
+    m_initial_buffer.setData(nullptr);
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -120,7 +173,11 @@ Fw::Buffer BufferRepeaterTester ::from_allocate_handler(const NATIVE_INT_TYPE po
 
 void BufferRepeaterTester ::from_deallocate_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
     this->pushFromPortEntry_deallocate(fwBuffer);
-    EXPECT_EQ(fwBuffer.getData(), m_initial_buffer.getData()) << "Deallocated non-initial buffer";
+    if (fwBuffer.getData() != m_initial_buffer.getData()) {
+        // Only a copy dropped by a full queue is deallocated besides the initial buffer
+        EXPECT_TRUE(m_queued) << "Deallocated non-initial buffer";
+        delete[] fwBuffer.getData();
+    }
 }
 
 void BufferRepeaterTester ::from_portOut_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
@@ -146,6 +203,12 @@ void BufferRepeaterTester ::connectPorts() {
     // Time
     this->component.set_Time_OutputPort(0, this->get_from_Time(0));
 
+    // schedIn
+    this->connect_to_schedIn(0, this->component.get_schedIn_InputPort(0));
+
+    // tlmOut
+    this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+
     // allocate
     this->component.set_allocate_OutputPort(0, this->get_from_allocate(0));
 
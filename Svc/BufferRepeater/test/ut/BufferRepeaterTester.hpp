@@ -45,6 +45,10 @@ class BufferRepeaterTester : public BufferRepeaterGTestBase {
     //!
     void testFailure(BufferRepeater::BufferRepeaterFailureOption failure_option);
 
+    //! Test an output port delivered from a queue, dropping on a full queue
+    //!
+    void testQueued();
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for serial from ports
@@ -89,6 +93,7 @@ class BufferRepeaterTester : public BufferRepeaterGTestBase {
     History<NATIVE_INT_TYPE> m_port_index_history;
     Fw::Buffer m_initial_buffer;
     bool m_failure;
+    bool m_queued;
 };
 
 }  // end namespace Svc
@@ -26,6 +26,18 @@ namespace Svc {
 
   }
 
+  Os::Queue::Status ComSplitter ::
+    configureQueuedPort(
+        FwIndexType port,
+        const Fw::StringBase& name,
+        FwSizeType depth,
+        FanOutHelper::Policy policy
+    )
+  {
+    FW_ASSERT((port >= 0) && (port < NUM_COMOUT_OUTPUT_PORTS), port);
+    return this->configurePort(port, name, depth, FW_COM_BUFFER_MAX_SIZE, policy);
+  }
+
   // ----------------------------------------------------------------------
   // Handler implementations
   // ----------------------------------------------------------------------
@@ -44,11 +56,46 @@ namespace Svc {
 
     for(NATIVE_INT_TYPE i = 0; i < numPorts; i++) {
       if( isConnected_comOut_OutputPort(i) ) {
-        // Need to make a copy because we are passing by reference!:
-        Fw::ComBuffer dataToSend = data;
-        comOut_out(i, dataToSend, 0);
+        if( this->isQueuedPort(i) ) {
+          // The queue copies the data, a full queue drops or blocks per the port policy
+          (void) this->enqueue(i, data);
+        } else {
+          // Need to make a copy because we are passing by reference!:
+          Fw::ComBuffer dataToSend = data;
+          comOut_out(i, dataToSend, 0);
+        }
       }
     }
   }
 
+  void ComSplitter ::
+    schedIn_handler(
+        NATIVE_INT_TYPE portNum,
+        U32 context
+    )
+  {
+    ComSplitterPortCounts lags;
+    ComSplitterPortCounts drops;
+    for(FwIndexType i = 0; i < NUM_COMOUT_OUTPUT_PORTS; i++) {
+      lags[i] = static_cast<U32>(this->getPortLag(i));
+      drops[i] = this->getPortDrops(i);
+    }
+    this->tlmWrite_PortLag(lags);
+    this->tlmWrite_PortDrops(drops);
+  }
+
+  // ----------------------------------------------------------------------
+  // FanOutHelper implementation
+  // ----------------------------------------------------------------------
+
+  void ComSplitter ::
+    drainPort(
+        FwIndexType port,
+        Fw::SerializeBufferBase& message
+    )
+  {
+    Fw::ComBuffer dataToSend(message.getBuffAddr(), message.getBuffLength());
+    comOut_out(port, dataToSend, 0);
+  }
+
 }
@@ -8,14 +8,22 @@
 #define COMSPLITTER_HPP
 
 #include <Svc/ComSplitter/ComSplitterComponentAc.hpp>
+#include <Svc/FanOut/FanOutHelper.hpp>
 #include <Fw/Types/Assert.hpp>
 
 namespace Svc {
 
+  //! Copies each Com buffer to every connected output port
+  //!
+  //! Output ports are called in turn on the caller's thread, unless configured with configureQueuedPort to be
+  //! delivered from a queue and task of their own, so that a slow consumer only delays its own port.
   class ComSplitter :
-    public ComSplitterComponentBase
+    public ComSplitterComponentBase,
+    public FanOutHelper
   {
 
+      static_assert(NUM_COMOUT_OUTPUT_PORTS <= FAN_OUT_MAX_PORTS, "FAN_OUT_MAX_PORTS must cover every output port");
+
       // ----------------------------------------------------------------------
       // Friend class for whitebox testing
       // ----------------------------------------------------------------------
@@ -32,6 +40,15 @@ namespace Svc {
 
       ~ComSplitter();
 
+      //! Deliver an output port from its own queue and task. Call before startPorts.
+      //! \return The status of the queue creation
+      Os::Queue::Status configureQueuedPort(
+          FwIndexType port, //!< The output port
+          const Fw::StringBase& name, //!< The name of the queue and of its task
+          FwSizeType depth, //!< The queue depth
+          FanOutHelper::Policy policy //!< The response to a full queue
+      );
+
       // ----------------------------------------------------------------------
       // Handler implementations
       // ----------------------------------------------------------------------
@@ -44,6 +61,20 @@ namespace Svc {
           U32 context
       );
 
+      void schedIn_handler(
+          NATIVE_INT_TYPE portNum,
+          U32 context
+      );
+
+      // ----------------------------------------------------------------------
+      // FanOutHelper implementation
+      // ----------------------------------------------------------------------
+
+      void drainPort(
+          FwIndexType port,
+          Fw::SerializeBufferBase& message
+      ) override;
+
     };
 
 }
@@ -19,6 +19,20 @@ TEST(TestNominal,Nominal) {
 
 }
 
+TEST(TestNominal,Queued) {
+
+    Svc::ComSplitterTester tester;
+    tester.test_queued();
+
+}
+
+TEST(Benchmark,DISABLED_SlowConsumerLatency) {
+
+    Svc::ComSplitterTester tester;
+    tester.test_slowConsumerLatency();
+
+}
+
 
 #ifndef TGT_OS_TYPE_VXWORKS
 int main(int argc, char* argv[]) {
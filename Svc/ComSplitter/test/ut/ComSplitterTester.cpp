@@ -10,9 +10,13 @@
 // ======================================================================
 
 #include "ComSplitterTester.hpp"
+#include <Fw/Types/String.hpp>
+#include <Os/RawTime.hpp>
+#include <cstdio>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 100
+#define SLOW_PORT 2
 
 namespace Svc {
 
@@ -23,7 +27,10 @@ namespace Svc {
   ComSplitterTester ::
     ComSplitterTester() :
       ComSplitterGTestBase("Tester", MAX_HISTORY_SIZE),
-      component("ComSplitter")
+      component("ComSplitter"),
+      m_slowDelay(0),
+      m_countOnly(false),
+      m_received(0)
   {
     this->initComponents();
     this->connectPorts();
@@ -60,6 +67,91 @@ namespace Svc {
       }
   }
 
+  void ComSplitterTester ::
+  test_queued()
+  {
+      const FwIndexType queued = 1;
+      ASSERT_EQ(this->component.configureQueuedPort(queued, Fw::String("SplitterQ"), 1, FanOutHelper::DROP),
+                Os::Queue::Status::OP_OK);
+
+      // The queue holds the first buffer for the queued port and drops the second
+      U8 d[4] = {0xde,0xad,0xbe,0xef};
+      for(U8 i = 0; i < 2; i++){
+        d[0] = i;
+        Fw::ComBuffer buffer(d, sizeof(d));
+        invoke_to_comIn(0, buffer, 0);
+      }
+      // The other ports are called on the caller's thread
+      ASSERT_from_comOut_SIZE(4);
+
+      this->invoke_to_schedIn(0, 0);
+      ComSplitterPortCounts lags;
+      ComSplitterPortCounts drops;
+      for(FwIndexType i = 0; i < ComSplitterPortCounts::SIZE; i++){
+        lags[i] = (i == queued) ? 1 : 0;
+        drops[i] = (i == queued) ? 1 : 0;
+      }
+      ASSERT_TLM_PortLag_SIZE(1);
+      ASSERT_TLM_PortLag(0, lags);
+      ASSERT_TLM_PortDrops_SIZE(1);
+      ASSERT_TLM_PortDrops(0, drops);
+
+      // Stopping delivers the queued buffer
+      this->component.startPorts();
+      this->component.stopPorts();
+      this->component.joinPorts();
+      ASSERT_from_comOut_SIZE(5);
+      d[0] = 0;
+      assert_comOut(4, Fw::ComBuffer(d, sizeof(d)));
+  }
+
+  void ComSplitterTester ::
+  test_slowConsumerLatency()
+  {
+      const U32 numMessages = 200;
+      const U32 slowDelay = 2000;
+      this->m_countOnly = true;
+      this->m_slowDelay = slowDelay;
+      U8 d[256] = {0};
+      Fw::ComBuffer buffer(d, sizeof(d));
+
+      for(U32 mode = 0; mode < 3; mode++){
+        ComSplitterTester* tester = this;
+        ComSplitterTester queuedTester;
+        if (mode > 0) {
+          // A fresh component, since a port cannot be configured once started
+          tester = &queuedTester;
+          tester->m_countOnly = true;
+          tester->m_slowDelay = slowDelay;
+          const FanOutHelper::Policy policy = (mode == 1) ? FanOutHelper::DROP : FanOutHelper::BLOCK;
+          ASSERT_EQ(tester->component.configureQueuedPort(SLOW_PORT, Fw::String("SlowQ"), 16, policy),
+                    Os::Queue::Status::OP_OK);
+          tester->component.startPorts();
+        }
+        U64 total = 0;
+        U32 worst = 0;
+        for(U32 i = 0; i < numMessages; i++){
+          Os::RawTime start;
+          Os::RawTime end;
+          (void) start.now();
+          tester->invoke_to_comIn(0, buffer, 0);
+          (void) end.now();
+          U32 interval = 0;
+          (void) end.getDiffUsec(start, interval);
+          total += interval;
+          worst = FW_MAX(worst, interval);
+        }
+        if (mode > 0) {
+          tester->component.stopPorts();
+          tester->component.joinPorts();
+        }
+        const char* const names[] = {"synchronous", "queued, drop", "queued, block"};
+        printf("%-14s mean %6.1f us, max %6u us, slow port drops %u, messages received %u\n", names[mode],
+               static_cast<double>(total) / numMessages, worst, tester->component.getPortDrops(SLOW_PORT),
+               tester->m_received.load());
+      }
+  }
+
   void ComSplitterTester ::
     assert_comOut(
         const U32 index,
@@ -87,7 +179,14 @@ namespace Svc {
         U32 context
     )
   {
-    this->pushFromPortEntry_comOut(data, context);
+    if ((portNum == SLOW_PORT) && (this->m_slowDelay > 0)) {
+      (void) Os::Task::delay(Fw::TimeInterval(0, this->m_slowDelay));
+    }
+    if (this->m_countOnly) {
+      this->m_received++;
+    } else {
+      this->pushFromPortEntry_comOut(data, context);
+    }
   }
 
   // ----------------------------------------------------------------------
@@ -104,6 +203,24 @@ namespace Svc {
         this->component.get_comIn_InputPort(0)
     );
 
+    // schedIn
+    this->connect_to_schedIn(
+        0,
+        this->component.get_schedIn_InputPort(0)
+    );
+
+    // tlmOut
+    this->component.set_tlmOut_OutputPort(
+        0,
+        this->get_from_tlmOut(0)
+    );
+
+    // timeCaller
+    this->component.set_timeCaller_OutputPort(
+        0,
+        this->get_from_timeCaller(0)
+    );
+
     // Just connect 3 of 5:
     // comOut
     for (NATIVE_INT_TYPE i = 0; i < 3; ++i) {
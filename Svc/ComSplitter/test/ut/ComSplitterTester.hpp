@@ -14,6 +14,7 @@
 
 #include "ComSplitterGTestBase.hpp"
 #include "Svc/ComSplitter/ComSplitter.hpp"
+#include <atomic>
 
 namespace Svc {
 
@@ -44,6 +45,12 @@ namespace Svc {
 
       void test_nominal();
 
+      //! Test an output port delivered from a queue, dropping on a full queue
+      void test_queued();
+
+      //! Measure the comIn latency with one slow consumer, with and without a queue for it
+      void test_slowConsumerLatency();
+
     private:
 
       // ----------------------------------------------------------------------
@@ -87,6 +94,15 @@ namespace Svc {
       //!
       ComSplitter component;
 
+      //! Delay of the consumer on port SLOW_PORT, in microseconds, zero for none
+      U32 m_slowDelay;
+
+      //! Count the messages received instead of recording them, for calls from several threads
+      bool m_countOnly;
+
+      //! Messages received when counting
+      std::atomic<U32> m_received;
+
   };
 
 } // end namespace Svc
@@ -111,9 +111,7 @@ void Deframer ::route(Fw::Buffer& packetBuffer) {
     FwPacketDescriptorType packetType = Fw::ComPacket::FW_PACKET_UNKNOWN;
     Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
     {
-        Fw::SerializeBufferBase& serial = packetBuffer.getSerializeRepr();
-        status = serial.setBuffLen(packetBuffer.getSize());
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK);
+        Fw::ExternalSerializeBufferWithMemberCopy serial = packetBuffer.getDeserializer();
         status = serial.deserialize(packetType);
     }
 
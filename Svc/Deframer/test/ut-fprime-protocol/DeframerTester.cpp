@@ -44,7 +44,7 @@ namespace Svc {
     void DeframerTester ::sizeOverflow() {
         U8 data[FpFrameHeader::SIZE];
         Fw::Buffer buffer(data, sizeof data);
-        Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
+        Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getSerializer();
         Fw::SerializeStatus status = serialRepr.serialize(FpFrameHeader::START_WORD);
         ASSERT_EQ(status, Fw::FW_SERIALIZE_OK);
         FpFrameHeader::TokenType size = std::numeric_limits<U32>::max();
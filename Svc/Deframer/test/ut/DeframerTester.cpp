@@ -37,7 +37,7 @@ void DeframerTester::MockDeframer::test_interface(Fw::ComPacket::ComPacketType c
     U8 chars[sizeof descriptorType];
     m_interface->allocate(3042);
     Fw::Buffer buffer(chars, sizeof(chars));
-    buffer.getSerializeRepr().serialize(descriptorType);
+    buffer.getSerializer().serialize(descriptorType);
     m_interface->route(buffer);
 }
 
@@ -118,7 +118,7 @@ void DeframerTester ::testCommandPacketTooLarge() {
     ::memset(bytes, 0, sizeof bytes);
     Fw::Buffer buffer(bytes, sizeof bytes);
     // Serialize the packet type
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getSerializer();
     const FwPacketDescriptorType descriptorType =
         Fw::ComPacket::FW_PACKET_COMMAND;
     const Fw::SerializeStatus status =
@@ -151,7 +151,7 @@ void DeframerTester ::testBufferOutUnconnected() {
     ::memset(bytes, 0, sizeof bytes);
     Fw::Buffer buffer(bytes, sizeof bytes);
     // Serialize the packet type
-    Fw::SerializeBufferBase& serialRepr = buffer.getSerializeRepr();
+    Fw::ExternalSerializeBufferWithMemberCopy serialRepr = buffer.getSerializer();
     const FwPacketDescriptorType descriptorType =
         Fw::ComPacket::FW_PACKET_FILE;
     const Fw::SerializeStatus status =
@@ -211,6 +211,11 @@ namespace Svc {
                     this->log_WARNING_HI_FileHdrDesError(fullFile, desStat);
                 }
 
+                // compressed files are downlinked as is, and their size is the compressed size
+                if ((container.getFlags() & Fw::DpContainer::FLAG_COMPRESSED) != 0) {
+                    this->log_ACTIVITY_LO_CompressedFile(fullFile, static_cast<U64>(container.getDataSize()));
+                }
+
                 // add entry to catalog.
                 DpStateEntry entry;
                 entry.dir = static_cast<FwIndexType>(dir);
@@ -5,6 +5,7 @@
 // ======================================================================
 
 #include "FpConfig.hpp"
+#include "Fw/Types/Assert.hpp"
 #include "Svc/DpManager/DpManager.hpp"
 
 namespace Svc {
@@ -18,10 +19,65 @@ DpManager::DpManager(const char* const compName)
       numSuccessfulAllocations(0),
       numFailedAllocations(0),
       numDataProducts(0),
-      numBytes(0) {}
+      numBytes(0),
+      numReservedAllocations(0),
+      numBytesAllocated(0) {
+    for (FwSizeType& maxSize : this->sizeClassMaxSizes) {
+        maxSize = 0;
+    }
+    for (ProductStats& stats : this->productStats) {
+        stats = ProductStats();
+    }
+    for (Reservation& reservation : this->reservations) {
+        reservation = Reservation();
+    }
+}
 
 DpManager::~DpManager() {}
 
+void DpManager::configureSizeClass(FwIndexType sizeClass, FwSizeType maxSize) {
+    FW_ASSERT((sizeClass >= 0) && (sizeClass < DpManagerNumSizeClasses), static_cast<FwAssertArgType>(sizeClass));
+    this->sizeClassMaxSizes[sizeClass] = maxSize;
+}
+
+Fw::Success DpManager::reserve(FwDpIdType id, FwSizeType size, FwIndexType portNum) {
+    FW_ASSERT((portNum >= 0) && (portNum < DpManagerNumPorts), static_cast<FwAssertArgType>(portNum));
+    Os::ScopeLock lock(this->mutex);
+    for (Reservation& reservation : this->reservations) {
+        if (not reservation.valid) {
+            reservation.valid = true;
+            reservation.id = id;
+            reservation.size = size;
+            reservation.portNum = portNum;
+            reservation.sizeClass = NO_SIZE_CLASS;
+            reservation.buffer = Fw::Buffer();
+            return Fw::Success::SUCCESS;
+        }
+    }
+    return Fw::Success::FAILURE;
+}
+
+Fw::Success DpManager::unreserve(FwDpIdType id) {
+    Fw::Success status = Fw::Success::FAILURE;
+    Reservation released = Reservation();
+    {
+        Os::ScopeLock lock(this->mutex);
+        for (Reservation& reservation : this->reservations) {
+            if (reservation.valid && (reservation.id == id)) {
+                released = reservation;
+                reservation = Reservation();
+                status = Fw::Success::SUCCESS;
+                break;
+            }
+        }
+    }
+    // Return the held buffer with the mutex unlocked
+    if (released.buffer.isValid()) {
+        this->returnBuffer(released.portNum, released.sizeClass, released.buffer);
+    }
+    return status;
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
@@ -42,22 +98,32 @@ void DpManager::productRequestIn_handler(const NATIVE_INT_TYPE portNum, FwDpIdTy
 }
 
 void DpManager::productSendIn_handler(const NATIVE_INT_TYPE portNum, FwDpIdType id, const Fw::Buffer& buffer) {
-    // id is unused
-    (void)id;
     // Update state variables
     ++this->numDataProducts;
     this->numBytes += buffer.getSize();
+    // Update the statistics of the container ID
+    {
+        Os::ScopeLock lock(this->mutex);
+        ProductStats* const stats = this->findProductStats(id);
+        if (stats != nullptr) {
+            stats->bytesSent += buffer.getSize();
+        }
+    }
     // Send the buffer on productSendOut
     Fw::Buffer sendBuffer = buffer;
     this->productSendOut_out(portNum, sendBuffer);
 }
 
 void DpManager::schedIn_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+    // Replace the reserved buffers that have been handed out
+    this->refillReservations();
     // Emit telemetry
     this->tlmWrite_NumSuccessfulAllocations(this->numSuccessfulAllocations);
     this->tlmWrite_NumFailedAllocations(this->numFailedAllocations);
     this->tlmWrite_NumDataProducts(this->numDataProducts);
     this->tlmWrite_NumBytes(this->numBytes);
+    this->tlmWrite_NumReservedAllocations(this->numReservedAllocations);
+    this->tlmWrite_NumBytesAllocated(this->numBytesAllocated);
 }
 
 // ----------------------------------------------------------------------
@@ -69,6 +135,22 @@ void DpManager ::CLEAR_EVENT_THROTTLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq
     this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
 }
 
+void DpManager ::DUMP_PRODUCT_STATS_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    for (FwSizeType i = 0; i < DP_MANAGER_NUM_TRACKED_IDS; i++) {
+        // Copy the entry, so that the events are emitted with the mutex unlocked
+        ProductStats stats;
+        {
+            Os::ScopeLock lock(this->mutex);
+            stats = this->productStats[i];
+        }
+        if (stats.valid) {
+            this->log_ACTIVITY_LO_ProductStats(stats.id, stats.numAllocations, stats.numFailedAllocations,
+                                               stats.maxRequestSize, stats.bytesAllocated, stats.bytesSent);
+        }
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
 // ----------------------------------------------------------------------
 // Private helper functions
 // ----------------------------------------------------------------------
@@ -76,18 +158,146 @@ void DpManager ::CLEAR_EVENT_THROTTLE_cmdHandler(FwOpcodeType opCode, U32 cmdSeq
 Fw::Success DpManager::getBuffer(FwIndexType portNum, FwDpIdType id, FwSizeType size, Fw::Buffer& buffer) {
     // Set status
     Fw::Success status(Fw::Success::FAILURE);
-    // Get a buffer
-    buffer = this->bufferGetOut_out(portNum, static_cast<U32>(size));
-    if (buffer.isValid()) {
+    // Get a buffer, from the reservation of the ID if there is one
+    const bool reserved = this->takeReservedBuffer(id, size, buffer);
+    if (not reserved) {
+        FwIndexType sizeClass = NO_SIZE_CLASS;
+        buffer = this->allocateBuffer(portNum, size, sizeClass);
+    }
+    const bool valid = buffer.isValid();
+    if (valid) {
         // Buffer is valid
         ++this->numSuccessfulAllocations;
+        if (reserved) {
+            ++this->numReservedAllocations;
+        }
+        this->numBytesAllocated += buffer.getSize();
         status = Fw::Success::SUCCESS;
     } else {
         // Buffer is invalid
         ++this->numFailedAllocations;
         this->log_WARNING_HI_BufferAllocationFailed(id);
     }
+    // Update the statistics of the container ID
+    Os::ScopeLock lock(this->mutex);
+    ProductStats* const stats = this->findProductStats(id);
+    if (stats != nullptr) {
+        stats->maxRequestSize = FW_MAX(stats->maxRequestSize, size);
+        if (valid) {
+            ++stats->numAllocations;
+            stats->bytesAllocated += buffer.getSize();
+        } else {
+            ++stats->numFailedAllocations;
+        }
+    }
     return status;
 }
 
+Fw::Buffer DpManager::allocateBuffer(FwIndexType portNum, FwSizeType size, FwIndexType& sizeClass) {
+    Fw::Buffer buffer;
+    sizeClass = this->getSizeClass(size);
+    if (sizeClass != NO_SIZE_CLASS) {
+        // Keep requests of different sizes in separate pools, so that small
+        // requests cannot use up the buffers that large requests need
+        buffer = this->sizeClassGetOut_out(sizeClass, static_cast<U32>(size));
+    } else if (this->isConnected_bufferGetOut_OutputPort(portNum)) {
+        buffer = this->bufferGetOut_out(portNum, static_cast<U32>(size));
+    }
+    return buffer;
+}
+
+void DpManager::returnBuffer(FwIndexType portNum, FwIndexType sizeClass, Fw::Buffer& buffer) {
+    if (sizeClass != NO_SIZE_CLASS) {
+        if (this->isConnected_sizeClassSendOut_OutputPort(sizeClass)) {
+            this->sizeClassSendOut_out(sizeClass, buffer);
+        }
+    } else if (this->isConnected_bufferSendOut_OutputPort(portNum)) {
+        this->bufferSendOut_out(portNum, buffer);
+    }
+}
+
+FwIndexType DpManager::getSizeClass(FwSizeType size) {
+    FwIndexType result = NO_SIZE_CLASS;
+    for (FwIndexType sizeClass = 0; sizeClass < DpManagerNumSizeClasses; sizeClass++) {
+        const FwSizeType maxSize = this->sizeClassMaxSizes[sizeClass];
+        if ((maxSize >= size) && (maxSize > 0) && this->isConnected_sizeClassGetOut_OutputPort(sizeClass) &&
+            ((result == NO_SIZE_CLASS) || (maxSize < this->sizeClassMaxSizes[result]))) {
+            result = sizeClass;
+        }
+    }
+    return result;
+}
+
+bool DpManager::takeReservedBuffer(FwDpIdType id, FwSizeType size, Fw::Buffer& buffer) {
+    Os::ScopeLock lock(this->mutex);
+    for (Reservation& reservation : this->reservations) {
+        if (reservation.valid && (reservation.id == id) && reservation.buffer.isValid() &&
+            (size <= reservation.buffer.getSize())) {
+            buffer = reservation.buffer;
+            buffer.setSize(static_cast<Fw::Buffer::SizeType>(size));
+            reservation.buffer = Fw::Buffer();
+            return true;
+        }
+    }
+    return false;
+}
+
+void DpManager::refillReservations() {
+    // Only this function, which runs on the thread of the component, fills
+    // reservations. The mutex is released for the port call, so the
+    // reservation is checked again before the buffer is stored in it.
+    for (Reservation& reservation : this->reservations) {
+        FwSizeType size = 0;
+        FwDpIdType id = 0;
+        FwIndexType portNum = 0;
+        {
+            Os::ScopeLock lock(this->mutex);
+            if (reservation.valid && (not reservation.buffer.isValid())) {
+                id = reservation.id;
+                portNum = reservation.portNum;
+                size = reservation.size;
+                if (size == 0) {
+                    const ProductStats* const stats = this->findProductStats(reservation.id);
+                    size = (stats != nullptr) ? stats->maxRequestSize : 0;
+                }
+            }
+        }
+        if (size > 0) {
+            FwIndexType sizeClass = NO_SIZE_CLASS;
+            Fw::Buffer buffer = this->allocateBuffer(portNum, size, sizeClass);
+            bool stored = false;
+            {
+                Os::ScopeLock lock(this->mutex);
+                if (reservation.valid && (reservation.id == id) && (not reservation.buffer.isValid())) {
+                    reservation.sizeClass = sizeClass;
+                    reservation.buffer = buffer;
+                    stored = true;
+                }
+            }
+            // The reservation was released during the port call
+            if ((not stored) && buffer.isValid()) {
+                this->returnBuffer(portNum, sizeClass, buffer);
+            }
+        }
+    }
+}
+
+DpManager::ProductStats* DpManager::findProductStats(FwDpIdType id) {
+    ProductStats* freeStats = nullptr;
+    for (ProductStats& stats : this->productStats) {
+        if (stats.valid && (stats.id == id)) {
+            return &stats;
+        }
+        if ((not stats.valid) && (freeStats == nullptr)) {
+            freeStats = &stats;
+        }
+    }
+    if (freeStats != nullptr) {
+        *freeStats = ProductStats();
+        freeStats->valid = true;
+        freeStats->id = id;
+    }
+    return freeStats;
+}
+
 }  // end namespace Svc
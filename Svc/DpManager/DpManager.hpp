@@ -9,7 +9,9 @@
 
 #include <atomic>
 
+#include "Os/Mutex.hpp"
 #include "Svc/DpManager/DpManagerComponentAc.hpp"
+#include "config/DpCfg.hpp"
 #include "config/FppConstantsAc.hpp"
 
 namespace Svc {
@@ -36,6 +38,18 @@ class DpManager : public DpManagerComponentBase {
         DpManager::NUM_BUFFERGETOUT_OUTPUT_PORTS == static_cast<FwSizeType>(DpManagerNumPorts),
         "Number of buffer get out ports must equal DpManagerNumPorts"
     );
+    static_assert(
+        DpManager::NUM_SIZECLASSGETOUT_OUTPUT_PORTS == static_cast<FwSizeType>(DpManagerNumSizeClasses),
+        "Number of size class get out ports must equal DpManagerNumSizeClasses"
+    );
+    static_assert(
+        DpManager::NUM_BUFFERSENDOUT_OUTPUT_PORTS == static_cast<FwSizeType>(DpManagerNumPorts),
+        "Number of buffer send out ports must equal DpManagerNumPorts"
+    );
+    static_assert(
+        DpManager::NUM_SIZECLASSSENDOUT_OUTPUT_PORTS == static_cast<FwSizeType>(DpManagerNumSizeClasses),
+        "Number of size class send out ports must equal DpManagerNumSizeClasses"
+    );
     static_assert(
         DpManager::NUM_PRODUCTSENDIN_INPUT_PORTS == static_cast<FwSizeType>(DpManagerNumPorts),
         "Number of product send in ports must equal DpManagerNumPorts"
@@ -57,6 +71,31 @@ class DpManager : public DpManagerComponentBase {
     //! Destroy the DpManager
     ~DpManager();
 
+    //! Configure a size class
+    //! A request goes to the connected size class with the smallest maximum size
+    //! that holds it. A request that fits no size class goes to bufferGetOut.
+    void configureSizeClass(FwIndexType sizeClass,  //!< The size class, a port number of sizeClassGetOut
+                            FwSizeType maxSize      //!< The largest request for the size class, zero to disable it
+    );
+
+    //! Reserve a buffer for a container ID
+    //! DpManager gets the buffer on schedIn and hands it out to the next
+    //! request for the ID that fits in it, so that periodic products are not
+    //! refused once the pools run low. The buffer comes from the size class
+    //! holding the size, or else from bufferGetOut.
+    //! \return SUCCESS if the reservation was added, FAILURE if the reservation table is full
+    Fw::Success reserve(FwDpIdType id,              //!< The container ID
+                        FwSizeType size,            //!< The buffer size, zero for the largest request seen for the ID
+                        FwIndexType portNum = 0     //!< The bufferGetOut port used when no size class holds the size
+    );
+
+    //! Release the reservation of a container ID
+    //! A buffer held for the reservation goes back on the sizeClassSendOut or
+    //! bufferSendOut port matching the port it was got from.
+    //! \return SUCCESS if the reservation was released, FAILURE if the ID has no reservation
+    Fw::Success unreserve(FwDpIdType id  //!< The container ID
+    );
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -98,6 +137,55 @@ class DpManager : public DpManagerComponentBase {
                                          U32 cmdSeq            //!< The command sequence number
                                          ) override;
 
+    //! Handler implementation for command DUMP_PRODUCT_STATS
+    //!
+    //! Report the allocation statistics of each tracked container ID
+    void DUMP_PRODUCT_STATS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                       U32 cmdSeq            //!< The command sequence number
+                                       ) override;
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private types
+    // ----------------------------------------------------------------------
+
+    //! The allocation statistics of a container ID
+    struct ProductStats {
+        //! Whether the entry is in use
+        bool valid;
+        //! The container ID
+        FwDpIdType id;
+        //! The number of successful allocations
+        U32 numAllocations;
+        //! The number of failed allocations
+        U32 numFailedAllocations;
+        //! The largest requested size
+        FwSizeType maxRequestSize;
+        //! The number of bytes allocated
+        U64 bytesAllocated;
+        //! The number of bytes sent
+        U64 bytesSent;
+    };
+
+    //! A buffer reserved for a container ID
+    struct Reservation {
+        //! Whether the entry is in use
+        bool valid;
+        //! The container ID
+        FwDpIdType id;
+        //! The configured size, zero for the largest request seen
+        FwSizeType size;
+        //! The bufferGetOut port used when no size class holds the size
+        FwIndexType portNum;
+        //! The size class the buffer came from, or NO_SIZE_CLASS for bufferGetOut
+        FwIndexType sizeClass;
+        //! The reserved buffer, invalid when it has been handed out
+        Fw::Buffer buffer;
+    };
+
+    //! The index of no size class
+    static constexpr FwIndexType NO_SIZE_CLASS = -1;
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Private helper functions
@@ -111,6 +199,40 @@ class DpManager : public DpManagerComponentBase {
                           Fw::Buffer& buffer    //!< The buffer (output)
     );
 
+    //! Allocate a buffer from the size class holding the size, or else from bufferGetOut
+    //! \return The buffer, invalid if allocation failed
+    Fw::Buffer allocateBuffer(FwIndexType portNum,    //!< The bufferGetOut port number
+                              FwSizeType size,        //!< The requested size
+                              FwIndexType& sizeClass  //!< The size class used, or NO_SIZE_CLASS (output)
+    );
+
+    //! Return a reserved buffer to the port matching the one it was got from
+    void returnBuffer(FwIndexType portNum,    //!< The bufferGetOut port number
+                      FwIndexType sizeClass,  //!< The size class, or NO_SIZE_CLASS
+                      Fw::Buffer& buffer      //!< The buffer
+    );
+
+    //! Get the connected size class with the smallest maximum size that holds a size
+    //! \return The size class, or NO_SIZE_CLASS
+    FwIndexType getSizeClass(FwSizeType size  //!< The size
+    );
+
+    //! Take the reserved buffer of a container ID if the size fits in it
+    //! \return True if the buffer was taken
+    bool takeReservedBuffer(FwDpIdType id,       //!< The container ID
+                            FwSizeType size,     //!< The requested size
+                            Fw::Buffer& buffer  //!< The buffer (output)
+    );
+
+    //! Get buffers for the reservations that have handed theirs out
+    void refillReservations();
+
+    //! Find the statistics of a container ID, adding an entry if there is room
+    //! Call with the mutex locked
+    //! \return The statistics, or nullptr if the table is full
+    ProductStats* findProductStats(FwDpIdType id  //!< The container ID
+    );
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Private member variables
@@ -127,6 +249,25 @@ class DpManager : public DpManagerComponentBase {
 
     //! The number of bytes handled
     U64 numBytes;
+
+    //! The number of allocations served from reserved buffers
+    std::atomic<U32> numReservedAllocations;
+
+    //! The number of bytes allocated
+    std::atomic<U64> numBytesAllocated;
+
+    //! The largest request of each size class, zero when disabled
+    FwSizeType sizeClassMaxSizes[DpManagerNumSizeClasses];
+
+    //! The allocation statistics of the tracked container IDs
+    ProductStats productStats[DP_MANAGER_NUM_TRACKED_IDS];
+
+    //! The reserved buffers
+    Reservation reservations[DP_MANAGER_NUM_RESERVATIONS];
+
+    //! The mutex guarding the statistics and the reservations, which
+    //! productGetIn updates on the thread of the client
+    Os::Mutex mutex;
 };
 
 }  // end namespace Svc
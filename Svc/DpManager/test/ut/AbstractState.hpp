@@ -17,6 +17,7 @@
 #include "Fw/Types/Assert.hpp"
 #include "STest/Pick/Pick.hpp"
 #include "Svc/DpManager/DpManager.hpp"
+#include "config/DpCfg.hpp"
 #include "TestUtils/OnChangeChannel.hpp"
 #include "TestUtils/Option.hpp"
 
@@ -47,6 +48,22 @@ class AbstractState {
         INVALID
     };
 
+    //! The allocation statistics of a container ID
+    struct ProductStats {
+        //! The container ID
+        FwDpIdType id;
+        //! The number of successful allocations
+        U32 numAllocations;
+        //! The number of failed allocations
+        U32 numFailedAllocations;
+        //! The largest requested size
+        FwSizeType maxRequestSize;
+        //! The number of bytes allocated
+        U64 bytesAllocated;
+        //! The number of bytes sent
+        U64 bytesSent;
+    };
+
   public:
     // ----------------------------------------------------------------------
     // Constructors
@@ -60,10 +77,18 @@ class AbstractState {
           NumFailedAllocations(0),
           NumDataProducts(0),
           NumBytes(0),
+          NumReservedAllocations(0),
+          NumBytesAllocated(0),
           bufferGetOutPortNumOpt(),
+          sizeClassGetOutPortNumOpt(),
           productResponseOutPortNumOpt(),
           productSendOutPortNumOpt(),
-          bufferAllocationFailedEventCount(0) {}
+          bufferAllocationFailedEventCount(0),
+          numTrackedIds(0),
+          reservationIdOpt(),
+          reservationSize(0),
+          reservationBufferSize(0),
+          reservationSizeClass(true) {}
 
   public:
     // ----------------------------------------------------------------------
@@ -78,6 +103,56 @@ class AbstractState {
     //! Set the buffer size
     void setBufferSize(FwSizeType bufferSize) { this->bufferSizeOpt.set(bufferSize); }
 
+    //! Find the statistics of a container ID, adding an entry if there is room
+    //! \return The statistics, or nullptr if the table is full
+    ProductStats* findProductStats(FwDpIdType id) {
+        for (FwSizeType i = 0; i < this->numTrackedIds; i++) {
+            if (this->productStats[i].id == id) {
+                return &this->productStats[i];
+            }
+        }
+        ProductStats* stats = nullptr;
+        if (this->numTrackedIds < DP_MANAGER_NUM_TRACKED_IDS) {
+            stats = &this->productStats[this->numTrackedIds];
+            ++this->numTrackedIds;
+            *stats = ProductStats();
+            stats->id = id;
+        }
+        return stats;
+    }
+
+    //! Get the largest requested size of a container ID
+    FwSizeType getMaxRequestSize(FwDpIdType id) const {
+        for (FwSizeType i = 0; i < this->numTrackedIds; i++) {
+            if (this->productStats[i].id == id) {
+                return this->productStats[i].maxRequestSize;
+            }
+        }
+        return 0;
+    }
+
+    //! Record an allocation in the statistics of a container ID
+    void recordAllocation(FwDpIdType id, FwSizeType size, bool valid) {
+        ProductStats* const stats = this->findProductStats(id);
+        if (stats != nullptr) {
+            stats->maxRequestSize = FW_MAX(stats->maxRequestSize, size);
+            if (valid) {
+                ++stats->numAllocations;
+                stats->bytesAllocated += size;
+            } else {
+                ++stats->numFailedAllocations;
+            }
+        }
+    }
+
+    //! Record a send in the statistics of a container ID
+    void recordSend(FwDpIdType id, FwSizeType size) {
+        ProductStats* const stats = this->findProductStats(id);
+        if (stats != nullptr) {
+            stats->bytesSent += size;
+        }
+    }
+
   private:
     // ----------------------------------------------------------------------
     // Private state variables
@@ -106,12 +181,21 @@ class AbstractState {
     //! The number of bytes handled
     TestUtils::OnChangeChannel<U64> NumBytes;
 
+    //! The number of allocations served from reserved buffers
+    TestUtils::OnChangeChannel<U32> NumReservedAllocations;
+
+    //! The number of bytes allocated
+    TestUtils::OnChangeChannel<U64> NumBytesAllocated;
+
     //! Data for buffers
     U8 bufferData[MAX_BUFFER_SIZE];
 
     //! The last port number used for bufferGetOut
     TestUtils::Option<FwIndexType> bufferGetOutPortNumOpt;
 
+    //! The last port number used for sizeClassGetOut
+    TestUtils::Option<FwIndexType> sizeClassGetOutPortNumOpt;
+
     //! The last port number used for productResponseOut
     TestUtils::Option<FwIndexType> productResponseOutPortNumOpt;
 
@@ -120,6 +204,24 @@ class AbstractState {
 
     //! The number of buffer allocation failed events since the last throttle clear
     FwSizeType bufferAllocationFailedEventCount;
+
+    //! The allocation statistics of the tracked container IDs, in the order they were added
+    ProductStats productStats[DP_MANAGER_NUM_TRACKED_IDS];
+
+    //! The number of tracked container IDs
+    FwSizeType numTrackedIds;
+
+    //! The container ID of the reservation, if there is one
+    TestUtils::Option<FwDpIdType> reservationIdOpt;
+
+    //! The configured size of the reservation, zero for the largest request seen
+    FwSizeType reservationSize;
+
+    //! The size of the buffer held by the reservation, zero when it holds none
+    FwSizeType reservationBufferSize;
+
+    //! Whether the reservation is served by size class zero rather than bufferGetOut port zero
+    bool reservationSizeClass;
 };
 
 }  // namespace Svc
@@ -7,6 +7,7 @@
 #include "Fw/Test/UnitTest.hpp"
 #include "STest/Random/Random.hpp"
 #include "Svc/DpManager/test/ut/Rules/Testers.hpp"
+#include "Svc/DpManager/test/ut/Scenarios/ProducerMix.hpp"
 #include "Svc/DpManager/test/ut/Scenarios/Random.hpp"
 
 namespace Svc {
@@ -76,16 +77,76 @@ namespace Svc {
     tester.OK();
   }
 
+  TEST(DUMP_PRODUCT_STATS, OK) {
+    COMMENT("Send command DUMP_PRODUCT_STATS.");
+    REQUIREMENT("SVC-DPMANAGER-005");
+    DUMP_PRODUCT_STATS::Tester tester;
+    tester.OK();
+  }
+
+  TEST(SizeClass, OK) {
+    COMMENT("Invoke productGetIn with random size classes configured.");
+    REQUIREMENT("SVC-DPMANAGER-006");
+    SizeClass::Tester tester;
+    tester.OK();
+  }
+
+  TEST(Reservation, ConfiguredSize) {
+    COMMENT("Reserve a buffer of a configured size for a container ID.");
+    REQUIREMENT("SVC-DPMANAGER-007");
+    Reservation::Tester tester;
+    tester.ConfiguredSize();
+  }
+
+  TEST(Reservation, LearnedSize) {
+    COMMENT("Reserve a buffer sized by the largest request seen for a container ID.");
+    REQUIREMENT("SVC-DPMANAGER-007");
+    Reservation::Tester tester;
+    tester.LearnedSize();
+  }
+
+  TEST(Reservation, TableFull) {
+    COMMENT("Add reservations until the reservation table is full.");
+    REQUIREMENT("SVC-DPMANAGER-007");
+    Reservation::Tester tester;
+    tester.TableFull();
+  }
+
+  TEST(Reservation, Unreserve) {
+    COMMENT("Release a reservation and return its buffer.");
+    REQUIREMENT("SVC-DPMANAGER-007");
+    Reservation::Tester tester;
+    tester.Unreserve();
+  }
+
+  TEST(Reservation, NoSizeClass) {
+    COMMENT("Reserve a buffer when no size class is configured.");
+    REQUIREMENT("SVC-DPMANAGER-007");
+    Reservation::Tester tester;
+    tester.NoSizeClass();
+  }
+
   TEST(Scenarios, Random) {
     COMMENT("Random scenario with all rules.");
     REQUIREMENT("SVC-DPMANAGER-002");
     REQUIREMENT("SVC-DPMANAGER-003");
     REQUIREMENT("SVC-DPMANAGER-004");
+    REQUIREMENT("SVC-DPMANAGER-005");
+    REQUIREMENT("SVC-DPMANAGER-006");
     const FwSizeType numSteps = 10000;
     Scenarios::Random::Tester tester;
     tester.run(numSteps);
   }
 
+  TEST(Scenarios, DISABLED_ProducerMix) {
+    COMMENT("Compare allocation failures and memory waste of a synthetic producer mix with and without size classes.");
+    const FwSizeType numSteps = 100000;
+    Scenarios::ProducerMix::Tester singlePool;
+    singlePool.run(Scenarios::ProducerMix::Tester::Routing::SINGLE_POOL, numSteps);
+    Scenarios::ProducerMix::Tester sizeClasses;
+    sizeClasses.run(Scenarios::ProducerMix::Tester::Routing::SIZE_CLASSES, numSteps);
+  }
+
 }
 
 int main(int argc, char **argv) {
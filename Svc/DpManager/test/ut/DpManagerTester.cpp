@@ -27,22 +27,21 @@ DpManagerTester ::~DpManagerTester() {}
 Fw::Buffer DpManagerTester::from_bufferGetOut_handler(const NATIVE_INT_TYPE portNum, U32 size) {
     this->abstractState.bufferGetOutPortNumOpt = TestUtils::Option<FwIndexType>::some(portNum);
     this->pushFromPortEntry_bufferGetOut(size);
-    Fw::Buffer buffer;
-    switch (this->abstractState.bufferGetStatus) {
-        case AbstractState::BufferGetStatus::VALID:
-            // Construct a valid buffer
-            buffer.setData(this->abstractState.bufferData);
-            FW_ASSERT(size <= AbstractState::MAX_BUFFER_SIZE);
-            buffer.setSize(size);
-            break;
-        case AbstractState::BufferGetStatus::INVALID:
-            // Leave buffer in invalid state
-            break;
-        default:
-            FW_ASSERT(0);
-            break;
-    }
-    return buffer;
+    return this->getBuffer(size);
+}
+
+Fw::Buffer DpManagerTester::from_sizeClassGetOut_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    this->abstractState.sizeClassGetOutPortNumOpt = TestUtils::Option<FwIndexType>::some(portNum);
+    this->pushFromPortEntry_sizeClassGetOut(size);
+    return this->getBuffer(size);
+}
+
+void DpManagerTester::from_bufferSendOut_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->pushFromPortEntry_bufferSendOut(fwBuffer);
+}
+
+void DpManagerTester::from_sizeClassSendOut_handler(const NATIVE_INT_TYPE portNum, Fw::Buffer& fwBuffer) {
+    this->pushFromPortEntry_sizeClassSendOut(fwBuffer);
 }
 
 void DpManagerTester::from_productResponseOut_handler(const NATIVE_INT_TYPE portNum,
@@ -62,6 +61,25 @@ void DpManagerTester::from_productSendOut_handler(const NATIVE_INT_TYPE portNum,
 // Helper methods
 // ----------------------------------------------------------------------
 
+Fw::Buffer DpManagerTester::getBuffer(U32 size) {
+    Fw::Buffer buffer;
+    switch (this->abstractState.bufferGetStatus) {
+        case AbstractState::BufferGetStatus::VALID:
+            // Construct a valid buffer
+            buffer.setData(this->abstractState.bufferData);
+            FW_ASSERT(size <= AbstractState::MAX_BUFFER_SIZE);
+            buffer.setSize(size);
+            break;
+        case AbstractState::BufferGetStatus::INVALID:
+            // Leave buffer in invalid state
+            break;
+        default:
+            FW_ASSERT(0);
+            break;
+    }
+    return buffer;
+}
+
 #define TESTER_CHECK_CHANNEL(NAME)                                       \
     {                                                                    \
         const auto changeStatus = this->abstractState.NAME.updatePrev(); \
@@ -78,6 +96,8 @@ void DpManagerTester::checkTelemetry() {
     TESTER_CHECK_CHANNEL(NumFailedAllocations);
     TESTER_CHECK_CHANNEL(NumDataProducts);
     TESTER_CHECK_CHANNEL(NumBytes);
+    TESTER_CHECK_CHANNEL(NumReservedAllocations);
+    TESTER_CHECK_CHANNEL(NumBytesAllocated);
 }
 
 }  // end namespace Svc
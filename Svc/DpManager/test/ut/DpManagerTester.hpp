@@ -20,7 +20,8 @@ class DpManagerTester : public DpManagerGTestBase {
     // ----------------------------------------------------------------------
 
     // Maximum size of histories storing events, telemetry, and port outputs
-    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10;
+    // DUMP_PRODUCT_STATS emits one event per tracked container ID
+    static const NATIVE_INT_TYPE MAX_HISTORY_SIZE = 10 + static_cast<NATIVE_INT_TYPE>(DP_MANAGER_NUM_TRACKED_IDS);
     // Instance ID supplied to the component instance under test
     static const NATIVE_INT_TYPE TEST_INSTANCE_ID = 0;
     // Queue depth supplied to component instance under test
@@ -42,6 +43,21 @@ class DpManagerTester : public DpManagerGTestBase {
                                          U32 size                        //!< The size
     );
 
+    //! Handler for from_sizeClassGetOut
+    Fw::Buffer from_sizeClassGetOut_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                            U32 size                        //!< The size
+    );
+
+    //! Handler for from_bufferSendOut
+    void from_bufferSendOut_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                    Fw::Buffer& fwBuffer            //!< The buffer
+    );
+
+    //! Handler for from_sizeClassSendOut
+    void from_sizeClassSendOut_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                                       Fw::Buffer& fwBuffer            //!< The buffer
+    );
+
     //! Handler for from_productResponseOut
     void from_productResponseOut_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
                                          FwDpIdType id,                  //!< The container ID
@@ -61,6 +77,10 @@ class DpManagerTester : public DpManagerGTestBase {
     //! Check telemetry
     void checkTelemetry();
 
+    //! Get a buffer with the buffer get status
+    Fw::Buffer getBuffer(U32 size  //!< The size
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Private helper methods
@@ -0,0 +1,70 @@
+// ======================================================================
+// \title  DUMP_PRODUCT_STATS.cpp
+// \brief  DUMP_PRODUCT_STATS class implementation
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#include "STest/Pick/Pick.hpp"
+#include "Svc/DpManager/test/ut/Rules/DUMP_PRODUCT_STATS.hpp"
+#include "Svc/DpManager/test/ut/Rules/Testers.hpp"
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Rule definitions
+// ----------------------------------------------------------------------
+
+bool TestState::precondition__DUMP_PRODUCT_STATS__OK() const {
+    return true;
+}
+
+void TestState::action__DUMP_PRODUCT_STATS__OK() {
+    // Clear history
+    this->clearHistory();
+    // Send the command
+    const NATIVE_INT_TYPE instance = static_cast<NATIVE_INT_TYPE>(STest::Pick::any());
+    const U32 cmdSeq = STest::Pick::any();
+    this->sendCmd_DUMP_PRODUCT_STATS(instance, cmdSeq);
+    this->component.doDispatch();
+    // Check the command response
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DpManagerComponentBase::OPCODE_DUMP_PRODUCT_STATS, cmdSeq, Fw::CmdResponse::OK);
+    // Check events, one per tracked container ID in the order the IDs were first seen
+    const FwSizeType numTrackedIds = this->abstractState.numTrackedIds;
+    ASSERT_EVENTS_SIZE(numTrackedIds);
+    ASSERT_EVENTS_ProductStats_SIZE(numTrackedIds);
+    for (FwSizeType i = 0; i < numTrackedIds; i++) {
+        const AbstractState::ProductStats& stats = this->abstractState.productStats[i];
+        ASSERT_EVENTS_ProductStats(i, stats.id, stats.numAllocations, stats.numFailedAllocations,
+                                   stats.maxRequestSize, stats.bytesAllocated, stats.bytesSent);
+    }
+}
+
+namespace DUMP_PRODUCT_STATS {
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void Tester::OK() {
+    this->ruleOK.apply(this->testState);
+    Testers::productGetIn.ruleBufferValid.apply(this->testState);
+    Testers::productSendIn.ruleOK.apply(this->testState);
+    Testers::bufferGetStatus.ruleInvalid.apply(this->testState);
+    Testers::productRequestIn.ruleBufferInvalid.apply(this->testState);
+    this->ruleOK.apply(this->testState);
+    // Fill the table and check that further IDs are not tracked
+    Testers::bufferGetStatus.ruleValid.apply(this->testState);
+    for (FwSizeType i = 0; i <= DP_MANAGER_NUM_TRACKED_IDS; i++) {
+        Testers::productRequestIn.ruleBufferValid.apply(this->testState);
+    }
+    this->ruleOK.apply(this->testState);
+}
+
+}  // namespace DUMP_PRODUCT_STATS
+
+}  // namespace Svc
@@ -0,0 +1,56 @@
+// ======================================================================
+// \title  DUMP_PRODUCT_STATS.hpp
+// \brief  DUMP_PRODUCT_STATS class interface
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#ifndef Svc_DUMP_PRODUCT_STATS_HPP
+#define Svc_DUMP_PRODUCT_STATS_HPP
+
+#include "Svc/DpManager/test/ut/Rules/Rules.hpp"
+#include "Svc/DpManager/test/ut/TestState/TestState.hpp"
+
+namespace Svc {
+
+  namespace DUMP_PRODUCT_STATS {
+
+    class Tester {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! OK
+        void OK();
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Rules
+        // ----------------------------------------------------------------------
+
+        //! Rule DUMP_PRODUCT_STATS::OK
+        Rules::DUMP_PRODUCT_STATS::OK ruleOK;
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Public member variables
+        // ----------------------------------------------------------------------
+
+        //! Test state
+        TestState testState;
+
+    };
+
+  }
+
+}
+
+#endif
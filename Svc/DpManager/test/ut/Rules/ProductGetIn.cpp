@@ -40,6 +40,8 @@ void TestState::action__ProductGetIn__BufferValid() {
     ASSERT_EVENTS_SIZE(0);
     // Update test state
     ++this->abstractState.NumSuccessfulAllocations.value;
+    this->abstractState.NumBytesAllocated.value += size;
+    this->abstractState.recordAllocation(id, size, true);
     // Check port history
     ASSERT_FROM_PORT_HISTORY_SIZE(1);
     // Check buffer get out
@@ -76,6 +78,7 @@ void TestState ::action__ProductGetIn__BufferInvalid() {
     }
     // Update test state
     ++this->abstractState.NumFailedAllocations.value;
+    this->abstractState.recordAllocation(id, size, false);
     // Check port history
     ASSERT_FROM_PORT_HISTORY_SIZE(1);
     // Check buffer get out
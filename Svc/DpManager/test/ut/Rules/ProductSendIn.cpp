@@ -39,6 +39,7 @@ void TestState ::action__ProductSendIn__OK() {
     // Update test state
     ++this->abstractState.NumDataProducts.value;
     this->abstractState.NumBytes.value += size;
+    this->abstractState.recordSend(id, size);
     // Check port history
     ASSERT_FROM_PORT_HISTORY_SIZE(1);
     // Check product send out
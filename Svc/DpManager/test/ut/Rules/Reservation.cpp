@@ -0,0 +1,238 @@
+// ======================================================================
+// \title  Reservation.cpp
+// \brief  Reservation class implementation
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#include <limits>
+
+#include "STest/Pick/Pick.hpp"
+#include "Svc/DpManager/test/ut/Rules/Reservation.hpp"
+#include "Svc/DpManager/test/ut/Rules/Testers.hpp"
+#include "config/FppConstantsAc.hpp"
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Rule definitions
+// ----------------------------------------------------------------------
+
+bool TestState::precondition__Reservation__Refill() const {
+    const auto& state = this->abstractState;
+    return state.reservationIdOpt.hasValue() && (state.reservationBufferSize == 0) &&
+           (state.bufferGetStatus == AbstractState::BufferGetStatus::VALID);
+}
+
+void TestState::action__Reservation__Refill() {
+    // Clear history
+    this->clearHistory();
+    // Invoke schedIn port
+    const U32 context = STest::Pick::any();
+    this->invoke_to_schedIn(0, context);
+    this->component.doDispatch();
+    // Check the refill, which uses the largest request seen when no size is configured
+    auto& state = this->abstractState;
+    FwSizeType size = state.reservationSize;
+    if (size == 0) {
+        size = state.getMaxRequestSize(state.reservationIdOpt.get());
+    }
+    if (size > 0) {
+        ASSERT_FROM_PORT_HISTORY_SIZE(1);
+        if (state.reservationSizeClass) {
+            ASSERT_from_sizeClassGetOut_SIZE(1);
+            ASSERT_from_sizeClassGetOut(0, size);
+        } else {
+            ASSERT_from_bufferGetOut_SIZE(1);
+            ASSERT_from_bufferGetOut(0, size);
+            ASSERT_EQ(state.bufferGetOutPortNumOpt.get(), 0);
+        }
+        state.reservationBufferSize = size;
+    } else {
+        ASSERT_FROM_PORT_HISTORY_SIZE(0);
+    }
+    // Check telemetry
+    this->checkTelemetry();
+}
+
+bool TestState::precondition__Reservation__Release() const {
+    return this->abstractState.reservationIdOpt.hasValue();
+}
+
+void TestState::action__Reservation__Release() {
+    // Clear history
+    this->clearHistory();
+    // Release the reservation
+    auto& state = this->abstractState;
+    const FwDpIdType id = state.reservationIdOpt.get();
+    ASSERT_EQ(this->component.unreserve(id), Fw::Success::SUCCESS);
+    // Check that a held buffer went back to where it came from
+    if (state.reservationBufferSize > 0) {
+        const Fw::Buffer expectedBuffer(state.bufferData, static_cast<U32>(state.reservationBufferSize));
+        ASSERT_FROM_PORT_HISTORY_SIZE(1);
+        if (state.reservationSizeClass) {
+            ASSERT_from_sizeClassSendOut_SIZE(1);
+            ASSERT_from_sizeClassSendOut(0, expectedBuffer);
+        } else {
+            ASSERT_from_bufferSendOut_SIZE(1);
+            ASSERT_from_bufferSendOut(0, expectedBuffer);
+        }
+    } else {
+        ASSERT_FROM_PORT_HISTORY_SIZE(0);
+    }
+    // Update test state
+    state.reservationIdOpt.clear();
+    state.reservationBufferSize = 0;
+    // Check that the reservation is gone, so schedIn gets no buffer for it
+    ASSERT_EQ(this->component.unreserve(id), Fw::Success::FAILURE);
+    this->clearHistory();
+    this->invoke_to_schedIn(0, 0);
+    this->component.doDispatch();
+    ASSERT_FROM_PORT_HISTORY_SIZE(0);
+    this->checkTelemetry();
+}
+
+bool TestState::precondition__Reservation__Request() const {
+    const auto& state = this->abstractState;
+    return state.reservationIdOpt.hasValue() && (state.reservationBufferSize == 0) &&
+           (state.bufferGetStatus == AbstractState::BufferGetStatus::VALID);
+}
+
+void TestState::action__Reservation__Request() {
+    // Clear history
+    this->clearHistory();
+    // Send the invocation
+    const FwIndexType portNum = STest::Pick::startLength(0, DpManagerNumPorts);
+    const FwDpIdType id = this->abstractState.reservationIdOpt.get();
+    const FwSizeType size = this->abstractState.getBufferSize();
+    Fw::Buffer buffer;
+    const auto status = this->invoke_to_productGetIn(portNum, id, size, buffer);
+    ASSERT_EQ(status, Fw::Success::SUCCESS);
+    // Check events
+    ASSERT_EVENTS_SIZE(0);
+    // Update test state
+    ++this->abstractState.NumSuccessfulAllocations.value;
+    this->abstractState.NumBytesAllocated.value += size;
+    this->abstractState.recordAllocation(id, size, true);
+    // Check that the request was allocated, since the reservation holds no buffer
+    ASSERT_FROM_PORT_HISTORY_SIZE(1);
+    if (this->abstractState.reservationSizeClass) {
+        ASSERT_from_sizeClassGetOut_SIZE(1);
+        ASSERT_from_sizeClassGetOut(0, size);
+    } else {
+        ASSERT_from_bufferGetOut_SIZE(1);
+        ASSERT_from_bufferGetOut(0, size);
+    }
+    // Check the buffer
+    const Fw::Buffer expectedBuffer(this->abstractState.bufferData, size);
+    ASSERT_EQ(buffer, expectedBuffer);
+}
+
+bool TestState::precondition__Reservation__Take() const {
+    return this->abstractState.reservationBufferSize > 0;
+}
+
+void TestState::action__Reservation__Take() {
+    // Clear history
+    this->clearHistory();
+    // Send the invocation
+    const FwIndexType portNum = STest::Pick::startLength(0, DpManagerNumPorts);
+    const FwDpIdType id = this->abstractState.reservationIdOpt.get();
+    const FwSizeType size =
+        STest::Pick::lowerUpper(AbstractState::MIN_BUFFER_SIZE, this->abstractState.reservationBufferSize);
+    Fw::Buffer buffer;
+    const auto status = this->invoke_to_productGetIn(portNum, id, size, buffer);
+    ASSERT_EQ(status, Fw::Success::SUCCESS);
+    // Check events
+    ASSERT_EVENTS_SIZE(0);
+    // Update test state
+    ++this->abstractState.NumSuccessfulAllocations.value;
+    ++this->abstractState.NumReservedAllocations.value;
+    this->abstractState.NumBytesAllocated.value += size;
+    this->abstractState.recordAllocation(id, size, true);
+    this->abstractState.reservationBufferSize = 0;
+    // Check that the reserved buffer was handed out without an allocation
+    ASSERT_FROM_PORT_HISTORY_SIZE(0);
+    // Check the buffer
+    const Fw::Buffer expectedBuffer(this->abstractState.bufferData, size);
+    ASSERT_EQ(buffer, expectedBuffer);
+}
+
+namespace Reservation {
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void Tester ::ConfiguredSize() {
+    this->reserve(STest::Pick::lowerUpper(AbstractState::MIN_BUFFER_SIZE, AbstractState::MAX_BUFFER_SIZE));
+    this->ruleRefill.apply(this->testState);
+    this->ruleTake.apply(this->testState);
+    this->ruleRequest.apply(this->testState);
+    this->ruleRefill.apply(this->testState);
+    this->ruleTake.apply(this->testState);
+}
+
+void Tester ::LearnedSize() {
+    this->reserve(0);
+    // No request has been seen, so there is nothing to reserve
+    this->ruleRefill.apply(this->testState);
+    this->ruleRequest.apply(this->testState);
+    this->ruleRefill.apply(this->testState);
+    this->ruleTake.apply(this->testState);
+    this->ruleRefill.apply(this->testState);
+}
+
+void Tester ::TableFull() {
+    for (FwSizeType i = 0; i < DP_MANAGER_NUM_RESERVATIONS; i++) {
+        ASSERT_EQ(this->testState.component.reserve(static_cast<FwDpIdType>(i), AbstractState::MAX_BUFFER_SIZE),
+                  Fw::Success::SUCCESS);
+    }
+    ASSERT_EQ(this->testState.component.reserve(DP_MANAGER_NUM_RESERVATIONS, AbstractState::MAX_BUFFER_SIZE),
+              Fw::Success::FAILURE);
+}
+
+void Tester ::Unreserve() {
+    this->reserve(STest::Pick::lowerUpper(AbstractState::MIN_BUFFER_SIZE, AbstractState::MAX_BUFFER_SIZE));
+    this->ruleRefill.apply(this->testState);
+    this->ruleRelease.apply(this->testState);
+    // A reservation holding no buffer returns nothing
+    this->reserve(STest::Pick::lowerUpper(AbstractState::MIN_BUFFER_SIZE, AbstractState::MAX_BUFFER_SIZE));
+    this->ruleRelease.apply(this->testState);
+}
+
+void Tester ::NoSizeClass() {
+    this->reserveNoSizeClass(STest::Pick::lowerUpper(AbstractState::MIN_BUFFER_SIZE, AbstractState::MAX_BUFFER_SIZE));
+    this->ruleRefill.apply(this->testState);
+    this->ruleTake.apply(this->testState);
+    this->ruleRequest.apply(this->testState);
+    this->ruleRefill.apply(this->testState);
+    this->ruleRelease.apply(this->testState);
+}
+
+// ----------------------------------------------------------------------
+// Private helper functions
+// ----------------------------------------------------------------------
+
+void Tester ::reserve(FwSizeType size) {
+    this->testState.component.configureSizeClass(0, AbstractState::MAX_BUFFER_SIZE);
+    const FwDpIdType id = STest::Pick::lowerUpper(0, std::numeric_limits<FwDpIdType>::max());
+    ASSERT_EQ(this->testState.component.reserve(id, size), Fw::Success::SUCCESS);
+    this->testState.abstractState.reservationIdOpt.set(id);
+    this->testState.abstractState.reservationSize = size;
+}
+
+void Tester ::reserveNoSizeClass(FwSizeType size) {
+    const FwDpIdType id = STest::Pick::lowerUpper(0, std::numeric_limits<FwDpIdType>::max());
+    ASSERT_EQ(this->testState.component.reserve(id, size), Fw::Success::SUCCESS);
+    this->testState.abstractState.reservationIdOpt.set(id);
+    this->testState.abstractState.reservationSize = size;
+    this->testState.abstractState.reservationSizeClass = false;
+}
+
+}  // namespace Reservation
+
+}  // namespace Svc
@@ -0,0 +1,91 @@
+// ======================================================================
+// \title  Reservation.hpp
+// \brief  Reservation class interface
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#ifndef Svc_Reservation_HPP
+#define Svc_Reservation_HPP
+
+#include "Svc/DpManager/test/ut/Rules/Rules.hpp"
+#include "Svc/DpManager/test/ut/TestState/TestState.hpp"
+
+namespace Svc {
+
+  namespace Reservation {
+
+    class Tester {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! Reservation with a configured size
+        void ConfiguredSize();
+
+        //! Reservation sized by the largest request seen
+        void LearnedSize();
+
+        //! Reservation table full
+        void TableFull();
+
+        //! Reservation released with and without a buffer held
+        void Unreserve();
+
+        //! Reservation with no size class configured
+        void NoSizeClass();
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Rules
+        // ----------------------------------------------------------------------
+
+        //! Rule Reservation::Refill
+        Rules::Reservation::Refill ruleRefill;
+
+        //! Rule Reservation::Release
+        Rules::Reservation::Release ruleRelease;
+
+        //! Rule Reservation::Request
+        Rules::Reservation::Request ruleRequest;
+
+        //! Rule Reservation::Take
+        Rules::Reservation::Take ruleTake;
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Public member variables
+        // ----------------------------------------------------------------------
+
+        //! Test state
+        TestState testState;
+
+      private:
+
+        // ----------------------------------------------------------------------
+        // Private helper functions
+        // ----------------------------------------------------------------------
+
+        //! Configure a size class holding every buffer size and add a reservation
+        void reserve(FwSizeType size //!< The reservation size
+        );
+
+        //! Add a reservation served by bufferGetOut port zero
+        void reserveNoSizeClass(FwSizeType size //!< The reservation size
+        );
+
+    };
+
+  }
+
+}
+
+#endif
@@ -35,12 +35,18 @@ namespace Rules {
 RULES_DEF_RULE(BufferGetStatus, Invalid)
 RULES_DEF_RULE(BufferGetStatus, Valid)
 RULES_DEF_RULE(CLEAR_EVENT_THROTTLE, OK)
+RULES_DEF_RULE(DUMP_PRODUCT_STATS, OK)
 RULES_DEF_RULE(ProductGetIn, BufferInvalid)
 RULES_DEF_RULE(ProductGetIn, BufferValid)
 RULES_DEF_RULE(ProductRequestIn, BufferInvalid)
 RULES_DEF_RULE(ProductRequestIn, BufferValid)
 RULES_DEF_RULE(ProductSendIn, OK)
+RULES_DEF_RULE(Reservation, Refill)
+RULES_DEF_RULE(Reservation, Release)
+RULES_DEF_RULE(Reservation, Request)
+RULES_DEF_RULE(Reservation, Take)
 RULES_DEF_RULE(SchedIn, OK)
+RULES_DEF_RULE(SizeClass, OK)
 
 }  // namespace Rules
 
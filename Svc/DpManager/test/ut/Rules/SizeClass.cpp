@@ -0,0 +1,103 @@
+// ======================================================================
+// \title  SizeClass.cpp
+// \brief  SizeClass class implementation
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#include <limits>
+
+#include "STest/Pick/Pick.hpp"
+#include "Svc/DpManager/test/ut/Rules/SizeClass.hpp"
+#include "Svc/DpManager/test/ut/Rules/Testers.hpp"
+#include "config/FppConstantsAc.hpp"
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Rule definitions
+// ----------------------------------------------------------------------
+
+bool TestState::precondition__SizeClass__OK() const {
+    return this->abstractState.bufferGetStatus == AbstractState::BufferGetStatus::VALID;
+}
+
+void TestState::action__SizeClass__OK() {
+    // Clear history
+    this->clearHistory();
+    // Configure random size classes, some of them disabled
+    FwSizeType maxSizes[DpManagerNumSizeClasses];
+    for (FwIndexType sizeClass = 0; sizeClass < DpManagerNumSizeClasses; sizeClass++) {
+        const bool enabled = static_cast<bool>(STest::Pick::lowerUpper(0, 1));
+        maxSizes[sizeClass] =
+            enabled ? STest::Pick::lowerUpper(AbstractState::MIN_BUFFER_SIZE, AbstractState::MAX_BUFFER_SIZE) : 0;
+        this->component.configureSizeClass(sizeClass, maxSizes[sizeClass]);
+    }
+    // Send the invocation
+    const FwIndexType portNum = STest::Pick::startLength(0, DpManagerNumPorts);
+    const FwDpIdType id = STest::Pick::lowerUpper(0, std::numeric_limits<FwDpIdType>::max());
+    const FwSizeType size = this->abstractState.getBufferSize();
+    Fw::Buffer buffer;
+    const auto status = this->invoke_to_productGetIn(portNum, id, size, buffer);
+    ASSERT_EQ(status, Fw::Success::SUCCESS);
+    // Check events
+    ASSERT_EVENTS_SIZE(0);
+    // Update test state
+    ++this->abstractState.NumSuccessfulAllocations.value;
+    this->abstractState.NumBytesAllocated.value += size;
+    this->abstractState.recordAllocation(id, size, true);
+    // Check port history
+    ASSERT_FROM_PORT_HISTORY_SIZE(1);
+    // Check that the smallest size class holding the size served the request
+    FwIndexType expectedSizeClass = -1;
+    for (FwIndexType sizeClass = 0; sizeClass < DpManagerNumSizeClasses; sizeClass++) {
+        if ((maxSizes[sizeClass] >= size) &&
+            ((expectedSizeClass == -1) || (maxSizes[sizeClass] < maxSizes[expectedSizeClass]))) {
+            expectedSizeClass = sizeClass;
+        }
+    }
+    if (expectedSizeClass != -1) {
+        ASSERT_from_sizeClassGetOut_SIZE(1);
+        ASSERT_from_sizeClassGetOut(0, size);
+        ASSERT_EQ(this->abstractState.sizeClassGetOutPortNumOpt.get(), expectedSizeClass);
+    } else {
+        ASSERT_from_bufferGetOut_SIZE(1);
+        ASSERT_from_bufferGetOut(0, size);
+        ASSERT_EQ(this->abstractState.bufferGetOutPortNumOpt.get(), portNum);
+    }
+    // Check the buffer
+    const Fw::Buffer expectedBuffer(this->abstractState.bufferData, size);
+    ASSERT_EQ(buffer, expectedBuffer);
+    // Disable the size classes
+    for (FwIndexType sizeClass = 0; sizeClass < DpManagerNumSizeClasses; sizeClass++) {
+        this->component.configureSizeClass(sizeClass, 0);
+    }
+}
+
+namespace SizeClass {
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void Tester ::OK() {
+    this->testState.abstractState.setBufferSize(Svc::AbstractState::MIN_BUFFER_SIZE);
+    this->ruleOK.apply(this->testState);
+    Testers::schedIn.ruleOK.apply(this->testState);
+    this->testState.abstractState.setBufferSize(Svc::AbstractState::MAX_BUFFER_SIZE);
+    this->ruleOK.apply(this->testState);
+    Testers::schedIn.ruleOK.apply(this->testState);
+    for (FwSizeType i = 0; i < 100; i++) {
+        this->testState.abstractState.setBufferSize(
+            STest::Pick::lowerUpper(Svc::AbstractState::MIN_BUFFER_SIZE, Svc::AbstractState::MAX_BUFFER_SIZE));
+        this->ruleOK.apply(this->testState);
+    }
+    Testers::schedIn.ruleOK.apply(this->testState);
+}
+
+}  // namespace SizeClass
+
+}  // namespace Svc
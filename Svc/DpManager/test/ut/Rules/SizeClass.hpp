@@ -0,0 +1,56 @@
+// ======================================================================
+// \title  SizeClass.hpp
+// \brief  SizeClass class interface
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#ifndef Svc_SizeClass_HPP
+#define Svc_SizeClass_HPP
+
+#include "Svc/DpManager/test/ut/Rules/Rules.hpp"
+#include "Svc/DpManager/test/ut/TestState/TestState.hpp"
+
+namespace Svc {
+
+  namespace SizeClass {
+
+    class Tester {
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Tests
+        // ----------------------------------------------------------------------
+
+        //! OK
+        void OK();
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Rules
+        // ----------------------------------------------------------------------
+
+        //! Rule SizeClass::OK
+        Rules::SizeClass::OK ruleOK;
+
+      public:
+
+        // ----------------------------------------------------------------------
+        // Public member variables
+        // ----------------------------------------------------------------------
+
+        //! Test state
+        TestState testState;
+
+    };
+
+  }
+
+}
+
+#endif
@@ -19,14 +19,20 @@ namespace Svc {
 
     CLEAR_EVENT_THROTTLE::Tester clearEventThrottle;
 
+    DUMP_PRODUCT_STATS::Tester dumpProductStats;
+
     ProductGetIn::Tester productGetIn;
 
     ProductRequestIn::Tester productRequestIn;
 
     ProductSendIn::Tester productSendIn;
 
+    Reservation::Tester reservation;
+
     SchedIn::Tester schedIn;
 
+    SizeClass::Tester sizeClass;
+
   }
 
 }
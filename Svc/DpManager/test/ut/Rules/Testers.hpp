@@ -14,10 +14,13 @@
 
 #include "Svc/DpManager/test/ut/Rules/BufferGetStatus.hpp"
 #include "Svc/DpManager/test/ut/Rules/CLEAR_EVENT_THROTTLE.hpp"
+#include "Svc/DpManager/test/ut/Rules/DUMP_PRODUCT_STATS.hpp"
 #include "Svc/DpManager/test/ut/Rules/ProductGetIn.hpp"
 #include "Svc/DpManager/test/ut/Rules/ProductRequestIn.hpp"
 #include "Svc/DpManager/test/ut/Rules/ProductSendIn.hpp"
+#include "Svc/DpManager/test/ut/Rules/Reservation.hpp"
 #include "Svc/DpManager/test/ut/Rules/SchedIn.hpp"
+#include "Svc/DpManager/test/ut/Rules/SizeClass.hpp"
 
 namespace Svc {
 
@@ -27,14 +30,20 @@ namespace Svc {
 
     extern CLEAR_EVENT_THROTTLE::Tester clearEventThrottle;
 
+    extern DUMP_PRODUCT_STATS::Tester dumpProductStats;
+
     extern ProductGetIn::Tester productGetIn;
 
     extern ProductRequestIn::Tester productRequestIn;
 
     extern ProductSendIn::Tester productSendIn;
 
+    extern Reservation::Tester reservation;
+
     extern SchedIn::Tester schedIn;
 
+    extern SizeClass::Tester sizeClass;
+
   }
 
 }
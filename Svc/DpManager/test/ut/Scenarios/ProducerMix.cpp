@@ -0,0 +1,179 @@
+// ======================================================================
+// \title  ProducerMix.cpp
+// \brief  Synthetic producer mix against pools of binned buffers
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#include <cstdio>
+
+#include "STest/Pick/Pick.hpp"
+#include "Svc/DpManager/test/ut/Scenarios/ProducerMix.hpp"
+
+namespace Svc {
+
+namespace Scenarios {
+
+namespace ProducerMix {
+
+// ----------------------------------------------------------------------
+// Pool
+// ----------------------------------------------------------------------
+
+Pool::Pool(const Bin* bins, FwSizeType numBins, U32 poolId) : m_poolId(poolId) {
+    FwSizeType offset = 0;
+    for (FwSizeType bin = 0; bin < numBins; bin++) {
+        for (FwSizeType i = 0; i < bins[bin].numBuffers; i++) {
+            this->m_slots.push_back({offset, bins[bin].bufferSize, false});
+            offset += bins[bin].bufferSize;
+        }
+    }
+    this->m_memory.resize(offset);
+}
+
+Fw::Buffer Pool::get(FwSizeType size) {
+    for (FwSizeType slot = 0; slot < this->m_slots.size(); slot++) {
+        Slot& entry = this->m_slots[slot];
+        if ((not entry.allocated) && (size <= entry.size)) {
+            entry.allocated = true;
+            const U32 context = (this->m_poolId << 16) | static_cast<U32>(slot);
+            return Fw::Buffer(&this->m_memory[entry.offset], static_cast<Fw::Buffer::SizeType>(size), context);
+        }
+    }
+    return Fw::Buffer();
+}
+
+void Pool::release(const Fw::Buffer& buffer) {
+    Slot& entry = this->m_slots.at(buffer.getContext() & 0xFFFF);
+    FW_ASSERT(entry.allocated);
+    entry.allocated = false;
+}
+
+FwSizeType Pool::getBufferSize(const Fw::Buffer& buffer) const {
+    return this->m_slots.at(buffer.getContext() & 0xFFFF).size;
+}
+
+// ----------------------------------------------------------------------
+// Tester
+// ----------------------------------------------------------------------
+
+namespace {
+
+//! A kind of data product
+struct Producer {
+    const char* name;        //!< The name
+    FwDpIdType firstId;      //!< The first container ID
+    FwDpIdType numIds;       //!< The number of container IDs
+    FwSizeType minSize;      //!< The smallest request
+    FwSizeType maxSize;      //!< The largest request
+    U32 percentPerStep;      //!< The chance of a request each step, for aperiodic producers
+    FwSizeType period;       //!< The period in steps, for periodic producers
+    FwSizeType minHold;      //!< The fewest steps a buffer is held before it is written and freed
+    FwSizeType maxHold;      //!< The most steps a buffer is held
+};
+
+const Producer producers[] = {
+    {"housekeeping", 0, 8, 256, 1024, 70, 0, 20, 60},
+    {"science", 100, 4, 4 * 1024, 16 * 1024, 25, 0, 10, 40},
+    {"image", 200, 1, 192 * 1024, 256 * 1024, 0, 50, 20, 40},
+};
+constexpr FwSizeType NUM_PRODUCERS = sizeof producers / sizeof producers[0];
+
+//! The bins, smallest first, which hold the same memory in both routings
+const Pool::Bin bins[] = {{1024, 32}, {16 * 1024, 12}, {256 * 1024, 4}};
+constexpr FwSizeType NUM_BINS = sizeof bins / sizeof bins[0];
+
+static_assert(NUM_BINS <= static_cast<FwSizeType>(DpManagerNumSizeClasses), "one size class per bin");
+
+//! A buffer held by a producer
+struct Held {
+    Fw::Buffer buffer;      //!< The buffer
+    FwSizeType pool;        //!< The pool index
+    FwSizeType releaseStep; //!< The step at which the buffer is freed
+};
+
+}  // namespace
+
+void Tester::run(Routing routing, FwSizeType numSteps) {
+    // Set up the pools and the routing
+    const FwDpIdType imageId = producers[NUM_PRODUCERS - 1].firstId;
+    if (routing == Routing::SINGLE_POOL) {
+        this->m_pools.emplace_back(bins, NUM_BINS, 0);
+    } else {
+        for (FwSizeType bin = 0; bin < NUM_BINS; bin++) {
+            this->m_pools.emplace_back(&bins[bin], 1, static_cast<U32>(bin));
+            this->component.configureSizeClass(static_cast<FwIndexType>(bin), bins[bin].bufferSize);
+        }
+        (void)this->component.reserve(imageId, producers[NUM_PRODUCERS - 1].maxSize);
+    }
+    // Run the producers
+    std::vector<Held> held;
+    U64 numRequests[NUM_PRODUCERS] = {};
+    U64 numFailures[NUM_PRODUCERS] = {};
+    U64 bytesRequested = 0;
+    U64 bytesBacking = 0;
+    for (FwSizeType step = 0; step < numSteps; step++) {
+        this->clearHistory();
+        // Free the buffers written this step
+        for (FwSizeType i = 0; i < held.size();) {
+            if (held[i].releaseStep == step) {
+                this->m_pools[held[i].pool].release(held[i].buffer);
+                held[i] = held.back();
+                held.pop_back();
+            } else {
+                i++;
+            }
+        }
+        // Refill the reservation
+        this->invoke_to_schedIn(0, 0);
+        this->component.doDispatch();
+        // Request buffers
+        for (FwSizeType p = 0; p < NUM_PRODUCERS; p++) {
+            const Producer& producer = producers[p];
+            const bool request = (producer.period > 0) ? (step % producer.period == 0)
+                                                       : (STest::Pick::lowerUpper(1, 100) <= producer.percentPerStep);
+            if (not request) {
+                continue;
+            }
+            const FwDpIdType id = producer.firstId + STest::Pick::startLength(0, producer.numIds);
+            const FwSizeType size = STest::Pick::lowerUpper(producer.minSize, producer.maxSize);
+            Fw::Buffer buffer;
+            ++numRequests[p];
+            if (this->invoke_to_productGetIn(0, id, size, buffer) != Fw::Success::SUCCESS) {
+                ++numFailures[p];
+                continue;
+            }
+            const FwSizeType pool = (buffer.getContext() >> 16);
+            bytesRequested += size;
+            bytesBacking += this->m_pools[pool].getBufferSize(buffer);
+            const FwSizeType hold = STest::Pick::lowerUpper(producer.minHold, producer.maxHold);
+            held.push_back({buffer, pool, step + hold});
+        }
+    }
+    this->clearHistory();
+    // Report
+    printf("%s:\n", (routing == Routing::SINGLE_POOL) ? "single pool" : "size classes");
+    for (FwSizeType p = 0; p < NUM_PRODUCERS; p++) {
+        printf("  %-12s %8" PRIu64 " requests, %6.2f%% failed\n", producers[p].name, numRequests[p],
+               100.0 * static_cast<F64>(numFailures[p]) / static_cast<F64>(numRequests[p]));
+    }
+    printf("  waste: %.1f%% of allocated buffer memory held beyond the requested size\n",
+           100.0 * static_cast<F64>(bytesBacking - bytesRequested) / static_cast<F64>(bytesBacking));
+}
+
+Fw::Buffer Tester::from_bufferGetOut_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    return this->m_pools.at(0).get(size);
+}
+
+Fw::Buffer Tester::from_sizeClassGetOut_handler(const NATIVE_INT_TYPE portNum, U32 size) {
+    return this->m_pools.at(static_cast<FwSizeType>(portNum)).get(size);
+}
+
+}  // namespace ProducerMix
+
+}  // namespace Scenarios
+
+}  // namespace Svc
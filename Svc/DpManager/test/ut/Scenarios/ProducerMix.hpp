@@ -0,0 +1,98 @@
+// ======================================================================
+// \title  ProducerMix.hpp
+// \brief  Synthetic producer mix against pools of binned buffers
+//
+// \copyright
+// Copyright (C) 2023 California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government sponsorship
+// acknowledged.
+// ======================================================================
+
+#ifndef Svc_ProducerMix_HPP
+#define Svc_ProducerMix_HPP
+
+#include <vector>
+
+#include "Svc/DpManager/test/ut/DpManagerTester.hpp"
+
+namespace Svc {
+
+namespace Scenarios {
+
+namespace ProducerMix {
+
+//! A pool of buffers in bins, allocated first fit in bin order as Svc::BufferManager does
+class Pool {
+  public:
+    //! A bin of buffers of one size
+    struct Bin {
+        FwSizeType bufferSize;  //!< The buffer size
+        FwSizeType numBuffers;  //!< The number of buffers
+    };
+
+    //! Construct a Pool
+    Pool(const Bin* bins,     //!< The bins, in allocation order
+         FwSizeType numBins,  //!< The number of bins
+         U32 poolId           //!< The pool id, stored in the buffer context
+    );
+
+    //! Allocate the first free buffer that holds size bytes
+    //! \return The buffer, invalid if none is free
+    Fw::Buffer get(FwSizeType size);
+
+    //! Return a buffer to the pool
+    void release(const Fw::Buffer& buffer);
+
+    //! Get the size of the buffer that backs an allocated buffer
+    FwSizeType getBufferSize(const Fw::Buffer& buffer) const;
+
+  private:
+    //! A buffer in the pool
+    struct Slot {
+        FwSizeType offset;  //!< The offset of the buffer in the pool memory
+        FwSizeType size;    //!< The buffer size
+        bool allocated;     //!< Whether the buffer is allocated
+    };
+
+    //! The pool id
+    U32 m_poolId;
+    //! The buffers
+    std::vector<Slot> m_slots;
+    //! The memory of the buffers
+    std::vector<U8> m_memory;
+};
+
+//! Runs a synthetic mix of producers through DpManager
+class Tester : public DpManagerTester {
+  public:
+    //! Whether DpManager routes by size class
+    enum class Routing {
+        //! Every request goes to one pool on bufferGetOut
+        SINGLE_POOL,
+        //! Requests go to one pool per size class, and the periodic product has a reservation
+        SIZE_CLASSES
+    };
+
+    //! Run the producer mix and print the allocation failure rate and memory waste
+    void run(Routing routing,     //!< The routing
+             FwSizeType numSteps  //!< The number of steps
+    );
+
+  private:
+    //! Handler for from_bufferGetOut
+    Fw::Buffer from_bufferGetOut_handler(const NATIVE_INT_TYPE portNum, U32 size) override;
+
+    //! Handler for from_sizeClassGetOut
+    Fw::Buffer from_sizeClassGetOut_handler(const NATIVE_INT_TYPE portNum, U32 size) override;
+
+    //! The pools, one for the single pool routing or one per size class
+    std::vector<Pool> m_pools;
+};
+
+}  // namespace ProducerMix
+
+}  // namespace Scenarios
+
+}  // namespace Svc
+
+#endif
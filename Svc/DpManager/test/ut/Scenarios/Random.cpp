@@ -27,10 +27,12 @@ namespace Random {
 Rules::BufferGetStatus::Invalid bufferGetStatusInvalid;
 Rules::BufferGetStatus::Valid bufferGetStatusValid;
 Rules::CLEAR_EVENT_THROTTLE::OK clearEventThrottleOK;
+Rules::DUMP_PRODUCT_STATS::OK dumpProductStatsOK;
 Rules::ProductRequestIn::BufferInvalid productRequestInBufferInvalid;
 Rules::ProductRequestIn::BufferValid productRequestInBufferValid;
 Rules::ProductSendIn::OK productSendInOK;
 Rules::SchedIn::OK schedInOK;
+Rules::SizeClass::OK sizeClassOK;
 
 // ----------------------------------------------------------------------
 // Tests
@@ -41,10 +43,12 @@ void Tester ::run(FwSizeType maxNumSteps) {
         &bufferGetStatusInvalid,
         &bufferGetStatusValid,
         &clearEventThrottleOK,
+        &dumpProductStatsOK,
         &productRequestInBufferInvalid,
         &productRequestInBufferValid,
         &productSendInOK,
-        &schedInOK
+        &schedInOK,
+        &sizeClassOK
     };
     STest::RandomScenario<TestState> scenario("RandomScenario", rules,
                                               sizeof(rules) / sizeof(STest::RandomScenario<TestState>*));
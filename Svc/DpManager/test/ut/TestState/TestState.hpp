@@ -29,12 +29,18 @@ class TestState : public DpManagerTester {
     TEST_STATE_DEF_RULE(BufferGetStatus, Invalid)
     TEST_STATE_DEF_RULE(BufferGetStatus, Valid)
     TEST_STATE_DEF_RULE(CLEAR_EVENT_THROTTLE, OK)
+    TEST_STATE_DEF_RULE(DUMP_PRODUCT_STATS, OK)
     TEST_STATE_DEF_RULE(ProductGetIn, BufferInvalid)
     TEST_STATE_DEF_RULE(ProductGetIn, BufferValid)
     TEST_STATE_DEF_RULE(ProductRequestIn, BufferInvalid)
     TEST_STATE_DEF_RULE(ProductRequestIn, BufferValid)
     TEST_STATE_DEF_RULE(ProductSendIn, OK)
+    TEST_STATE_DEF_RULE(Reservation, Refill)
+    TEST_STATE_DEF_RULE(Reservation, Release)
+    TEST_STATE_DEF_RULE(Reservation, Request)
+    TEST_STATE_DEF_RULE(Reservation, Take)
     TEST_STATE_DEF_RULE(SchedIn, OK)
+    TEST_STATE_DEF_RULE(SizeClass, OK)
 };
 
 }  // namespace Svc
@@ -4,6 +4,8 @@
 // \brief  cpp file for DpWriter component implementation class
 // ======================================================================
 
+#include <cstring>
+
 #include "Fw/Com/ComPacket.hpp"
 #include "Fw/Types/FileNameString.hpp"
 #include "Fw/Types/Serializable.hpp"
@@ -27,6 +29,14 @@ void DpWriter::configure(const Fw::StringBase& dpFileNamePrefix) {
     this->m_dpFileNamePrefix = dpFileNamePrefix;
 }
 
+void DpWriter::configureCompression(bool enabled, U8 filterWidth) {
+    FW_ASSERT(Fw::DpCodec::isValidFilterWidth(filterWidth), static_cast<FwAssertArgType>(filterWidth));
+    // Compressed files are marked in the container header flags
+    FW_ASSERT(DP_CONTAINER_HEADER_FLAGS or not enabled);
+    this->m_compressionEnabled = enabled;
+    this->m_filterWidth = filterWidth;
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
@@ -122,6 +132,7 @@ void DpWriter::schedIn_handler(const NATIVE_INT_TYPE portNum, U32 context) {
     this->tlmWrite_NumSuccessfulWrites(this->m_numSuccessfulWrites);
     this->tlmWrite_NumFailedWrites(this->m_numFailedWrites);
     this->tlmWrite_NumErrors(this->m_numErrors);
+    this->tlmWrite_CompressionRatio(this->m_compressionRatio);
 }
 
 // ----------------------------------------------------------------------
@@ -189,26 +200,15 @@ Fw::Success::T DpWriter::writeFile(const Fw::DpContainer& container,
     }
     // Write the file
     if (status == Fw::Success::SUCCESS) {
-        // Set write size to file size
-        // On entry to the write call, this is the number of bytes to write
-        // On return from the write call, this is the number of bytes written
-        FwSignedSizeType writeSize = static_cast<FwSignedSizeType>(fileSize);
-        fileStatus = file.write(buffer.getData(), writeSize);
-        // If a successful write occurred, then update the number of bytes written
-        if (fileStatus == Os::File::OP_OK) {
-            this->m_numBytesWritten += static_cast<U64>(writeSize);
-        }
-        if ((fileStatus == Os::File::OP_OK) and (writeSize == static_cast<FwSignedSizeType>(fileSize))) {
-            // If the write status is success, and the number of bytes written
-            // is the expected number, then record the success
-            this->log_ACTIVITY_LO_FileWritten(
-                static_cast<U32>(writeSize),
-                fileName);
+        const bool compress = this->m_compressionEnabled and (container.getDataSize() > 0) and
+                              ((container.getFlags() & Fw::DpContainer::FLAG_COMPRESSED) == 0);
+        if (compress) {
+            status = this->writeCompressedData(file, container, fileName, fileSize);
         } else {
-            // Otherwise record the failure
-            this->log_WARNING_HI_FileWriteError(static_cast<U32>(fileStatus), static_cast<U32>(writeSize),
-                                                static_cast<U32>(fileSize), fileName);
-            status = Fw::Success::FAILURE;
+            status = this->writeData(file, buffer.getData(), fileSize, fileName);
+        }
+        if (status == Fw::Success::SUCCESS) {
+            this->log_ACTIVITY_LO_FileWritten(static_cast<U32>(fileSize), fileName);
         }
     }
     // Update the count of successful or failed writes
@@ -221,6 +221,100 @@ Fw::Success::T DpWriter::writeFile(const Fw::DpContainer& container,
     return status;
 }
 
+Fw::Success::T DpWriter::writeCompressedData(Os::File& file,
+                                             const Fw::DpContainer& container,
+                                             const Fw::FileNameString& fileName,
+                                             FwSizeType& fileSize) {
+    static_assert(sizeof(DpWriter::m_chunk) >= Fw::DpCodec::Preamble::SIZE, "chunk must hold the preamble");
+    Fw::Success::T status = Fw::Success::SUCCESS;
+    const Fw::Buffer buffer = container.getBuffer();
+    const U8* const data = &buffer.getData()[Fw::DpContainer::DATA_OFFSET];
+    const FwSizeType dataSize = container.getDataSize();
+    // The header holds the compressed data size, so write the data first
+    const Os::File::Status fileStatus =
+        file.seek(static_cast<FwSignedSizeType>(Fw::DpContainer::DATA_OFFSET), Os::File::SeekType::ABSOLUTE);
+    if (fileStatus != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileWriteError(static_cast<U32>(fileStatus), 0, static_cast<U32>(fileSize), fileName);
+        status = Fw::Success::FAILURE;
+    }
+    // Write the preamble and the chunks, hashing them as they are written
+    Utils::Hash dataHash;
+    dataHash.init();
+    FwSizeType compressedSize = Fw::DpCodec::Preamble::SIZE;
+    if (status == Fw::Success::SUCCESS) {
+        Fw::DpCodec::serializePreamble(this->m_chunk, this->m_filterWidth, DP_COMPRESSION_CHUNK_SIZE, dataSize);
+        dataHash.update(this->m_chunk, static_cast<NATIVE_INT_TYPE>(Fw::DpCodec::Preamble::SIZE));
+        status = this->writeData(file, this->m_chunk, Fw::DpCodec::Preamble::SIZE, fileName);
+    }
+    for (FwSizeType offset = 0; (status == Fw::Success::SUCCESS) and (offset < dataSize);
+         offset += DP_COMPRESSION_CHUNK_SIZE) {
+        const FwSizeType chunkSize = FW_MIN(DP_COMPRESSION_CHUNK_SIZE, dataSize - offset);
+        const FwSizeType encodedSize =
+            this->m_codec.encodeChunk(&data[offset], chunkSize, this->m_filterWidth, this->m_chunk);
+        dataHash.update(this->m_chunk, static_cast<NATIVE_INT_TYPE>(encodedSize));
+        status = this->writeData(file, this->m_chunk, encodedSize, fileName);
+        compressedSize += encodedSize;
+    }
+    // Write the data hash
+    if (status == Fw::Success::SUCCESS) {
+        Utils::HashBuffer hashBuffer;
+        dataHash.final(hashBuffer);
+        status = this->writeData(file, hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH, fileName);
+    }
+    // Write the header and the header hash
+    // Update a copy of the header, so the buffer stays as it was sent
+    if (status == Fw::Success::SUCCESS) {
+        U8 headerData[Fw::DpContainer::MIN_PACKET_SIZE];
+        (void)::memcpy(headerData, buffer.getData(), Fw::DpContainer::DATA_OFFSET);
+        Fw::DpContainer header;
+        header.setBuffer(Fw::Buffer(headerData, sizeof headerData));
+        const Fw::SerializeStatus serialStatus = header.deserializeHeader();
+        FW_ASSERT(serialStatus == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(serialStatus));
+        header.setFlags(static_cast<U8>(header.getFlags() | Fw::DpContainer::FLAG_COMPRESSED));
+        header.setDataSize(compressedSize);
+        header.serializeHeader();
+        const Os::File::Status seekStatus = file.seek(0, Os::File::SeekType::ABSOLUTE);
+        if (seekStatus != Os::File::OP_OK) {
+            this->log_WARNING_HI_FileWriteError(static_cast<U32>(seekStatus), 0,
+                                                static_cast<U32>(Fw::DpContainer::DATA_OFFSET), fileName);
+            status = Fw::Success::FAILURE;
+        }
+        if (status == Fw::Success::SUCCESS) {
+            status = this->writeData(file, headerData, Fw::DpContainer::DATA_OFFSET, fileName);
+        }
+    }
+    if (status == Fw::Success::SUCCESS) {
+        fileSize = Fw::DpContainer::getPacketSizeForDataSize(compressedSize);
+        this->m_compressionRatio = static_cast<F32>(dataSize) / static_cast<F32>(compressedSize);
+        this->log_ACTIVITY_LO_DataCompressed(static_cast<U32>(dataSize), static_cast<U32>(compressedSize), fileName);
+    }
+    return status;
+}
+
+Fw::Success::T DpWriter::writeData(Os::File& file,
+                                   const U8* data,
+                                   FwSizeType size,
+                                   const Fw::FileNameString& fileName) {
+    Fw::Success::T status = Fw::Success::SUCCESS;
+    // Set write size to data size
+    // On entry to the write call, this is the number of bytes to write
+    // On return from the write call, this is the number of bytes written
+    FwSignedSizeType writeSize = static_cast<FwSignedSizeType>(size);
+    const Os::File::Status fileStatus = file.write(data, writeSize);
+    // If a successful write occurred, then update the number of bytes written
+    if (fileStatus == Os::File::OP_OK) {
+        this->m_numBytesWritten += static_cast<U64>(writeSize);
+    }
+    if ((fileStatus != Os::File::OP_OK) or (writeSize != static_cast<FwSignedSizeType>(size))) {
+        // If the write status is not success, or the number of bytes written
+        // is not the expected number, then record the failure
+        this->log_WARNING_HI_FileWriteError(static_cast<U32>(fileStatus), static_cast<U32>(writeSize),
+                                            static_cast<U32>(size), fileName);
+        status = Fw::Success::FAILURE;
+    }
+    return status;
+}
+
 void DpWriter::sendNotification(const Fw::DpContainer& container,
                                 const Fw::FileNameString& fileName,
                                 FwSizeType fileSize) {
@@ -9,10 +9,12 @@
 
 #include <DpCfg.hpp>
 
+#include "Fw/Dp/DpCodec.hpp"
 #include "Fw/Dp/DpContainer.hpp"
 #include "Fw/Types/FileNameString.hpp"
 #include "Fw/Types/String.hpp"
 #include "Fw/Types/SuccessEnumAc.hpp"
+#include "Os/File.hpp"
 #include "Svc/DpWriter/DpWriterComponentAc.hpp"
 
 namespace Svc {
@@ -36,6 +38,14 @@ class DpWriter : public DpWriterComponentBase {
     void configure(const Fw::StringBase& dpFileNamePrefix  //!< The file name prefix for writing DP files
     );
 
+    //! Configure compression of container data
+    //! Compressed files have the Fw::DpContainer::FLAG_COMPRESSED header flag set, and their data
+    //! is encoded as described by Fw::DpCodec. Containers that are already compressed are written as is.
+    //! Enabling compression needs DP_CONTAINER_HEADER_FLAGS.
+    void configureCompression(bool enabled,       //!< Whether to compress container data
+                              U8 filterWidth = 0  //!< The width of the integers to filter, 0 for no filter
+    );
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -87,6 +97,22 @@ class DpWriter : public DpWriterComponentBase {
                              FwSizeType& fileSize                 //!< The file size (output)
     );
 
+    //! Write the container with its data compressed
+    //! \return Success or failure
+    Fw::Success::T writeCompressedData(Os::File& file,                      //!< The open file
+                                       const Fw::DpContainer& container,    //!< The container
+                                       const Fw::FileNameString& fileName,  //!< The file name
+                                       FwSizeType& fileSize                 //!< The file size (output)
+    );
+
+    //! Write data to the file
+    //! \return Success or failure
+    Fw::Success::T writeData(Os::File& file,                     //!< The open file
+                             const U8* data,                     //!< The data
+                             FwSizeType size,                    //!< The data size
+                             const Fw::FileNameString& fileName  //!< The file name
+    );
+
     //! Send the DpWritten notification
     void sendNotification(const Fw::DpContainer& container,    //!< The container
                           const Fw::FileNameString& fileName,  //!< The file name
@@ -117,6 +143,21 @@ class DpWriter : public DpWriterComponentBase {
     //! The precise meaning depends on the DP format string
     //! For example, this could be a directory path prefix
     Fw::FileNameString m_dpFileNamePrefix;
+
+    //! Whether to compress container data
+    bool m_compressionEnabled = false;
+
+    //! The width of the integers to filter before compression
+    U8 m_filterWidth = 0;
+
+    //! The compression ratio of the last compressed container
+    F32 m_compressionRatio = 0.0f;
+
+    //! The codec for compressing container data
+    Fw::DpCodec m_codec;
+
+    //! The encoded chunk being written
+    U8 m_chunk[Fw::DpCodec::getMaxEncodedChunkSize(DP_COMPRESSION_CHUNK_SIZE)];
 };
 
 }  // end namespace Svc
@@ -51,6 +51,7 @@ class AbstractState {
           m_NumFailedWrites(0),
           m_NumSuccessfulWrites(0),
           m_NumErrors(0),
+          m_CompressionRatio(0.0f),
           m_procTypes(0) {}
 
   public:
@@ -98,6 +99,9 @@ class AbstractState {
     //! The number of errors
     TestUtils::OnChangeChannel<U32> m_NumErrors;
 
+    //! The compression ratio of the last compressed container
+    TestUtils::OnChangeChannel<F32> m_CompressionRatio;
+
     //! The number of BufferTooSmallForData events since the last throttle clear
     FwSizeType m_bufferTooSmallForDataEventCount = 0;
 
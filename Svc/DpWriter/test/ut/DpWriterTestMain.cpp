@@ -25,6 +25,16 @@ TEST(BufferSendIn, BufferTooSmallForPacket) {
     tester.BufferTooSmallForPacket();
 }
 
+TEST(BufferSendIn, Compressed) {
+    COMMENT("Invoke bufferSendIn with compression enabled.");
+    REQUIREMENT("SVC-DPWRITER-007");
+    if (not DP_CONTAINER_HEADER_FLAGS) {
+        GTEST_SKIP() << "Compression needs DP_CONTAINER_HEADER_FLAGS";
+    }
+    BufferSendIn::Tester tester;
+    tester.Compressed();
+}
+
 TEST(BufferSendIn, FileOpenError) {
     COMMENT("Invoke bufferSendIn with a file open error.");
     REQUIREMENT("SVC-DPMANAGER-001");
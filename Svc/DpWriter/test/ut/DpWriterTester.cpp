@@ -85,6 +85,7 @@ void DpWriterTester::checkTelemetry() {
     TESTER_CHECK_CHANNEL(NumSuccessfulWrites);
     TESTER_CHECK_CHANNEL(NumFailedWrites);
     TESTER_CHECK_CHANNEL(NumErrors);
+    TESTER_CHECK_CHANNEL(CompressionRatio);
 }
 
 }  // namespace Svc
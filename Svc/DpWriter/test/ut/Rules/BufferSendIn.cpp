@@ -392,6 +392,103 @@ void TestState ::action__BufferSendIn__FileWriteError() {
     fileData.writeResult = savedWriteResult;
 }
 
+bool TestState ::precondition__BufferSendIn__Compressed() const {
+    const auto& fileData = Os::Stub::File::Test::StaticData::data;
+    bool result = DP_CONTAINER_HEADER_FLAGS;
+    result &= (fileData.openStatus == Os::File::Status::OP_OK);
+    result &= (fileData.writeStatus == Os::File::Status::OP_OK);
+    return result;
+}
+
+void TestState ::action__BufferSendIn__Compressed() {
+    // Clear the history
+    this->clearHistory();
+    // Reset the saved proc types
+    // These are updated in the from_procBufferSendOut handler
+    this->abstractState.m_procTypes = 0;
+    // Reset the file pointer in the stub file implementation
+    auto& fileData = Os::Stub::File::Test::StaticData::data;
+    fileData.pointer = 0;
+    // Update m_NumBuffersReceived
+    this->abstractState.m_NumBuffersReceived.value++;
+    // Construct a random buffer holding slowly varying data
+    Fw::Buffer buffer = this->abstractState.getDpBuffer();
+    Fw::DpContainer container;
+    container.setBuffer(buffer);
+    Fw::SerializeStatus status = container.deserializeHeader();
+    ASSERT_EQ(status, Fw::FW_SERIALIZE_OK);
+    const FwSizeType dataSize = container.getDataSize();
+    U8* const data = &buffer.getData()[Fw::DpContainer::DATA_OFFSET];
+    for (FwSizeType i = 0; i < dataSize; i++) {
+        data[i] = static_cast<U8>(i / 64);
+    }
+    container.updateDataHash();
+    static U8 sentData[AbstractState::MAX_BUFFER_SIZE];
+    (void)::memcpy(sentData, buffer.getData(), buffer.getSize());
+    // Send the buffer with compression enabled
+    const U8 filterWidths[] = {0, 1, 2, 4, 8};
+    const U8 filterWidth = filterWidths[STest::Pick::startLength(0, sizeof filterWidths)];
+    this->component.configureCompression(true, filterWidth);
+    this->invoke_to_bufferSendIn(0, buffer);
+    this->component.doDispatch();
+    this->component.configureCompression(false);
+    // Check that the buffer is unchanged
+    ASSERT_EQ(0, ::memcmp(sentData, buffer.getData(), buffer.getSize()));
+    // Check the file header and hashes
+    Fw::DpContainer fileContainer;
+    fileContainer.setBuffer(Fw::Buffer(this->abstractState.m_writeResultData, AbstractState::MAX_BUFFER_SIZE));
+    Utils::HashBuffer storedHash;
+    Utils::HashBuffer computedHash;
+    ASSERT_EQ(fileContainer.checkHeaderHash(storedHash, computedHash), Fw::Success::SUCCESS);
+    status = fileContainer.deserializeHeader();
+    ASSERT_EQ(status, Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(fileContainer.getId(), container.getId());
+    ASSERT_EQ(fileContainer.getPriority(), container.getPriority());
+    ASSERT_EQ(fileContainer.getTimeTag(), container.getTimeTag());
+    ASSERT_EQ(fileContainer.getProcTypes(), container.getProcTypes());
+    ASSERT_EQ(fileContainer.checkDataHash(storedHash, computedHash), Fw::Success::SUCCESS);
+    const FwSizeType fileSize = fileContainer.getPacketSize();
+    Fw::FileNameString fileName;
+    this->constructDpFileName(container.getId(), container.getTimeTag(), fileName);
+    if (dataSize > 0) {
+        // Check the compressed data
+        ASSERT_EQ(fileContainer.getFlags(), Fw::DpContainer::FLAG_COMPRESSED);
+        static Fw::DpCodec codec;
+        static U8 decodedData[AbstractState::MAX_DATA_SIZE];
+        FwSizeType decodedSize = 0;
+        status = codec.decode(&this->abstractState.m_writeResultData[Fw::DpContainer::DATA_OFFSET],
+                              fileContainer.getDataSize(), decodedData, sizeof decodedData, decodedSize);
+        ASSERT_EQ(status, Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(decodedSize, dataSize);
+        ASSERT_EQ(0, ::memcmp(decodedData, data, dataSize));
+        // Check events
+        ASSERT_EVENTS_SIZE(2);
+        ASSERT_EVENTS_DataCompressed_SIZE(1);
+        ASSERT_EVENTS_DataCompressed(0, dataSize, fileContainer.getDataSize(), fileName.toChar());
+        this->abstractState.m_CompressionRatio.value =
+            static_cast<F32>(dataSize) / static_cast<F32>(fileContainer.getDataSize());
+    } else {
+        // Empty data is written as is
+        ASSERT_EQ(fileContainer.getFlags(), 0);
+        ASSERT_EQ(0, ::memcmp(buffer.getData(), this->abstractState.m_writeResultData, buffer.getSize()));
+        ASSERT_EVENTS_SIZE(1);
+    }
+    ASSERT_EVENTS_FileWritten_SIZE(1);
+    ASSERT_EVENTS_FileWritten(0, fileSize, fileName.toChar());
+    // Check processing types
+    this->checkProcTypes(container);
+    // Check DP notification
+    ASSERT_from_dpWrittenOut_SIZE(1);
+    ASSERT_from_dpWrittenOut(0, fileName, container.getPriority(), fileSize);
+    // Check deallocation
+    ASSERT_from_deallocBufferSendOut_SIZE(1);
+    ASSERT_from_deallocBufferSendOut(0, buffer);
+    // Update m_NumBytesWritten
+    this->abstractState.m_NumBytesWritten.value += fileSize;
+    // Update m_NumSuccessfulWrites
+    this->abstractState.m_NumSuccessfulWrites.value++;
+}
+
 namespace BufferSendIn {
 
 // ----------------------------------------------------------------------
@@ -408,6 +505,11 @@ void Tester::BufferTooSmallForPacket() {
     this->testState.printEvents();
 }
 
+void Tester::Compressed() {
+    this->ruleCompressed.apply(this->testState);
+    this->testState.printEvents();
+}
+
 void Tester::FileOpenError() {
     Testers::fileOpenStatus.ruleError.apply(this->testState);
     this->ruleFileOpenError.apply(this->testState);
@@ -49,6 +49,9 @@ class Tester {
     //! File write error
     void FileWriteError();
 
+    //! Compressed data
+    void Compressed();
+
   public:
     // ----------------------------------------------------------------------
     // Rules
@@ -78,6 +81,9 @@ class Tester {
     //! Rule BufferSendIn::FileWriteError
     Rules::BufferSendIn::FileWriteError ruleFileWriteError;
 
+    //! Rule BufferSendIn::Compressed
+    Rules::BufferSendIn::Compressed ruleCompressed;
+
   public:
     // ----------------------------------------------------------------------
     // Public member variables
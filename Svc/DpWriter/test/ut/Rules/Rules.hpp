@@ -34,6 +34,7 @@ namespace Rules {
 
 RULES_DEF_RULE(BufferSendIn, BufferTooSmallForData)
 RULES_DEF_RULE(BufferSendIn, BufferTooSmallForPacket)
+RULES_DEF_RULE(BufferSendIn, Compressed)
 RULES_DEF_RULE(BufferSendIn, FileOpenError)
 RULES_DEF_RULE(BufferSendIn, FileWriteError)
 RULES_DEF_RULE(BufferSendIn, InvalidBuffer)
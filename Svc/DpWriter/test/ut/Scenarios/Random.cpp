@@ -26,6 +26,7 @@ namespace Random {
 
 Rules::BufferSendIn::BufferTooSmallForData bufferSendInBufferTooSmallForData;
 Rules::BufferSendIn::BufferTooSmallForPacket bufferSendInBufferTooSmallForPacket;
+Rules::BufferSendIn::Compressed bufferSendInCompressed;
 Rules::BufferSendIn::FileOpenError bufferSendInFileOpenError;
 Rules::BufferSendIn::FileWriteError bufferSendInFileWriteError;
 Rules::BufferSendIn::InvalidBuffer bufferSendInInvalidBuffer;
@@ -46,6 +47,7 @@ Rules::SchedIn::OK schedInOK;
 void Tester ::run(FwSizeType maxNumSteps) {
     STest::Rule<TestState>* rules[] = {&bufferSendInBufferTooSmallForData,
                                        &bufferSendInBufferTooSmallForPacket,
+                                       &bufferSendInCompressed,
                                        &bufferSendInFileOpenError,
                                        &bufferSendInFileWriteError,
                                        &bufferSendInInvalidBuffer,
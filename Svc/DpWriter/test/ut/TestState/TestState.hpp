@@ -28,6 +28,7 @@ class TestState : public DpWriterTester {
 
     TEST_STATE_DEF_RULE(BufferSendIn, BufferTooSmallForData)
     TEST_STATE_DEF_RULE(BufferSendIn, BufferTooSmallForPacket)
+    TEST_STATE_DEF_RULE(BufferSendIn, Compressed)
     TEST_STATE_DEF_RULE(BufferSendIn, FileOpenError)
     TEST_STATE_DEF_RULE(BufferSendIn, FileWriteError)
     TEST_STATE_DEF_RULE(BufferSendIn, InvalidBuffer)
@@ -0,0 +1,346 @@
+// ======================================================================
+// \title  EventArchive.cpp
+// \brief  cpp file for EventArchive component implementation class
+// ======================================================================
+
+#include <cstring>
+
+#include "Fw/Types/Assert.hpp"
+#include "Svc/EventArchive/EventArchive.hpp"
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction, initialization, and destruction
+// ----------------------------------------------------------------------
+
+EventArchive::EventArchive(const char* const compName)
+    : EventArchiveComponentBase(compName),
+      m_filePrefix(),
+      m_segmentSeconds(0),
+      m_logPacket(),
+      m_packetBuffer(),
+      m_blockSize(0),
+      m_blockEntry(),
+      m_numBlocks(0),
+      m_summary(),
+      m_fileName(),
+      m_fileOpen(false),
+      m_header(),
+      m_fileSize(0),
+      m_reader(),
+      m_eventsArchived(0),
+      m_eventsDropped(0),
+      m_bytesWritten(0),
+      m_filesClosed(0) {}
+
+EventArchive::~EventArchive() {
+    // no index and no events here, a reader scans the blocks of the file
+    if (this->m_fileOpen) {
+        this->m_file.close();
+    }
+}
+
+void EventArchive::configure(const Fw::StringBase& filePrefix, U32 segmentSeconds) {
+    FW_ASSERT(segmentSeconds > 0);
+    this->m_filePrefix = filePrefix;
+    this->m_segmentSeconds = segmentSeconds;
+    this->m_reader.configure(filePrefix, segmentSeconds);
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void EventArchive::logIn_handler(const NATIVE_INT_TYPE portNum,
+                                 FwEventIdType id,
+                                 Fw::Time& timeTag,
+                                 const Fw::LogSeverity& severity,
+                                 Fw::LogBuffer& args) {
+    FW_ASSERT(this->m_segmentSeconds > 0);
+    // the packet sent to the ground, as ActiveLogger serializes it
+    this->m_logPacket.setId(id);
+    this->m_logPacket.setTimeTag(timeTag);
+    this->m_logPacket.setLogBuffer(args);
+    this->m_packetBuffer.resetSer();
+    const Fw::SerializeStatus status = this->m_logPacket.serialize(this->m_packetBuffer);
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == status, static_cast<FwAssertArgType>(status));
+    this->archiveEvent(timeTag, severity, id);
+}
+
+void EventArchive::pingIn_handler(const NATIVE_INT_TYPE portNum, U32 key) {
+    this->pingOut_out(0, key);
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void EventArchive::CLOSE_SEGMENT_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    this->closeSegment();
+    this->writeTelemetry();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void EventArchive::REPLAY_cmdHandler(FwOpcodeType opCode,
+                                     U32 cmdSeq,
+                                     U32 startSeconds,
+                                     U32 endSeconds,
+                                     U32 firstId,
+                                     U32 lastId,
+                                     U8 severities) {
+    FW_ASSERT(this->m_segmentSeconds > 0);
+    // the buffered block goes to the file so that the reader finds its events
+    if (this->m_numBlocks + 1 >= EVENT_ARCHIVE_MAX_BLOCKS) {
+        this->closeSegment();
+    } else if (this->m_fileOpen) {
+        (void)this->flushBlock();
+    }
+    this->writeTelemetry();
+    const Fw::Time now = this->getTime();
+    const Fw::Time start(now.getTimeBase(), now.getContext(), startSeconds, 0);
+    const Fw::Time end(now.getTimeBase(), now.getContext(), endSeconds, 999999);
+    Replayer replayer(*this);
+    const EventArchiveReader::Status status =
+        this->m_reader.query(start, end, firstId, lastId, severities, replayer);
+    if (status != EventArchiveReader::QUERY_OK) {
+        this->log_WARNING_LO_ReplayError(replayer.getCount(), status);
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+        return;
+    }
+    this->log_ACTIVITY_HI_ReplayDone(replayer.getCount());
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Types
+// ----------------------------------------------------------------------
+
+void EventArchive::Replayer::visitEvent(const EventArchiveFormat::Record& record) {
+    Fw::ComBuffer& packet = this->m_archive.m_packetBuffer;
+    packet.resetSer();
+    const Fw::SerializeStatus status =
+        packet.serialize(record.packet, record.packetSize, Fw::Serialization::OMIT_LENGTH);
+    if (status != Fw::FW_SERIALIZE_OK) {
+        return;
+    }
+    if (this->m_archive.isConnected_replayOut_OutputPort(0)) {
+        this->m_archive.replayOut_out(0, packet, 0);
+    }
+    this->m_count++;
+}
+
+// ----------------------------------------------------------------------
+// Private helper functions
+// ----------------------------------------------------------------------
+
+void EventArchive::archiveEvent(const Fw::Time& timeTag, const Fw::LogSeverity& severity, FwEventIdType id) {
+    const U32 segmentStart = EventArchiveFormat::getSegmentStart(timeTag.getSeconds(), this->m_segmentSeconds);
+    // an event of a later segment closes the file, a late event stays in it, see EventArchiveReader
+    if (this->m_fileOpen and ((timeTag.getTimeBase() != this->m_header.timeBase) or
+                              (timeTag.getContext() != this->m_header.context) or
+                              (segmentStart > this->m_header.segmentStart))) {
+        this->closeSegment();
+    }
+    if ((not this->m_fileOpen) and (not this->openSegment(timeTag))) {
+        this->m_eventsDropped++;
+        this->writeTelemetry();
+        return;
+    }
+
+    const FwSizeType packetSize = this->m_packetBuffer.getBuffLength();
+    const FwSizeType recordSize = EventArchiveFormat::RECORD_HEADER_SIZE + packetSize;
+    if ((this->m_blockSize + recordSize > EVENT_ARCHIVE_BLOCK_SIZE) or (this->m_blockEntry.count == 0xFFFF)) {
+        // the last block of a file is written when it closes
+        if (this->m_numBlocks + 1 >= EVENT_ARCHIVE_MAX_BLOCKS) {
+            this->closeSegment();
+            if (not this->openSegment(timeTag)) {
+                this->m_eventsDropped++;
+                this->writeTelemetry();
+                return;
+            }
+        } else if (not this->flushBlock()) {
+            this->m_eventsDropped++;
+            this->writeTelemetry();
+            return;
+        }
+    }
+
+    const I64 time = EventArchiveFormat::toMicroseconds(timeTag.getSeconds(), timeTag.getUSeconds());
+    if (this->m_blockEntry.count == 0) {
+        this->m_blockEntry.severities = 0;
+        this->m_blockEntry.minTime = time;
+        this->m_blockEntry.maxTime = time;
+        (void)memset(this->m_blockEntry.filter, 0, sizeof(this->m_blockEntry.filter));
+    }
+    if (this->m_summary.count == 0) {
+        this->m_summary.minTime = time;
+        this->m_summary.maxTime = time;
+    }
+    U8* record = &this->m_block[EventArchiveFormat::BlockHeader::SIZE + this->m_blockSize];
+    record[0] = static_cast<U8>(packetSize >> 8);
+    record[1] = static_cast<U8>(packetSize);
+    record[2] = static_cast<U8>(severity.e);
+    (void)memcpy(&record[EventArchiveFormat::RECORD_HEADER_SIZE], this->m_packetBuffer.getBuffAddr(), packetSize);
+    this->m_blockSize += recordSize;
+
+    const U8 severityBit = EventArchiveFormat::getSeverityBit(severity);
+    this->m_blockEntry.count++;
+    this->m_blockEntry.severities |= severityBit;
+    this->m_blockEntry.minTime = FW_MIN(this->m_blockEntry.minTime, time);
+    this->m_blockEntry.maxTime = FW_MAX(this->m_blockEntry.maxTime, time);
+    EventArchiveFormat::addToFilter(this->m_blockEntry.filter, sizeof(this->m_blockEntry.filter), id);
+    this->m_summary.count++;
+    this->m_summary.severities |= severityBit;
+    this->m_summary.minTime = FW_MIN(this->m_summary.minTime, time);
+    this->m_summary.maxTime = FW_MAX(this->m_summary.maxTime, time);
+    EventArchiveFormat::addToFilter(this->m_summary.filter, sizeof(this->m_summary.filter), id);
+    this->m_eventsArchived++;
+}
+
+bool EventArchive::openSegment(const Fw::Time& timeTag) {
+    FW_ASSERT(not this->m_fileOpen);
+    this->m_header.timeBase = static_cast<FwTimeBaseStoreType>(timeTag.getTimeBase());
+    this->m_header.context = timeTag.getContext();
+    this->m_header.segmentStart = EventArchiveFormat::getSegmentStart(timeTag.getSeconds(), this->m_segmentSeconds);
+    this->m_header.segmentSeconds = this->m_segmentSeconds;
+
+    // a segment already written to, before a restart or a time jump, continues in the next free file
+    Os::File::Status status = Os::File::FILE_EXISTS;
+    for (U32 fileNumber = 0; (fileNumber < EVENT_ARCHIVE_MAX_FILES_PER_SEGMENT) and (status == Os::File::FILE_EXISTS);
+         fileNumber++) {
+        EventArchiveFormat::formatFileName(this->m_fileName, this->m_filePrefix, this->m_header.timeBase,
+                                           this->m_header.segmentStart, fileNumber);
+        status = this->m_file.open(this->m_fileName.toChar(), Os::File::OPEN_CREATE, Os::File::NO_OVERWRITE);
+    }
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileOpenError(status, this->m_fileName);
+        return false;
+    }
+    this->m_fileOpen = true;
+    this->m_fileSize = 0;
+    this->m_numBlocks = 0;
+    this->m_blockSize = 0;
+    this->m_blockEntry.count = 0;
+    this->m_summary.count = 0;
+    this->m_summary.severities = 0;
+    (void)memset(this->m_summary.filter, 0, sizeof(this->m_summary.filter));
+
+    U8 header[EventArchiveFormat::Header::SIZE];
+    Fw::ExternalSerializeBuffer buffer(header, sizeof(header));
+    const Fw::SerializeStatus serStatus = this->m_header.serialize(buffer);
+    FW_ASSERT(serStatus == Fw::FW_SERIALIZE_OK, serStatus);
+    if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+        this->abandonSegment();
+        return false;
+    }
+    return true;
+}
+
+void EventArchive::closeSegment() {
+    if (not this->m_fileOpen) {
+        return;
+    }
+    if ((not this->flushBlock()) or (not this->writeIndex())) {
+        return;
+    }
+    this->m_file.close();
+    this->m_fileOpen = false;
+    this->m_filesClosed++;
+    this->log_ACTIVITY_LO_SegmentFileClosed(static_cast<U32>(this->m_numBlocks), this->m_fileSize, this->m_fileName);
+    this->writeTelemetry();
+}
+
+void EventArchive::abandonSegment() {
+    this->m_file.close();
+    this->m_fileOpen = false;
+    this->m_eventsDropped += this->m_blockEntry.count;
+    this->m_blockEntry.count = 0;
+    this->m_blockSize = 0;
+}
+
+bool EventArchive::flushBlock() {
+    if (this->m_blockEntry.count == 0) {
+        return true;
+    }
+    FW_ASSERT(this->m_numBlocks < EVENT_ARCHIVE_MAX_BLOCKS, static_cast<FwAssertArgType>(this->m_numBlocks));
+    // the header goes in front of the records so that the block is a single write
+    EventArchiveFormat::BlockHeader header;
+    header.size = static_cast<U32>(this->m_blockSize);
+    header.count = this->m_blockEntry.count;
+    Fw::ExternalSerializeBuffer buffer(this->m_block, EventArchiveFormat::BlockHeader::SIZE);
+    const Fw::SerializeStatus status = header.serialize(buffer);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    this->m_blockEntry.offset = this->m_fileSize;
+    this->m_blockEntry.size = static_cast<U32>(EventArchiveFormat::BlockHeader::SIZE + this->m_blockSize);
+    if (not this->writeData(this->m_block, this->m_blockEntry.size)) {
+        this->abandonSegment();
+        return false;
+    }
+    this->m_blocks[this->m_numBlocks++] = this->m_blockEntry;
+    this->m_blockEntry.count = 0;
+    this->m_blockSize = 0;
+    this->writeTelemetry();
+    return true;
+}
+
+bool EventArchive::writeIndex() {
+    EventArchiveFormat::Trailer trailer;
+    trailer.indexOffset = this->m_fileSize;
+    trailer.numBlocks = static_cast<U32>(this->m_numBlocks);
+    // the block was written, its buffer holds the index
+    Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+    for (FwSizeType block = 0; block < this->m_numBlocks; block++) {
+        if (buffer.getBuffCapacity() - buffer.getBuffLength() < EventArchiveFormat::IndexEntry::SIZE) {
+            if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+                this->abandonSegment();
+                return false;
+            }
+            buffer.resetSer();
+        }
+        const Fw::SerializeStatus status = this->m_blocks[block].serialize(buffer);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    }
+    if (buffer.getBuffCapacity() - buffer.getBuffLength() < EventArchiveFormat::Summary::SIZE +
+                                                              EventArchiveFormat::Trailer::SIZE) {
+        if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+            this->abandonSegment();
+            return false;
+        }
+        buffer.resetSer();
+    }
+    Fw::SerializeStatus status = this->m_summary.serialize(buffer);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    status = trailer.serialize(buffer);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+        this->abandonSegment();
+        return false;
+    }
+    return true;
+}
+
+bool EventArchive::writeData(const U8* data, FwSizeType size) {
+    FwSignedSizeType writeSize = static_cast<FwSignedSizeType>(size);
+    const Os::File::Status status = this->m_file.write(data, writeSize);
+    if (status == Os::File::OP_OK) {
+        this->m_bytesWritten += static_cast<U64>(writeSize);
+        this->m_fileSize += static_cast<U32>(writeSize);
+    }
+    if ((status != Os::File::OP_OK) or (writeSize != static_cast<FwSignedSizeType>(size))) {
+        this->log_WARNING_HI_FileWriteError(status, static_cast<U32>(writeSize), static_cast<U32>(size),
+                                            this->m_fileName);
+        return false;
+    }
+    return true;
+}
+
+void EventArchive::writeTelemetry() {
+    this->tlmWrite_EventsArchived(this->m_eventsArchived);
+    this->tlmWrite_EventsDropped(this->m_eventsDropped);
+    this->tlmWrite_BytesWritten(this->m_bytesWritten);
+    this->tlmWrite_FilesClosed(this->m_filesClosed);
+}
+
+}  // end namespace Svc
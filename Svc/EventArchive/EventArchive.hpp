@@ -0,0 +1,223 @@
+// ======================================================================
+// \title  EventArchive.hpp
+// \brief  hpp file for EventArchive component implementation class
+// ======================================================================
+
+#ifndef Svc_EventArchive_HPP
+#define Svc_EventArchive_HPP
+
+#include <EventArchiveCfg.hpp>
+
+#include "Fw/Com/ComBuffer.hpp"
+#include "Fw/Log/LogPacket.hpp"
+#include "Fw/Types/FileNameString.hpp"
+#include "Os/File.hpp"
+#include "Svc/EventArchive/EventArchiveComponentAc.hpp"
+#include "Svc/EventArchive/EventArchiveFormat.hpp"
+#include "Svc/EventArchive/EventArchiveReader.hpp"
+
+namespace Svc {
+
+//! Archives events into time-segmented files indexed by event id, severity and time
+//!
+//! Events from the LogArchive port of ActiveLogger are stored as the packets sent to the ground, with their
+//! severity, in blocks appended to the file of the current segment. Closing a segment file writes the index of its
+//! blocks and a summary of the file, each with a time range, a severity mask and a filter of the event ids, so
+//! that EventArchiveReader reads only the blocks a query needs. REPLAY sends the events of a query on replayOut.
+//! See EventArchiveFormat for the file layout.
+class EventArchive : public EventArchiveComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Construction, initialization, and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object EventArchive
+    //!
+    EventArchive(const char* const compName  //!< The component name
+    );
+
+    //! Destroy object EventArchive
+    //!
+    //! The current segment file is closed without its index. EventArchiveReader still reads its blocks, by
+    //! scanning the file.
+    ~EventArchive();
+
+    //! Configure the archive
+    void configure(const Fw::StringBase& filePrefix,  //!< The file name prefix
+                   U32 segmentSeconds                 //!< The number of seconds in a segment
+    );
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for logIn
+    //!
+    void logIn_handler(const NATIVE_INT_TYPE portNum,      //!< The port number
+                       FwEventIdType id,                   //!< Log ID
+                       Fw::Time& timeTag,                  //!< Time Tag
+                       const Fw::LogSeverity& severity,    //!< The severity argument
+                       Fw::LogBuffer& args                 //!< Buffer containing serialized log entry
+                       ) final;
+
+    //! Handler implementation for pingIn
+    //!
+    void pingIn_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                        U32 key                         //!< Value to return to pinger
+                        ) final;
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for commands
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for command CLOSE_SEGMENT
+    //!
+    void CLOSE_SEGMENT_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                  U32 cmdSeq            //!< The command sequence number
+                                  ) final;
+
+    //! Handler implementation for command REPLAY
+    //!
+    void REPLAY_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                           U32 cmdSeq,           //!< The command sequence number
+                           U32 startSeconds,     //!< The earliest time tag
+                           U32 endSeconds,       //!< The latest time tag
+                           U32 firstId,          //!< The first event id
+                           U32 lastId,           //!< The last event id
+                           U8 severities         //!< The severities
+                           ) final;
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Types
+    // ----------------------------------------------------------------------
+
+    //! Sends the events of a replay
+    class Replayer : public EventArchiveReader::Visitor {
+      public:
+        explicit Replayer(EventArchive& archive) : m_archive(archive), m_count(0) {}
+
+        void visitEvent(const EventArchiveFormat::Record& record) override;
+
+        //! Get the number of events sent
+        U32 getCount() const { return this->m_count; }
+
+      PRIVATE:
+        EventArchive& m_archive;  //!< The component
+        U32 m_count;              //!< The number of events sent
+    };
+
+    static_assert(EVENT_ARCHIVE_BLOCK_SIZE >= EventArchiveFormat::RECORD_HEADER_SIZE + FW_COM_BUFFER_MAX_SIZE,
+                  "a block must hold the largest event");
+    static_assert(FW_COM_BUFFER_MAX_SIZE <= 0xFFFF, "packet sizes are stored as U16");
+    static_assert(EVENT_ARCHIVE_MAX_BLOCKS > 1, "a file holds at least two blocks");
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private helper functions
+    // ----------------------------------------------------------------------
+
+    //! Archive the event serialized in m_packetBuffer
+    void archiveEvent(const Fw::Time& timeTag,          //!< The time tag
+                      const Fw::LogSeverity& severity,  //!< The severity
+                      FwEventIdType id                  //!< The event id
+    );
+
+    //! Open a file for the segment holding a time tag
+    //! \return True if the file is open
+    bool openSegment(const Fw::Time& timeTag);
+
+    //! Write the buffered block, the index, the summary and the trailer, and close the segment file
+    void closeSegment();
+
+    //! Close the segment file after an error, dropping the buffered events
+    void abandonSegment();
+
+    //! Write the buffered block to the segment file
+    //! \return True on success
+    bool flushBlock();
+
+    //! Write the index, the summary and the trailer
+    //! \return True on success
+    bool writeIndex();
+
+    //! Write data to the segment file
+    //! \return True on success
+    bool writeData(const U8* data,  //!< The data
+                   FwSizeType size  //!< The size of the data
+    );
+
+    //! Write the telemetry
+    void writeTelemetry();
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private member variables
+    // ----------------------------------------------------------------------
+
+    //! The file name prefix
+    Fw::FileNameString m_filePrefix;
+
+    //! The number of seconds in a segment
+    U32 m_segmentSeconds;
+
+    //! The event being archived
+    Fw::LogPacket m_logPacket;
+
+    //! The serialized event, also the packet being replayed
+    Fw::ComBuffer m_packetBuffer;
+
+    //! The buffered block, its header followed by its records
+    U8 m_block[EventArchiveFormat::BlockHeader::SIZE + EVENT_ARCHIVE_BLOCK_SIZE];
+
+    //! The size of the records of the buffered block
+    FwSizeType m_blockSize;
+
+    //! The index entry of the buffered block
+    EventArchiveFormat::IndexEntry m_blockEntry;
+
+    //! The blocks written to the segment file
+    EventArchiveFormat::IndexEntry m_blocks[EVENT_ARCHIVE_MAX_BLOCKS];
+
+    //! The number of blocks written to the segment file
+    FwSizeType m_numBlocks;
+
+    //! The summary of the segment file
+    EventArchiveFormat::Summary m_summary;
+
+    //! The segment file
+    Os::File m_file;
+
+    //! The name of the segment file
+    Fw::FileNameString m_fileName;
+
+    //! Whether a segment file is open
+    bool m_fileOpen;
+
+    //! The header of the segment file
+    EventArchiveFormat::Header m_header;
+
+    //! The size of the segment file
+    U32 m_fileSize;
+
+    //! The reader of replays
+    EventArchiveReader m_reader;
+
+    //! The number of events archived
+    U32 m_eventsArchived;
+
+    //! The number of events dropped
+    U32 m_eventsDropped;
+
+    //! The number of bytes written
+    U64 m_bytesWritten;
+
+    //! The number of segment files completed
+    U32 m_filesClosed;
+};
+
+}  // end namespace Svc
+
+#endif
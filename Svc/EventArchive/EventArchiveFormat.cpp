@@ -0,0 +1,277 @@
+// ======================================================================
+// \title  EventArchiveFormat.cpp
+// \brief  cpp file for the layout of event archive files
+// ======================================================================
+
+#include <Svc/EventArchive/EventArchiveFormat.hpp>
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Serialization
+// ----------------------------------------------------------------------
+
+Fw::SerializeStatus EventArchiveFormat::Header::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(MAGIC);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(VERSION);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->timeBase);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->context);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->segmentStart);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->segmentSeconds);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::Header::deserialize(Fw::SerializeBufferBase& buffer) {
+    U32 magic = 0;
+    U8 version = 0;
+    Fw::SerializeStatus status = buffer.deserialize(magic);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(version);
+    }
+    if ((status == Fw::FW_SERIALIZE_OK) and ((magic != MAGIC) or (version != VERSION))) {
+        status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->timeBase);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->context);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->segmentStart);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->segmentSeconds);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::BlockHeader::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->size);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->count);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::BlockHeader::deserialize(Fw::SerializeBufferBase& buffer) {
+    Fw::SerializeStatus status = buffer.deserialize(this->size);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->count);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::IndexEntry::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->offset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->size);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->count);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->severities);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->minTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->maxTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->filter, sizeof(this->filter), Fw::Serialization::OMIT_LENGTH);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::IndexEntry::deserialize(Fw::SerializeBufferBase& buffer) {
+    Fw::SerializeStatus status = buffer.deserialize(this->offset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->size);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->count);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->severities);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->minTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->maxTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        FwSizeType size = sizeof(this->filter);
+        status = buffer.deserialize(this->filter, size, Fw::Serialization::OMIT_LENGTH);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::Summary::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->count);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->severities);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->minTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->maxTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->filter, sizeof(this->filter), Fw::Serialization::OMIT_LENGTH);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::Summary::deserialize(Fw::SerializeBufferBase& buffer) {
+    Fw::SerializeStatus status = buffer.deserialize(this->count);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->severities);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->minTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->maxTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        FwSizeType size = sizeof(this->filter);
+        status = buffer.deserialize(this->filter, size, Fw::Serialization::OMIT_LENGTH);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::Trailer::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->indexOffset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->numBlocks);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(MAGIC);
+    }
+    return status;
+}
+
+Fw::SerializeStatus EventArchiveFormat::Trailer::deserialize(Fw::SerializeBufferBase& buffer) {
+    U32 magic = 0;
+    Fw::SerializeStatus status = buffer.deserialize(this->indexOffset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->numBlocks);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(magic);
+    }
+    // a file whose writer stopped before closing it has no trailer
+    if ((status == Fw::FW_SERIALIZE_OK) and (magic != MAGIC)) {
+        status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------
+// Public static functions
+// ----------------------------------------------------------------------
+
+void EventArchiveFormat::addToFilter(U8* filter, FwSizeType size, FwEventIdType id) {
+    FW_ASSERT(filter != nullptr);
+    const U32 hash = hashId(id);
+    const U32 mask = static_cast<U32>(size * 8 - 1);
+    const U32 first = hash & mask;
+    const U32 second = (hash >> 16) & mask;
+    filter[first / 8] = static_cast<U8>(filter[first / 8] | (1U << (first % 8)));
+    filter[second / 8] = static_cast<U8>(filter[second / 8] | (1U << (second % 8)));
+}
+
+bool EventArchiveFormat::filterMayContain(const U8* filter,
+                                          FwSizeType size,
+                                          FwEventIdType firstId,
+                                          FwEventIdType lastId) {
+    FW_ASSERT(filter != nullptr);
+    if ((lastId < firstId) or (static_cast<U64>(lastId - firstId) >= MAX_FILTER_IDS)) {
+        return true;
+    }
+    const U32 mask = static_cast<U32>(size * 8 - 1);
+    for (U64 id = firstId; id <= lastId; id++) {
+        const U32 hash = hashId(static_cast<FwEventIdType>(id));
+        const U32 first = hash & mask;
+        const U32 second = (hash >> 16) & mask;
+        if (((filter[first / 8] & (1U << (first % 8))) != 0) and ((filter[second / 8] & (1U << (second % 8))) != 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+FwSizeType EventArchiveFormat::decodeRecord(const U8* data, FwSizeType size, Record& record) {
+    FW_ASSERT(data != nullptr);
+    if (size < RECORD_HEADER_SIZE) {
+        return 0;
+    }
+    const FwSizeType packetSize = (static_cast<FwSizeType>(data[0]) << 8) | data[1];
+    if (packetSize > size - RECORD_HEADER_SIZE) {
+        return 0;
+    }
+    record.severity = static_cast<Fw::LogSeverity::T>(data[2]);
+    record.packet = &data[RECORD_HEADER_SIZE];
+    record.packetSize = packetSize;
+    // the id and the time tag are read from the packet
+    Fw::ExternalSerializeBuffer buffer(const_cast<U8*>(record.packet),
+                                       static_cast<Fw::Serializable::SizeType>(packetSize));
+    (void)buffer.setBuffLen(static_cast<Fw::Serializable::SizeType>(packetSize));
+    FwPacketDescriptorType descriptor = 0;
+    Fw::SerializeStatus status = buffer.deserialize(descriptor);
+    if ((status == Fw::FW_SERIALIZE_OK) and (descriptor != Fw::ComPacket::FW_PACKET_LOG)) {
+        status = Fw::FW_DESERIALIZE_TYPE_MISMATCH;
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(record.id);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(record.timeTag);
+    }
+    if ((status != Fw::FW_SERIALIZE_OK) or (not record.severity.isValid())) {
+        return 0;
+    }
+    return RECORD_HEADER_SIZE + packetSize;
+}
+
+void EventArchiveFormat::formatFileName(Fw::StringBase& fileName,
+                                        const Fw::StringBase& prefix,
+                                        FwTimeBaseStoreType timeBase,
+                                        U32 segmentStart,
+                                        U32 fileNumber) {
+    fileName.format("%s_%" PRI_FwTimeBaseStoreType "_%010" PRIu32 "_%" PRIu32 ".eva", prefix.toChar(), timeBase,
+                    segmentStart, fileNumber);
+}
+
+// ----------------------------------------------------------------------
+// Private static functions
+// ----------------------------------------------------------------------
+
+U32 EventArchiveFormat::hashId(FwEventIdType id) {
+    // the finalizer of MurmurHash3, so that neighboring ids set unrelated bits
+    U32 hash = static_cast<U32>(id);
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+}  // namespace Svc
@@ -0,0 +1,195 @@
+// ======================================================================
+// \title  EventArchiveFormat.hpp
+// \brief  hpp file for the layout of event archive files
+// ======================================================================
+
+#ifndef Svc_EventArchiveFormat_HPP
+#define Svc_EventArchiveFormat_HPP
+
+#include <EventArchiveCfg.hpp>
+#include <FpConfig.hpp>
+#include <Fw/Log/LogSeverityEnumAc.hpp>
+#include <Fw/Time/Time.hpp>
+#include <Fw/Types/Serializable.hpp>
+#include <Fw/Types/StringBase.hpp>
+
+namespace Svc {
+
+//! Layout of the event archive files written by EventArchive and read by EventArchiveReader
+//!
+//! Events are segmented by time. A segment covers a fixed number of seconds of one time base and is stored in one
+//! or more files named `<prefix>_<time base>_<segment start>_<file number>.eva`. A file holds, in order:
+//!
+//!     header | blocks | index | summary | trailer
+//!
+//! A block holds consecutive event records. A record is the size of its packet as a U16, the severity as a U8,
+//! and the event as the Fw::LogPacket sent to the ground, so that it can be replayed as is. The index lists the
+//! blocks with their time range, the severities they hold and a filter of the event ids they hold. The summary
+//! holds the same for the whole file, with a larger filter. The trailer locates the index. A query reads the
+//! trailer and the summary, and the index and the blocks only when the summary may match.
+//!
+//! The id filters are Bloom filters with two bits per id: an id missing from a filter is not in the block or the
+//! file, an id present in a filter may be.
+class EventArchiveFormat {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants and Types
+    // ----------------------------------------------------------------------
+
+    //! The magic number at the start and at the end of a file
+    static constexpr U32 MAGIC = 0x45564131;
+    //! The format version
+    static constexpr U8 VERSION = 1;
+    //! The size of a record before its packet: the packet size and the severity
+    static constexpr FwSizeType RECORD_HEADER_SIZE = sizeof(U16) + sizeof(U8);
+    //! The widest id range checked against the filters. Wider ranges read every block of their time range.
+    static constexpr FwSizeType MAX_FILTER_IDS = 256;
+    //! The severity mask holding every severity
+    static constexpr U8 ALL_SEVERITIES = 0xFF;
+
+    //! The file header
+    struct Header {
+        FwTimeBaseStoreType timeBase;     //!< The time base of the segment
+        FwTimeContextStoreType context;   //!< The time context of the events in the file
+        U32 segmentStart;                 //!< The first second of the segment
+        U32 segmentSeconds;               //!< The number of seconds in the segment
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = sizeof(U32) + sizeof(U8) + sizeof(FwTimeBaseStoreType) +
+                                           sizeof(FwTimeContextStoreType) + 2 * sizeof(U32);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! The header of a block
+    struct BlockHeader {
+        U32 size;   //!< The size of the records
+        U16 count;  //!< The number of records
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = sizeof(U32) + sizeof(U16);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! A block in the index
+    struct IndexEntry {
+        U32 offset;                                //!< The file offset of the block
+        U32 size;                                  //!< The size of the block, with its header
+        U16 count;                                 //!< The number of records
+        U8 severities;                             //!< The severities of the records, one bit per severity
+        I64 minTime;                               //!< The earliest time tag, in microseconds
+        I64 maxTime;                               //!< The latest time tag, in microseconds
+        U8 filter[EVENT_ARCHIVE_BLOCK_FILTER_SIZE];  //!< The filter of the event ids
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE =
+            2 * sizeof(U32) + sizeof(U16) + sizeof(U8) + 2 * sizeof(I64) + EVENT_ARCHIVE_BLOCK_FILTER_SIZE;
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! The summary of a file
+    struct Summary {
+        U32 count;                                //!< The number of records
+        U8 severities;                            //!< The severities of the records, one bit per severity
+        I64 minTime;                              //!< The earliest time tag, in microseconds
+        I64 maxTime;                              //!< The latest time tag, in microseconds
+        U8 filter[EVENT_ARCHIVE_FILE_FILTER_SIZE];  //!< The filter of the event ids
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = sizeof(U32) + sizeof(U8) + 2 * sizeof(I64) + EVENT_ARCHIVE_FILE_FILTER_SIZE;
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! The file trailer
+    struct Trailer {
+        U32 indexOffset;  //!< The file offset of the index
+        U32 numBlocks;    //!< The number of blocks in the index
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = 3 * sizeof(U32);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! A record decoded from a block
+    struct Record {
+        Fw::LogSeverity severity;  //!< The severity
+        FwEventIdType id;          //!< The event id
+        Fw::Time timeTag;          //!< The time tag
+        const U8* packet;          //!< The serialized Fw::LogPacket
+        FwSizeType packetSize;     //!< The size of the packet
+    };
+
+    static_assert((EVENT_ARCHIVE_BLOCK_FILTER_SIZE & (EVENT_ARCHIVE_BLOCK_FILTER_SIZE - 1)) == 0,
+                  "the block filter size must be a power of two");
+    static_assert((EVENT_ARCHIVE_FILE_FILTER_SIZE & (EVENT_ARCHIVE_FILE_FILTER_SIZE - 1)) == 0,
+                  "the file filter size must be a power of two");
+    static_assert(EVENT_ARCHIVE_FILE_FILTER_SIZE <= 0x2000, "filter bits are taken from 16 bits of the id hash");
+
+  public:
+    // ----------------------------------------------------------------------
+    // Public static functions
+    // ----------------------------------------------------------------------
+
+    //! Get the bit of a severity in a severity mask
+    static U8 getSeverityBit(const Fw::LogSeverity& severity) {
+        return static_cast<U8>(1U << (static_cast<U32>(severity.e) & 0x7));
+    }
+
+    //! Add an event id to a filter
+    static void addToFilter(U8* filter,        //!< The filter
+                            FwSizeType size,   //!< The size of the filter, a power of two
+                            FwEventIdType id   //!< The event id
+    );
+
+    //! Check whether a filter may hold an event id in a range
+    //! \return False if no id of the range is in the filter, true if one may be or the range is too wide to check
+    static bool filterMayContain(const U8* filter,        //!< The filter
+                                 FwSizeType size,         //!< The size of the filter, a power of two
+                                 FwEventIdType firstId,   //!< The first event id of the range
+                                 FwEventIdType lastId     //!< The last event id of the range
+    );
+
+    //! Decode the record at the start of data
+    //! \return The size of the record, zero if the data does not start with a valid record
+    static FwSizeType decodeRecord(const U8* data,   //!< The data
+                                   FwSizeType size,  //!< The size of the data
+                                   Record& record    //!< The record (output)
+    );
+
+    //! Get a time tag in microseconds
+    static I64 toMicroseconds(U32 seconds, U32 useconds) {
+        return static_cast<I64>(seconds) * 1000000 + static_cast<I64>(useconds);
+    }
+
+    //! Get the first second of the segment holding a second
+    static U32 getSegmentStart(U32 seconds,         //!< The second
+                               U32 segmentSeconds   //!< The number of seconds in a segment
+    ) {
+        return seconds - (seconds % segmentSeconds);
+    }
+
+    //! Format the name of a file of a segment
+    static void formatFileName(Fw::StringBase& fileName,        //!< The file name (output)
+                               const Fw::StringBase& prefix,    //!< The file name prefix
+                               FwTimeBaseStoreType timeBase,    //!< The time base of the segment
+                               U32 segmentStart,                //!< The first second of the segment
+                               U32 fileNumber                   //!< The number of the file in the segment
+    );
+
+  PRIVATE:
+    //! Hash an event id, the two filter bits are taken from the low and the high half
+    static U32 hashId(FwEventIdType id);
+};
+
+}  // namespace Svc
+
+#endif
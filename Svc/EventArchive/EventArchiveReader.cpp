@@ -0,0 +1,245 @@
+// ======================================================================
+// \title  EventArchiveReader.cpp
+// \brief  cpp file for EventArchiveReader, queries of event archives
+// ======================================================================
+
+#include <Svc/EventArchive/EventArchiveReader.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+EventArchiveReader::EventArchiveReader()
+    : m_filePrefix(), m_segmentSeconds(0), m_summary(), m_bytesRead(0), m_blocksRead(0) {}
+
+EventArchiveReader::~EventArchiveReader() {}
+
+void EventArchiveReader::configure(const Fw::StringBase& filePrefix, U32 segmentSeconds) {
+    FW_ASSERT(segmentSeconds > 0);
+    this->m_filePrefix = filePrefix;
+    this->m_segmentSeconds = segmentSeconds;
+}
+
+EventArchiveReader::Status EventArchiveReader::query(const Fw::Time& start,
+                                                     const Fw::Time& end,
+                                                     FwEventIdType firstId,
+                                                     FwEventIdType lastId,
+                                                     U8 severities,
+                                                     Visitor& visitor) {
+    FW_ASSERT(this->m_segmentSeconds > 0);
+    FW_ASSERT(start.getTimeBase() == end.getTimeBase(), start.getTimeBase(), end.getTimeBase());
+    Query query;
+    query.start = EventArchiveFormat::toMicroseconds(start.getSeconds(), start.getUSeconds());
+    query.end = EventArchiveFormat::toMicroseconds(end.getSeconds(), end.getUSeconds());
+    query.firstId = firstId;
+    query.lastId = lastId;
+    query.severities = severities;
+
+    const FwTimeBaseStoreType timeBase = static_cast<FwTimeBaseStoreType>(start.getTimeBase());
+    // late events are in the next segment, U64 so that the last segment of the U32 seconds range ends the loop
+    const U64 lastSegment =
+        static_cast<U64>(EventArchiveFormat::getSegmentStart(end.getSeconds(), this->m_segmentSeconds)) +
+        this->m_segmentSeconds;
+    Status result = QUERY_OK;
+    for (U64 segment = EventArchiveFormat::getSegmentStart(start.getSeconds(), this->m_segmentSeconds);
+         (segment <= lastSegment) and (segment <= 0xFFFFFFFF); segment += this->m_segmentSeconds) {
+        for (U32 fileNumber = 0; fileNumber < EVENT_ARCHIVE_MAX_FILES_PER_SEGMENT; fileNumber++) {
+            Fw::FileNameString fileName;
+            EventArchiveFormat::formatFileName(fileName, this->m_filePrefix, timeBase, static_cast<U32>(segment),
+                                               fileNumber);
+            Os::File file;
+            const Os::File::Status fileStatus = file.open(fileName.toChar(), Os::File::OPEN_READ);
+            if (fileStatus == Os::File::DOESNT_EXIST) {
+                break;
+            }
+            Status status = FILE_ERROR;
+            if (fileStatus == Os::File::OP_OK) {
+                status = this->queryFile(file, query, visitor);
+                file.close();
+            }
+            if (result == QUERY_OK) {
+                result = status;
+            }
+        }
+    }
+    return result;
+}
+
+EventArchiveReader::Status EventArchiveReader::queryFile(Os::File& file, const Query& query, Visitor& visitor) {
+    FwSignedSizeType fileSize = 0;
+    if (file.size(fileSize) != Os::File::OP_OK) {
+        return FILE_ERROR;
+    }
+    if (fileSize < static_cast<FwSignedSizeType>(EventArchiveFormat::Header::SIZE)) {
+        return FORMAT_ERROR;
+    }
+    Status status = this->readAt(file, 0, this->m_block, EventArchiveFormat::Header::SIZE);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+    (void)buffer.setBuffLen(EventArchiveFormat::Header::SIZE);
+    EventArchiveFormat::Header header;
+    if (header.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+        return FORMAT_ERROR;
+    }
+
+    // a file without a trailer was not closed by its writer
+    const FwSignedSizeType trailerOffset =
+        fileSize - static_cast<FwSignedSizeType>(EventArchiveFormat::Trailer::SIZE);
+    const FwSignedSizeType summaryOffset =
+        trailerOffset - static_cast<FwSignedSizeType>(EventArchiveFormat::Summary::SIZE);
+    EventArchiveFormat::Trailer trailer;
+    if (summaryOffset < static_cast<FwSignedSizeType>(EventArchiveFormat::Header::SIZE)) {
+        return this->scanFile(file, fileSize, query, visitor);
+    }
+    status = this->readAt(file, trailerOffset, this->m_block, EventArchiveFormat::Trailer::SIZE);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    buffer.resetSer();
+    (void)buffer.setBuffLen(EventArchiveFormat::Trailer::SIZE);
+    if (trailer.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+        return this->scanFile(file, fileSize, query, visitor);
+    }
+    if (static_cast<U64>(trailer.indexOffset) + static_cast<U64>(trailer.numBlocks) * EventArchiveFormat::IndexEntry::SIZE !=
+        static_cast<U64>(summaryOffset)) {
+        return FORMAT_ERROR;
+    }
+
+    // the summary rules out most files of a narrow query
+    status = this->readAt(file, summaryOffset, this->m_block, EventArchiveFormat::Summary::SIZE);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    buffer.resetSer();
+    (void)buffer.setBuffLen(EventArchiveFormat::Summary::SIZE);
+    if (this->m_summary.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+        return FORMAT_ERROR;
+    }
+    if ((this->m_summary.count == 0) or (this->m_summary.maxTime < query.start) or
+        (this->m_summary.minTime > query.end) or ((this->m_summary.severities & query.severities) == 0) or
+        (not EventArchiveFormat::filterMayContain(this->m_summary.filter, sizeof(this->m_summary.filter),
+                                                  query.firstId, query.lastId))) {
+        return QUERY_OK;
+    }
+
+    // read the blocks that may match
+    Fw::ExternalSerializeBuffer entries(this->m_entries, sizeof(this->m_entries));
+    for (U32 done = 0; done < trailer.numBlocks;) {
+        const U32 count = FW_MIN(trailer.numBlocks - done, static_cast<U32>(ENTRIES_PER_READ));
+        status = this->readAt(file, trailer.indexOffset + done * EventArchiveFormat::IndexEntry::SIZE,
+                              this->m_entries, count * EventArchiveFormat::IndexEntry::SIZE);
+        if (status != QUERY_OK) {
+            return status;
+        }
+        entries.resetSer();
+        (void)entries.setBuffLen(static_cast<Fw::Serializable::SizeType>(count * EventArchiveFormat::IndexEntry::SIZE));
+        for (U32 entry = 0; entry < count; entry++) {
+            EventArchiveFormat::IndexEntry block;
+            if (block.deserialize(entries) != Fw::FW_SERIALIZE_OK) {
+                return FORMAT_ERROR;
+            }
+            if ((block.maxTime < query.start) or (block.minTime > query.end) or
+                ((block.severities & query.severities) == 0) or
+                (not EventArchiveFormat::filterMayContain(block.filter, sizeof(block.filter), query.firstId,
+                                                          query.lastId))) {
+                continue;
+            }
+            status = this->readBlock(file, block.offset, block.size, query, visitor);
+            if (status != QUERY_OK) {
+                return status;
+            }
+        }
+        done += count;
+    }
+    return QUERY_OK;
+}
+
+EventArchiveReader::Status EventArchiveReader::scanFile(Os::File& file,
+                                                        FwSignedSizeType fileSize,
+                                                        const Query& query,
+                                                        Visitor& visitor) {
+    FwSignedSizeType offset = EventArchiveFormat::Header::SIZE;
+    while (offset + static_cast<FwSignedSizeType>(EventArchiveFormat::BlockHeader::SIZE) <= fileSize) {
+        const Status status = this->readAt(file, offset, this->m_block, EventArchiveFormat::BlockHeader::SIZE);
+        if (status != QUERY_OK) {
+            return status;
+        }
+        Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+        (void)buffer.setBuffLen(EventArchiveFormat::BlockHeader::SIZE);
+        EventArchiveFormat::BlockHeader header;
+        if (header.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+            break;
+        }
+        const FwSignedSizeType size = static_cast<FwSignedSizeType>(EventArchiveFormat::BlockHeader::SIZE) + header.size;
+        // the last block may have been cut short when the writer stopped
+        if ((header.count == 0) or (size > static_cast<FwSignedSizeType>(sizeof(this->m_block))) or
+            (offset + size > fileSize)) {
+            break;
+        }
+        const Status blockStatus =
+            this->readBlock(file, static_cast<U32>(offset), static_cast<U32>(size), query, visitor);
+        if (blockStatus != QUERY_OK) {
+            return blockStatus;
+        }
+        offset += size;
+    }
+    return QUERY_OK;
+}
+
+EventArchiveReader::Status EventArchiveReader::readBlock(Os::File& file,
+                                                         U32 offset,
+                                                         U32 size,
+                                                         const Query& query,
+                                                         Visitor& visitor) {
+    if ((size < EventArchiveFormat::BlockHeader::SIZE) or (size > sizeof(this->m_block))) {
+        return FORMAT_ERROR;
+    }
+    const Status status = this->readAt(file, offset, this->m_block, size);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    this->m_blocksRead++;
+    Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+    (void)buffer.setBuffLen(size);
+    EventArchiveFormat::BlockHeader header;
+    if ((header.deserialize(buffer) != Fw::FW_SERIALIZE_OK) or
+        (EventArchiveFormat::BlockHeader::SIZE + header.size != size)) {
+        return FORMAT_ERROR;
+    }
+
+    FwSizeType recordOffset = EventArchiveFormat::BlockHeader::SIZE;
+    for (U32 record = 0; record < header.count; record++) {
+        EventArchiveFormat::Record event;
+        const FwSizeType recordSize =
+            EventArchiveFormat::decodeRecord(&this->m_block[recordOffset], size - recordOffset, event);
+        if (recordSize == 0) {
+            return FORMAT_ERROR;
+        }
+        recordOffset += recordSize;
+        const I64 time = EventArchiveFormat::toMicroseconds(event.timeTag.getSeconds(), event.timeTag.getUSeconds());
+        if ((time < query.start) or (time > query.end) or (event.id < query.firstId) or (event.id > query.lastId) or
+            ((EventArchiveFormat::getSeverityBit(event.severity) & query.severities) == 0)) {
+            continue;
+        }
+        visitor.visitEvent(event);
+    }
+    return QUERY_OK;
+}
+
+EventArchiveReader::Status EventArchiveReader::readAt(Os::File& file,
+                                                      FwSignedSizeType offset,
+                                                      U8* data,
+                                                      FwSizeType size) {
+    if (file.seek(offset, Os::File::SeekType::ABSOLUTE) != Os::File::OP_OK) {
+        return FILE_ERROR;
+    }
+    FwSignedSizeType readSize = static_cast<FwSignedSizeType>(size);
+    if ((file.read(data, readSize) != Os::File::OP_OK) or (readSize != static_cast<FwSignedSizeType>(size))) {
+        return FILE_ERROR;
+    }
+    this->m_bytesRead += static_cast<U64>(readSize);
+    return QUERY_OK;
+}
+
+}  // namespace Svc
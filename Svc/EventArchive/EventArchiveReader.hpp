@@ -0,0 +1,122 @@
+// ======================================================================
+// \title  EventArchiveReader.hpp
+// \brief  hpp file for EventArchiveReader, queries of event archives
+// ======================================================================
+
+#ifndef Svc_EventArchiveReader_HPP
+#define Svc_EventArchiveReader_HPP
+
+#include <EventArchiveCfg.hpp>
+
+#include "Fw/Types/FileNameString.hpp"
+#include "Os/File.hpp"
+#include "Svc/EventArchive/EventArchiveFormat.hpp"
+
+namespace Svc {
+
+//! Reads the events of an id range and a set of severities over a time range from the files written by EventArchive
+//!
+//! Only the segments overlapping the time range, and the segment after it, are opened: EventArchive keeps an event
+//! that arrives late for its segment in the file of the current one. In each file, the reader reads the summary,
+//! then the index when the summary may match, then only the blocks whose time range, severities and id filter may
+//! match. A file without an index, left by a writer that stopped before closing it, is scanned block by block
+//! instead.
+class EventArchiveReader {
+  public:
+    //! The query status
+    enum Status {
+        QUERY_OK,      //!< The query read every file of its segments
+        FILE_ERROR,    //!< A file could not be read, its events are missing from the query
+        FORMAT_ERROR,  //!< A file or a block is malformed, its events are missing from the query
+    };
+
+    //! Receives the events of a query
+    class Visitor {
+      public:
+        virtual ~Visitor() {}
+
+        //! Receive an event. Events arrive in archive order.
+        virtual void visitEvent(const EventArchiveFormat::Record& record  //!< The event, valid during the call
+                                ) = 0;
+    };
+
+    //! Constructor
+    EventArchiveReader();
+
+    //! Destructor
+    ~EventArchiveReader();
+
+    //! Configure the reader with the settings of the archive
+    void configure(const Fw::StringBase& filePrefix,  //!< The file name prefix
+                   U32 segmentSeconds                 //!< The number of seconds in a segment
+    );
+
+    //! Read the events with a time tag in [start, end], an id in [firstId, lastId] and one of the severities
+    //! \return The query status
+    Status query(const Fw::Time& start,   //!< The earliest time tag
+                 const Fw::Time& end,     //!< The latest time tag, in the time base of start
+                 FwEventIdType firstId,   //!< The first event id
+                 FwEventIdType lastId,    //!< The last event id
+                 U8 severities,           //!< The severities, see EventArchiveFormat::getSeverityBit
+                 Visitor& visitor         //!< The receiver of the events
+    );
+
+    //! Get the number of bytes read by queries
+    U64 getBytesRead() const { return this->m_bytesRead; }
+
+    //! Get the number of blocks read by queries
+    U32 getBlocksRead() const { return this->m_blocksRead; }
+
+  PRIVATE:
+    //! A query
+    struct Query {
+        I64 start;              //!< The earliest time tag, in microseconds
+        I64 end;                //!< The latest time tag, in microseconds
+        FwEventIdType firstId;  //!< The first event id
+        FwEventIdType lastId;   //!< The last event id
+        U8 severities;          //!< The severities
+    };
+
+    //! The number of index entries read at a time
+    static constexpr FwSizeType ENTRIES_PER_READ = 32;
+
+    //! Run a query over a file
+    Status queryFile(Os::File& file, const Query& query, Visitor& visitor);
+
+    //! Run a query over a file without an index
+    Status scanFile(Os::File& file, FwSignedSizeType fileSize, const Query& query, Visitor& visitor);
+
+    //! Read and decode a block
+    //! \return The status, FORMAT_ERROR if the block does not have the expected size
+    Status readBlock(Os::File& file, U32 offset, U32 size, const Query& query, Visitor& visitor);
+
+    //! Read data at an offset
+    Status readAt(Os::File& file, FwSignedSizeType offset, U8* data, FwSizeType size);
+
+    //! The file name prefix
+    Fw::FileNameString m_filePrefix;
+
+    //! The number of seconds in a segment
+    U32 m_segmentSeconds;
+
+    //! The summary of the file being read
+    EventArchiveFormat::Summary m_summary;
+
+    //! The block being read, also scratch space for the header, the summary and the trailer
+    U8 m_block[EventArchiveFormat::BlockHeader::SIZE + EVENT_ARCHIVE_BLOCK_SIZE];
+
+    //! The index entries being read
+    U8 m_entries[ENTRIES_PER_READ * EventArchiveFormat::IndexEntry::SIZE];
+
+    //! The number of bytes read
+    U64 m_bytesRead;
+
+    //! The number of blocks read
+    U32 m_blocksRead;
+
+    static_assert(EventArchiveFormat::Summary::SIZE <= EVENT_ARCHIVE_BLOCK_SIZE, "the summary is read in the block");
+};
+
+}  // namespace Svc
+
+#endif
@@ -0,0 +1,45 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "EventArchiveTester.hpp"
+
+TEST(Nominal, Archive) {
+    Svc::EventArchiveTester tester;
+    tester.testArchive();
+}
+
+TEST(Nominal, Queries) {
+    Svc::EventArchiveTester tester;
+    tester.testQueries();
+}
+
+TEST(Nominal, Replay) {
+    Svc::EventArchiveTester tester;
+    tester.testReplay();
+}
+
+TEST(Nominal, FileRoll) {
+    Svc::EventArchiveTester tester;
+    tester.testFileRoll();
+}
+
+TEST(Nominal, LateEvents) {
+    Svc::EventArchiveTester tester;
+    tester.testLateEvents();
+}
+
+TEST(Nominal, UnclosedFile) {
+    Svc::EventArchiveTester tester;
+    tester.testUnclosedFile();
+}
+
+TEST(Benchmark, DISABLED_Queries) {
+    Svc::EventArchiveTester tester;
+    tester.benchmarkQueries();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
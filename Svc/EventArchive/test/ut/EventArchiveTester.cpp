@@ -0,0 +1,521 @@
+// ======================================================================
+// \title  EventArchiveTester.cpp
+// \brief  cpp file for EventArchive test harness implementation class
+// ======================================================================
+
+#include "EventArchiveTester.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Log/LogPacket.hpp>
+#include <Os/FileSystem.hpp>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+#define QUEUE_DEPTH 10
+
+namespace {
+
+const char* const FILE_PREFIX = "EventArchiveTest";
+const U32 SEGMENT_SECONDS = 100;
+
+//! The size of the record of an event with one U32 argument
+const FwSizeType RECORD_SIZE = Svc::EventArchiveFormat::RECORD_HEADER_SIZE + sizeof(FwPacketDescriptorType) +
+                               sizeof(FwEventIdType) + Fw::Time::SERIALIZED_SIZE + sizeof(U32);
+const U32 EVENTS_PER_BLOCK = Svc::EVENT_ARCHIVE_BLOCK_SIZE / RECORD_SIZE;
+
+//! The severity of an event in testArchive
+Fw::LogSeverity getSeverity(U32 second) {
+    return static_cast<Fw::LogSeverity::T>(Fw::LogSeverity::FATAL + (second % 7));
+}
+
+U8 getBit(Fw::LogSeverity::T severity) {
+    return Svc::EventArchiveFormat::getSeverityBit(Fw::LogSeverity(severity));
+}
+
+}  // namespace
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+EventArchiveTester::EventArchiveTester()
+    : EventArchiveGTestBase("Tester", MAX_HISTORY_SIZE), component("EventArchive") {
+    this->initComponents();
+    this->connectPorts();
+    this->removeFiles();
+    this->component.configure(Fw::String(FILE_PREFIX), SEGMENT_SECONDS);
+}
+
+EventArchiveTester::~EventArchiveTester() {
+    this->removeFiles();
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void EventArchiveTester::testArchive() {
+    // 240 seconds over three segments
+    for (U32 second = 10; second < 250; second++) {
+        this->sendEvent(0x100 + (second % 16), getSeverity(second), second, 500, second * 2);
+    }
+    // leaving a segment closes its file
+    ASSERT_EVENTS_SegmentFileClosed_SIZE(2);
+    this->closeSegment();
+    ASSERT_EVENTS_SegmentFileClosed_SIZE(3);
+    ASSERT_TLM_EventsArchived(this->tlmHistory_EventsArchived->size() - 1, 240);
+    ASSERT_TLM_EventsDropped_SIZE(1);
+    ASSERT_TLM_EventsDropped(0, 0);
+    ASSERT_TLM_FilesClosed(this->tlmHistory_FilesClosed->size() - 1, 3);
+
+    EventArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), SEGMENT_SECONDS);
+    Collector all;
+    this->query(reader, 0, 1000, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, all);
+    ASSERT_EQ(all.events.size(), 240u);
+    for (U32 event = 0; event < 240; event++) {
+        const U32 second = 10 + event;
+        ASSERT_EQ(all.events[event].id, 0x100 + (second % 16));
+        ASSERT_EQ(all.events[event].severity, getSeverity(second));
+        ASSERT_EQ(all.events[event].timeTag, Fw::Time(TB_NONE, second, 500));
+        ASSERT_EQ(all.events[event].argument, second * 2);
+    }
+
+    // an id, a severity and a time range
+    Collector some;
+    this->query(reader, 50, 200, 0x105, 0x105, getBit(Fw::LogSeverity::WARNING_HI), some);
+    U32 expected = 0;
+    for (U32 second = 50; second <= 200; second++) {
+        if (((second % 16) == 5) and (getSeverity(second) == Fw::LogSeverity::WARNING_HI)) {
+            ASSERT_LT(expected, some.events.size());
+            ASSERT_EQ(some.events[expected].timeTag, Fw::Time(TB_NONE, second, 500));
+            expected++;
+        }
+    }
+    ASSERT_GT(expected, 0u);
+    ASSERT_EQ(some.events.size(), expected);
+
+    // another time base has no files
+    Collector none;
+    ASSERT_EQ(reader.query(Fw::Time(TB_PROC_TIME, 0, 0), Fw::Time(TB_PROC_TIME, 1000, 0), 0, 0xFFFFFFFF,
+                           EventArchiveFormat::ALL_SEVERITIES, none),
+              EventArchiveReader::QUERY_OK);
+    ASSERT_EQ(none.events.size(), 0u);
+}
+
+void EventArchiveTester::testQueries() {
+    this->component.configure(Fw::String(FILE_PREFIX), 10000);
+    const U32 EVENTS = 20 * EVENTS_PER_BLOCK;
+    for (U32 second = 0; second < EVENTS; second++) {
+        if (second == EVENTS / 2) {
+            this->sendEvent(0x205, Fw::LogSeverity::WARNING_HI, second, 0, second);
+        } else {
+            this->sendEvent(0x100 + (second % 16), Fw::LogSeverity::ACTIVITY_LO, second, 0, second);
+        }
+    }
+    this->closeSegment();
+
+    EventArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), 10000);
+    Collector all;
+    this->query(reader, 0, EVENTS, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, all);
+    ASSERT_EQ(all.events.size(), EVENTS);
+    ASSERT_EQ(reader.getBlocksRead(), 20u);
+
+    // the severities of the blocks
+    U32 blocksRead = reader.getBlocksRead();
+    Collector warnings;
+    this->query(reader, 0, EVENTS, 0x200, 0x2FF, getBit(Fw::LogSeverity::WARNING_HI), warnings);
+    ASSERT_EQ(warnings.events.size(), 1u);
+    ASSERT_EQ(warnings.events[0].id, 0x205u);
+    ASSERT_EQ(warnings.events[0].argument, EVENTS / 2);
+    ASSERT_EQ(reader.getBlocksRead() - blocksRead, 1u);
+
+    // the id filters of the blocks
+    blocksRead = reader.getBlocksRead();
+    Collector component;
+    this->query(reader, 0, EVENTS, 0x200, 0x20F, EventArchiveFormat::ALL_SEVERITIES, component);
+    ASSERT_EQ(component.events.size(), 1u);
+    ASSERT_LT(reader.getBlocksRead() - blocksRead, 5u);
+
+    // the id filter of the file
+    blocksRead = reader.getBlocksRead();
+    const U64 bytesRead = reader.getBytesRead();
+    Collector missing;
+    this->query(reader, 0, EVENTS, 0x300, 0x300, EventArchiveFormat::ALL_SEVERITIES, missing);
+    ASSERT_EQ(missing.events.size(), 0u);
+    ASSERT_EQ(reader.getBlocksRead(), blocksRead);
+    ASSERT_LT(reader.getBytesRead() - bytesRead, 2 * EventArchiveFormat::Summary::SIZE);
+
+    // the time ranges of the blocks
+    blocksRead = reader.getBlocksRead();
+    Collector window;
+    this->query(reader, EVENTS / 4, EVENTS / 4 + 10, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, window);
+    ASSERT_EQ(window.events.size(), 11u);
+    ASSERT_LE(reader.getBlocksRead() - blocksRead, 2u);
+}
+
+void EventArchiveTester::testReplay() {
+    this->setTestTime(Fw::Time(TB_NONE, 0, 0));
+    for (U32 second = 1; second <= 20; second++) {
+        this->sendEvent(0x100 + (second % 2), (second % 2 == 0) ? Fw::LogSeverity::WARNING_HI : Fw::LogSeverity::ACTIVITY_LO,
+                        second, 0, second);
+    }
+    // the buffered block is replayed
+    this->sendCmd_REPLAY(INSTANCE, 0, 5, 9, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(0, EventArchiveComponentBase::OPCODE_REPLAY, 0, Fw::CmdResponse::OK);
+    ASSERT_EVENTS_ReplayDone_SIZE(1);
+    ASSERT_EVENTS_ReplayDone(0, 5);
+    ASSERT_from_replayOut_SIZE(5);
+    for (U32 event = 0; event < 5; event++) {
+        Fw::ComBuffer& data = this->fromPortHistory_replayOut->at(event).data;
+        Fw::LogPacket packet;
+        ASSERT_EQ(packet.deserialize(data), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packet.getId(), 0x100 + ((5 + event) % 2));
+        ASSERT_EQ(packet.getTimeTag(), Fw::Time(TB_NONE, 5 + event, 0));
+        U32 argument = 0;
+        ASSERT_EQ(packet.getLogBuffer().deserialize(argument), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(argument, 5 + event);
+    }
+
+    // events after the replay continue the file, and closed files are replayed
+    for (U32 second = 21; second <= 40; second++) {
+        this->sendEvent(0x100 + (second % 2), (second % 2 == 0) ? Fw::LogSeverity::WARNING_HI : Fw::LogSeverity::ACTIVITY_LO,
+                        second, 0, second);
+    }
+    this->closeSegment();
+    this->clearHistory();
+    this->sendCmd_REPLAY(INSTANCE, 0, 0, 99, 0x100, 0x100, getBit(Fw::LogSeverity::WARNING_HI));
+    this->component.doDispatch();
+    ASSERT_EVENTS_ReplayDone(0, 20);
+    ASSERT_from_replayOut_SIZE(20);
+
+    this->clearHistory();
+    this->sendCmd_REPLAY(INSTANCE, 0, 0, 99, 0x100, 0x100, getBit(Fw::LogSeverity::ACTIVITY_LO));
+    this->component.doDispatch();
+    ASSERT_EVENTS_ReplayDone(0, 0);
+    ASSERT_from_replayOut_SIZE(0);
+}
+
+void EventArchiveTester::testFileRoll() {
+    this->component.configure(Fw::String(FILE_PREFIX), 1000000);
+    // more blocks than a file indexes, all in one segment
+    const U32 EVENTS = EVENTS_PER_BLOCK * (EVENT_ARCHIVE_MAX_BLOCKS + 10);
+    for (U32 event = 0; event < EVENTS; event++) {
+        this->sendEvent(0x100, Fw::LogSeverity::ACTIVITY_LO, event / 10, (event % 10) * 100000, event);
+    }
+    ASSERT_EVENTS_SegmentFileClosed_SIZE(1);
+    this->closeSegment();
+    ASSERT_EVENTS_SegmentFileClosed_SIZE(2);
+    Fw::FileNameString second;
+    EventArchiveFormat::formatFileName(second, Fw::String(FILE_PREFIX), TB_NONE, 0, 1);
+    ASSERT_EQ(Os::FileSystem::getPathType(second.toChar()), Os::FileSystem::FILE);
+
+    EventArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), 1000000);
+    Collector all;
+    this->query(reader, 0, EVENTS, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, all);
+    ASSERT_EQ(all.events.size(), EVENTS);
+    for (U32 event = 0; event < EVENTS; event++) {
+        ASSERT_EQ(all.events[event].argument, event);
+    }
+}
+
+void EventArchiveTester::testLateEvents() {
+    this->sendEvent(0x100, Fw::LogSeverity::ACTIVITY_LO, 50, 0, 1);
+    this->sendEvent(0x100, Fw::LogSeverity::ACTIVITY_LO, 150, 0, 2);
+    // late for the segment starting at 0, so in the file of the segment starting at 100
+    this->sendEvent(0x100, Fw::LogSeverity::ACTIVITY_LO, 90, 0, 3);
+    this->sendEvent(0x100, Fw::LogSeverity::ACTIVITY_LO, 160, 0, 4);
+    this->closeSegment();
+    ASSERT_EVENTS_SegmentFileClosed_SIZE(2);
+
+    EventArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), SEGMENT_SECONDS);
+    Collector late;
+    this->query(reader, 80, 95, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, late);
+    ASSERT_EQ(late.events.size(), 1u);
+    ASSERT_EQ(late.events[0].argument, 3u);
+}
+
+void EventArchiveTester::testUnclosedFile() {
+    const U32 EVENTS = 2 * EVENTS_PER_BLOCK + 10;
+    for (U32 event = 0; event < EVENTS; event++) {
+        this->sendEvent(0x100, Fw::LogSeverity::ACTIVITY_LO, event / 100, (event % 100) * 10000, event);
+    }
+    // only full blocks are in the file so far, and it has no index
+    EventArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), SEGMENT_SECONDS);
+    Collector partial;
+    this->query(reader, 0, SEGMENT_SECONDS, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, partial);
+    ASSERT_EQ(partial.events.size(), 2 * EVENTS_PER_BLOCK);
+
+    this->closeSegment();
+    Collector all;
+    this->query(reader, 0, SEGMENT_SECONDS, 0, 0xFFFFFFFF, EventArchiveFormat::ALL_SEVERITIES, all);
+    ASSERT_EQ(all.events.size(), EVENTS);
+}
+
+void EventArchiveTester::benchmarkQueries() {
+    // 100 million events at 1000 events a second, about 28 hours, in one hour segments
+    const U32 EVENTS = 100000000;
+    const U32 RATE = 1000;
+    const U32 HOUR = 3600;
+    const U32 COMPONENTS = 200;
+    const U32 LAST_SECOND = (EVENTS - 1) / RATE;
+    this->component.configure(Fw::String(FILE_PREFIX), HOUR);
+
+    // each component has 16 events, of a severity fixed by the event, mostly activity and diagnostics
+    const Fw::LogSeverity::T SEVERITIES[16] = {
+        Fw::LogSeverity::WARNING_HI,  Fw::LogSeverity::WARNING_LO,  Fw::LogSeverity::COMMAND,
+        Fw::LogSeverity::ACTIVITY_HI, Fw::LogSeverity::ACTIVITY_HI, Fw::LogSeverity::ACTIVITY_HI,
+        Fw::LogSeverity::ACTIVITY_LO, Fw::LogSeverity::ACTIVITY_LO, Fw::LogSeverity::ACTIVITY_LO,
+        Fw::LogSeverity::ACTIVITY_LO, Fw::LogSeverity::ACTIVITY_LO, Fw::LogSeverity::ACTIVITY_LO,
+        Fw::LogSeverity::DIAGNOSTIC,  Fw::LogSeverity::DIAGNOSTIC,  Fw::LogSeverity::DIAGNOSTIC,
+        Fw::LogSeverity::FATAL};
+    const FwEventIdType RARE_ID = 0x100 * 7 + 15;
+
+    // the same packets in a ComLogger file: a U16 length, then the packet
+    const char* const comLoggerFile = "EventArchiveTest.com";
+    Os::File comLogger;
+    ASSERT_EQ(comLogger.open(comLoggerFile, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    std::vector<U8> chunk;
+    chunk.reserve(1 << 20);
+    U32 random = 1;
+    double ingestSeconds = 0.0;
+    for (U32 event = 0; event < EVENTS; event++) {
+        random = random * 1103515245 + 12345;
+        const U32 component = (random >> 8) % COMPONENTS;
+        const U32 draw = (random >> 16) % 1000;
+        U32 number = 0;
+        if (draw < 1) {
+            number = 0;
+        } else if (draw < 5) {
+            number = 1;
+        } else if (draw < 15) {
+            number = 2;
+        } else if (draw < 100) {
+            number = 3 + draw % 3;
+        } else if (draw < 600) {
+            number = 6 + draw % 6;
+        } else {
+            number = 12 + draw % 3;
+        }
+        // a FATAL once in about a million events, all from one component
+        if ((event % 1000003) == 999) {
+            number = 15;
+        }
+        const FwEventIdType id = (number == 15) ? RARE_ID : 0x100 * (component + 1) + number;
+        Fw::Time timeTag(TB_NONE, event / RATE, (event % RATE) * (1000000 / RATE));
+        Fw::LogBuffer args;
+        ASSERT_EQ(args.serialize(event), Fw::FW_SERIALIZE_OK);
+        const auto start = std::chrono::steady_clock::now();
+        this->invoke_to_logIn(0, id, timeTag, SEVERITIES[number], args);
+        this->component.doDispatch();
+        ingestSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        Fw::LogPacket packet;
+        packet.setId(id);
+        packet.setTimeTag(timeTag);
+        packet.setLogBuffer(args);
+        Fw::ComBuffer buffer;
+        ASSERT_EQ(packet.serialize(buffer), Fw::FW_SERIALIZE_OK);
+        chunk.push_back(static_cast<U8>(buffer.getBuffLength() >> 8));
+        chunk.push_back(static_cast<U8>(buffer.getBuffLength()));
+        chunk.insert(chunk.end(), buffer.getBuffAddr(), buffer.getBuffAddr() + buffer.getBuffLength());
+        if ((chunk.size() > (1 << 20) - FW_COM_BUFFER_MAX_SIZE) or (event == EVENTS - 1)) {
+            FwSignedSizeType size = static_cast<FwSignedSizeType>(chunk.size());
+            ASSERT_EQ(comLogger.write(chunk.data(), size), Os::File::OP_OK);
+            chunk.clear();
+        }
+    }
+    comLogger.close();
+    this->closeSegment();
+    printf("ingest: %" PRIu32 " events in %.1f s, %.0f events/s\n", EVENTS, ingestSeconds, EVENTS / ingestSeconds);
+
+    struct Query {
+        const char* name;
+        U32 start;
+        U32 end;
+        FwEventIdType firstId;
+        FwEventIdType lastId;
+        U8 severities;
+    } queries[] = {
+        {"WARNING_HI of a component, last hour", LAST_SECOND - HOUR, LAST_SECOND, 0x100 * 43, 0x100 * 43 + 0xFF,
+         getBit(Fw::LogSeverity::WARNING_HI)},
+        {"all events of a component, last hour", LAST_SECOND - HOUR, LAST_SECOND, 0x100 * 43, 0x100 * 43 + 0xFF,
+         EventArchiveFormat::ALL_SEVERITIES},
+        {"WARNING_HI of all components, all time", 0, LAST_SECOND, 0, 0xFFFFFFFF,
+         getBit(Fw::LogSeverity::WARNING_HI)},
+        {"a rare event, all time", 0, LAST_SECOND, RARE_ID, RARE_ID, EventArchiveFormat::ALL_SEVERITIES},
+    };
+
+    for (const Query& query : queries) {
+        // scan the ComLogger file, with the severities of the dictionary
+        auto start = std::chrono::steady_clock::now();
+        U64 scanBytes = 0;
+        U32 scanEvents = 0;
+        ASSERT_EQ(comLogger.open(comLoggerFile, Os::File::OPEN_READ), Os::File::OP_OK);
+        std::vector<U8> data(1 << 20);
+        FwSizeType used = 0;
+        while (true) {
+            FwSignedSizeType size = static_cast<FwSignedSizeType>(data.size() - used);
+            ASSERT_EQ(comLogger.read(&data[used], size), Os::File::OP_OK);
+            if (size == 0) {
+                break;
+            }
+            scanBytes += static_cast<U64>(size);
+            used += static_cast<FwSizeType>(size);
+            FwSizeType offset = 0;
+            while (offset + sizeof(U16) <= used) {
+                const FwSizeType packetSize = (static_cast<FwSizeType>(data[offset]) << 8) | data[offset + 1];
+                if (offset + sizeof(U16) + packetSize > used) {
+                    break;
+                }
+                Fw::ExternalSerializeBuffer packet(&data[offset + sizeof(U16)],
+                                                   static_cast<Fw::Serializable::SizeType>(packetSize));
+                (void)packet.setBuffLen(static_cast<Fw::Serializable::SizeType>(packetSize));
+                FwPacketDescriptorType descriptor = 0;
+                FwEventIdType id = 0;
+                Fw::Time timeTag;
+                ASSERT_EQ(packet.deserialize(descriptor), Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(packet.deserialize(id), Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(packet.deserialize(timeTag), Fw::FW_SERIALIZE_OK);
+                const Fw::LogSeverity severity = SEVERITIES[(id == RARE_ID) ? 15 : (id & 0xFF)];
+                if ((timeTag.getSeconds() >= query.start) and (timeTag.getSeconds() <= query.end) and
+                    (id >= query.firstId) and (id <= query.lastId) and
+                    ((EventArchiveFormat::getSeverityBit(severity) & query.severities) != 0)) {
+                    scanEvents++;
+                }
+                offset += sizeof(U16) + packetSize;
+            }
+            (void)memmove(&data[0], &data[offset], used - offset);
+            used -= offset;
+        }
+        comLogger.close();
+        const double scanSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // query the archive
+        start = std::chrono::steady_clock::now();
+        EventArchiveReader reader;
+        reader.configure(Fw::String(FILE_PREFIX), HOUR);
+        Collector collector;
+        this->query(reader, query.start, query.end, query.firstId, query.lastId, query.severities, collector);
+        const double archiveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(collector.events.size(), scanEvents);
+
+        printf("%s: %" PRIu32 " events, ComLogger scan %.1f ms reading %" PRIu64 " bytes, archive %.1f ms reading %" PRIu64
+               " bytes in %" PRIu32 " blocks\n",
+               query.name, scanEvents, scanSeconds * 1000.0, scanBytes, archiveSeconds * 1000.0, reader.getBytesRead(),
+               reader.getBlocksRead());
+    }
+    (void)Os::FileSystem::removeFile(comLoggerFile);
+    for (U32 segment = 0; segment <= LAST_SECOND; segment += HOUR) {
+        for (U32 fileNumber = 0; fileNumber < EVENT_ARCHIVE_MAX_FILES_PER_SEGMENT; fileNumber++) {
+            Fw::FileNameString fileName;
+            EventArchiveFormat::formatFileName(fileName, Fw::String(FILE_PREFIX), TB_NONE, segment, fileNumber);
+            if (Os::FileSystem::removeFile(fileName.toChar()) != Os::FileSystem::OP_OK) {
+                break;
+            }
+        }
+    }
+}
+
+// ----------------------------------------------------------------------
+// Types
+// ----------------------------------------------------------------------
+
+void EventArchiveTester::Collector::visitEvent(const EventArchiveFormat::Record& record) {
+    Fw::ExternalSerializeBuffer buffer(const_cast<U8*>(record.packet),
+                                       static_cast<Fw::Serializable::SizeType>(record.packetSize));
+    ASSERT_EQ(buffer.setBuffLen(static_cast<Fw::Serializable::SizeType>(record.packetSize)), Fw::FW_SERIALIZE_OK);
+    Fw::LogPacket packet;
+    ASSERT_EQ(packet.deserialize(buffer), Fw::FW_SERIALIZE_OK);
+    Event event;
+    event.severity = record.severity;
+    event.id = packet.getId();
+    event.timeTag = packet.getTimeTag();
+    ASSERT_EQ(event.id, record.id);
+    ASSERT_EQ(event.timeTag, record.timeTag);
+    event.argument = 0;
+    ASSERT_EQ(packet.getLogBuffer().deserialize(event.argument), Fw::FW_SERIALIZE_OK);
+    this->events.push_back(event);
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void EventArchiveTester::sendEvent(FwEventIdType id,
+                                   Fw::LogSeverity severity,
+                                   U32 seconds,
+                                   U32 useconds,
+                                   U32 argument) {
+    Fw::Time timeTag(TB_NONE, seconds, useconds);
+    Fw::LogBuffer args;
+    ASSERT_EQ(args.serialize(argument), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_logIn(0, id, timeTag, severity, args);
+    this->component.doDispatch();
+}
+
+void EventArchiveTester::closeSegment() {
+    this->sendCmd_CLOSE_SEGMENT(INSTANCE, 0);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(this->cmdResponseHistory->size() - 1, EventArchiveComponentBase::OPCODE_CLOSE_SEGMENT, 0,
+                        Fw::CmdResponse::OK);
+}
+
+void EventArchiveTester::query(EventArchiveReader& reader,
+                               U32 startSeconds,
+                               U32 endSeconds,
+                               FwEventIdType firstId,
+                               FwEventIdType lastId,
+                               U8 severities,
+                               Collector& collector) {
+    // whole seconds, as in REPLAY
+    ASSERT_EQ(reader.query(Fw::Time(TB_NONE, startSeconds, 0), Fw::Time(TB_NONE, endSeconds, 999999), firstId, lastId,
+                           severities, collector),
+              EventArchiveReader::QUERY_OK);
+}
+
+void EventArchiveTester::removeFiles() {
+    const U32 segmentSizes[] = {SEGMENT_SECONDS, 10000, 1000000};
+    for (U32 segmentSeconds : segmentSizes) {
+        for (U32 segment = 0; segment < 4; segment++) {
+            for (U32 fileNumber = 0; fileNumber < 3; fileNumber++) {
+                Fw::FileNameString fileName;
+                EventArchiveFormat::formatFileName(fileName, Fw::String(FILE_PREFIX), TB_NONE,
+                                                   segment * segmentSeconds, fileNumber);
+                (void)Os::FileSystem::removeFile(fileName.toChar());
+            }
+        }
+    }
+}
+
+void EventArchiveTester::connectPorts() {
+    this->connect_to_logIn(0, this->component.get_logIn_InputPort(0));
+    this->connect_to_pingIn(0, this->component.get_pingIn_InputPort(0));
+    this->connect_to_cmdIn(0, this->component.get_cmdIn_InputPort(0));
+    this->component.set_replayOut_OutputPort(0, this->get_from_replayOut(0));
+    this->component.set_pingOut_OutputPort(0, this->get_from_pingOut(0));
+    this->component.set_cmdRegIn_OutputPort(0, this->get_from_cmdRegIn(0));
+    this->component.set_cmdResponseOut_OutputPort(0, this->get_from_cmdResponseOut(0));
+    this->component.set_timeGetOut_OutputPort(0, this->get_from_timeGetOut(0));
+    this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+    this->component.set_eventOut_OutputPort(0, this->get_from_eventOut(0));
+    this->component.set_textEventOut_OutputPort(0, this->get_from_textEventOut(0));
+}
+
+void EventArchiveTester::initComponents() {
+    this->init();
+    this->component.init(QUEUE_DEPTH, INSTANCE);
+}
+
+}  // end namespace Svc
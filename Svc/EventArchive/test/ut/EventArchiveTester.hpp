@@ -0,0 +1,127 @@
+// ======================================================================
+// \title  EventArchiveTester.hpp
+// \brief  hpp file for EventArchive test harness implementation class
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include <vector>
+
+#include "EventArchiveGTestBase.hpp"
+#include "Svc/EventArchive/EventArchive.hpp"
+#include "Svc/EventArchive/EventArchiveReader.hpp"
+
+namespace Svc {
+
+class EventArchiveTester : public EventArchiveGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object EventArchiveTester
+    //!
+    EventArchiveTester();
+
+    //! Destroy object EventArchiveTester
+    //!
+    ~EventArchiveTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Archive events over several segments and read them back
+    //!
+    void testArchive();
+
+    //! Check that queries by id, severity and time only read the blocks they need
+    //!
+    void testQueries();
+
+    //! Replay archived events, buffered or in closed files
+    //!
+    void testReplay();
+
+    //! Fill the index of a file so that the segment continues in a second file
+    //!
+    void testFileRoll();
+
+    //! Keep late events in the open segment, where queries of their time find them
+    //!
+    void testLateEvents();
+
+    //! Read a file whose writer stopped before writing the index
+    //!
+    void testUnclosedFile();
+
+    //! Measure ingest and queries against a scan of ComLogger files
+    //!
+    void benchmarkQueries();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Types
+    // ----------------------------------------------------------------------
+
+    //! An event read back from the archive
+    struct Event {
+        Fw::LogSeverity severity;
+        FwEventIdType id;
+        Fw::Time timeTag;
+        U32 argument;
+    };
+
+    //! Collects the events of a query
+    class Collector : public EventArchiveReader::Visitor {
+      public:
+        void visitEvent(const EventArchiveFormat::Record& record) override;
+        std::vector<Event> events;
+    };
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+    //! Send an event with one U32 argument
+    void sendEvent(FwEventIdType id, Fw::LogSeverity severity, U32 seconds, U32 useconds, U32 argument);
+
+    //! Send the CLOSE_SEGMENT command
+    void closeSegment();
+
+    //! Query the archive
+    void query(EventArchiveReader& reader,
+               U32 startSeconds,
+               U32 endSeconds,
+               FwEventIdType firstId,
+               FwEventIdType lastId,
+               U8 severities,
+               Collector& collector);
+
+    //! Remove the archive files of the test
+    void removeFiles();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    EventArchive component;
+};
+
+}  // end namespace Svc
+
+#endif
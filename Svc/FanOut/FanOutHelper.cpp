@@ -0,0 +1,124 @@
+// ======================================================================
+// \title  FanOutHelper.cpp
+// \brief  cpp file for FanOutHelper, queued delivery of output ports
+// ======================================================================
+
+#include <Svc/FanOut/FanOutHelper.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+FanOutHelper::FanOutHelper() {
+    for (FwIndexType port = 0; port < FAN_OUT_MAX_PORTS; port++) {
+        Lane& lane = this->m_lanes[port];
+        lane.helper = this;
+        lane.port = port;
+        lane.configured = false;
+        lane.policy = DROP;
+        lane.drops = 0;
+    }
+}
+
+FanOutHelper::~FanOutHelper() {}
+
+Os::Queue::Status FanOutHelper::configurePort(FwIndexType port,
+                                              const Fw::StringBase& name,
+                                              FwSizeType depth,
+                                              FwSizeType messageSize,
+                                              Policy policy) {
+    FW_ASSERT((port >= 0) && (port < FAN_OUT_MAX_PORTS), static_cast<FwAssertArgType>(port));
+    FW_ASSERT(messageSize <= FAN_OUT_MAX_MESSAGE_SIZE, static_cast<FwAssertArgType>(messageSize));
+    Lane& lane = this->m_lanes[port];
+    // It is a coding error to configure a port once its task has started
+    FW_ASSERT(lane.task.getState() == Os::Task::State::NOT_STARTED, static_cast<FwAssertArgType>(port));
+    const Os::Queue::Status status = lane.queue.create(name, depth, messageSize);
+    if (status == Os::Queue::Status::OP_OK) {
+        lane.configured = true;
+        lane.policy = policy;
+    }
+    return status;
+}
+
+void FanOutHelper::startPorts(const Os::Task::ParamType priority,
+                              const Os::Task::ParamType stack,
+                              const Os::Task::ParamType cpuAffinity) {
+    for (Lane& lane : this->m_lanes) {
+        if (lane.configured) {
+            Os::Task::Arguments arguments(lane.queue.getName(), FanOutHelper::drainTask, &lane, priority, stack,
+                                          cpuAffinity);
+            const Os::Task::Status status = lane.task.start(arguments);
+            FW_ASSERT(status == Os::Task::Status::OP_OK, static_cast<FwAssertArgType>(status));
+        }
+    }
+}
+
+void FanOutHelper::stopPorts() {
+    const U8 stop = 0;
+    for (Lane& lane : this->m_lanes) {
+        if (lane.configured) {
+            const Os::Queue::Status status =
+                lane.queue.send(&stop, sizeof(stop), STOP_PRIORITY, Os::Queue::BlockingType::BLOCKING);
+            FW_ASSERT(status == Os::Queue::Status::OP_OK, static_cast<FwAssertArgType>(status));
+        }
+    }
+}
+
+void FanOutHelper::joinPorts() {
+    for (Lane& lane : this->m_lanes) {
+        if (lane.configured) {
+            (void)lane.task.join();
+        }
+    }
+}
+
+bool FanOutHelper::isQueuedPort(FwIndexType port) const {
+    FW_ASSERT((port >= 0) && (port < FAN_OUT_MAX_PORTS), static_cast<FwAssertArgType>(port));
+    return this->m_lanes[port].configured;
+}
+
+FwSizeType FanOutHelper::getPortLag(FwIndexType port) const {
+    FW_ASSERT((port >= 0) && (port < FAN_OUT_MAX_PORTS), static_cast<FwAssertArgType>(port));
+    const Lane& lane = this->m_lanes[port];
+    return lane.configured ? lane.queue.getMessagesAvailable() : 0;
+}
+
+U32 FanOutHelper::getPortDrops(FwIndexType port) const {
+    FW_ASSERT((port >= 0) && (port < FAN_OUT_MAX_PORTS), static_cast<FwAssertArgType>(port));
+    return this->m_lanes[port].drops.load();
+}
+
+bool FanOutHelper::enqueue(FwIndexType port, const Fw::SerializeBufferBase& message) {
+    FW_ASSERT(this->isQueuedPort(port), static_cast<FwAssertArgType>(port));
+    Lane& lane = this->m_lanes[port];
+    const Os::Queue::BlockingType blockType =
+        (lane.policy == BLOCK) ? Os::Queue::BlockingType::BLOCKING : Os::Queue::BlockingType::NONBLOCKING;
+    const Os::Queue::Status status = lane.queue.send(message, MESSAGE_PRIORITY, blockType);
+    if (status == Os::Queue::Status::FULL) {
+        ++lane.drops;
+        return false;
+    }
+    FW_ASSERT(status == Os::Queue::Status::OP_OK, static_cast<FwAssertArgType>(status));
+    return true;
+}
+
+void FanOutHelper::drainLane(Lane& lane) {
+    U8 data[FAN_OUT_MAX_MESSAGE_SIZE];
+    Fw::ExternalSerializeBuffer message(data, sizeof(data));
+    while (true) {
+        FwQueuePriorityType priority = 0;
+        const Os::Queue::Status status = lane.queue.receive(message, Os::Queue::BlockingType::BLOCKING, priority);
+        FW_ASSERT(status == Os::Queue::Status::OP_OK, static_cast<FwAssertArgType>(status));
+        if (priority == STOP_PRIORITY) {
+            break;
+        }
+        this->drainPort(lane.port, message);
+    }
+}
+
+void FanOutHelper::drainTask(void* pointer) {
+    FW_ASSERT(pointer != nullptr);
+    Lane* const lane = static_cast<Lane*>(pointer);
+    lane->helper->drainLane(*lane);
+}
+
+}  // namespace Svc
@@ -0,0 +1,122 @@
+// ======================================================================
+// \title  FanOutHelper.hpp
+// \brief  hpp file for FanOutHelper, queued delivery of output ports
+// ======================================================================
+
+#ifndef Svc_FanOutHelper_HPP
+#define Svc_FanOutHelper_HPP
+
+#include <atomic>
+
+#include <FpConfig.hpp>
+#include <Fw/Types/Serializable.hpp>
+#include <Os/Queue.hpp>
+#include <Os/Task.hpp>
+#include <config/FanOutCfg.hpp>
+
+namespace Svc {
+
+//! Delivers the output ports of a fan-out component from a queue and a task per port
+//!
+//! By default a fan-out component calls each output port in turn on the caller's thread, so the slowest consumer sets
+//! the latency of every call. A port configured here is instead handed a copy of the message through its own bounded
+//! queue, and a task per port drains the queue into the port. When the queue is full the message is either dropped,
+//! counting the drop, or the caller blocks until the port catches up, as chosen per port.
+//!
+//! The inheriting component serializes its message for a queued port, passes it to `enqueue`, and delivers it from
+//! `drainPort`, which runs on the task of the port. Ports that are not configured stay the component's to call.
+class FanOutHelper {
+  public:
+    //! Response to a full queue
+    enum Policy {
+        DROP,   //!< Drop the message and count the drop
+        BLOCK,  //!< Block the caller until the queue has room
+    };
+
+    //! Constructor
+    FanOutHelper();
+
+    //! Destructor
+    virtual ~FanOutHelper();
+
+    //! Start the drain task of every configured port
+    void startPorts(const Os::Task::ParamType priority = Os::Task::TASK_DEFAULT,    //!< Priority of the tasks
+                    const Os::Task::ParamType stack = Os::Task::TASK_DEFAULT,       //!< Stack size of the tasks
+                    const Os::Task::ParamType cpuAffinity = Os::Task::TASK_DEFAULT  //!< CPU affinity of the tasks
+    );
+
+    //! Stop the drain tasks once the messages already queued have been delivered
+    void stopPorts();
+
+    //! Join the stopped drain tasks
+    void joinPorts();
+
+    //! Check whether a port is delivered from a queue
+    //! \return True if the port is configured
+    bool isQueuedPort(FwIndexType port  //!< The port
+    ) const;
+
+    //! Get the number of messages waiting in the queue of a port
+    //! \return The number of messages, zero for a port that is not configured
+    FwSizeType getPortLag(FwIndexType port  //!< The port
+    ) const;
+
+    //! Get the number of messages dropped for a port
+    //! \return The number of drops
+    U32 getPortDrops(FwIndexType port  //!< The port
+    ) const;
+
+  PROTECTED:
+    //! Give a port its own queue. Call before startPorts.
+    //! \return The status of the queue creation
+    Os::Queue::Status configurePort(FwIndexType port,            //!< The port
+                                    const Fw::StringBase& name,  //!< The name of the queue and of the task
+                                    FwSizeType depth,            //!< The depth of the queue
+                                    FwSizeType messageSize,      //!< The largest message, at most FAN_OUT_MAX_MESSAGE_SIZE
+                                    Policy policy                //!< The response to a full queue
+    );
+
+    //! Queue a message for a configured port
+    //! \return True if the message was queued, false if it was dropped
+    bool enqueue(FwIndexType port,                       //!< The port
+                 const Fw::SerializeBufferBase& message  //!< The message
+    );
+
+    //! Deliver a message on a port. Runs on the task of the port.
+    //!
+    //! Note: this must be implemented by the inheritor
+    virtual void drainPort(FwIndexType port,                 //!< The port
+                           Fw::SerializeBufferBase& message  //!< The message, ready for deserializing
+                           ) = 0;
+
+  PRIVATE:
+    //! The queue priority of messages
+    static constexpr FwQueuePriorityType MESSAGE_PRIORITY = 1;
+    //! The queue priority of the stop request, below messages so that the queue is drained first
+    static constexpr FwQueuePriorityType STOP_PRIORITY = 0;
+
+    //! The queue and task of a port
+    struct Lane {
+        FanOutHelper* helper;      //!< The helper owning the lane
+        FwIndexType port;          //!< The port
+        bool configured;           //!< True if the port is delivered from the queue
+        Policy policy;             //!< The response to a full queue
+        Os::Queue queue;           //!< The queue
+        Os::Task task;             //!< The drain task
+        std::atomic<U32> drops;    //!< The number of dropped messages
+    };
+
+    //! Drain a lane until stopped
+    void drainLane(Lane& lane);
+
+    //! The drain task
+    static void drainTask(void* pointer  //!< The lane
+    );
+
+    //! The lanes, one per port
+    Lane m_lanes[FAN_OUT_MAX_PORTS];
+};
+
+}  // namespace Svc
+
+#endif
@@ -0,0 +1,142 @@
+// ======================================================================
+// \title  FanOutHelperTest.cpp
+// \brief  tests of FanOutHelper queued port delivery
+// ======================================================================
+#include <gtest/gtest.h>
+#include <Fw/Types/String.hpp>
+#include <Svc/FanOut/FanOutHelper.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const U32 NUM_MESSAGES = 100;
+
+//! Helper recording the messages delivered on each port, optionally holding delivery until released
+class RecordingHelper : public Svc::FanOutHelper {
+  public:
+    RecordingHelper() : m_hold(false), m_entered(0) {}
+
+    void configure(FwIndexType port, FwSizeType depth, Policy policy) {
+        Fw::String name;
+        name.format("FanOut%d", static_cast<int>(port));
+        ASSERT_EQ(this->configurePort(port, name, depth, sizeof(U32), policy), Os::Queue::Status::OP_OK);
+    }
+
+    bool send(FwIndexType port, U32 value) {
+        U8 data[sizeof(U32)];
+        Fw::ExternalSerializeBuffer message(data, sizeof(data));
+        EXPECT_EQ(message.serialize(value), Fw::FW_SERIALIZE_OK);
+        return this->enqueue(port, message);
+    }
+
+    void drainPort(FwIndexType port, Fw::SerializeBufferBase& message) override {
+        U32 value = 0;
+        EXPECT_EQ(message.deserialize(value), Fw::FW_SERIALIZE_OK);
+        m_entered++;
+        while (m_hold.load()) {
+            (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+        }
+        m_delivered[port].push_back(value);
+    }
+
+    //! Wait until the drain tasks have taken count messages off their queues
+    void waitEntered(U32 count) {
+        while (m_entered.load() < count) {
+            (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+        }
+    }
+
+    void finish() {
+        m_hold = false;
+        this->stopPorts();
+        this->joinPorts();
+    }
+
+    std::atomic<bool> m_hold;
+    std::atomic<U32> m_entered;
+    std::vector<U32> m_delivered[Svc::FAN_OUT_MAX_PORTS];
+};
+
+}  // namespace
+
+TEST(FanOutHelper, Delivery) {
+    RecordingHelper helper;
+    helper.configure(0, 8, Svc::FanOutHelper::BLOCK);
+    helper.configure(2, 8, Svc::FanOutHelper::BLOCK);
+    ASSERT_TRUE(helper.isQueuedPort(0));
+    ASSERT_FALSE(helper.isQueuedPort(1));
+    ASSERT_TRUE(helper.isQueuedPort(2));
+    helper.startPorts();
+    for (U32 i = 0; i < NUM_MESSAGES; i++) {
+        ASSERT_TRUE(helper.send(0, i));
+        ASSERT_TRUE(helper.send(2, NUM_MESSAGES + i));
+    }
+    // Stopping delivers the messages already queued
+    helper.finish();
+    ASSERT_EQ(helper.m_delivered[0].size(), NUM_MESSAGES);
+    ASSERT_EQ(helper.m_delivered[2].size(), NUM_MESSAGES);
+    for (U32 i = 0; i < NUM_MESSAGES; i++) {
+        ASSERT_EQ(helper.m_delivered[0][i], i);
+        ASSERT_EQ(helper.m_delivered[2][i], NUM_MESSAGES + i);
+    }
+    ASSERT_EQ(helper.getPortLag(0), 0u);
+    ASSERT_EQ(helper.getPortDrops(0), 0u);
+    ASSERT_EQ(helper.getPortDrops(2), 0u);
+}
+
+TEST(FanOutHelper, DropWhenFull) {
+    const FwSizeType depth = 4;
+    RecordingHelper helper;
+    helper.configure(0, depth, Svc::FanOutHelper::DROP);
+    helper.configure(1, depth, Svc::FanOutHelper::DROP);
+    helper.startPorts();
+    // Hold the consumer of port 0 on its first message
+    helper.m_hold = true;
+    ASSERT_TRUE(helper.send(0, 0));
+    helper.waitEntered(1);
+    // The queue takes depth messages, the rest are dropped
+    for (U32 i = 1; i < NUM_MESSAGES; i++) {
+        ASSERT_EQ(helper.send(0, i), i <= depth);
+    }
+    ASSERT_EQ(helper.getPortLag(0), depth);
+    ASSERT_EQ(helper.getPortDrops(0), NUM_MESSAGES - 1 - depth);
+    helper.finish();
+    ASSERT_EQ(helper.m_delivered[0].size(), depth + 1);
+    ASSERT_EQ(helper.getPortLag(0), 0u);
+    // The other port is not affected
+    ASSERT_EQ(helper.getPortDrops(1), 0u);
+}
+
+TEST(FanOutHelper, BlockWhenFull) {
+    const FwSizeType depth = 2;
+    RecordingHelper helper;
+    helper.configure(0, depth, Svc::FanOutHelper::BLOCK);
+    helper.startPorts();
+    helper.m_hold = true;
+    std::atomic<U32> sent(0);
+    std::thread producer([&helper, &sent]() {
+        for (U32 i = 0; i < NUM_MESSAGES; i++) {
+            EXPECT_TRUE(helper.send(0, i));
+            sent++;
+        }
+    });
+    // The producer fills the queue behind the held message and then blocks
+    helper.waitEntered(1);
+    while (helper.getPortLag(0) < depth) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    (void)Os::Task::delay(Fw::TimeInterval(0, 10000));
+    ASSERT_EQ(sent.load(), 1 + depth);
+    helper.m_hold = false;
+    producer.join();
+    helper.finish();
+    ASSERT_EQ(helper.m_delivered[0].size(), NUM_MESSAGES);
+    ASSERT_EQ(helper.getPortDrops(0), 0u);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -18,6 +18,8 @@ namespace Svc {
     void FatalHandlerComponentImpl::FatalReceive_handler(
             const NATIVE_INT_TYPE portNum,
             FwEventIdType Id) {
+        // format messages here, as a thread draining deferred messages may not run again
+        Fw::Logger::registerRing(nullptr);
         Fw::Logger::log("FATAL %" PRI_FwEventIdType "handled.\n",Id);
         while (true) {} // Returning might be bad
     }
@@ -26,6 +26,8 @@ namespace Svc {
     void FatalHandlerComponentImpl::FatalReceive_handler(
             const NATIVE_INT_TYPE portNum,
             FwEventIdType Id) {
+        // format messages here, as a thread draining deferred messages may not run again
+        Fw::Logger::registerRing(nullptr);
         // for **nix, delay then exit with error code
         Fw::Logger::log("FATAL %d handled.\n",Id);
         (void)Os::Task::delay(Fw::TimeInterval(1, 0));
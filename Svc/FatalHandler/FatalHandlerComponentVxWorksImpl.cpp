@@ -20,6 +20,8 @@ namespace Svc {
     void FatalHandlerComponentImpl::FatalReceive_handler(
             const NATIVE_INT_TYPE portNum,
             FwEventIdType Id) {
+        // format messages here, as a thread draining deferred messages may not run again
+        Fw::Logger::registerRing(nullptr);
         Fw::Logger::log("FATAL %d handled.\n",Id,0,0,0,0,0);
         taskSuspend(0);
     }
@@ -79,6 +79,20 @@ void Framer ::send(Fw::Buffer& outgoing) {
     this->m_frame_sent = true;  // A frame was sent
 }
 
+void Framer ::sendSegments(Fw::Buffer& header, Fw::Buffer& payload, Fw::Buffer& trailer) {
+    // Without a driver taking segments, the frame is assembled and sent out framedOut
+    if (!this->isConnected_framedSegmentsOut_OutputPort(0)) {
+        FramingProtocolInterface::sendSegments(header, payload, trailer);
+        return;
+    }
+    FW_ASSERT(!this->m_frame_sent); // Prevent multiple sends per-packet
+    const Drv::SendStatus sendStatus = this->framedSegmentsOut_out(0, header, payload, trailer);
+    if (sendStatus.e != Drv::SendStatus::SEND_OK) {
+        Fw::Logger::log("[ERROR] Failed to send framed data: %d\n", sendStatus.e);
+    }
+    this->m_frame_sent = true;  // A frame was sent
+}
+
 Fw::Buffer Framer ::allocate(const U32 size) {
     return this->framedAllocate_out(0, size);
 }
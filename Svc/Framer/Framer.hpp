@@ -89,6 +89,16 @@ class Framer : public FramerComponentBase, public FramingProtocolInterface {
     void send(Fw::Buffer& outgoing  //!< The buffer to send
     );
 
+    //! \brief Send a frame as a header, a payload and a trailer
+    //!
+    //! Sends the segments out framedSegmentsOut when connected, sparing the copy of the payload into an allocated
+    //! frame buffer. Otherwise the segments are assembled in a buffer from framedAllocate and sent out framedOut.
+    //!
+    //! \param header: frame header
+    //! \param payload: frame payload
+    //! \param trailer: frame trailer
+    void sendSegments(Fw::Buffer& header, Fw::Buffer& payload, Fw::Buffer& trailer) override;
+
     // ----------------------------------------------------------------------
     // Helper functions
     // ----------------------------------------------------------------------
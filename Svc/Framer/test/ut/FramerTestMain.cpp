@@ -51,6 +51,15 @@ TEST(Nominal, NoSendStatus) {
     tester.test_no_send_status();
 }
 
+TEST(Nominal, Segments) {
+    COMMENT("Send frames as header, payload and trailer segments");
+    REQUIREMENT("SVC-FRAMER-001");
+    REQUIREMENT("SVC-FRAMER-002");
+    REQUIREMENT("SVC-FRAMER-003");
+    Svc::FramerTester tester;
+    tester.test_segments(5);
+}
+
 TEST(SendError, Buffer) {
     COMMENT("Send one Fw::Buffer to the framer (send error)");
     REQUIREMENT("SVC-FRAMER-002");
@@ -17,11 +17,18 @@
 
 namespace Svc {
 
-FramerTester::MockFramer::MockFramer(FramerTester& parent) : m_parent(parent), m_do_not_send(false) {}
+FramerTester::MockFramer::MockFramer(FramerTester& parent) : m_parent(parent), m_do_not_send(false), m_segments(false) {}
 
 void FramerTester::MockFramer::frame(const U8* const data, const U32 size, Fw::ComPacket::ComPacketType packet_type) {
     // When testing without the send case, disable all mock functions
-    if (!m_do_not_send) {
+    if (m_segments) {
+        U8 header[] = {0xde, 0xad, 0xbe, 0xef};
+        U8 trailer[] = {0x01, 0x02};
+        Fw::Buffer headerBuffer(header, sizeof(header));
+        Fw::Buffer payload(const_cast<U8*>(data), size);
+        Fw::Buffer trailerBuffer(trailer, sizeof(trailer));
+        m_interface->sendSegments(headerBuffer, payload, trailerBuffer);
+    } else if (!m_do_not_send) {
         Fw::Buffer buffer(const_cast<U8*>(data), size);
         m_parent.check_last_buffer(buffer);
         Fw::Buffer allocated = m_interface->allocate(size);
@@ -121,6 +128,31 @@ void FramerTester ::test_no_send_status() {
     test_status_pass_through();
 }
 
+void FramerTester ::test_segments(U32 iterations) {
+    m_mock.m_segments = true;
+    for (U32 i = 0; i < iterations; i++) {
+        Fw::ComBuffer com;
+        m_buffer.set(com.getBuffAddr(), com.getBuffLength());
+        m_framed = false;
+        m_sent = false;
+        invoke_to_comIn(0, com, 0);
+        ASSERT_TRUE(m_framed);
+        ASSERT_EQ(m_sent, m_sendStatus == Drv::SendStatus::SEND_OK);
+
+        Fw::Buffer buffer(new U8[3412], 3412);
+        m_framed = false;
+        m_returned = false;
+        m_buffer = buffer;
+        invoke_to_bufferIn(0, buffer);
+        ASSERT_TRUE(m_framed);
+        ASSERT_TRUE(m_returned);
+    }
+    // The payload went out in place, no frame buffer was allocated
+    ASSERT_from_framedSegmentsOut_SIZE(2 * iterations);
+    ASSERT_from_framedAllocate_SIZE(0);
+    ASSERT_from_framedOut_SIZE(0);
+}
+
 void FramerTester ::check_last_buffer(Fw::Buffer buffer) {
     ASSERT_EQ(buffer, m_buffer);
 }
@@ -153,6 +185,21 @@ Drv::SendStatus FramerTester ::from_framedOut_handler(const NATIVE_INT_TYPE port
     return m_sendStatus;
 }
 
+Drv::SendStatus FramerTester ::from_framedSegmentsOut_handler(const NATIVE_INT_TYPE portNum,
+                                                              Fw::Buffer& header,
+                                                              Fw::Buffer& payload,
+                                                              Fw::Buffer& trailer) {
+    this->pushFromPortEntry_framedSegmentsOut(header, payload, trailer);
+    this->check_last_buffer(payload);
+    EXPECT_EQ(header.getSize(), 4u);
+    EXPECT_EQ(trailer.getSize(), 2u);
+    m_framed = true;
+    if (m_sendStatus == Drv::SendStatus::SEND_OK) {
+        m_sent = true;
+    }
+    return m_sendStatus;
+}
+
 void FramerTester ::from_comStatusOut_handler(const NATIVE_INT_TYPE portNum, Fw::Success& condition) {
     this->pushFromPortEntry_comStatusOut(condition);
 }
@@ -177,6 +224,9 @@ void FramerTester ::connectPorts() {
     // framedOut
     this->component.set_framedOut_OutputPort(0, this->get_from_framedOut(0));
 
+    // framedSegmentsOut
+    this->component.set_framedSegmentsOut_OutputPort(0, this->get_from_framedSegmentsOut(0));
+
     // comStatusIn
     this->connect_to_comStatusIn(0, this->component.get_comStatusIn_InputPort(0));
 
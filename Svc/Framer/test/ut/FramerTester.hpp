@@ -37,6 +37,7 @@ class FramerTester : public FramerGTestBase {
         );
         FramerTester& m_parent;
         bool m_do_not_send;
+        bool m_segments;
     };
 
     // ----------------------------------------------------------------------
@@ -69,6 +70,9 @@ class FramerTester : public FramerGTestBase {
     //! Tests statuses on no-send
     void test_no_send_status();
 
+    //! Test frames sent as segments
+    void test_segments(U32 iterations = 1);
+
     //! Check that buffer is equal to the last buffer allocated
     void check_last_buffer(Fw::Buffer buffer);
 
@@ -96,6 +100,14 @@ class FramerTester : public FramerGTestBase {
         Fw::Buffer& sendBuffer //!< The buffer containing framed data
     );
 
+    //! Handler for from_framedSegmentsOut
+    Drv::SendStatus from_framedSegmentsOut_handler(
+        const NATIVE_INT_TYPE portNum, //!< The port number
+        Fw::Buffer& header, //!< The frame header
+        Fw::Buffer& payload, //!< The frame payload
+        Fw::Buffer& trailer //!< The frame trailer
+    );
+
     //! Handler for from_comStatusOut
     //!
     void from_comStatusOut_handler(
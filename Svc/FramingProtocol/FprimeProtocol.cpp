@@ -27,12 +27,11 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
         size + ((packet_type != Fw::ComPacket::FW_PACKET_UNKNOWN) ?
         static_cast<Svc::FpFrameHeader::TokenType>(sizeof(I32)) :
         0);
-    FpFrameHeader::TokenType total = real_data_size + FpFrameHeader::SIZE + HASH_DIGEST_LENGTH;
-    Fw::Buffer buffer = m_interface->allocate(total);
-    Fw::SerializeBufferBase& serializer = buffer.getSerializeRepr();
-    Utils::HashBuffer hash;
+    U8 header[FpFrameHeader::SIZE + sizeof(I32)];
+    Fw::ExternalSerializeBuffer serializer(header, sizeof(header));
+    Utils::HashBuffer hashBuffer;
 
-    // Serialize data
+    // Serialize header
     Fw::SerializeStatus status;
     status = serializer.serialize(FpFrameHeader::START_WORD);
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
@@ -46,17 +45,17 @@ void FprimeFraming::frame(const U8* const data, const U32 size, Fw::ComPacket::C
         FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
     }
 
-    status = serializer.serialize(data, size, true);  // Serialize without length
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-
-    // Calculate and add transmission hash
-    Utils::Hash::hash(buffer.getData(), static_cast<NATIVE_INT_TYPE>(total - HASH_DIGEST_LENGTH), hash);
-    status = serializer.serialize(hash.getBuffAddr(), HASH_DIGEST_LENGTH, true);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
-
-    buffer.setSize(total);
+    // Calculate transmission hash across the header and the data, left in place
+    Utils::Hash hash;
+    hash.init();
+    hash.update(header, static_cast<NATIVE_INT_TYPE>(serializer.getBuffLength()));
+    hash.update(data, static_cast<NATIVE_INT_TYPE>(size));
+    hash.final(hashBuffer);
 
-    m_interface->send(buffer);
+    Fw::Buffer headerBuffer(header, static_cast<U32>(serializer.getBuffLength()));
+    Fw::Buffer dataBuffer(const_cast<U8*>(data), size);
+    Fw::Buffer hashTrailer(hashBuffer.getBuffAddr(), HASH_DIGEST_LENGTH);
+    m_interface->sendSegments(headerBuffer, dataBuffer, hashTrailer);
 }
 
 bool FprimeDeframing::validate(Types::CircularBuffer& ring, U32 size) {
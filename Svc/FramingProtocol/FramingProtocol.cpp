@@ -13,6 +13,7 @@
 
 #include "FramingProtocol.hpp"
 #include "FramingProtocolInterface.hpp"
+#include <cstring>
 
 namespace Svc {
 
@@ -22,4 +23,24 @@ void FramingProtocol::setup(FramingProtocolInterface& interface) {
     FW_ASSERT(m_interface == nullptr);
     m_interface = &interface;
 }
+
+void FramingProtocolInterface::sendSegments(Fw::Buffer& header, Fw::Buffer& payload, Fw::Buffer& trailer) {
+    const U32 total = header.getSize() + payload.getSize() + trailer.getSize();
+    Fw::Buffer buffer = this->allocate(total);
+    FW_ASSERT(buffer.getSize() >= total, static_cast<FwAssertArgType>(buffer.getSize()),
+              static_cast<FwAssertArgType>(total));
+    U8* const data = buffer.getData();
+    // Empty segments may carry no data
+    if (header.getSize() > 0) {
+        ::memcpy(data, header.getData(), header.getSize());
+    }
+    if (payload.getSize() > 0) {
+        ::memcpy(data + header.getSize(), payload.getData(), payload.getSize());
+    }
+    if (trailer.getSize() > 0) {
+        ::memcpy(data + header.getSize() + payload.getSize(), trailer.getData(), trailer.getSize());
+    }
+    buffer.setSize(total);
+    this->send(buffer);
+}
 }
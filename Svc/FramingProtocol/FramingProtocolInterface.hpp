@@ -37,6 +37,15 @@ class FramingProtocolInterface {
     //! \param outgoing: framed data wrapped in an Fw::Buffer
     virtual void send(Fw::Buffer& outgoing) = 0;
 
+    //! \brief send a frame out of the framer as a header, a payload and a trailer
+    //!
+    //! Lets a frame go out without copying the payload into an allocated frame buffer. The buffers are only borrowed
+    //! for the call. By default the segments are copied into one buffer from allocate and passed to send.
+    //! \param header: frame header
+    //! \param payload: frame payload
+    //! \param trailer: frame trailer
+    virtual void sendSegments(Fw::Buffer& header, Fw::Buffer& payload, Fw::Buffer& trailer);
+
 };
 
 }
@@ -24,19 +24,36 @@ namespace Svc {
 // Construction, initialization, and destruction
 // ----------------------------------------------------------------------
 
-GenericHubComponentImpl ::GenericHubComponentImpl(const char* const compName) : GenericHubComponentBase(compName) {}
+GenericHubComponentImpl ::GenericHubComponentImpl(const char* const compName)
+    : GenericHubComponentBase(compName), m_batchUsed(0), m_maxBatchSize(0), m_maxLatencyUs(0) {}
 
 GenericHubComponentImpl ::~GenericHubComponentImpl() {}
 
+void GenericHubComponentImpl ::configureBatching(const U32 maxBatchSize, const U32 maxLatencyUs) {
+    FW_ASSERT((maxBatchSize == 0) || (maxBatchSize > GENERIC_HUB_HEADER_SIZE), static_cast<FwAssertArgType>(maxBatchSize));
+    this->m_maxBatchSize = maxBatchSize;
+    this->m_maxLatencyUs = maxLatencyUs;
+}
+
 void GenericHubComponentImpl ::send_data(const HubType type,
                                          const NATIVE_INT_TYPE port,
                                          const U8* data,
                                          const U32 size) {
     FW_ASSERT(data != nullptr);
+    if (this->m_maxBatchSize != 0) {
+        Os::ScopeLock lock(this->m_batchLock);
+        // Buffers and messages too large to batch go alone, after the batch so messages stay in order
+        if ((type == HUB_TYPE_BUFFER) || ((size + GENERIC_HUB_HEADER_SIZE) > this->m_maxBatchSize)) {
+            this->flush_batch();
+        } else {
+            this->batch_data(type, port, data, size);
+            return;
+        }
+    }
     Fw::SerializeStatus status;
     // Buffer to send and a buffer used to write to it
-    Fw::Buffer outgoing = dataOutAllocate_out(0, static_cast<U32>(size + sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType)));
-    Fw::SerializeBufferBase& serialize = outgoing.getSerializeRepr();
+    Fw::Buffer outgoing = dataOutAllocate_out(0, static_cast<U32>(size + GENERIC_HUB_HEADER_SIZE));
+    Fw::ExternalSerializeBufferWithMemberCopy serialize = outgoing.getSerializer();
     // Write data to our buffer
     status = serialize.serialize(static_cast<U32>(type));
     FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
@@ -48,6 +65,53 @@ void GenericHubComponentImpl ::send_data(const HubType type,
     dataOut_out(0, outgoing);
 }
 
+void GenericHubComponentImpl ::batch_data(const HubType type,
+                                          const NATIVE_INT_TYPE port,
+                                          const U8* data,
+                                          const U32 size) {
+    const U32 messageSize = size + GENERIC_HUB_HEADER_SIZE;
+    if ((this->m_batch.getData() != nullptr) && ((this->m_batchUsed + messageSize) > this->m_batch.getSize())) {
+        this->flush_batch();
+    }
+    if (this->m_batch.getData() == nullptr) {
+        this->m_batch = dataOutAllocate_out(0, this->m_maxBatchSize);
+        this->m_batchUsed = 0;
+        (void)this->m_batchStart.now();
+    }
+    Fw::SerializeStatus status;
+    // Write data after the messages already in the batch
+    Fw::ExternalSerializeBuffer serialize(this->m_batch.getData() + this->m_batchUsed,
+                                          this->m_batch.getSize() - this->m_batchUsed);
+    status = serialize.serialize(static_cast<U32>(type));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+    status = serialize.serialize(static_cast<U32>(port));
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+    status = serialize.serialize(data, size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+    this->m_batchUsed += serialize.getBuffLength();
+
+    if (this->m_maxLatencyUs != 0) {
+        Os::RawTime now;
+        U32 waitedUs = 0;
+        (void)now.now();
+        if ((now.getDiffUsec(this->m_batchStart, waitedUs) == Os::RawTime::OP_OK) &&
+            (waitedUs >= this->m_maxLatencyUs)) {
+            this->flush_batch();
+        }
+    }
+}
+
+void GenericHubComponentImpl ::flush_batch() {
+    if (this->m_batch.getData() == nullptr) {
+        return;
+    }
+    Fw::Buffer outgoing = this->m_batch;
+    outgoing.setSize(this->m_batchUsed);
+    this->m_batch = Fw::Buffer();
+    this->m_batchUsed = 0;
+    dataOut_out(0, outgoing);
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for user-defined typed input ports
 // ----------------------------------------------------------------------
@@ -64,38 +128,55 @@ void GenericHubComponentImpl ::dataIn_handler(const NATIVE_INT_TYPE portNum, Fw:
     FwBuffSizeType size = 0;
     Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
 
-    // Representation of incoming data prepped for serialization
-    Fw::SerializeBufferBase& incoming = fwBuffer.getSerializeRepr();
-    FW_ASSERT(incoming.setBuffLen(fwBuffer.getSize()) == Fw::FW_SERIALIZE_OK);
+    // Representation of incoming data prepped for deserialization
+    Fw::ExternalSerializeBufferWithMemberCopy incoming = fwBuffer.getDeserializer();
 
-    // Must inform buffer that there is *real* data in the buffer
-    status = incoming.setBuffLen(fwBuffer.getSize());
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = incoming.deserialize(type_in);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    type = static_cast<HubType>(type_in);
-    FW_ASSERT(type < HUB_TYPE_MAX, type);
-    status = incoming.deserialize(port);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-    status = incoming.deserialize(size);
-    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+    // A batching hub may have packed several messages one after another
+    while (incoming.getBuffLeft() > 0) {
+        status = incoming.deserialize(type_in);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        type = static_cast<HubType>(type_in);
+        FW_ASSERT(type < HUB_TYPE_MAX, type);
+        status = incoming.deserialize(port);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+        status = incoming.deserialize(size);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+
+        U8* rawData = fwBuffer.getData() + (fwBuffer.getSize() - incoming.getBuffLeft());
+        U32 rawSize = static_cast<U32>(size);
+        FW_ASSERT(rawSize <= incoming.getBuffLeft(), static_cast<FwAssertArgType>(rawSize),
+                  static_cast<FwAssertArgType>(incoming.getBuffLeft()));
+        if (type == HUB_TYPE_BUFFER) {
+            // Fw::Buffers can reuse the existing data buffer as the storage type!  No deallocation done.
+            // The sending hub never batches buffers, so this is the only message.
+            FW_ASSERT(rawSize == incoming.getBuffLeft(), static_cast<FwAssertArgType>(rawSize),
+                      static_cast<FwAssertArgType>(incoming.getBuffLeft()));
+            FW_ASSERT(rawData == fwBuffer.getData() + GENERIC_HUB_HEADER_SIZE);
+            fwBuffer.set(rawData, rawSize, fwBuffer.getContext());
+            buffersOut_out(static_cast<FwIndexType>(port), fwBuffer);
+            return;
+        }
+        this->receive_data(type, port, rawData, rawSize);
+        status = incoming.deserializeSkip(rawSize);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
+    }
 
+    // Deallocate the existing buffer
+    dataInDeallocate_out(0, fwBuffer);
+}
+
+void GenericHubComponentImpl ::receive_data(const HubType type,
+                                            const U32 port,
+                                            U8* const data,
+                                            const U32 size) {
+    Fw::SerializeStatus status = Fw::FW_SERIALIZE_OK;
     // invokeSerial deserializes arguments before calling a normal invoke, this will return ownership immediately
-    U8* rawData = fwBuffer.getData() + sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType);
-    U32 rawSize = static_cast<U32>(fwBuffer.getSize() - sizeof(U32) - sizeof(U32) - sizeof(FwBuffSizeType));
-    FW_ASSERT(rawSize == static_cast<U32>(size));
+    // Com buffer representations should be copied before the call returns, so we need not "allocate" new data
+    Fw::ExternalSerializeBuffer incoming(data, size);
+    status = incoming.setBuffLen(size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
     if (type == HUB_TYPE_PORT) {
-        // Com buffer representations should be copied before the call returns, so we need not "allocate" new data
-        Fw::ExternalSerializeBuffer wrapper(rawData, rawSize);
-        status = wrapper.setBuffLen(rawSize);
-        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<NATIVE_INT_TYPE>(status));
-        portOut_out(static_cast<FwIndexType>(port), wrapper);
-        // Deallocate the existing buffer
-        dataInDeallocate_out(0, fwBuffer);
-    } else if (type == HUB_TYPE_BUFFER) {
-        // Fw::Buffers can reuse the existing data buffer as the storage type!  No deallocation done.
-        fwBuffer.set(rawData, rawSize, fwBuffer.getContext());
-        buffersOut_out(static_cast<FwIndexType>(port), fwBuffer);
+        portOut_out(static_cast<FwIndexType>(port), incoming);
     } else if (type == HUB_TYPE_EVENT) {
         FwEventIdType id;
         Fw::Time timeTag;
@@ -114,9 +195,6 @@ void GenericHubComponentImpl ::dataIn_handler(const NATIVE_INT_TYPE portNum, Fw:
 
         // Send it!
         this->LogSend_out(static_cast<FwIndexType>(port), id, timeTag, severity, args);
-
-        // Deallocate the existing buffer
-        dataInDeallocate_out(0, fwBuffer);
     } else if (type == HUB_TYPE_CHANNEL) {
         FwChanIdType id;
         Fw::Time timeTag;
@@ -132,9 +210,22 @@ void GenericHubComponentImpl ::dataIn_handler(const NATIVE_INT_TYPE portNum, Fw:
 
         // Send it!
         this->TlmSend_out(static_cast<FwIndexType>(port), id, timeTag, val);
+    }
+}
 
-        // Deallocate the existing buffer
-        dataInDeallocate_out(0, fwBuffer);
+void GenericHubComponentImpl ::run_handler(const NATIVE_INT_TYPE portNum, U32 context) {
+    if (this->m_maxBatchSize == 0) {
+        return;
+    }
+    Os::ScopeLock lock(this->m_batchLock);
+    if (this->m_batch.getData() == nullptr) {
+        return;
+    }
+    Os::RawTime now;
+    U32 waitedUs = 0;
+    (void)now.now();
+    if ((now.getDiffUsec(this->m_batchStart, waitedUs) != Os::RawTime::OP_OK) || (waitedUs >= this->m_maxLatencyUs)) {
+        this->flush_batch();
     }
 }
 
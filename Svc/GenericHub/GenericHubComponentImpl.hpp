@@ -14,6 +14,8 @@
 #define GenericHub_HPP
 
 #include "Svc/GenericHub/GenericHubComponentAc.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/RawTime.hpp"
 
 namespace Svc {
 
@@ -33,6 +35,8 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     };
 
     const static U32 GENERIC_HUB_DATA_SIZE = 1024;
+    //! Size of the type, port, and size header preceding each message on the wire
+    const static U32 GENERIC_HUB_HEADER_SIZE = sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType);
     // ----------------------------------------------------------------------
     // Construction, initialization, and destruction
     // ----------------------------------------------------------------------
@@ -46,6 +50,20 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     //!
     ~GenericHubComponentImpl();
 
+    //! Pack several messages into each buffer sent on dataOut
+    //!
+    //! Messages are appended to a buffer of maxBatchSize bytes allocated from dataOutAllocate. The buffer is sent
+    //! when the next message does not fit, when its oldest message has waited maxLatencyUs, or on a run call once
+    //! maxLatencyUs has passed. A maxLatencyUs of zero leaves sending to the size and to run. Buffers from buffersIn
+    //! are always sent alone as the remote hub passes their storage on in place. The remote hub must be able to
+    //! unpack several messages per buffer, as this hub does on dataIn. A maxBatchSize of zero, the default, sends
+    //! each message in its own buffer. Must be called before the hub is in use. With batching on, batches go out on
+    //! dataOut with a lock held, so the dataOut call must not come back into this hub.
+    //!
+    void configureBatching(const U32 maxBatchSize, /*!< Bytes per batch buffer, zero to disable batching*/
+                           const U32 maxLatencyUs  /*!< Longest time a message may wait in a batch*/
+    );
+
   PRIVATE:
     // ----------------------------------------------------------------------
     // Handler implementations for user-defined typed input ports
@@ -61,6 +79,12 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
     void dataIn_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
                         Fw::Buffer& fwBuffer);
 
+    //! Handler implementation for run
+    //!
+    void run_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                     U32 context                    /*!< The call order*/
+    );
+
     //! Handler implementation for LogRecv
     //!
     void LogRecv_handler(const NATIVE_INT_TYPE portNum,   /*!< The port number*/
@@ -90,6 +114,22 @@ class GenericHubComponentImpl : public GenericHubComponentBase {
 
     // Helpers and members
     void send_data(const HubType type, const NATIVE_INT_TYPE port, const U8* data, const U32 size);
+
+    //! Append a message to the batch, sending the batch as needed. Called with m_batchLock held.
+    void batch_data(const HubType type, const NATIVE_INT_TYPE port, const U8* data, const U32 size);
+
+    //! Send the batch if it holds any messages. Called with m_batchLock held.
+    void flush_batch();
+
+    //! Deserialize and send out one message
+    void receive_data(const HubType type, const U32 port, U8* const data, const U32 size);
+
+    Os::Mutex m_batchLock;  //!< Protects the batch, taken by every sending thread
+    Fw::Buffer m_batch;     //!< Buffer being filled with messages, invalid when no batch is started
+    U32 m_batchUsed;        //!< Bytes of m_batch filled
+    Os::RawTime m_batchStart;  //!< Time the first message of the batch was added
+    U32 m_maxBatchSize;     //!< Bytes per batch buffer, zero when batching is off
+    U32 m_maxLatencyUs;     //!< Longest time a message may wait in a batch, zero for no limit
 };
 
 }  // end namespace Svc
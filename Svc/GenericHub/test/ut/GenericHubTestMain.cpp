@@ -30,6 +30,21 @@ TEST(Nominal, TestTelemetry) {
     tester.test_telemetry();
 }
 
+TEST(Batching, TestBatching) {
+    Svc::GenericHubTester tester;
+    tester.test_batching();
+}
+
+TEST(Batching, TestLatency) {
+    Svc::GenericHubTester tester;
+    tester.test_batching_latency();
+}
+
+TEST(Batching, DISABLED_TestThroughput) {
+    Svc::GenericHubTester tester;
+    tester.test_batching_throughput();
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -12,6 +12,9 @@
 
 #include "GenericHubTester.hpp"
 #include <STest/Pick/Pick.hpp>
+#include <Os/Task.hpp>
+#include <chrono>
+#include <cstdio>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10000
@@ -116,6 +119,113 @@ void GenericHubTester ::test_events() {
     ASSERT_from_LogSend(0, 123, time, severity, buffer);
     clearFromPortHistory();
 }
+void GenericHubTester ::test_batching() {
+    componentIn.configureBatching(GenericHubComponentImpl::GENERIC_HUB_DATA_SIZE, 0);
+    Fw::TlmBuffer buffer;
+    random_fill(buffer, FW_TLM_BUFFER_MAX_SIZE / 4);
+    Fw::LogSeverity severity = Fw::LogSeverity::WARNING_HI;
+    Fw::LogBuffer args;
+    random_fill(args, FW_LOG_BUFFER_MAX_SIZE / 4);
+    Fw::Time time(100, 200);
+
+    // Messages wait in the batch until it is sent
+    const U32 count = 5;
+    for (U32 i = 0; i < count; i++) {
+        invoke_to_TlmRecv(0, i, time, buffer);
+    }
+    invoke_to_LogRecv(0, 123, time, severity, args);
+    ASSERT_from_dataOut_SIZE(0);
+    invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_dataInDeallocate_SIZE(1);
+    ASSERT_from_TlmSend_SIZE(count);
+    for (U32 i = 0; i < count; i++) {
+        ASSERT_from_TlmSend(i, i, time, buffer);
+    }
+    ASSERT_from_LogSend_SIZE(1);
+    ASSERT_from_LogSend(0, 123, time, severity, args);
+    invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    clearFromPortHistory();
+
+    // Buffers are sent alone, after the messages ahead of them
+    invoke_to_TlmRecv(0, count, time, buffer);
+    m_buffer.set(m_data_store, FW_COM_BUFFER_MAX_SIZE);
+    invoke_to_buffersIn(0, m_buffer);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_from_TlmSend_SIZE(1);
+    ASSERT_from_TlmSend(0, count, time, buffer);
+    ASSERT_EQ(m_buffer_out, 1U);
+    ASSERT_from_dataInDeallocate_SIZE(2);
+    clearFromPortHistory();
+
+    // A full batch is sent to make room
+    const U32 many = 4 * GenericHubComponentImpl::GENERIC_HUB_DATA_SIZE /
+                     (GenericHubComponentImpl::GENERIC_HUB_HEADER_SIZE + buffer.getBuffLength());
+    for (U32 i = 0; i < many; i++) {
+        invoke_to_TlmRecv(0, i, time, buffer);
+    }
+    invoke_to_run(0, 0);
+    ASSERT_GT(fromPortHistory_dataOut->size(), 3U);
+    ASSERT_LT(fromPortHistory_dataOut->size(), many);
+    ASSERT_from_TlmSend_SIZE(many);
+    for (U32 i = 0; i < many; i++) {
+        ASSERT_from_TlmSend(i, i, time, buffer);
+    }
+    ASSERT_from_dataInDeallocate_SIZE(fromPortHistory_dataOut->size());
+}
+
+void GenericHubTester ::test_batching_latency() {
+    const U32 latencyUs = 2000;
+    componentIn.configureBatching(GenericHubComponentImpl::GENERIC_HUB_DATA_SIZE, latencyUs);
+    Fw::TlmBuffer buffer;
+    random_fill(buffer, FW_TLM_BUFFER_MAX_SIZE);
+    Fw::Time time(100, 200);
+
+    // run sends the batch only once it has waited the latency limit
+    invoke_to_TlmRecv(0, 1, time, buffer);
+    invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(0);
+    (void)Os::Task::delay(Fw::TimeInterval(0, 2 * latencyUs));
+    invoke_to_run(0, 0);
+    ASSERT_from_dataOut_SIZE(1);
+    ASSERT_from_TlmSend_SIZE(1);
+
+    // a message arriving after the limit sends the batch with it
+    invoke_to_TlmRecv(0, 2, time, buffer);
+    (void)Os::Task::delay(Fw::TimeInterval(0, 2 * latencyUs));
+    invoke_to_TlmRecv(0, 3, time, buffer);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_from_TlmSend_SIZE(3);
+    ASSERT_from_TlmSend(1, 2, time, buffer);
+    ASSERT_from_TlmSend(2, 3, time, buffer);
+}
+
+void GenericHubTester ::test_batching_throughput() {
+    const U32 messages = 200000;
+    const U32 sizes[] = {0, 256, GenericHubComponentImpl::GENERIC_HUB_DATA_SIZE};
+    Fw::TlmBuffer buffer;
+    ASSERT_EQ(buffer.serialize(static_cast<U32>(0)), Fw::FW_SERIALIZE_OK);
+    Fw::Time time(100, 200);
+    for (U32 size : sizes) {
+        componentIn.configureBatching(size, 0);
+        U32 buffers = 0;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (U32 i = 0; i < messages; i++) {
+            invoke_to_TlmRecv(0, i, time, buffer);
+            if (fromPortHistory_TlmSend->size() >= MAX_HISTORY_SIZE / 4) {
+                buffers += fromPortHistory_dataOut->size();
+                clearFromPortHistory();
+            }
+        }
+        invoke_to_run(0, 0);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        buffers += fromPortHistory_dataOut->size();
+        clearFromPortHistory();
+        printf("batch size %u: %.0f messages/s in %u buffers\n", size, messages / elapsed.count(), buffers);
+    }
+}
+
 // Helpers
 
 void GenericHubTester ::send_random_comm(U32 port) {
@@ -132,7 +242,8 @@ void GenericHubTester ::send_random_buffer(U32 port) {
     U32 max_random_size = STest::Pick::lowerUpper(0, DATA_SIZE - (sizeof(U32) + sizeof(U32) + sizeof(FwBuffSizeType)));
     m_buffer.set(m_data_store, sizeof(m_data_store));
     ASSERT_GE(m_buffer.getSize(), max_random_size);
-    random_fill(m_buffer.getSerializeRepr(), max_random_size);
+    Fw::ExternalSerializeBufferWithMemberCopy serializer = m_buffer.getSerializer();
+    random_fill(serializer, max_random_size);
     m_buffer.setSize(max_random_size);
     m_current_port = port;
     invoke_to_buffersIn(m_current_port, m_buffer);
@@ -247,6 +358,9 @@ void GenericHubTester ::connectPorts() {
     // TlmRecv
     this->connect_to_TlmRecv(0, this->componentIn.get_TlmRecv_InputPort(0));
 
+    // run
+    this->connect_to_run(0, this->componentIn.get_run_InputPort(0));
+
     // dataIn
     this->connect_to_dataIn(0, this->componentOut.get_dataIn_InputPort(0));
 
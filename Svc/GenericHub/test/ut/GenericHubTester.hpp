@@ -60,6 +60,18 @@ class GenericHubTester : public GenericHubGTestBase {
     //!
     void test_events();
 
+    //! Test of several messages batched into one buffer
+    //!
+    void test_batching();
+
+    //! Test of the batch latency limit
+    //!
+    void test_batching_latency();
+
+    //! Measure telemetry messages/s with and without batching
+    //!
+    void test_batching_throughput();
+
 
 
   private:
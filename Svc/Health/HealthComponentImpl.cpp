@@ -22,6 +22,10 @@ namespace Svc {
 
     HealthImpl::HealthImpl(const char * const compName) :
             HealthComponentBase(compName),
+            m_latencyHead(0),
+            m_latencyCount(0),
+            m_pingPeriod(1),
+            m_pingLatency(false),
             m_numPingEntries(0),
             m_key(0),
             m_watchDogCode(0),
@@ -33,7 +37,10 @@ namespace Svc {
                 entry < FW_NUM_ARRAY_ELEMENTS(this->m_pingTrackerEntries);
                 entry++) {
             this->m_pingTrackerEntries[entry].enabled = Fw::Enabled::DISABLED;
+            this->m_pingTrackerEntries[entry].awaiting = false;
+            this->m_pingTrackerEntries[entry].latencyQueued = false;
         }
+        this->m_wheel.setup(this->m_wheelEntries, FW_NUM_ARRAY_ELEMENTS(this->m_wheelEntries));
     }
 
     void HealthImpl::init(const FwSizeType queueDepth, const NATIVE_INT_TYPE instance) {
@@ -42,25 +49,48 @@ namespace Svc {
 
     }
 
-    void HealthImpl::setPingEntries(PingEntry* pingEntries, NATIVE_INT_TYPE numPingEntries, U32 watchDogCode) {
+    void HealthImpl::setPingEntries(PingEntry* pingEntries, NATIVE_INT_TYPE numPingEntries, U32 watchDogCode, U32 pingPeriod, bool pingLatency) {
 
         FW_ASSERT(pingEntries);
         // make sure not asking for more pings than ports
         FW_ASSERT(numPingEntries <= NUM_PINGSEND_OUTPUT_PORTS);
+        FW_ASSERT((pingPeriod > 0) and (pingPeriod <= TimingWheel::MAX_DELAY), static_cast<FwAssertArgType>(pingPeriod));
 
         this->m_numPingEntries = static_cast<U32>(numPingEntries);
         this->m_watchDogCode = watchDogCode;
+        this->m_pingPeriod = pingPeriod;
+        this->m_pingLatency = pingLatency;
+
+        // start over with no deadlines and no latency reports
+        this->m_wheel = TimingWheel();
+        this->m_wheel.setup(this->m_wheelEntries, FW_NUM_ARRAY_ELEMENTS(this->m_wheelEntries));
+        this->m_latencyHead = 0;
+        this->m_latencyCount = 0;
 
         // copy entries to private data
-        for (NATIVE_INT_TYPE entry = 0; entry < numPingEntries; entry++) {
+        for (NATIVE_UINT_TYPE entry = 0; entry < NUM_PINGSEND_OUTPUT_PORTS; entry++) {
+            PingTracker& tracker = this->m_pingTrackerEntries[entry];
+            tracker.enabled = Fw::Enabled::DISABLED;
+            tracker.awaiting = false;
+            tracker.latencyQueued = false;
+            if (entry >= this->m_numPingEntries) {
+                continue;
+            }
             FW_ASSERT(
                 pingEntries[entry].warnCycles <= pingEntries[entry].fatalCycles,
                 static_cast<FwAssertArgType>(pingEntries[entry].warnCycles),
                 static_cast<FwAssertArgType>(pingEntries[entry].fatalCycles));
-            this->m_pingTrackerEntries[entry].entry = pingEntries[entry];
-            this->m_pingTrackerEntries[entry].cycleCount = 0;
-            this->m_pingTrackerEntries[entry].enabled = Fw::Enabled::ENABLED;
-            this->m_pingTrackerEntries[entry].key = 0;
+            tracker.entry = pingEntries[entry];
+            tracker.enabled = Fw::Enabled::ENABLED;
+            tracker.key = 0;
+            tracker.frozenCycles = 0;
+            for (U32 bin = 0; bin < HealthPingLatencyHistogram::SIZE; bin++) {
+                tracker.histogram[bin] = 0;
+            }
+            // spread the first pings evenly over the first period
+            const U32 offset = static_cast<U32>((static_cast<U64>(entry) * pingPeriod) / this->m_numPingEntries);
+            tracker.pingCycle = this->m_wheel.getTicks() + offset - pingPeriod;
+            this->scheduleEntry(entry);
         }
     }
 
@@ -73,18 +103,51 @@ namespace Svc {
     // ----------------------------------------------------------------------
 
     void HealthImpl::PingReturn_handler(const NATIVE_INT_TYPE portNum, U32 key) {
+        // only ports in the ping table are pinged, so a return on any other
+        // port is a wiring error and is rejected
+        if ((portNum < 0) or (static_cast<U32>(portNum) >= this->m_numPingEntries)) {
+            this->log_WARNING_HI_HLTH_PING_UNKNOWN_PORT(portNum, key);
+            return;
+        }
+        const U32 entry = static_cast<U32>(portNum);
+        PingTracker& tracker = this->m_pingTrackerEntries[entry];
+
         // verify the key value
-        if (key != this->m_pingTrackerEntries[portNum].key) {
-            Fw::LogStringArg _arg = this->m_pingTrackerEntries[portNum].entry.entryName;
+        if (key != tracker.key) {
+            Fw::LogStringArg _arg = tracker.entry.entryName;
             this->log_FATAL_HLTH_PING_WRONG_KEY(_arg,key);
-        } else {
-            // reset the counter and clear the key
-            this->m_pingTrackerEntries[portNum].cycleCount = 0;
-            this->m_pingTrackerEntries[portNum].key = 0;
+        } else if (tracker.awaiting) {
+            if (this->m_pingLatency) {
+                this->m_returnLock.lock();
+                const Os::RawTime returnTime = tracker.returnTime;
+                this->m_returnLock.unLock();
+                U32 latency = 0;
+                // Cast to void as the only possible error is overflow, which caps latency
+                (void) returnTime.getDiffUsec(tracker.pingTime, latency);
+                this->updateLatency(entry, latency);
+            }
+            // clear the key and schedule the next ping
+            tracker.awaiting = false;
+            tracker.key = 0;
+            this->scheduleEntry(entry);
         }
 
     }
 
+    void HealthImpl::PingReturn_preMsgHook(const NATIVE_INT_TYPE portNum, U32 key) {
+        // returns on ports outside the ping table are rejected by the handler
+        if ((not this->m_pingLatency) or (portNum < 0) or (static_cast<U32>(portNum) >= this->m_numPingEntries)) {
+            return;
+        }
+        // the return is only dispatched on the next Run call, so the round trip
+        // ends when the returning component queues it
+        Os::RawTime returnTime;
+        (void) returnTime.now();
+        this->m_returnLock.lock();
+        this->m_pingTrackerEntries[portNum].returnTime = returnTime;
+        this->m_returnLock.unLock();
+    }
+
     void HealthImpl::Run_handler(const NATIVE_INT_TYPE portNum, U32 context) {
         //dispatch messages
         for (NATIVE_UINT_TYPE i = 0; i < this->queue_depth; i++) {
@@ -96,42 +159,23 @@ namespace Svc {
         }
 
         if (this->m_enabled == Fw::Enabled::ENABLED) {
-            // cycle through ping table, pinging ports that are not awaiting a reply
-            // for ports that are awaiting a reply, decrement their counters
-            // and check for violations
-
-            for (NATIVE_UINT_TYPE entry = 0; entry < this->m_numPingEntries; entry++) {
-                if (Fw::Enabled::ENABLED == this->m_pingTrackerEntries[entry].enabled) {
-                    // If clear entry
-                    if (0 == this->m_pingTrackerEntries[entry].cycleCount) {
-                        // start a ping
-                        this->m_pingTrackerEntries[entry].key = this->m_key;
-                        // send ping
-                        this->PingSend_out(static_cast<FwIndexType>(entry), this->m_pingTrackerEntries[entry].key);
-                        // increment key
-                        this->m_key++;
-                        // increment cycles for the entry
-                        this->m_pingTrackerEntries[entry].cycleCount++;
-                    } else {
-                        // check to see if it is at warning threshold
-                        if (this->m_pingTrackerEntries[entry].cycleCount ==
-                                this->m_pingTrackerEntries[entry].entry.warnCycles) {
-                            Fw::LogStringArg _arg = this->m_pingTrackerEntries[entry].entry.entryName;
-                            this->log_WARNING_HI_HLTH_PING_WARN(_arg);
-                            this->tlmWrite_PingLateWarnings(++this->m_warnings);
-                        } else {
-                            // check for FATAL timeout value
-                            if (this->m_pingTrackerEntries[entry].entry.fatalCycles ==
-                                    this->m_pingTrackerEntries[entry].cycleCount) {
-                                Fw::LogStringArg _arg = this->m_pingTrackerEntries[entry].entry.entryName;
-                                this->log_FATAL_HLTH_PING_LATE(_arg);
-                            }
-                        } // if at warning or fatal threshold
-
-                        this->m_pingTrackerEntries[entry].cycleCount++;
-                    } // if clear entry
-                } // if entry has ping enabled
-            } // for each entry
+            // advance the cycle and check only the entries with a ping or a
+            // threshold due on it
+            this->m_wheel.tick();
+            const U32 cycle = this->m_wheel.getTicks() - 1;
+            U32 entry = 0;
+            // pings are only timed when latency is measured
+            bool stamped = not this->m_pingLatency;
+            while (this->m_wheel.popExpired(entry)) {
+                // the pings of a cycle are sent together and share one time
+                if ((not stamped) and (not this->m_pingTrackerEntries[entry].awaiting)) {
+                    (void) this->m_cycleTime.now();
+                    stamped = true;
+                }
+                this->checkEntry(entry, cycle);
+            }
+
+            this->reportLatency();
 
             // do other specialized platform checks (e.g. VxWorks suspended tasks)
             this->doOtherChecks();
@@ -168,7 +212,17 @@ namespace Svc {
             return;
         }
 
-        this->m_pingTrackerEntries[entryIndex].enabled = enable.e;
+        // keep the cycle count of an outstanding ping while the entry is not checked
+        const U32 index = static_cast<U32>(entryIndex);
+        PingTracker& tracker = this->m_pingTrackerEntries[index];
+        const U32 cycleCount = this->getCycleCount(index);
+        tracker.enabled = enable.e;
+        if (tracker.awaiting) {
+            tracker.frozenCycles = cycleCount;
+            tracker.pingCycle = this->m_wheel.getTicks() - cycleCount;
+        }
+        this->scheduleEntry(index);
+
         Fw::Enabled isEnabled(Fw::Enabled::DISABLED);
         if (enable == Fw::Enabled::ENABLED) {
             isEnabled = Fw::Enabled::ENABLED;
@@ -198,6 +252,7 @@ namespace Svc {
 
         this->m_pingTrackerEntries[entryIndex].entry.warnCycles = warningValue;
         this->m_pingTrackerEntries[entryIndex].entry.fatalCycles = fatalValue;
+        this->scheduleEntry(static_cast<U32>(entryIndex));
         Fw::LogStringArg arg = entry;
         this->log_ACTIVITY_HI_HLTH_PING_UPDATED(arg,warningValue,fatalValue);
         this->cmdResponse_out(opCode,cmdSeq,Fw::CmdResponse::OK);
@@ -206,7 +261,7 @@ namespace Svc {
     NATIVE_INT_TYPE HealthImpl::findEntry(const Fw::CmdStringArg& entry) {
 
         // walk through entries
-        for (NATIVE_UINT_TYPE tableEntry = 0; tableEntry < NUM_PINGSEND_OUTPUT_PORTS; tableEntry++) {
+        for (NATIVE_UINT_TYPE tableEntry = 0; tableEntry < this->m_numPingEntries; tableEntry++) {
             if (entry == this->m_pingTrackerEntries[tableEntry].entry.entryName) {
                 return static_cast<NATIVE_INT_TYPE>(tableEntry);
             }
@@ -217,6 +272,114 @@ namespace Svc {
         return -1;
     }
 
+    U32 HealthImpl::getCycleCount(U32 entry) const {
+        FW_ASSERT(entry < NUM_PINGSEND_OUTPUT_PORTS, static_cast<FwAssertArgType>(entry));
+        const PingTracker& tracker = this->m_pingTrackerEntries[entry];
+        if (not tracker.awaiting) {
+            return 0;
+        }
+        if (Fw::Enabled::ENABLED != tracker.enabled) {
+            return tracker.frozenCycles;
+        }
+        return this->m_wheel.getTicks() - tracker.pingCycle;
+    }
+
+    void HealthImpl::scheduleEntry(U32 entry) {
+        FW_ASSERT(entry < this->m_numPingEntries, static_cast<FwAssertArgType>(entry));
+        const PingTracker& tracker = this->m_pingTrackerEntries[entry];
+        if (Fw::Enabled::ENABLED != tracker.enabled) {
+            this->m_wheel.cancel(entry);
+            return;
+        }
+
+        if (not tracker.awaiting) {
+            // ping on the next cycle, unless the last ping was sent less than a period ago
+            const I32 wait = static_cast<I32>(tracker.pingCycle + this->m_pingPeriod - this->m_wheel.getTicks());
+            this->m_wheel.schedule(entry, (wait > 0) ? static_cast<U32>(wait) : 0, 0);
+            return;
+        }
+
+        // cycle count of the outstanding ping on the next cycle. Thresholds already
+        // passed have been checked, and warnCycles <= fatalCycles
+        const U32 cycleCount = this->m_wheel.getTicks() - tracker.pingCycle;
+        U32 threshold = 0;
+        if (tracker.entry.warnCycles >= cycleCount) {
+            threshold = tracker.entry.warnCycles;
+        } else if (tracker.entry.fatalCycles >= cycleCount) {
+            threshold = tracker.entry.fatalCycles;
+        } else {
+            this->m_wheel.cancel(entry);
+            return;
+        }
+        // a threshold beyond the wheel is checked again when the longest delay expires
+        this->m_wheel.schedule(entry, FW_MIN(threshold - cycleCount, TimingWheel::MAX_DELAY), 0);
+    }
+
+    void HealthImpl::checkEntry(U32 entry, U32 cycle) {
+        PingTracker& tracker = this->m_pingTrackerEntries[entry];
+        if (not tracker.awaiting) {
+            // start a ping
+            tracker.key = this->m_key;
+            tracker.pingCycle = cycle;
+            tracker.awaiting = true;
+            tracker.pingTime = this->m_cycleTime;
+            // send ping
+            this->PingSend_out(static_cast<FwIndexType>(entry), tracker.key);
+            // increment key
+            this->m_key++;
+        } else {
+            const U32 cycleCount = cycle - tracker.pingCycle;
+            // check to see if it is at warning threshold
+            if (cycleCount == tracker.entry.warnCycles) {
+                Fw::LogStringArg _arg = tracker.entry.entryName;
+                this->log_WARNING_HI_HLTH_PING_WARN(_arg);
+                this->tlmWrite_PingLateWarnings(++this->m_warnings);
+            } else if (cycleCount == tracker.entry.fatalCycles) {
+                // check for FATAL timeout value
+                Fw::LogStringArg _arg = tracker.entry.entryName;
+                this->log_FATAL_HLTH_PING_LATE(_arg);
+            }
+        }
+        this->scheduleEntry(entry);
+    }
+
+    void HealthImpl::updateLatency(U32 entry, U32 latency) {
+        PingTracker& tracker = this->m_pingTrackerEntries[entry];
+
+        // find the bin: each bin is 2^SHIFT wider than the previous, last bin catches the rest
+        U32 bin = 0;
+        U32 bound = HEALTH_PING_LATENCY_BIN_BASE_USEC;
+        while ((bin < (HealthPingLatencyHistogram::SIZE - 1)) && (latency >= bound)) {
+            bound <<= HEALTH_PING_LATENCY_BIN_SHIFT;
+            bin++;
+        }
+        tracker.histogram[bin]++;
+
+        // queue the entry for its next report
+        if (not tracker.latencyQueued) {
+            tracker.latencyQueued = true;
+            this->m_latencyQueue[(this->m_latencyHead + this->m_latencyCount) % NUM_PINGSEND_OUTPUT_PORTS] = entry;
+            this->m_latencyCount++;
+        }
+    }
+
+    void HealthImpl::reportLatency() {
+        if (0 == this->m_latencyCount) {
+            return;
+        }
+        const U32 entry = this->m_latencyQueue[this->m_latencyHead];
+        this->m_latencyHead = (this->m_latencyHead + 1) % NUM_PINGSEND_OUTPUT_PORTS;
+        this->m_latencyCount--;
+
+        PingTracker& tracker = this->m_pingTrackerEntries[entry];
+        tracker.latencyQueued = false;
+        HealthPingLatencyHistogram histogram;
+        for (U32 bin = 0; bin < HealthPingLatencyHistogram::SIZE; bin++) {
+            histogram[bin] = tracker.histogram[bin];
+        }
+        this->tlmWrite_PingLatency(HealthPingLatency(entry, histogram));
+    }
+
 
 
 } // end namespace Svc
@@ -14,20 +14,26 @@
 #define Health_HPP
 
 #include <Svc/Health/HealthComponentAc.hpp>
+#include <Svc/TimingWheel/TimingWheel.hpp>
 #include <Fw/Types/String.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/RawTime.hpp>
+#include <HealthCfg.hpp>
 
 namespace Svc {
 
     //!  \class HealthImpl
     //!  \brief Health component implementation class
     //!
-    //!  The health component iterates through each entry
-    //!  in its table and checks its status. If a ping entry
-    //!  tracker is enabled, it will ping its corresponding port
-    //!  with a provided key. If a ping return is outstanding,
-    //!  a counter is decremented, and its value is checked
-    //!  against warning and fault thresholds. A watchdog is
-    //!  always stroked in the run handler.
+    //!  The health component keeps the next deadline of each
+    //!  entry in its table in a timing wheel. If a ping entry
+    //!  tracker is enabled and its ping is due, it will ping
+    //!  its corresponding port with a provided key. If a ping
+    //!  return is outstanding, the entry is only checked on the
+    //!  cycles it reaches its warning and fault thresholds. When
+    //!  enabled, the round trip latency of each entry is kept in
+    //!  a histogram.
+    //!  A watchdog is always stroked in the run handler.
 
     class HealthImpl: public HealthComponentBase {
 
@@ -65,12 +71,17 @@ namespace Svc {
 
             //! \brief Set ping entry tables
             //!
-            //! Provides a table of ping entries
+            //! Provides a table of ping entries. An entry is pinged again on the
+            //! cycle after its reply, but no sooner than pingPeriod cycles after
+            //! its previous ping. The first pings of the entries are spread evenly
+            //! over the first pingPeriod cycles.
             //!
             //!  \param pingEntries Pointer to provided ping table entries
             //!  \param numPingEntries Number of ping entries in table
             //!  \param watchDogCode Value that is sent to watchdog
-            void setPingEntries(PingEntry* pingEntries, NATIVE_INT_TYPE numPingEntries, U32 watchDogCode);
+            //!  \param pingPeriod Minimum number of cycles between pings of an entry
+            //!  \param pingLatency Whether to time the pings and report the latency histograms
+            void setPingEntries(PingEntry* pingEntries, NATIVE_INT_TYPE numPingEntries, U32 watchDogCode, U32 pingPeriod = 1, bool pingLatency = false);
 
             //!  \brief Component destructor
             //!
@@ -94,6 +105,16 @@ namespace Svc {
             //!  \param key Key value
             void PingReturn_handler(const NATIVE_INT_TYPE portNum, U32 key);
 
+            //!  \brief ping return pre-message hook
+            //!
+            //!  Stamps the time of the ping return on the thread of the
+            //!  returning component, before the return waits in the queue,
+            //!  when ping latency is measured
+            //!
+            //!  \param portNum Port number
+            //!  \param key Key value
+            void PingReturn_preMsgHook(const NATIVE_INT_TYPE portNum, U32 key);
+
             //!  \brief run handler
             //!
             //!  Handler implementation for run
@@ -137,14 +158,59 @@ namespace Svc {
             //!  Array for storing ping table entries
             struct PingTracker {
                 PingEntry entry; //!< entry passed by user
-                U32 cycleCount; //!< current cycle count
+                U32 pingCycle; //!< cycle the last ping was sent on
+                U32 frozenCycles; //!< cycle count of the outstanding ping while the entry is disabled
                 U32 key; //!< key passed to ping
+                bool awaiting; //!< if a ping return is outstanding
                 Fw::Enabled::t enabled; //!< if current ping result is checked
+                Os::RawTime pingTime; //!< time the outstanding ping was sent
+                Os::RawTime returnTime; //!< time the last ping return was queued, guarded by m_returnLock
+                U32 histogram[HealthPingLatencyHistogram::SIZE]; //!< round trip latency histogram
+                bool latencyQueued; //!< if the entry is waiting in the latency report queue
             } m_pingTrackerEntries[NUM_PINGSEND_OUTPUT_PORTS];
 
             NATIVE_INT_TYPE findEntry(const Fw::CmdStringArg& entry);
 
+            //!  \brief get the cycle count of an entry
+            //!
+            //!  \param entry Ping entry number
+            //!  \return number of checked cycles since the outstanding ping was sent, 0 when no ping is outstanding
+            U32 getCycleCount(U32 entry) const;
+
+            //!  \brief schedule the next deadline of an entry
+            //!
+            //!  The deadline is the next ping when no ping is outstanding, else the
+            //!  next of the warning and fatal thresholds. Disabled entries and entries
+            //!  past both thresholds are not scheduled.
+            //!
+            //!  \param entry Ping entry number
+            void scheduleEntry(U32 entry);
+
+            //!  \brief handle the deadline of an entry
+            //!
+            //!  \param entry Ping entry number
+            //!  \param cycle the cycle being run
+            void checkEntry(U32 entry, U32 cycle);
+
+            //!  \brief add a round trip latency to the histogram of an entry
+            //!
+            //!  \param entry Ping entry number
+            //!  \param latency round trip latency in microseconds
+            void updateLatency(U32 entry, U32 latency);
+
+            //!  \brief report the latency histogram of the entry that has waited longest
+            void reportLatency();
+
             //!  Private member data
+            TimingWheel m_wheel; //!< deadlines of the ping entries, one tick per enabled cycle
+            TimingWheel::Entry m_wheelEntries[NUM_PINGSEND_OUTPUT_PORTS]; //!< timing wheel storage
+            U32 m_latencyQueue[NUM_PINGSEND_OUTPUT_PORTS]; //!< entries with histogram updates to report
+            U32 m_latencyHead; //!< oldest entry in the latency report queue
+            U32 m_latencyCount; //!< number of entries in the latency report queue
+            U32 m_pingPeriod; //!< minimum number of cycles between pings of an entry
+            bool m_pingLatency; //!< if ping round trip latencies are measured
+            Os::Mutex m_returnLock; //!< guards the return times, stamped on the threads of the returning components
+            Os::RawTime m_cycleTime; //!< time of the first ping of the current cycle
             U32 m_numPingEntries; //!< stores number of entries passed to constructor
             U32 m_key; //!< current key value. Just increments for each ping entry.
             U32 m_watchDogCode; //!< stores code used for watchdog stroking
@@ -51,8 +51,11 @@ namespace Svc {
         U32 key
     )
   {
+    this->pingCounts[portNum]++;
     if(this->override) {
         invoke_to_PingReturn(portNum,this->override_key);
+    } else if (this->echo) {
+        this->invoke_to_PingReturn(portNum, key);
     } else {
 
         ASSERT_TRUE(portNum < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS);
@@ -177,9 +180,11 @@ namespace Svc {
     this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode);
     this->override = false;
     this->override_key = 0;
+    this->echo = false;
 
     for (U32 i = 0; i < this->numPingEntries; i++) {
         this->keys[i] = 100000;
+        this->pingCounts[i] = 0;
     }
   }
 
@@ -249,7 +254,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_UINT_TYPE port = 0; port < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; port++) {
-              ASSERT_EQ(i+1,this->component.m_pingTrackerEntries[port].cycleCount);
+              ASSERT_EQ(i+1,this->component.getCycleCount(port));
           }
       }
 
@@ -283,7 +288,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_UINT_TYPE port = 0; port < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; port++) {
-              ASSERT_EQ(i+1,this->component.m_pingTrackerEntries[port].cycleCount);
+              ASSERT_EQ(i+1,this->component.getCycleCount(port));
           }
       }
 
@@ -305,7 +310,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_UINT_TYPE port = 0; port < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; port++) {
-              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+i+1,this->component.m_pingTrackerEntries[port].cycleCount);
+              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+i+1,this->component.getCycleCount(port));
           }
       }
       this->invoke_to_Run(0,0);
@@ -338,7 +343,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_INT_TYPE entry = 0; entry < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; entry++) {
-              ASSERT_EQ(i+1,this->component.m_pingTrackerEntries[entry].cycleCount);
+              ASSERT_EQ(i+1,this->component.getCycleCount(entry));
           }
       }
 
@@ -371,7 +376,7 @@ namespace Svc {
           // cycle count should stay the same
 
           ASSERT_EQ(static_cast<U32>(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS)*2,
-                  this->component.m_pingTrackerEntries[0].cycleCount);
+                  this->component.getCycleCount(0));
       }
 
       //confirm no telemetry was received
@@ -396,7 +401,7 @@ namespace Svc {
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; i++) {
           this->invoke_to_Run(0,0);
           for (NATIVE_INT_TYPE entry = 0; entry < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; entry++) {
-              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+1+i,this->component.m_pingTrackerEntries[entry].cycleCount);
+              ASSERT_EQ(Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2+1+i,this->component.getCycleCount(entry));
           }
       }
       this->invoke_to_Run(0,0);
@@ -430,9 +435,7 @@ namespace Svc {
           this->clearEvents();
           this->clearHistory();
           // reset cycle count
-          for (NATIVE_INT_TYPE e2 = 0; e2 < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; e2++) {
-              this->component.m_pingTrackerEntries[e2].cycleCount = 0;
-          }
+          this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode);
           // disable entry
           char name[80];
           snprintf(name, sizeof(name), "task%d",entry);
@@ -455,10 +458,10 @@ namespace Svc {
               for (NATIVE_INT_TYPE e3 = 0; e3 < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS; e3++) {
                   if (e3 == entry) {
                       // shouldn't be counting up
-                      ASSERT_EQ(0u,this->component.m_pingTrackerEntries[e3].cycleCount);
+                      ASSERT_EQ(0u,this->component.getCycleCount(e3));
                   } else {
                       // others should be counting up
-                      ASSERT_EQ(static_cast<U32>(cycle+1),this->component.m_pingTrackerEntries[e3].cycleCount);
+                      ASSERT_EQ(static_cast<U32>(cycle+1),this->component.getCycleCount(e3));
                   }
               }
           }
@@ -663,6 +666,21 @@ namespace Svc {
       this->clearEvents();
       this->clearTlm();
 
+      //return a ping on a port without a ping entry
+      const NATIVE_INT_TYPE unknownPort = Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS - 1;
+      this->component.setPingEntries(this->pingEntries, this->numPingEntries - 1, this->watchDogCode, 1, true);
+      this->invoke_to_PingReturn(unknownPort, FLAG_KEY_VALUE);
+      this->dispatchAll();
+
+      ASSERT_EVENTS_SIZE(1);
+      ASSERT_EVENTS_HLTH_PING_UNKNOWN_PORT_SIZE(1);
+      ASSERT_EVENTS_HLTH_PING_UNKNOWN_PORT(0,unknownPort,FLAG_KEY_VALUE);
+      ASSERT_TLM_SIZE(0);
+
+      this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode);
+      this->clearEvents();
+      this->clearTlm();
+
       COMMENT("Case 2: Command input anomalies.");
 
       //Check no events or telemetry have occurred
@@ -726,9 +744,7 @@ namespace Svc {
       this->component.m_key = 0;
 
       //reset cycle counts
-      for (U32 i = 0; i < this->numPingEntries; i++) {
-          this->component.m_pingTrackerEntries[i].cycleCount = 0;
-      }
+      this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode);
 
       //invoke schedIn handler
       for (U32 i = 0; i < Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS*2; i++) {
@@ -756,6 +772,139 @@ namespace Svc {
 
   }
 
+  void HealthTester ::
+  staggeredPings()
+  {
+      TEST_CASE(900.1.11,"Staggered pings");
+      COMMENT("Pings are spread over the ping period and sent once per period while entries reply.");
+
+      const U32 period = 5;
+      const U32 entries = Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS;
+      this->echo = true;
+      this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode, period);
+
+      for (U32 cycle = 0; cycle < period*4; cycle++) {
+          this->clearFromPortHistory();
+          this->invoke_to_Run(0,0);
+          // only the entries whose ping is due are pinged
+          ASSERT_from_PingSend_SIZE(entries/period + (((entries % period) > (cycle % period)) ? 1 : 0));
+          for (U32 entry = 0; entry < entries; entry++) {
+              const U32 offset = (entry * period) / entries;
+              const U32 expected = (cycle >= offset) ? ((cycle - offset) / period + 1) : 0;
+              ASSERT_EQ(expected, this->pingCounts[entry]);
+              // replies are received on the next cycle
+              ASSERT_EQ((offset == (cycle % period)) ? 1u : 0u, this->component.getCycleCount(entry));
+          }
+      }
+
+      ASSERT_EVENTS_SIZE(0);
+      ASSERT_TLM_PingLateWarnings_SIZE(0);
+
+      COMMENT("A late reply is pinged again on the next cycle.");
+      this->echo = false;
+      this->clearHistory();
+      for (U32 cycle = 0; cycle < period*2; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      ASSERT_EQ(period*2, this->component.getCycleCount(0));
+      ASSERT_EQ(5u, this->pingCounts[0]);
+      this->echo = true;
+      this->invoke_to_PingReturn(0, this->component.m_pingTrackerEntries[0].key);
+      this->invoke_to_Run(0,0);
+      ASSERT_EQ(6u, this->pingCounts[0]);
+      ASSERT_EQ(1u, this->component.getCycleCount(0));
+  }
+
+  void HealthTester ::
+  latencyTlm()
+  {
+      TEST_CASE(900.1.12,"Ping latency telemetry");
+      COMMENT("The latency histogram of each replying entry is reported in turn.");
+
+      const U32 entries = Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS;
+      this->echo = true;
+      this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode, 1, true);
+
+      // the first cycle only sends pings
+      this->invoke_to_Run(0,0);
+      ASSERT_TLM_PingLatency_SIZE(0);
+
+      for (U32 cycle = 0; cycle < entries*2; cycle++) {
+          this->invoke_to_Run(0,0);
+          ASSERT_TLM_PingLatency_SIZE(cycle + 1);
+          const HealthPingLatency& latency = this->tlmHistory_PingLatency->at(cycle).arg;
+          ASSERT_EQ(cycle % entries, latency.getentry());
+          // each entry replies once per cycle
+          U32 replies = 0;
+          for (U32 bin = 0; bin < HealthPingLatencyHistogram::SIZE; bin++) {
+              replies += latency.gethistogram()[bin];
+          }
+          ASSERT_EQ(cycle + 1, replies);
+      }
+
+      // no reports without new replies once the queued reports are sent
+      this->echo = false;
+      for (U32 cycle = 0; cycle < entries + 1; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      this->clearTlm();
+      for (U32 cycle = 0; cycle < entries; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      ASSERT_TLM_PingLatency_SIZE(0);
+
+      COMMENT("Without latency measurement no histograms are reported.");
+      this->echo = true;
+      this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode);
+      this->clearHistory();
+      for (U32 cycle = 0; cycle < entries*2; cycle++) {
+          this->invoke_to_Run(0,0);
+      }
+      ASSERT_TLM_PingLatency_SIZE(0);
+      ASSERT_EVENTS_SIZE(0);
+      for (U32 entry = 0; entry < entries; entry++) {
+          ASSERT_EQ(1u, this->component.getCycleCount(entry));
+      }
+  }
+
+  void HealthTester ::
+  runTime()
+  {
+      COMMENT("Run handler time with every entry awaiting a distant threshold, and with every entry replying.");
+
+      const U32 entries = Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS;
+      const U32 cycles = 100000;
+      const U32 blockCycles = 1000;
+      for (U32 entry = 0; entry < entries; entry++) {
+          this->pingEntries[entry].warnCycles = cycles*2;
+          this->pingEntries[entry].fatalCycles = cycles*3;
+      }
+      const char* const names[] = {"awaiting", "replying", "replying, latency", "replying, period 10"};
+      const U32 periods[] = {1, 1, 1, 10};
+      const bool latencies[] = {false, false, true, false};
+      for (U32 mode = 0; mode < FW_NUM_ARRAY_ELEMENTS(names); mode++) {
+          this->echo = (mode > 0);
+          this->component.setPingEntries(this->pingEntries, this->numPingEntries, this->watchDogCode, periods[mode],
+                                         latencies[mode]);
+          U64 total = 0;
+          for (U32 block = 0; block < cycles/blockCycles; block++) {
+              this->clearHistory();
+              Os::RawTime start;
+              Os::RawTime end;
+              (void) start.now();
+              for (U32 cycle = 0; cycle < blockCycles; cycle++) {
+                  this->invoke_to_Run(0,0);
+              }
+              (void) end.now();
+              U32 interval = 0;
+              (void) end.getDiffUsec(start, interval);
+              total += interval;
+          }
+          printf("%-20s mean %6.2f us per cycle for %u entries\n", names[mode],
+                 static_cast<double>(total) / cycles, entries);
+      }
+  }
+
   void HealthTester::textLogIn(const FwEventIdType id, //!< The event ID
           const Fw::Time& timeTag, //!< The time
           const Fw::LogSeverity severity, //!< The severity
@@ -52,6 +52,9 @@ namespace Svc {
       void nominalCmd();
       void nominal2CmdsDuringTlm();
       void miscellaneous();
+      void staggeredPings();
+      void latencyTlm();
+      void runTime();
 
     private:
 
@@ -101,6 +104,8 @@ namespace Svc {
       U32 keys[Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS];
       bool override;
       U32 override_key;
+      bool echo; //!< return every ping with its key
+      U32 pingCounts[Svc::HealthComponentBase::NUM_PINGSEND_OUTPUT_PORTS];
 
       //! The component under test
       //!
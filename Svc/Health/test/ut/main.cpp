@@ -54,6 +54,21 @@ TEST(Test, Miscellaneous) {
   tester.miscellaneous();
 }
 
+TEST(Test, StaggeredPings) {
+  Svc::HealthTester tester;
+  tester.staggeredPings();
+}
+
+TEST(Test, LatencyTlm) {
+  Svc::HealthTester tester;
+  tester.latencyTlm();
+}
+
+TEST(Benchmark, DISABLED_RunTime) {
+  Svc::HealthTester tester;
+  tester.runTime();
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
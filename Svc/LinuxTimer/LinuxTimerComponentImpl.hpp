@@ -14,6 +14,7 @@
 #define LinuxTimer_HPP
 
 #include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
 #include "Svc/LinuxTimer/LinuxTimerComponentAc.hpp"
 
 namespace Svc {
@@ -38,6 +39,15 @@ namespace Svc {
       //!
       ~LinuxTimerComponentImpl();
 
+      //! Configure the scheduling of the thread that calls startTimer
+      //!
+      //! The settings are applied to the calling thread when startTimer is called. A priority
+      //! selects a real-time FIFO policy. Os::Task::TASK_DEFAULT leaves a setting unchanged.
+      void configure(
+          const Os::Task::ParamType priority, //!< real-time priority of the timer thread
+          const Os::Task::ParamType cpuAffinity = Os::Task::TASK_DEFAULT //!< CPU to pin the timer thread to
+      );
+
       //! Start timer
       void startTimer(NATIVE_INT_TYPE interval); //!< interval in milliseconds
 
@@ -46,12 +56,32 @@ namespace Svc {
 
     PRIVATE:
 
+      //! Apply the configured priority and affinity to the calling thread
+      void applyThreadProperties();
+
+      //! Record the statistics of one timer wakeup and write telemetry when the period elapses
+      void recordTick(
+          U32 missed, //!< number of expirations that passed without a cycle
+          U32 lateness, //!< lateness of the wakeup past its deadline in microseconds
+          NATIVE_INT_TYPE interval //!< timer interval in milliseconds
+      );
+
       Os::Mutex m_mutex; //!< mutex for quit flag
 
       volatile bool m_quit; //!< flag to quit
 
       Os::RawTime m_rawTime; //!< timestamp to pass to CycleOut port calls
 
+      Os::Task::ParamType m_priority; //!< priority of the timer thread
+      Os::Task::ParamType m_cpuAffinity; //!< CPU affinity of the timer thread
+
+      U32 m_missedTicks; //!< total expirations that passed without a cycle
+      U32 m_maxLateness; //!< maximum wakeup lateness in microseconds
+      U64 m_latenessTotal; //!< sum of wakeup lateness in the current telemetry period
+      U32 m_latenessCount; //!< number of wakeups in the current telemetry period
+      U32 m_tlmElapsed; //!< milliseconds elapsed in the current telemetry period
+      U32 m_histogram[LinuxTimerLatenessHistogram::SIZE]; //!< wakeup lateness histogram
+
 
     };
 
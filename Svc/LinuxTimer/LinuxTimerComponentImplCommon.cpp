@@ -13,6 +13,7 @@
 
 #include <Svc/LinuxTimer/LinuxTimerComponentImpl.hpp>
 #include <FpConfig.hpp>
+#include <LinuxTimerCfg.hpp>
 
 namespace Svc {
 
@@ -24,9 +25,18 @@ namespace Svc {
     LinuxTimerComponentImpl(
         const char *const compName
     ) : LinuxTimerComponentBase(compName),
-        m_quit(false)
+        m_quit(false),
+        m_priority(Os::Task::TASK_DEFAULT),
+        m_cpuAffinity(Os::Task::TASK_DEFAULT),
+        m_missedTicks(0),
+        m_maxLateness(0),
+        m_latenessTotal(0),
+        m_latenessCount(0),
+        m_tlmElapsed(0)
   {
-
+      for (U32 bin = 0; bin < LinuxTimerLatenessHistogram::SIZE; bin++) {
+          this->m_histogram[bin] = 0;
+      }
   }
 
   LinuxTimerComponentImpl ::
@@ -35,6 +45,45 @@ namespace Svc {
 
   }
 
+  void LinuxTimerComponentImpl::configure(const Os::Task::ParamType priority, const Os::Task::ParamType cpuAffinity) {
+      this->m_priority = priority;
+      this->m_cpuAffinity = cpuAffinity;
+  }
+
+  void LinuxTimerComponentImpl::recordTick(U32 missed, U32 lateness, NATIVE_INT_TYPE interval) {
+      this->m_missedTicks += missed;
+      if (lateness > this->m_maxLateness) {
+          this->m_maxLateness = lateness;
+      }
+      this->m_latenessTotal += lateness;
+      this->m_latenessCount++;
+
+      // find the bin: each bin is 2^SHIFT wider than the previous, last bin catches the rest
+      U32 bin = 0;
+      U32 bound = LINUX_TIMER_LATENESS_BIN_BASE_USEC;
+      while ((bin < (LinuxTimerLatenessHistogram::SIZE - 1)) && (lateness >= bound)) {
+          bound <<= LINUX_TIMER_LATENESS_BIN_SHIFT;
+          bin++;
+      }
+      this->m_histogram[bin]++;
+
+      // write telemetry once per period rather than on every tick
+      this->m_tlmElapsed += static_cast<U32>(interval) * (missed + 1);
+      if (this->m_tlmElapsed >= LINUX_TIMER_TLM_PERIOD_MS) {
+          LinuxTimerLatenessHistogram histogram;
+          for (U32 entry = 0; entry < LinuxTimerLatenessHistogram::SIZE; entry++) {
+              histogram[entry] = this->m_histogram[entry];
+          }
+          this->tlmWrite_MissedTicks(this->m_missedTicks);
+          this->tlmWrite_MaxLateness(this->m_maxLateness);
+          this->tlmWrite_MeanLateness(static_cast<U32>(this->m_latenessTotal / this->m_latenessCount));
+          this->tlmWrite_LatenessHistogram(histogram);
+          this->m_latenessTotal = 0;
+          this->m_latenessCount = 0;
+          this->m_tlmElapsed = 0;
+      }
+  }
+
   void LinuxTimerComponentImpl::quit() {
       this->m_mutex.lock();
       this->m_quit = true;
@@ -14,12 +14,29 @@
 #include <Svc/LinuxTimer/LinuxTimerComponentImpl.hpp>
 #include <FpConfig.hpp>
 #include <Os/Task.hpp>
+#include <Fw/Logger/Logger.hpp>
 
 namespace Svc {
 
+  void LinuxTimerComponentImpl::applyThreadProperties() {
+      if ((this->m_priority != Os::Task::TASK_DEFAULT) || (this->m_cpuAffinity != Os::Task::TASK_DEFAULT)) {
+          Fw::Logger::log("[WARNING] timer priority and CPU affinity are not supported on this platform\n");
+      }
+  }
+
   void LinuxTimerComponentImpl::startTimer(NATIVE_INT_TYPE interval) {
+      const I64 intervalUsec = static_cast<I64>(interval) * 1000;
+      // how far the actual wakeup lags the ideal deadline. Each delay is shortened by this amount
+      // so that time spent sleeping and handling a tick does not accumulate as drift.
+      I64 offset = 0;
+      Os::RawTime previous;
+
+      this->applyThreadProperties();
+      previous.now();
+
       while (true) {
-          Os::Task::delay(Fw::TimeInterval(static_cast<U32>(interval/1000), static_cast<U32>((interval % 1000) * 1000)));
+          const I64 sleepUsec = (offset < intervalUsec) ? (intervalUsec - offset) : 0;
+          Os::Task::delay(Fw::TimeInterval(static_cast<U32>(sleepUsec / 1000000), static_cast<U32>(sleepUsec % 1000000)));
           this->m_mutex.lock();
           bool quit = this->m_quit;
           this->m_mutex.unLock();
@@ -27,7 +44,22 @@ namespace Svc {
               return;
           }
           this->m_rawTime.now();
+          U32 elapsed;
+          // Cast to void as the only possible error is overflow, which caps elapsed
+          (void) this->m_rawTime.getDiffUsec(previous, elapsed);
+          previous = this->m_rawTime;
+
+          offset += static_cast<I64>(elapsed) - intervalUsec;
+          U32 missed = 0;
+          if (offset >= intervalUsec) {
+              // whole intervals were skipped, move the deadline past them
+              missed = static_cast<U32>(offset / intervalUsec);
+              offset -= static_cast<I64>(missed) * intervalUsec;
+          }
+          const U32 lateness = (offset > 0) ? static_cast<U32>(offset) : 0;
+
           this->CycleOut_out(0,this->m_rawTime);
+          this->recordTick(missed, lateness, interval);
       }
   }
 
@@ -14,32 +14,83 @@
 #include <Svc/LinuxTimer/LinuxTimerComponentImpl.hpp>
 #include <FpConfig.hpp>
 #include <sys/timerfd.h>
+#include <pthread.h>
+#include <sched.h>
+#include <ctime>
 #include <unistd.h>
 #include <cerrno>
 #include <cstring>
 
 namespace Svc {
 
+  namespace {
+      const U64 NSEC_PER_SEC = 1000000000ULL;
+
+      U64 toNsec(const struct timespec& spec) {
+          return static_cast<U64>(spec.tv_sec) * NSEC_PER_SEC + static_cast<U64>(spec.tv_nsec);
+      }
+
+      struct timespec fromNsec(U64 nsec) {
+          struct timespec spec;
+          spec.tv_sec = static_cast<time_t>(nsec / NSEC_PER_SEC);
+          spec.tv_nsec = static_cast<long>(nsec % NSEC_PER_SEC);
+          return spec;
+      }
+  }
+
+  void LinuxTimerComponentImpl::applyThreadProperties() {
+      if (this->m_priority != Os::Task::TASK_DEFAULT) {
+          sched_param schedParam;
+          memset(&schedParam, 0, sizeof(sched_param));
+          schedParam.sched_priority = static_cast<int>(this->m_priority);
+          int status = pthread_setschedparam(pthread_self(), SCHED_FIFO, &schedParam);
+          if (status != 0) {
+              Fw::Logger::log("[WARNING] timer priority not set: %s\n", strerror(status));
+          }
+      }
+      if (this->m_cpuAffinity != Os::Task::TASK_DEFAULT) {
+// Feature set check for _GNU_SOURCE before using GNU only features
+#ifdef _GNU_SOURCE
+          cpu_set_t cpu_set;
+          CPU_ZERO(&cpu_set);
+          CPU_SET(static_cast<int>(this->m_cpuAffinity), &cpu_set);
+          int status = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+          if (status != 0) {
+              Fw::Logger::log("[WARNING] timer CPU affinity not set: %s\n", strerror(status));
+          }
+#else
+          Fw::Logger::log("[WARNING] setting timer CPU affinity is only available with GNU pthreads\n");
+#endif
+      }
+  }
+
   void LinuxTimerComponentImpl::startTimer(NATIVE_INT_TYPE interval) {
       int fd;
       struct itimerspec itval;
+      struct timespec now;
+      const U64 intervalNsec = static_cast<U64>(interval) * 1000000;
+
+      this->applyThreadProperties();
 
       /* Create the timer */
       fd = timerfd_create (CLOCK_MONOTONIC, 0);
 
-      itval.it_interval.tv_sec = interval/1000;
-      itval.it_interval.tv_nsec = (interval*1000000)%1000000000;
-      itval.it_value.tv_sec = interval/1000;
-      itval.it_value.tv_nsec = (interval*1000000)%1000000000;
+      // Arm the timer with an absolute first deadline. Later deadlines are kept by the kernel
+      // relative to that one, so time spent handling a tick does not accumulate as drift.
+      clock_gettime(CLOCK_MONOTONIC, &now);
+      U64 deadline = toNsec(now) + intervalNsec;
+      itval.it_interval = fromNsec(intervalNsec);
+      itval.it_value = fromNsec(deadline);
 
-      timerfd_settime (fd, 0, &itval, nullptr);
+      timerfd_settime (fd, TFD_TIMER_ABSTIME, &itval, nullptr);
 
       while (true) {
-          unsigned long long missed;
-          int ret = static_cast<int>(read (fd, &missed, sizeof (missed)));
+          unsigned long long expirations = 0;
+          int ret = static_cast<int>(read (fd, &expirations, sizeof (expirations)));
           if (-1 == ret) {
               Fw::Logger::log("timer read error: %s\n", strerror(errno));
           }
+          clock_gettime(CLOCK_MONOTONIC, &now);
           this->m_mutex.lock();
           bool quit = this->m_quit;
           this->m_mutex.unLock();
@@ -50,10 +101,23 @@ namespace Svc {
               itval.it_value.tv_nsec = 0;
 
               timerfd_settime (fd, 0, &itval, nullptr);
+              (void) close(fd);
               return;
           }
           this->m_rawTime.now();
           this->CycleOut_out(0,this->m_rawTime);
+
+          // a failed read still emits a cycle, but consumed no expiration, so the
+          // deadline and the statistics are left for the next successful read
+          if (expirations > 0) {
+              const U32 missed = static_cast<U32>(expirations - 1);
+              // deadline of the most recent expiration
+              deadline += static_cast<U64>(missed) * intervalNsec;
+              const U64 wakeup = toNsec(now);
+              const U32 lateness = (wakeup > deadline) ? static_cast<U32>((wakeup - deadline) / 1000) : 0;
+              this->recordTick(missed, lateness, interval);
+              deadline += intervalNsec;
+          }
       }
   }
 
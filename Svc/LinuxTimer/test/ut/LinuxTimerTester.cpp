@@ -11,6 +11,7 @@
 // ======================================================================
 
 #include "LinuxTimerTester.hpp"
+#include <cstdio>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
@@ -26,6 +27,7 @@ namespace Svc {
       LinuxTimerGTestBase("Tester", MAX_HISTORY_SIZE),
       component("LinuxTimer")
       ,m_numCalls(0)
+      ,m_discardTlm(false)
   {
     this->initComponents();
     this->connectPorts();
@@ -46,6 +48,37 @@ namespace Svc {
   {
     this->m_numCalls = 5;
     this->component.startTimer(1000);
+
+    // one telemetry period per tick at this interval
+    ASSERT_TLM_LatenessHistogram_SIZE(5);
+    ASSERT_TLM_MeanLateness_SIZE(5);
+    ASSERT_EQ(this->component.m_missedTicks, 0u);
+    U32 total = 0;
+    for (U32 bin = 0; bin < LinuxTimerLatenessHistogram::SIZE; bin++) {
+        total += this->tlmHistory_LatenessHistogram->at(4).arg[bin];
+    }
+    ASSERT_EQ(total, 5u);
+  }
+
+  void LinuxTimerTester ::
+      runJitterBenchmark(NATIVE_INT_TYPE interval, NATIVE_INT_TYPE cycles)
+  {
+    this->m_numCalls = cycles;
+    this->m_discardTlm = true;
+    this->component.startTimer(interval);
+
+    printf("Ticks: %d at %d ms\n", cycles, interval);
+    printf("Missed ticks: %u\n", this->component.m_missedTicks);
+    printf("Max lateness: %u us\n", this->component.m_maxLateness);
+    U32 bound = LINUX_TIMER_LATENESS_BIN_BASE_USEC;
+    for (U32 bin = 0; bin < LinuxTimerLatenessHistogram::SIZE; bin++) {
+        if (bin < (LinuxTimerLatenessHistogram::SIZE - 1)) {
+            printf("  < %6u us: %u\n", bound, this->component.m_histogram[bin]);
+        } else {
+            printf("  >= %5u us: %u\n", bound >> LINUX_TIMER_LATENESS_BIN_SHIFT, this->component.m_histogram[bin]);
+        }
+        bound <<= LINUX_TIMER_LATENESS_BIN_SHIFT;
+    }
   }
 
   // ----------------------------------------------------------------------
@@ -58,7 +91,10 @@ namespace Svc {
         Os::RawTime &cycleStart
     )
   {
-      printf("TICK\n");
+      // long runs would overflow the telemetry history
+      if (this->m_discardTlm) {
+          this->clearTlm();
+      }
 
       if (--this->m_numCalls == 0) {
           this->component.quit();
@@ -79,6 +115,18 @@ namespace Svc {
         this->get_from_CycleOut(0)
     );
 
+    // Time
+    this->component.set_Time_OutputPort(
+        0,
+        this->get_from_Time(0)
+    );
+
+    // Tlm
+    this->component.set_Tlm_OutputPort(
+        0,
+        this->get_from_Tlm(0)
+    );
+
 
 
 
@@ -15,6 +15,7 @@
 
 #include "LinuxTimerGTestBase.hpp"
 #include "Svc/LinuxTimer/LinuxTimerComponentImpl.hpp"
+#include <LinuxTimerCfg.hpp>
 
 namespace Svc {
 
@@ -46,6 +47,9 @@ namespace Svc {
       //!
       void runCycles();
 
+      //! Run the timer for a number of cycles and print the wakeup lateness statistics
+      void runJitterBenchmark(NATIVE_INT_TYPE interval, NATIVE_INT_TYPE cycles);
+
     private:
 
       // ----------------------------------------------------------------------
@@ -85,6 +89,8 @@ namespace Svc {
 
       NATIVE_INT_TYPE m_numCalls;
 
+      bool m_discardTlm; //!< drop telemetry history on each cycle
+
   };
 
 } // end namespace Svc
@@ -11,6 +11,12 @@ TEST(Nominal, InitTest) {
     tester.runCycles();
 }
 
+// Jitter benchmark at 1 kHz for 10 minutes, run with --gtest_also_run_disabled_tests
+TEST(Benchmark, DISABLED_Jitter1kHz) {
+    Svc::LinuxTimerTester tester;
+    tester.runJitterBenchmark(1, 600000);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
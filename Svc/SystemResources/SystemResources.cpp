@@ -98,10 +98,14 @@ void SystemResources::Cpu() {
     U32 count = 0;
     F32 cpuAvg = 0;
 
-    for (U32 i = 0; i < m_cpu_count && i < CPU_COUNT; i++) {
-        Os::Cpu::Status status = Os::Cpu::getTicks(m_cpu[i], i);
-        // Best-effort calculations and telemetry
-        if (status == Os::Generic::OP_OK) {
+    // A single sample of all CPUs per cycle
+    FwSizeType sampled = 0;
+    if (Os::Cpu::getAllTicks(m_cpu, CPU_COUNT, sampled) != Os::Generic::OP_OK) {
+        sampled = 0;
+    }
+    for (U32 i = 0; i < m_cpu_count && i < CPU_COUNT && i < sampled; i++) {
+        // Best-effort calculations and telemetry, offline CPUs have no ticks
+        if (m_cpu[i].total != 0) {
             F32 cpuUtil = compCpuUtil(m_cpu[i], m_cpu_prev[i]);
             cpuAvg += cpuUtil;
 
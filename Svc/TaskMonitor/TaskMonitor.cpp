@@ -0,0 +1,226 @@
+// ======================================================================
+// \title  TaskMonitor.cpp
+// \brief  cpp file for TaskMonitor component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/TaskMonitor/TaskMonitor.hpp>
+#include <Fw/Types/Assert.hpp>
+#include <cstring>
+
+namespace Svc {
+
+TaskMonitor::TaskMonitor(const char* compName)
+    : TaskMonitorComponentBase(compName),
+      m_queueCount(0),
+      m_dropped(0),
+      m_hasLastRun(false),
+      m_reportTasks(false) {
+    for (U32 entry = 0; entry < TASK_MONITOR_MAX_TASKS; entry++) {
+        this->m_tasks[entry].task = nullptr;
+        this->m_tasks[entry].queue = nullptr;
+        this->m_tasks[entry].sampled = false;
+    }
+    for (U32 queue = 0; queue < TASK_MONITOR_MAX_QUEUES; queue++) {
+        this->m_queues[queue] = nullptr;
+    }
+}
+
+TaskMonitor::~TaskMonitor() {
+    // leave registries set by others in place
+    if (Os::Task::getTaskRegistry() == this) {
+        Os::Task::registerTaskRegistry(nullptr);
+    }
+#if FW_QUEUE_REGISTRATION
+    if (Os::Queue::getRegistry() == this) {
+        Os::Queue::setRegistry(nullptr);
+    }
+#endif
+}
+
+void TaskMonitor::registerRegistries() {
+    Os::Task::registerTaskRegistry(this);
+#if FW_QUEUE_REGISTRATION
+    Os::Queue::setRegistry(this);
+#endif
+}
+
+void TaskMonitor::addTask(Os::Task* task) {
+    FW_ASSERT(task != nullptr);
+    Os::ScopeLock lock(this->m_lock);
+    for (U32 entry = 0; entry < TASK_MONITOR_MAX_TASKS; entry++) {
+        TaskEntry& free = this->m_tasks[entry];
+        if (free.task == nullptr) {
+            free.task = task;
+            free.queue = this->findQueue(*task);
+            free.sampled = false;
+            return;
+        }
+    }
+    this->m_dropped++;
+}
+
+void TaskMonitor::removeTask(Os::Task* task) {
+    Os::ScopeLock lock(this->m_lock);
+    for (U32 entry = 0; entry < TASK_MONITOR_MAX_TASKS; entry++) {
+        if (this->m_tasks[entry].task == task) {
+            this->m_tasks[entry].task = nullptr;
+            this->m_tasks[entry].queue = nullptr;
+            this->m_tasks[entry].sampled = false;
+        }
+    }
+}
+
+void TaskMonitor::registerQueue(Os::Queue* queue) {
+    FW_ASSERT(queue != nullptr);
+    Os::ScopeLock lock(this->m_lock);
+    if (this->m_queueCount < TASK_MONITOR_MAX_QUEUES) {
+        this->m_queues[this->m_queueCount++] = queue;
+    }
+    // queues are normally created before their task is started, handle the other order as well
+    for (U32 entry = 0; entry < TASK_MONITOR_MAX_TASKS; entry++) {
+        TaskEntry& monitored = this->m_tasks[entry];
+        if ((monitored.task != nullptr) && (monitored.queue == nullptr) &&
+            (monitored.task->getName() == queue->getName())) {
+            monitored.queue = queue;
+        }
+    }
+}
+
+void TaskMonitor::removeQueue(Os::Queue* queue) {
+    Os::ScopeLock lock(this->m_lock);
+    for (U32 index = 0; index < this->m_queueCount; index++) {
+        if (this->m_queues[index] == queue) {
+            this->m_queues[index] = this->m_queues[--this->m_queueCount];
+            this->m_queues[this->m_queueCount] = nullptr;
+            break;
+        }
+    }
+    for (U32 entry = 0; entry < TASK_MONITOR_MAX_TASKS; entry++) {
+        TaskEntry& monitored = this->m_tasks[entry];
+        if (monitored.queue == queue) {
+            // the dispatch count restarts with the next queue of the task
+            monitored.queue = nullptr;
+            monitored.sampled = false;
+        }
+    }
+}
+
+Os::Queue* TaskMonitor::findQueue(const Os::Task& task) const {
+    for (U32 queue = 0; queue < this->m_queueCount; queue++) {
+        if (this->m_queues[queue]->getName() == task.getName()) {
+            return this->m_queues[queue];
+        }
+    }
+    return nullptr;
+}
+
+void TaskMonitor::run_handler(NATIVE_INT_TYPE portNum, U32 context) {
+    Os::RawTime now;
+    (void)now.now();
+    U32 elapsedUsec = 0;
+    if (not this->m_hasLastRun or (now.getDiffUsec(this->m_lastRun, elapsedUsec) != Os::RawTime::OP_OK)) {
+        elapsedUsec = 0;
+    }
+    this->m_lastRun = now;
+    this->m_hasLastRun = true;
+
+    U32 taskCount = 0;
+    U32 dropped = 0;
+    U32 reportCount = 0;
+    F32 busiestCpu = -1.0f;
+    const TaskReport* busiest = nullptr;
+    F32 fullestFill = -1.0f;
+    const TaskReport* fullest = nullptr;
+    const TaskReport* preempted = nullptr;
+
+    // sample under the lock, the tasks and queues may go away once it is released
+    {
+        Os::ScopeLock lock(this->m_lock);
+        dropped = this->m_dropped;
+        for (U32 entry = 0; entry < TASK_MONITOR_MAX_TASKS; entry++) {
+            TaskEntry& monitored = this->m_tasks[entry];
+            if (monitored.task == nullptr) {
+                continue;
+            }
+            taskCount++;
+            Os::Cpu::Ticks ticks;
+            Os::Cpu::TaskSwitches switches;
+            // a task not yet running has no usage, sampled again on the next run
+            if ((Os::Cpu::getTaskTicks(ticks, *monitored.task) != Os::Cpu::Status::OP_OK) ||
+                (Os::Cpu::getTaskSwitches(switches, *monitored.task) != Os::Cpu::Status::OP_OK)) {
+                monitored.sampled = false;
+                continue;
+            }
+            const FwSizeType received = (monitored.queue != nullptr) ? monitored.queue->getMessagesReceived() : 0;
+            if (monitored.sampled) {
+                TaskReport& report = this->m_reports[reportCount++];
+                const FwSizeType total = ticks.total - monitored.ticks.total;
+                report.name = monitored.task->getName();
+                report.cpu = (total == 0) ? 0.0f
+                    : (static_cast<F32>(ticks.used - monitored.ticks.used) / static_cast<F32>(total)) * 100.0f;
+                report.voluntary = static_cast<U32>(switches.voluntary - monitored.switches.voluntary);
+                report.involuntary = static_cast<U32>(switches.involuntary - monitored.switches.involuntary);
+                report.rate = (elapsedUsec == 0) ? 0.0f
+                    : (static_cast<F32>(received - monitored.received) * 1000000.0f) / static_cast<F32>(elapsedUsec);
+                report.depth = 0;
+                report.highWater = 0;
+                if (monitored.queue != nullptr) {
+                    report.depth = static_cast<U32>(monitored.queue->getMessagesAvailable());
+                    report.highWater = static_cast<U32>(monitored.queue->getMessageHighWaterMark());
+                    const F32 fill = static_cast<F32>(report.depth) / static_cast<F32>(monitored.queue->getDepth());
+                    if (fill > fullestFill) {
+                        fullestFill = fill;
+                        fullest = &report;
+                    }
+                }
+                if (report.cpu > busiestCpu) {
+                    busiestCpu = report.cpu;
+                    busiest = &report;
+                }
+                if ((preempted == nullptr) || (report.involuntary > preempted->involuntary)) {
+                    preempted = &report;
+                }
+            }
+            monitored.ticks = ticks;
+            monitored.switches = switches;
+            monitored.received = received;
+            monitored.sampled = true;
+        }
+    }
+
+    if (this->m_reportTasks) {
+        for (U32 index = 0; index < reportCount; index++) {
+            const TaskReport& report = this->m_reports[index];
+            Fw::LogStringArg name(report.name.toChar());
+            this->log_ACTIVITY_LO_TASK_USAGE(name, report.cpu, report.voluntary, report.involuntary, report.depth,
+                                             report.highWater, report.rate);
+        }
+    }
+    this->tlmWrite_TASK_COUNT(taskCount);
+    this->tlmWrite_TASKS_DROPPED(dropped);
+    if (busiest != nullptr) {
+        this->tlmWrite_BUSIEST_TASK(Fw::TlmString(busiest->name.toChar()));
+        this->tlmWrite_BUSIEST_TASK_CPU(busiest->cpu);
+    }
+    if (fullest != nullptr) {
+        this->tlmWrite_FULLEST_QUEUE_TASK(Fw::TlmString(fullest->name.toChar()));
+        this->tlmWrite_FULLEST_QUEUE_DEPTH(fullest->depth);
+    }
+    if (preempted != nullptr) {
+        this->tlmWrite_MOST_PREEMPTED_TASK(Fw::TlmString(preempted->name.toChar()));
+        this->tlmWrite_MOST_PREEMPTED_SWITCHES(preempted->involuntary);
+    }
+}
+
+void TaskMonitor::REPORT_TASKS_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::Enabled enable) {
+    this->m_reportTasks = (enable == Fw::Enabled::ENABLED);
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+}  // end namespace Svc
@@ -0,0 +1,139 @@
+// ======================================================================
+// \title  TaskMonitor.hpp
+// \brief  hpp file for TaskMonitor component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SVC_TASKMONITOR_HPP
+#define SVC_TASKMONITOR_HPP
+
+#include <Svc/TaskMonitor/TaskMonitorComponentAc.hpp>
+#include <Os/Cpu.hpp>
+#include <Os/Mutex.hpp>
+#include <Os/Queue.hpp>
+#include <Os/RawTime.hpp>
+#include <Os/Task.hpp>
+#include <TaskMonitorCfg.hpp>
+#include <FpConfig.hpp>
+
+namespace Svc {
+
+    //! \class TaskMonitor
+    //! \brief Reports CPU, context switch and queue usage of each task
+    //!
+    //! The component registers itself as the Os::Task and Os::Queue registry. Each task is matched
+    //! with the queue of the same name, which is how active components name their task and queue.
+    //! On each run the usage since the previous run is reported per task, along with the tasks that
+    //! stand out as the likely bottleneck.
+    //!
+
+    class TaskMonitor : public TaskMonitorComponentBase, public Os::TaskRegistry, public Os::QueueRegistry {
+
+        public:
+            //!  \brief TaskMonitor constructor
+            //!
+            //!  \param compName component name
+            //!
+            TaskMonitor(const char* compName);
+
+            //!  \brief TaskMonitor destructor
+            //!
+            //!  Unregisters the component from the registries it is still set as
+            //!
+            ~TaskMonitor();
+
+            //!  \brief register as the task and queue registry
+            //!
+            //!  Only tasks started and queues created after this call are monitored, so it should be
+            //!  called before the other components are initialized.
+            //!
+            void registerRegistries();
+
+            //! \brief add a started task to the monitored tasks
+            //!
+            //! \param task: pointer to task to register
+            void addTask(Os::Task* task) override;
+
+            //! \brief remove a task from the monitored tasks
+            //!
+            //! \param task: pointer to task to deregister
+            void removeTask(Os::Task* task) override;
+
+            //! \brief record a created queue to be matched with its task
+            //!
+            //! \param queue: queue being registered
+            void registerQueue(Os::Queue* queue) override;
+
+            //! \brief forget a queue being destroyed
+            //!
+            //! \param queue: queue being destroyed
+            void removeQueue(Os::Queue* queue) override;
+
+        PRIVATE:
+
+            //! Handler for input port run
+            void run_handler(NATIVE_INT_TYPE portNum, U32 context);
+
+            //! Implementation for REPORT_TASKS command handler
+            void REPORT_TASKS_cmdHandler(FwOpcodeType opCode, U32 cmdSeq, Fw::Enabled enable);
+
+            //! Find the registered queue named after a task, nullptr when there is none. Caller holds m_lock.
+            Os::Queue* findQueue(const Os::Task& task) const;
+
+            //! Usage sample of a monitored task
+            struct TaskEntry {
+                Os::Task* task; //!< monitored task, nullptr for a free entry
+                Os::Queue* queue; //!< queue of the task, nullptr when the task has none
+                Os::Cpu::Ticks ticks; //!< CPU ticks at the previous run
+                Os::Cpu::TaskSwitches switches; //!< context switches at the previous run
+                FwSizeType received; //!< messages received from the queue at the previous run
+                bool sampled; //!< previous values are valid
+            };
+
+            //! Usage of a task computed on a run, reported once m_lock is released
+            struct TaskReport {
+                Os::TaskString name; //!< name of the task
+                F32 cpu; //!< CPU share in percent
+                U32 voluntary; //!< voluntary context switches
+                U32 involuntary; //!< involuntary context switches
+                U32 depth; //!< current queue depth
+                U32 highWater; //!< queue high-water mark
+                F32 rate; //!< messages dispatched per second
+            };
+
+            //! protects the tables, updated from the tasks starting and stopping and the queues being destroyed
+            Os::Mutex m_lock;
+
+            //! monitored tasks
+            TaskEntry m_tasks[TASK_MONITOR_MAX_TASKS];
+
+            //! queues created since registration
+            Os::Queue* m_queues[TASK_MONITOR_MAX_QUEUES];
+
+            //! number of entries of m_queues in use
+            U32 m_queueCount;
+
+            //! usage computed on the current run, only used by the run handler
+            TaskReport m_reports[TASK_MONITOR_MAX_TASKS];
+
+            //! tasks started while the task table was full
+            U32 m_dropped;
+
+            //! time of the previous run
+            Os::RawTime m_lastRun;
+
+            //! m_lastRun is valid
+            bool m_hasLastRun;
+
+            //! emit a usage event per task on each run
+            bool m_reportTasks;
+    };
+
+}
+
+#endif
@@ -0,0 +1,30 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "TaskMonitorTester.hpp"
+
+TEST(Nominal, Usage) {
+    Svc::TaskMonitorTester tester;
+    tester.testUsage();
+}
+
+TEST(Nominal, ReportDisabled) {
+    Svc::TaskMonitorTester tester;
+    tester.testReportDisabled();
+}
+
+TEST(OffNominal, TableFull) {
+    Svc::TaskMonitorTester tester;
+    tester.testTableFull();
+}
+
+TEST(OffNominal, Unregister) {
+    Svc::TaskMonitorTester tester;
+    tester.testUnregister();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
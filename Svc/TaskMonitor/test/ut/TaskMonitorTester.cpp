@@ -0,0 +1,233 @@
+// ======================================================================
+// \title  TaskMonitorTester.cpp
+// \brief  cpp file for TaskMonitor test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "TaskMonitorTester.hpp"
+#include <Fw/Types/String.hpp>
+#include <atomic>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+
+namespace {
+
+//! Message sent to the worker task, a zero value stops it
+class WorkMessage : public Fw::SerializeBufferBase {
+  public:
+    NATIVE_UINT_TYPE getBuffCapacity() const { return sizeof(m_data); }
+    U8* getBuffAddr() { return m_data; }
+    const U8* getBuffAddr() const { return m_data; }
+
+  private:
+    U8 m_data[sizeof(U32)];
+};
+
+//! Dispatch loop of an active component: block on the queue and handle each message
+void worker(void* argument) {
+    Os::Queue& queue = *static_cast<Os::Queue*>(argument);
+    WorkMessage message;
+    while (true) {
+        FwQueuePriorityType priority = 0;
+        U32 value = 0;
+        if ((queue.receive(message, Os::Queue::BLOCKING, priority) != Os::Queue::OP_OK) ||
+            (message.deserialize(value) != Fw::FW_SERIALIZE_OK) || (value == 0)) {
+            break;
+        }
+        // some work per message
+        volatile U32 spin = 0;
+        for (U32 count = 0; count < value; count++) {
+            spin = spin + count;
+        }
+    }
+}
+
+void sendWork(Os::Queue& queue, U32 value) {
+    WorkMessage message;
+    ASSERT_EQ(message.serialize(value), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(queue.send(message, 0, Os::Queue::BLOCKING), Os::Queue::OP_OK);
+}
+
+}  // namespace
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TaskMonitorTester ::TaskMonitorTester()
+    : TaskMonitorGTestBase("Tester", MAX_HISTORY_SIZE), component("TaskMonitor") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+TaskMonitorTester ::~TaskMonitorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TaskMonitorTester ::testUsage() {
+    this->component.registerRegistries();
+    this->sendCmd_REPORT_TASKS(0, 0, Fw::Enabled::ENABLED);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, TaskMonitor::OPCODE_REPORT_TASKS, 0, Fw::CmdResponse::OK);
+
+    // an active component names its queue and task after itself
+    Os::Queue queue;
+    ASSERT_EQ(queue.create(Fw::String("Worker"), 100, sizeof(U32)), Os::Queue::OP_OK);
+    Os::Task task;
+    Os::Task::Arguments arguments(Fw::String("Worker"), worker, &queue);
+    ASSERT_EQ(task.start(arguments), Os::Task::OP_OK);
+    (void)Os::Task::delay(Fw::TimeInterval(0, 10000));
+
+    // first run only takes the reference sample
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_TASK_USAGE_SIZE(0);
+    ASSERT_TLM_TASK_COUNT(0, 1);
+
+    const U32 MESSAGES = 50;
+    for (U32 message = 0; message < MESSAGES; message++) {
+        sendWork(queue, 100000);
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    while (queue.getMessagesAvailable() != 0) {
+        (void)Os::Task::delay(Fw::TimeInterval(0, 1000));
+    }
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+
+    ASSERT_EVENTS_TASK_USAGE_SIZE(1);
+    ASSERT_EQ(this->eventHistory_TASK_USAGE->at(0).name, "Worker");
+    ASSERT_GE(this->eventHistory_TASK_USAGE->at(0).cpu, 0.0f);
+    ASSERT_LE(this->eventHistory_TASK_USAGE->at(0).cpu, 100.0f);
+    // the worker blocks on its queue between messages
+    ASSERT_GT(this->eventHistory_TASK_USAGE->at(0).voluntary, 0u);
+    ASSERT_EQ(this->eventHistory_TASK_USAGE->at(0).depth, 0u);
+    ASSERT_GE(this->eventHistory_TASK_USAGE->at(0).highWater, 1u);
+    ASSERT_GT(this->eventHistory_TASK_USAGE->at(0).rate, 0.0f);
+
+    ASSERT_TLM_TASK_COUNT(0, 1);
+    ASSERT_TLM_TASKS_DROPPED(0, 0);
+    ASSERT_TLM_BUSIEST_TASK_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_BUSIEST_TASK->at(0).arg, "Worker");
+    ASSERT_TLM_FULLEST_QUEUE_TASK_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_FULLEST_QUEUE_TASK->at(0).arg, "Worker");
+    ASSERT_TLM_FULLEST_QUEUE_DEPTH(0, 0);
+    ASSERT_TLM_MOST_PREEMPTED_TASK_SIZE(1);
+
+    sendWork(queue, 0);
+    ASSERT_EQ(task.join(), Os::Task::OP_OK);
+}
+
+void TaskMonitorTester ::testReportDisabled() {
+    this->component.registerRegistries();
+    Os::Queue queue;
+    ASSERT_EQ(queue.create(Fw::String("Idle"), 10, sizeof(U32)), Os::Queue::OP_OK);
+    Os::Task task;
+    Os::Task::Arguments arguments(Fw::String("Idle"), worker, &queue);
+    ASSERT_EQ(task.start(arguments), Os::Task::OP_OK);
+    (void)Os::Task::delay(Fw::TimeInterval(0, 10000));
+
+    this->invoke_to_run(0, 0);
+    sendWork(queue, 1);
+    (void)Os::Task::delay(Fw::TimeInterval(0, 10000));
+    this->invoke_to_run(0, 0);
+    ASSERT_EVENTS_TASK_USAGE_SIZE(0);
+    ASSERT_TLM_BUSIEST_TASK_SIZE(1);
+    ASSERT_EQ(this->tlmHistory_BUSIEST_TASK->at(0).arg, "Idle");
+
+    sendWork(queue, 0);
+    ASSERT_EQ(task.join(), Os::Task::OP_OK);
+}
+
+void TaskMonitorTester ::testTableFull() {
+    const U32 EXTRA = 2;
+    Os::Task tasks[TASK_MONITOR_MAX_TASKS + EXTRA];
+    for (U32 task = 0; task < TASK_MONITOR_MAX_TASKS + EXTRA; task++) {
+        this->component.addTask(&tasks[task]);
+    }
+    // tasks that are not running are counted but have no usage to report
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_TASK_COUNT(0, TASK_MONITOR_MAX_TASKS);
+    ASSERT_TLM_TASKS_DROPPED(0, EXTRA);
+    ASSERT_TLM_BUSIEST_TASK_SIZE(0);
+
+    for (U32 task = 0; task < TASK_MONITOR_MAX_TASKS + EXTRA; task++) {
+        this->component.removeTask(&tasks[task]);
+    }
+    this->clearHistory();
+    this->invoke_to_run(0, 0);
+    ASSERT_TLM_TASK_COUNT(0, 0);
+}
+
+void TaskMonitorTester ::testUnregister() {
+    this->component.registerRegistries();
+    {
+        Os::Queue queue;
+        ASSERT_EQ(queue.create(Fw::String("Transient"), 10, sizeof(U32)), Os::Queue::OP_OK);
+        ASSERT_EQ(this->component.m_queueCount, 1u);
+    }
+    // a destroyed queue is no longer matched with a task
+    ASSERT_EQ(this->component.m_queueCount, 0u);
+    ASSERT_EQ(this->component.m_queues[0], nullptr);
+
+    // destroying another monitor leaves this one registered
+    {
+        TaskMonitor other("Other");
+    }
+    ASSERT_EQ(Os::Task::getTaskRegistry(), static_cast<Os::TaskRegistry*>(&this->component));
+    ASSERT_EQ(Os::Queue::getRegistry(), static_cast<Os::QueueRegistry*>(&this->component));
+
+    // destroying the registered monitor clears the registries
+    {
+        TaskMonitor other("Other");
+        other.registerRegistries();
+    }
+    ASSERT_EQ(Os::Task::getTaskRegistry(), nullptr);
+    ASSERT_EQ(Os::Queue::getRegistry(), nullptr);
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void TaskMonitorTester ::connectPorts() {
+    // run
+    this->connect_to_run(0, this->component.get_run_InputPort(0));
+
+    // CmdDisp
+    this->connect_to_CmdDisp(0, this->component.get_CmdDisp_InputPort(0));
+
+    // CmdStatus
+    this->component.set_CmdStatus_OutputPort(0, this->get_from_CmdStatus(0));
+
+    // CmdReg
+    this->component.set_CmdReg_OutputPort(0, this->get_from_CmdReg(0));
+
+    // Tlm
+    this->component.set_Tlm_OutputPort(0, this->get_from_Tlm(0));
+
+    // Time
+    this->component.set_Time_OutputPort(0, this->get_from_Time(0));
+
+    // Log
+    this->component.set_Log_OutputPort(0, this->get_from_Log(0));
+
+    // LogText
+    this->component.set_LogText_OutputPort(0, this->get_from_LogText(0));
+}
+
+void TaskMonitorTester ::initComponents() {
+    this->init();
+    this->component.init(INSTANCE);
+}
+
+}  // end namespace Svc
@@ -0,0 +1,80 @@
+// ======================================================================
+// \title  TaskMonitorTester.hpp
+// \brief  hpp file for TaskMonitor test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "TaskMonitorGTestBase.hpp"
+#include "Svc/TaskMonitor/TaskMonitor.hpp"
+
+namespace Svc {
+
+class TaskMonitorTester : public TaskMonitorGTestBase {
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+  public:
+    //! Construct object TaskMonitorTester
+    //!
+    TaskMonitorTester();
+
+    //! Destroy object TaskMonitorTester
+    //!
+    ~TaskMonitorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test the usage reported for an active task dispatching from its queue
+    //!
+    void testUsage();
+
+    //! Test that usage events are only emitted when enabled
+    //!
+    void testReportDisabled();
+
+    //! Test tasks started while the task table is full
+    //!
+    void testTableFull();
+
+    //! Test that destroyed queues and other monitors are unregistered
+    //!
+    void testUnregister();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    TaskMonitor component;
+};
+
+}  // end namespace Svc
+
+#endif
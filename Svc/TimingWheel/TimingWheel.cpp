@@ -0,0 +1,182 @@
+// ======================================================================
+// \title  TimingWheel.cpp
+// \brief  cpp file for a hierarchical timing wheel
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/TimingWheel/TimingWheel.hpp>
+#include <Fw/Types/Assert.hpp>
+
+static_assert(Svc::TIMING_WHEEL_LEVELS > 0, "Timing wheel needs at least one level");
+static_assert((Svc::TIMING_WHEEL_SLOT_BITS * Svc::TIMING_WHEEL_LEVELS) < 32,
+              "Timing wheel span must fit in the 32 bit tick count");
+
+namespace Svc {
+
+TimingWheel::TimingWheel() : m_entries(nullptr), m_count(0), m_now(0) {
+    for (U32 list = 0; list < FW_NUM_ARRAY_ELEMENTS(this->m_lists); list++) {
+        this->m_lists[list].head = INVALID_ENTRY;
+        this->m_lists[list].tail = INVALID_ENTRY;
+    }
+}
+
+void TimingWheel::setup(Entry* entries, U32 count) {
+    FW_ASSERT(entries != nullptr);
+    FW_ASSERT(count < INVALID_ENTRY, count);
+    this->m_entries = entries;
+    this->m_count = count;
+    for (U32 entry = 0; entry < count; entry++) {
+        this->m_entries[entry].next = INVALID_ENTRY;
+        this->m_entries[entry].prev = INVALID_ENTRY;
+        this->m_entries[entry].list = INVALID_ENTRY;
+        this->m_entries[entry].expiry = 0;
+        this->m_entries[entry].period = 0;
+    }
+}
+
+void TimingWheel::schedule(U32 entry, U32 delay, U32 period) {
+    FW_ASSERT(entry < this->m_count, entry, this->m_count);
+    FW_ASSERT(delay <= MAX_DELAY, delay);
+    FW_ASSERT(period <= MAX_DELAY, period);
+    this->cancel(entry);
+    this->m_entries[entry].expiry = this->m_now + delay;
+    this->m_entries[entry].period = period;
+    this->insert(entry);
+}
+
+void TimingWheel::cancel(U32 entry) {
+    FW_ASSERT(entry < this->m_count, entry, this->m_count);
+    if (this->m_entries[entry].list != INVALID_ENTRY) {
+        this->remove(entry);
+    }
+}
+
+bool TimingWheel::isScheduled(U32 entry) const {
+    FW_ASSERT(entry < this->m_count, entry, this->m_count);
+    return this->m_entries[entry].list != INVALID_ENTRY;
+}
+
+void TimingWheel::tick() {
+    FW_ASSERT(this->m_entries != nullptr);
+    // cascade from the top so an entry moved down a level is cascaded again in the same tick
+    for (U32 level = TIMING_WHEEL_LEVELS - 1; level > 0; level--) {
+        const U32 mask = (1U << (TIMING_WHEEL_SLOT_BITS * level)) - 1;
+        if ((this->m_now & mask) == 0) {
+            this->cascade(level);
+        }
+    }
+    this->splice(this->m_now & (SLOTS - 1));
+    this->m_now++;
+}
+
+bool TimingWheel::popExpired(U32& entry) {
+    entry = this->m_lists[EXPIRED_LIST].head;
+    if (entry == INVALID_ENTRY) {
+        return false;
+    }
+    this->remove(entry);
+    Entry& expired = this->m_entries[entry];
+    if (expired.period != 0) {
+        expired.expiry += expired.period;
+        this->insert(entry);
+    }
+    return true;
+}
+
+U32 TimingWheel::getTicks() const {
+    return this->m_now;
+}
+
+void TimingWheel::insert(U32 entry) {
+    const U32 expiry = this->m_entries[entry].expiry;
+    // already due, processing has fallen behind
+    if (static_cast<I32>(expiry - this->m_now) < 0) {
+        this->append(EXPIRED_LIST, entry);
+        return;
+    }
+    // lowest level where the expiry shares the enclosing span of the current tick. Its slot
+    // in that level is then always ahead of the current slot, so it will be cascaded in time.
+    U32 level = 0;
+    while ((level < (TIMING_WHEEL_LEVELS - 1)) &&
+           (((expiry ^ this->m_now) >> (TIMING_WHEEL_SLOT_BITS * (level + 1))) != 0)) {
+        level++;
+    }
+    const U32 slot = (expiry >> (TIMING_WHEEL_SLOT_BITS * level)) & (SLOTS - 1);
+    this->append(level * SLOTS + slot, entry);
+}
+
+void TimingWheel::append(U32 list, U32 entry) {
+    Entry& appended = this->m_entries[entry];
+    List& target = this->m_lists[list];
+    appended.list = list;
+    appended.next = INVALID_ENTRY;
+    appended.prev = target.tail;
+    if (target.tail == INVALID_ENTRY) {
+        target.head = entry;
+    } else {
+        this->m_entries[target.tail].next = entry;
+    }
+    target.tail = entry;
+}
+
+void TimingWheel::remove(U32 entry) {
+    Entry& removed = this->m_entries[entry];
+    List& source = this->m_lists[removed.list];
+    if (removed.prev == INVALID_ENTRY) {
+        source.head = removed.next;
+    } else {
+        this->m_entries[removed.prev].next = removed.next;
+    }
+    if (removed.next == INVALID_ENTRY) {
+        source.tail = removed.prev;
+    } else {
+        this->m_entries[removed.next].prev = removed.prev;
+    }
+    removed.next = INVALID_ENTRY;
+    removed.prev = INVALID_ENTRY;
+    removed.list = INVALID_ENTRY;
+}
+
+void TimingWheel::cascade(U32 level) {
+    const U32 slot = (this->m_now >> (TIMING_WHEEL_SLOT_BITS * level)) & (SLOTS - 1);
+    List& source = this->m_lists[level * SLOTS + slot];
+    U32 entry = source.head;
+    // detach the whole slot first, entries may be re-inserted into the same slot
+    source.head = INVALID_ENTRY;
+    source.tail = INVALID_ENTRY;
+    while (entry != INVALID_ENTRY) {
+        const U32 next = this->m_entries[entry].next;
+        this->m_entries[entry].next = INVALID_ENTRY;
+        this->m_entries[entry].prev = INVALID_ENTRY;
+        this->insert(entry);
+        entry = next;
+    }
+}
+
+void TimingWheel::splice(U32 list) {
+    List& source = this->m_lists[list];
+    if (source.head == INVALID_ENTRY) {
+        return;
+    }
+    List& expired = this->m_lists[EXPIRED_LIST];
+    // list membership is updated per entry so that cancel() keeps working on expired entries
+    for (U32 entry = source.head; entry != INVALID_ENTRY; entry = this->m_entries[entry].next) {
+        this->m_entries[entry].list = EXPIRED_LIST;
+    }
+    if (expired.tail == INVALID_ENTRY) {
+        expired.head = source.head;
+    } else {
+        this->m_entries[expired.tail].next = source.head;
+        this->m_entries[source.head].prev = expired.tail;
+    }
+    expired.tail = source.tail;
+    source.head = INVALID_ENTRY;
+    source.tail = INVALID_ENTRY;
+}
+
+}  // end namespace Svc
@@ -0,0 +1,122 @@
+// ======================================================================
+// \title  TimingWheel.hpp
+// \brief  hpp file for a hierarchical timing wheel
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SVC_TIMINGWHEEL_HPP
+#define SVC_TIMINGWHEEL_HPP
+
+#include <FpConfig.hpp>
+#include <TimingWheelCfg.hpp>
+
+namespace Svc {
+
+//! \class TimingWheel
+//! \brief Hierarchical timing wheel scheduling entries in units of ticks
+//!
+//! Entries are identified by their index in caller-provided storage. Each level of the wheel
+//! holds 2^TIMING_WHEEL_SLOT_BITS slots of doubly linked entry lists. An entry is placed in the
+//! lowest level whose slot span covers its expiry. When the lower bits of the tick count roll
+//! over, the matching slot of the level above is cascaded down. Scheduling, cancelling and
+//! advancing a tick are O(1) apart from the entries that expire or cascade.
+//!
+//! Expired entries are handed out through popExpired. Periodic entries are rescheduled relative
+//! to their previous expiry so that late processing does not accumulate drift.
+class TimingWheel {
+  public:
+    //! Marks the end of a list and an unused entry
+    static const U32 INVALID_ENTRY = 0xFFFFFFFF;
+
+    //! Number of slots per level
+    static const U32 SLOTS = 1U << TIMING_WHEEL_SLOT_BITS;
+
+    //! Longest delay that may be scheduled
+    static const U32 MAX_DELAY = (SLOTS - 1) << (TIMING_WHEEL_SLOT_BITS * (TIMING_WHEEL_LEVELS - 1));
+
+    //! Bookkeeping for a single scheduled entry
+    struct Entry {
+        U32 next;    //!< next entry in the list
+        U32 prev;    //!< previous entry in the list
+        U32 list;    //!< list the entry is in, INVALID_ENTRY when not scheduled
+        U32 expiry;  //!< absolute tick the entry expires on
+        U32 period;  //!< reschedule period in ticks, 0 for one-shot entries
+    };
+
+    TimingWheel();
+
+    //! \brief set up the wheel with caller-owned entry storage
+    //!
+    //! \param entries storage for the entries, owned by the caller
+    //! \param count number of entries in the storage
+    void setup(Entry* entries, U32 count);
+
+    //! \brief schedule an entry, replacing any existing schedule of the entry
+    //!
+    //! \param entry index of the entry
+    //! \param delay ticks until the entry expires. 0 expires on the next call to tick()
+    //! \param period reschedule period in ticks, 0 for a one-shot entry
+    void schedule(U32 entry, U32 delay, U32 period);
+
+    //! \brief cancel a scheduled entry. Does nothing when the entry is not scheduled
+    //!
+    //! \param entry index of the entry
+    void cancel(U32 entry);
+
+    //! \brief check if an entry is scheduled or waiting to be popped
+    //!
+    //! \param entry index of the entry
+    //! \return true when scheduled
+    bool isScheduled(U32 entry) const;
+
+    //! \brief process the current tick, moving its expired entries to the expired list
+    void tick();
+
+    //! \brief remove the next expired entry, rescheduling it when periodic
+    //!
+    //! \param entry set to the index of the expired entry
+    //! \return true when an entry was returned, false when no entries have expired
+    bool popExpired(U32& entry);
+
+    //! \brief get the number of the next tick to be processed
+    U32 getTicks() const;
+
+  PRIVATE:
+    //! Index of the expired list in m_lists
+    static const U32 EXPIRED_LIST = SLOTS * TIMING_WHEEL_LEVELS;
+
+    //! Head and tail of an entry list
+    struct List {
+        U32 head;
+        U32 tail;
+    };
+
+    //! Place a detached entry in the list matching its expiry
+    void insert(U32 entry);
+
+    //! Append a detached entry to a list
+    void append(U32 list, U32 entry);
+
+    //! Detach an entry from its list
+    void remove(U32 entry);
+
+    //! Re-insert every entry of a slot into the levels below
+    void cascade(U32 level);
+
+    //! Move every entry of a list to the end of the expired list
+    void splice(U32 list);
+
+    Entry* m_entries;                                  //!< caller-owned entry storage
+    U32 m_count;                                       //!< number of entries in storage
+    U32 m_now;                                         //!< next tick to be processed
+    List m_lists[SLOTS * TIMING_WHEEL_LEVELS + 1];     //!< slot lists followed by the expired list
+};
+
+}  // end namespace Svc
+
+#endif
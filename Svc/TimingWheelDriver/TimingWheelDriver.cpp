@@ -0,0 +1,86 @@
+// ======================================================================
+// \title  TimingWheelDriver.cpp
+// \brief  cpp file for TimingWheelDriver component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include <Svc/TimingWheelDriver/TimingWheelDriver.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+    TimingWheelDriver::TimingWheelDriver(const char* compName) :
+        TimingWheelDriverComponentBase(compName),
+        m_freeOneShot(TimingWheel::INVALID_ENTRY),
+        m_configured(false) {
+        this->m_wheel.setup(this->m_entries, ENTRY_COUNT);
+        // chain the one-shot entries into the free list
+        for (U32 oneShot = 0; oneShot < TIMING_WHEEL_DRIVER_ONE_SHOTS; oneShot++) {
+            this->m_oneShotPorts[oneShot] = 0;
+            this->m_nextFreeOneShot[oneShot] = this->m_freeOneShot;
+            this->m_freeOneShot = oneShot;
+        }
+    }
+
+    void TimingWheelDriver::configure(const ScheduleSet& scheduleSet) {
+        for (NATIVE_UINT_TYPE entry = 0; entry < TimingWheelDriver::SCHEDULE_SIZE; entry++) {
+            const Schedule& schedule = scheduleSet.schedules[entry];
+            // A port with a phase equal or bigger than the period is not accepted because it would never be called
+            FW_ASSERT((schedule.phase == 0) || (schedule.phase < schedule.period),
+                      static_cast<FwAssertArgType>(schedule.phase),
+                      static_cast<FwAssertArgType>(schedule.period));
+            if (schedule.period != 0) {
+                this->m_wheel.schedule(entry, schedule.phase, schedule.period);
+            } else {
+                this->m_wheel.cancel(entry);
+            }
+        }
+        this->m_configured = true;
+    }
+
+    TimingWheelDriver::~TimingWheelDriver() {
+
+    }
+
+    void TimingWheelDriver::CycleIn_handler(NATIVE_INT_TYPE portNum, Os::RawTime& cycleStart) {
+
+        // Make sure that the schedules have been configured:
+        // If this asserts, add the configure() call to initialization.
+        FW_ASSERT(this->m_configured);
+
+        this->m_wheel.tick();
+
+        U32 entry;
+        while (this->m_wheel.popExpired(entry)) {
+            FwIndexType port = static_cast<FwIndexType>(entry);
+            if (entry >= NUM_CYCLEOUT_OUTPUT_PORTS) {
+                // return the one-shot entry to the free list
+                const U32 oneShot = entry - NUM_CYCLEOUT_OUTPUT_PORTS;
+                port = this->m_oneShotPorts[oneShot];
+                this->m_nextFreeOneShot[oneShot] = this->m_freeOneShot;
+                this->m_freeOneShot = oneShot;
+            }
+            if (this->isConnected_CycleOut_OutputPort(port)) {
+                this->CycleOut_out(port, cycleStart);
+            }
+        }
+    }
+
+    Fw::Success TimingWheelDriver::ScheduleIn_handler(NATIVE_INT_TYPE portNum, FwIndexType outputPort, U32 delay) {
+        if ((outputPort < 0) || (outputPort >= NUM_CYCLEOUT_OUTPUT_PORTS) ||
+            (this->m_freeOneShot == TimingWheel::INVALID_ENTRY) || (delay > TimingWheel::MAX_DELAY)) {
+            return Fw::Success::FAILURE;
+        }
+        const U32 oneShot = this->m_freeOneShot;
+        this->m_freeOneShot = this->m_nextFreeOneShot[oneShot];
+        this->m_oneShotPorts[oneShot] = outputPort;
+        this->m_wheel.schedule(NUM_CYCLEOUT_OUTPUT_PORTS + oneShot, delay, 0);
+        return Fw::Success::SUCCESS;
+    }
+
+}
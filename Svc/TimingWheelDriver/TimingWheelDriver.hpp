@@ -0,0 +1,111 @@
+// ======================================================================
+// \title  TimingWheelDriver.hpp
+// \brief  hpp file for TimingWheelDriver component implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef SVC_TIMINGWHEELDRIVER_HPP
+#define SVC_TIMINGWHEELDRIVER_HPP
+
+#include <Svc/TimingWheelDriver/TimingWheelDriverComponentAc.hpp>
+#include <Svc/TimingWheel/TimingWheel.hpp>
+#include <TimingWheelCfg.hpp>
+#include <FpConfig.hpp>
+
+namespace Svc {
+
+    //! \class TimingWheelDriver
+    //! \brief Drives rate groups and one-shot deadlines from a timing wheel
+    //!
+    //! Takes the input from CycleIn and calls each CycleOut port every period ticks,
+    //! starting at the tick given by its phase. Unlike RateGroupDriver only the outputs
+    //! due on a tick are touched, so the cost of a tick does not grow with the number of
+    //! outputs. Other components may request one-shot calls of an output through ScheduleIn.
+    //!
+
+    class TimingWheelDriver : public TimingWheelDriverComponentBase {
+
+        public:
+            //! Size of the schedule table, provided as a constant to users passing the table in
+            static const NATIVE_UINT_TYPE SCHEDULE_SIZE = NUM_CYCLEOUT_OUTPUT_PORTS;
+
+            //! \class Schedule
+            //! \brief Struct describing the periodic schedule of an output
+            struct Schedule {
+                //! Initializes period and phase to 0 (unused)
+                Schedule() : period(0), phase(0)
+                {}
+                //! Initializes period and phase to passed-in pair
+                Schedule(U32 periodIn, U32 phaseIn) :
+                    period(periodIn), phase(phaseIn)
+                {}
+                //! Period in ticks, 0 when the output is not called periodically
+                U32 period;
+                //! Tick within the period the output is called on
+                U32 phase;
+            };
+
+            //! \class ScheduleSet
+            //! \brief Struct containing an array of schedules
+            struct ScheduleSet {
+                //! Schedules
+                Schedule schedules[Svc::TimingWheelDriver::SCHEDULE_SIZE];
+            };
+
+            //!  \brief TimingWheelDriver constructor
+            //!
+            //!  \param compName component name
+            //!
+            TimingWheelDriver(const char* compName);
+
+            //!  \brief TimingWheelDriver configuration function
+            //!
+            //!  Output phases should be spread across the ticks of the period so that outputs
+            //!  sharing a period are not all called on the same tick.
+            //!
+            //!  \param scheduleSet set of periodic output schedules
+
+            void configure(const ScheduleSet& scheduleSet);
+
+            //!  \brief TimingWheelDriver destructor
+
+            ~TimingWheelDriver();
+
+        PRIVATE:
+
+            //! Handler for input port CycleIn
+            void CycleIn_handler(NATIVE_INT_TYPE portNum, Os::RawTime& cycleStart);
+
+            //! Handler for input port ScheduleIn
+            Fw::Success ScheduleIn_handler(NATIVE_INT_TYPE portNum, FwIndexType outputPort, U32 delay);
+
+            //! Number of wheel entries, one per output followed by the one-shot pool
+            static const U32 ENTRY_COUNT = NUM_CYCLEOUT_OUTPUT_PORTS + TIMING_WHEEL_DRIVER_ONE_SHOTS;
+
+            //! the timing wheel
+            TimingWheel m_wheel;
+
+            //! wheel entry storage
+            TimingWheel::Entry m_entries[ENTRY_COUNT];
+
+            //! output port of each one-shot entry
+            FwIndexType m_oneShotPorts[TIMING_WHEEL_DRIVER_ONE_SHOTS];
+
+            //! first free one-shot entry
+            U32 m_freeOneShot;
+
+            //! next free one-shot entry after each one-shot entry
+            U32 m_nextFreeOneShot[TIMING_WHEEL_DRIVER_ONE_SHOTS];
+
+            //! has the configure method been called
+            bool m_configured;
+    };
+
+}
+
+#endif
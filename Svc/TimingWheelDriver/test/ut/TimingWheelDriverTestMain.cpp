@@ -0,0 +1,28 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "TimingWheelDriverTester.hpp"
+
+TEST(Nominal, Periodic) {
+    Svc::TimingWheelDriverTester tester;
+    tester.testPeriodic();
+}
+
+TEST(Nominal, OneShot) {
+    Svc::TimingWheelDriverTester tester;
+    tester.testOneShot();
+}
+
+// Tick overhead benchmark, run with --gtest_also_run_disabled_tests
+TEST(Benchmark, DISABLED_TickOverhead) {
+    Svc::TimingWheelDriverTester tester;
+    tester.benchmarkTick(10);
+    tester.benchmarkTick(100);
+    tester.benchmarkTick(1000);
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,167 @@
+// ======================================================================
+// \title  TimingWheelDriverTester.cpp
+// \brief  cpp file for TimingWheelDriver test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#include "TimingWheelDriverTester.hpp"
+#include <Fw/Test/UnitTest.hpp>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 10
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TimingWheelDriverTester ::TimingWheelDriverTester()
+    : TimingWheelDriverGTestBase("Tester", MAX_HISTORY_SIZE), component("TimingWheelDriver") {
+    this->initComponents();
+    this->connectPorts();
+    this->clearPortCalls();
+}
+
+TimingWheelDriverTester ::~TimingWheelDriverTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TimingWheelDriverTester ::testPeriodic() {
+    TimingWheelDriver::ScheduleSet scheduleSet;
+    for (U32 entry = 0; entry < TimingWheelDriver::SCHEDULE_SIZE; entry++) {
+        // mix of short and long periods, leaving the last port unscheduled
+        if (entry < (TimingWheelDriver::SCHEDULE_SIZE - 1)) {
+            const U32 period = (entry % 2) ? (entry + 1) : (100 * (entry + 1));
+            scheduleSet.schedules[entry] = TimingWheelDriver::Schedule(period, entry % period);
+        }
+    }
+    this->component.configure(scheduleSet);
+
+    // run long enough to cascade through the upper wheel levels
+    const U32 ticks = 3 * TimingWheel::SLOTS * TimingWheel::SLOTS;
+    for (U32 tick = 0; tick < ticks; tick++) {
+        this->clearPortCalls();
+        Os::RawTime t;
+        this->invoke_to_CycleIn(0, t);
+        for (U32 entry = 0; entry < TimingWheelDriver::SCHEDULE_SIZE; entry++) {
+            const TimingWheelDriver::Schedule& schedule = scheduleSet.schedules[entry];
+            const bool expected = (schedule.period != 0) && ((tick % schedule.period) == schedule.phase);
+            ASSERT_EQ(this->m_portCalls[entry], expected ? 1u : 0u) << "port " << entry << " tick " << tick;
+        }
+    }
+}
+
+void TimingWheelDriverTester ::testOneShot() {
+    TimingWheelDriver::ScheduleSet scheduleSet;
+    this->component.configure(scheduleSet);
+
+    // a delay of zero is called on the next tick
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, 1, 0), Fw::Success::SUCCESS);
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, 2, 70), Fw::Success::SUCCESS);
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, 3, TimingWheel::MAX_DELAY + 1), Fw::Success::FAILURE);
+
+    Os::RawTime t;
+    for (U32 tick = 0; tick <= 70; tick++) {
+        this->clearPortCalls();
+        this->invoke_to_CycleIn(0, t);
+        ASSERT_EQ(this->m_portCalls[1], (tick == 0) ? 1u : 0u);
+        ASSERT_EQ(this->m_portCalls[2], (tick == 70) ? 1u : 0u);
+    }
+    // one-shots are not repeated
+    this->clearPortCalls();
+    for (U32 tick = 0; tick < 200; tick++) {
+        this->invoke_to_CycleIn(0, t);
+    }
+    ASSERT_EQ(this->m_portCalls[1], 0u);
+    ASSERT_EQ(this->m_portCalls[2], 0u);
+
+    // invalid output ports are rejected
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, -1, 0), Fw::Success::FAILURE);
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, TimingWheelDriver::NUM_CYCLEOUT_OUTPUT_PORTS, 0), Fw::Success::FAILURE);
+
+    // exhaust the pool, then verify entries are returned once called
+    for (U32 oneShot = 0; oneShot < TIMING_WHEEL_DRIVER_ONE_SHOTS; oneShot++) {
+        ASSERT_EQ(this->invoke_to_ScheduleIn(0, 0, oneShot), Fw::Success::SUCCESS);
+    }
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, 0, 0), Fw::Success::FAILURE);
+    this->clearPortCalls();
+    this->invoke_to_CycleIn(0, t);
+    ASSERT_EQ(this->m_portCalls[0], 1u);
+    ASSERT_EQ(this->invoke_to_ScheduleIn(0, 0, 0), Fw::Success::SUCCESS);
+}
+
+void TimingWheelDriverTester ::benchmarkTick(U32 entries) {
+    const U32 ticks = 1000000;
+    std::vector<TimingWheel::Entry> storage(entries);
+    TimingWheel wheel;
+    wheel.setup(storage.data(), entries);
+    // periods of 10 to 1000 ticks with phases spread across the period
+    for (U32 entry = 0; entry < entries; entry++) {
+        const U32 period = 10 * (1 + (entry % 100));
+        wheel.schedule(entry, entry % period, period);
+    }
+
+    U64 calls = 0;
+    Os::RawTime start;
+    Os::RawTime end;
+    start.now();
+    for (U32 tick = 0; tick < ticks; tick++) {
+        wheel.tick();
+        U32 entry;
+        while (wheel.popExpired(entry)) {
+            calls++;
+        }
+    }
+    end.now();
+    U32 elapsed;
+    (void)end.getDiffUsec(start, elapsed);
+    printf("%u entries: %u ticks in %u us (%.1f ns/tick), %llu calls\n", entries, ticks, elapsed,
+           (static_cast<F64>(elapsed) * 1000.0) / ticks, static_cast<unsigned long long>(calls));
+}
+
+// ----------------------------------------------------------------------
+// Handlers for typed from ports
+// ----------------------------------------------------------------------
+
+void TimingWheelDriverTester ::from_CycleOut_handler(const NATIVE_INT_TYPE portNum, Os::RawTime& cycleStart) {
+    this->m_portCalls[portNum]++;
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void TimingWheelDriverTester ::connectPorts() {
+    // CycleIn
+    this->connect_to_CycleIn(0, this->component.get_CycleIn_InputPort(0));
+
+    // ScheduleIn
+    this->connect_to_ScheduleIn(0, this->component.get_ScheduleIn_InputPort(0));
+
+    // CycleOut
+    for (NATIVE_INT_TYPE port = 0; port < this->component.getNum_CycleOut_OutputPorts(); port++) {
+        this->component.set_CycleOut_OutputPort(port, this->get_from_CycleOut(port));
+    }
+}
+
+void TimingWheelDriverTester ::initComponents() {
+    this->init();
+    this->component.init(INSTANCE);
+}
+
+void TimingWheelDriverTester ::clearPortCalls() {
+    memset(this->m_portCalls, 0, sizeof(this->m_portCalls));
+}
+
+}  // end namespace Svc
@@ -0,0 +1,94 @@
+// ======================================================================
+// \title  TimingWheelDriverTester.hpp
+// \brief  hpp file for TimingWheelDriver test harness implementation class
+//
+// \copyright
+// Copyright 2009-2015, by the California Institute of Technology.
+// ALL RIGHTS RESERVED.  United States Government Sponsorship
+// acknowledged.
+//
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include "TimingWheelDriverGTestBase.hpp"
+#include "Svc/TimingWheelDriver/TimingWheelDriver.hpp"
+
+namespace Svc {
+
+class TimingWheelDriverTester : public TimingWheelDriverGTestBase {
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+  public:
+    //! Construct object TimingWheelDriverTester
+    //!
+    TimingWheelDriverTester();
+
+    //! Destroy object TimingWheelDriverTester
+    //!
+    ~TimingWheelDriverTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test periodic outputs with phase offsets against the RateGroupDriver rule
+    //!
+    void testPeriodic();
+
+    //! Test one-shot calls and exhaustion of the one-shot pool
+    //!
+    void testOneShot();
+
+    //! Measure the cost of a wheel tick with a number of periodic entries
+    //!
+    void benchmarkTick(U32 entries);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handlers for typed from ports
+    // ----------------------------------------------------------------------
+
+    //! Handler for from_CycleOut
+    //!
+    void from_CycleOut_handler(const NATIVE_INT_TYPE portNum, /*!< The port number*/
+                               Os::RawTime& cycleStart /*!< Cycle start timer value*/
+    );
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+    //! Clear the record of output calls
+    //!
+    void clearPortCalls();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    TimingWheelDriver component;
+
+    //! Number of calls of each output since the last clear
+    U32 m_portCalls[TimingWheelDriver::SCHEDULE_SIZE];
+};
+
+}  // end namespace Svc
+
+#endif
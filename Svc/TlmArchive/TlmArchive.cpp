@@ -0,0 +1,466 @@
+// ======================================================================
+// \title  TlmArchive.cpp
+// \brief  cpp file for TlmArchive component implementation class
+// ======================================================================
+
+#include <cstring>
+
+#include "Fw/Com/ComPacket.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Svc/TlmArchive/TlmArchive.hpp"
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction, initialization, and destruction
+// ----------------------------------------------------------------------
+
+TlmArchive::TlmArchive(const char* const compName)
+    : TlmArchiveComponentBase(compName),
+      m_filePrefix(),
+      m_partitionSeconds(0),
+      m_channels(nullptr),
+      m_numChannels(0),
+      m_packetList(nullptr),
+      m_numColumns(0),
+      m_numBlocks(0),
+      m_fileName(),
+      m_fileOpen(false),
+      m_header(),
+      m_fileSize(0),
+      m_samplesArchived(0),
+      m_samplesDropped(0),
+      m_bytesWritten(0),
+      m_filesClosed(0) {}
+
+TlmArchive::~TlmArchive() {
+    // no index and no events here, a reader scans the blocks of the file
+    if (this->m_fileOpen) {
+        this->m_file.close();
+    }
+}
+
+void TlmArchive::configure(const Fw::StringBase& filePrefix,
+                           U32 partitionSeconds,
+                           const TlmArchiveChannel* channels,
+                           FwSizeType numChannels,
+                           const TlmPacketizerPacketList* packetList) {
+    FW_ASSERT(partitionSeconds > 0);
+    FW_ASSERT((channels != nullptr) or (numChannels == 0));
+    for (FwSizeType channel = 0; channel < numChannels; channel++) {
+        const FwSizeType valueSize = TlmArchiveFormat::getValueSize(channels[channel].type);
+        FW_ASSERT((valueSize == 0) or (valueSize == channels[channel].size), static_cast<FwAssertArgType>(channel));
+    }
+    this->m_filePrefix = filePrefix;
+    this->m_partitionSeconds = partitionSeconds;
+    this->m_channels = channels;
+    this->m_numChannels = numChannels;
+    this->m_packetList = packetList;
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for user-defined typed input ports
+// ----------------------------------------------------------------------
+
+void TlmArchive::comIn_handler(const NATIVE_INT_TYPE portNum, Fw::ComBuffer& data, U32 context) {
+    FW_ASSERT(this->m_partitionSeconds > 0);
+    data.resetDeser();
+    FwPacketDescriptorType descriptor = 0;
+    Fw::SerializeStatus status = data.deserialize(descriptor);
+    if (status != Fw::FW_SERIALIZE_OK) {
+        this->log_WARNING_LO_InvalidPacket(data.getBuffLength(), status);
+    } else if (descriptor == Fw::ComPacket::FW_PACKET_TELEM) {
+        this->archiveTlmPacket(data);
+    } else if (descriptor == Fw::ComPacket::FW_PACKET_PACKETIZED_TLM) {
+        this->archivePacketizedTlm(data);
+    } else {
+        this->log_WARNING_LO_InvalidPacket(data.getBuffLength(), Fw::FW_DESERIALIZE_TYPE_MISMATCH);
+    }
+    this->writeTelemetry();
+}
+
+void TlmArchive::pingIn_handler(const NATIVE_INT_TYPE portNum, U32 key) {
+    this->pingOut_out(0, key);
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void TlmArchive::CLOSE_PARTITION_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    this->closePartition();
+    this->writeTelemetry();
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Private helper functions
+// ----------------------------------------------------------------------
+
+void TlmArchive::archiveTlmPacket(Fw::ComBuffer& data) {
+    // each entry is a channel id, a time tag and a value whose size is only known from the channel table
+    while (data.getBuffLeft() > 0) {
+        FwChanIdType id = 0;
+        Fw::Time timeTag;
+        Fw::SerializeStatus status = data.deserialize(id);
+        if (status == Fw::FW_SERIALIZE_OK) {
+            status = data.deserialize(timeTag);
+        }
+        if (status != Fw::FW_SERIALIZE_OK) {
+            this->log_WARNING_LO_InvalidPacket(data.getBuffLength(), status);
+            return;
+        }
+        const TlmArchiveChannel* channel = this->findChannel(id);
+        if (channel == nullptr) {
+            this->log_WARNING_LO_UnknownChannel(id);
+            return;
+        }
+        if (data.getBuffLeft() < channel->size) {
+            this->log_WARNING_LO_InvalidPacket(data.getBuffLength(), Fw::FW_DESERIALIZE_SIZE_MISMATCH);
+            return;
+        }
+        const U8* value = data.getBuffAddr() + (data.getBuffLength() - data.getBuffLeft());
+        this->archiveSample(id, timeTag, value, channel->size);
+        (void)data.deserializeSkip(channel->size);
+    }
+}
+
+void TlmArchive::archivePacketizedTlm(Fw::ComBuffer& data) {
+    FwTlmPacketizeIdType packetId = 0;
+    Fw::Time timeTag;
+    Fw::SerializeStatus status = data.deserialize(packetId);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = data.deserialize(timeTag);
+    }
+    if (status != Fw::FW_SERIALIZE_OK) {
+        this->log_WARNING_LO_InvalidPacket(data.getBuffLength(), status);
+        return;
+    }
+    const TlmPacketizerPacket* packet = nullptr;
+    if (this->m_packetList != nullptr) {
+        for (NATIVE_UINT_TYPE entry = 0; entry < this->m_packetList->numEntries; entry++) {
+            if (this->m_packetList->list[entry]->id == packetId) {
+                packet = this->m_packetList->list[entry];
+                break;
+            }
+        }
+    }
+    if (packet == nullptr) {
+        this->log_WARNING_LO_UnknownPacket(packetId);
+        return;
+    }
+    // the values follow in packet list order, all with the packet time tag
+    for (NATIVE_UINT_TYPE entry = 0; entry < packet->numEntries; entry++) {
+        const TlmPacketizerChannelEntry& channel = packet->list[entry];
+        if (data.getBuffLeft() < channel.size) {
+            this->log_WARNING_LO_InvalidPacket(data.getBuffLength(), Fw::FW_DESERIALIZE_SIZE_MISMATCH);
+            return;
+        }
+        const U8* value = data.getBuffAddr() + (data.getBuffLength() - data.getBuffLeft());
+        this->archiveSample(channel.id, timeTag, value, channel.size);
+        (void)data.deserializeSkip(channel.size);
+    }
+}
+
+void TlmArchive::archiveSample(FwChanIdType id, const Fw::Time& timeTag, const U8* value, FwSizeType size) {
+    const U32 partitionStart = TlmArchiveFormat::getPartitionStart(timeTag.getSeconds(), this->m_partitionSeconds);
+    // a sample outside the partition of the open file closes it
+    if (this->m_fileOpen and ((timeTag.getTimeBase() != this->m_header.timeBase) or
+                              (timeTag.getContext() != this->m_header.context) or
+                              (partitionStart != this->m_header.partitionStart))) {
+        this->closePartition();
+    }
+    if ((not this->m_fileOpen) and (not this->openPartition(timeTag))) {
+        this->m_samplesDropped++;
+        return;
+    }
+    Column* column = this->getColumn(id, size);
+    if ((column == nullptr) or (column->valueSize != size)) {
+        this->m_samplesDropped++;
+        return;
+    }
+
+    const I64 time = TlmArchiveFormat::toMicroseconds(timeTag.getSeconds(), timeTag.getUSeconds());
+    U8 delta[TlmArchiveFormat::MAX_VARINT_SIZE];
+    FwSizeType deltaSize = TlmArchiveFormat::encodeVarint(time - column->lastTime, delta);
+    const bool full = (column->count == 0xFFFF) or
+                      (column->timesSize + deltaSize > TLM_ARCHIVE_BLOCK_SIZE) or
+                      ((column->count + 1U) * column->valueSize > TLM_ARCHIVE_BLOCK_SIZE);
+    if ((column->count > 0) and full) {
+        // keep room in the index for the blocks written when the file closes
+        if (this->m_numBlocks + this->m_numColumns >= TLM_ARCHIVE_MAX_BLOCKS) {
+            this->closePartition();
+            if (not this->openPartition(timeTag)) {
+                this->m_samplesDropped++;
+                return;
+            }
+        } else if (not this->flushColumn(*column)) {
+            this->m_samplesDropped++;
+            return;
+        }
+    }
+
+    if (column->count == 0) {
+        column->firstSeconds = timeTag.getSeconds();
+        column->firstUSeconds = timeTag.getUSeconds();
+        column->range.minTime = time;
+        column->range.maxTime = time;
+        column->range.hasRange = false;
+        column->lastTime = time;
+        deltaSize = TlmArchiveFormat::encodeVarint(0, delta);
+    }
+    (void)memcpy(&column->times[column->timesSize], delta, deltaSize);
+    column->timesSize += deltaSize;
+    (void)memcpy(&column->values[column->count * column->valueSize], value, size);
+    column->count++;
+    column->lastTime = time;
+    if (time < column->range.minTime) {
+        column->range.minTime = time;
+    }
+    if (time > column->range.maxTime) {
+        column->range.maxTime = time;
+    }
+    F64 number = 0.0;
+    if (TlmArchiveFormat::decodeValue(column->type, value, size, number)) {
+        if (not column->range.hasRange) {
+            column->range.hasRange = true;
+            column->range.minValue = number;
+            column->range.maxValue = number;
+        } else if (number < column->range.minValue) {
+            column->range.minValue = number;
+        } else if (number > column->range.maxValue) {
+            column->range.maxValue = number;
+        }
+    }
+    this->m_samplesArchived++;
+}
+
+const TlmArchiveChannel* TlmArchive::findChannel(FwChanIdType id) const {
+    for (FwSizeType channel = 0; channel < this->m_numChannels; channel++) {
+        if (this->m_channels[channel].id == id) {
+            return &this->m_channels[channel];
+        }
+    }
+    return nullptr;
+}
+
+TlmArchive::Column* TlmArchive::getColumn(FwChanIdType id, FwSizeType size) {
+    for (FwSizeType column = 0; column < this->m_numColumns; column++) {
+        if (this->m_columns[column].id == id) {
+            return &this->m_columns[column];
+        }
+    }
+    if (this->m_numColumns == TLM_ARCHIVE_MAX_CHANNELS) {
+        this->log_WARNING_HI_ChannelTableFull(id);
+        return nullptr;
+    }
+    const TlmArchiveChannel* channel = this->findChannel(id);
+    Column& column = this->m_columns[this->m_numColumns++];
+    column.id = id;
+    // a channel of TlmPacketizer packets only may be missing from the table
+    column.type = (channel != nullptr) ? channel->type : TlmArchiveFormat::VALUE_RAW;
+    column.valueSize = static_cast<U16>(size);
+    column.count = 0;
+    column.timesSize = 0;
+    return &column;
+}
+
+bool TlmArchive::openPartition(const Fw::Time& timeTag) {
+    FW_ASSERT(not this->m_fileOpen);
+    this->m_header.timeBase = static_cast<FwTimeBaseStoreType>(timeTag.getTimeBase());
+    this->m_header.context = timeTag.getContext();
+    this->m_header.partitionStart =
+        TlmArchiveFormat::getPartitionStart(timeTag.getSeconds(), this->m_partitionSeconds);
+    this->m_header.partitionSeconds = this->m_partitionSeconds;
+
+    // a partition already written to, before a restart or a time jump, continues in the next free file
+    Os::File::Status status = Os::File::FILE_EXISTS;
+    for (U32 fileNumber = 0; (fileNumber < TLM_ARCHIVE_MAX_FILES_PER_PARTITION) and (status == Os::File::FILE_EXISTS);
+         fileNumber++) {
+        TlmArchiveFormat::formatFileName(this->m_fileName, this->m_filePrefix, this->m_header.timeBase,
+                                         this->m_header.partitionStart, fileNumber);
+        status = this->m_file.open(this->m_fileName.toChar(), Os::File::OPEN_CREATE, Os::File::NO_OVERWRITE);
+    }
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_HI_FileOpenError(status, this->m_fileName);
+        return false;
+    }
+    this->m_fileOpen = true;
+    this->m_fileSize = 0;
+    this->m_numBlocks = 0;
+
+    Fw::ExternalSerializeBuffer buffer(this->m_scratch, sizeof(this->m_scratch));
+    const Fw::SerializeStatus serStatus = this->m_header.serialize(buffer);
+    FW_ASSERT(serStatus == Fw::FW_SERIALIZE_OK, serStatus);
+    if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+        this->abandonPartition();
+        return false;
+    }
+    return true;
+}
+
+void TlmArchive::closePartition() {
+    if (not this->m_fileOpen) {
+        return;
+    }
+    for (FwSizeType column = 0; column < this->m_numColumns; column++) {
+        if (not this->flushColumn(this->m_columns[column])) {
+            return;
+        }
+    }
+    if (not this->writeIndex()) {
+        return;
+    }
+    this->m_file.close();
+    this->m_fileOpen = false;
+    this->m_filesClosed++;
+    this->log_ACTIVITY_LO_PartitionFileClosed(static_cast<U32>(this->m_numBlocks), this->m_fileSize,
+                                              this->m_fileName);
+}
+
+void TlmArchive::abandonPartition() {
+    this->m_file.close();
+    this->m_fileOpen = false;
+    for (FwSizeType column = 0; column < this->m_numColumns; column++) {
+        this->m_samplesDropped += this->m_columns[column].count;
+        this->m_columns[column].count = 0;
+        this->m_columns[column].timesSize = 0;
+    }
+}
+
+bool TlmArchive::flushColumn(Column& column) {
+    if (column.count == 0) {
+        return true;
+    }
+    FW_ASSERT(this->m_numBlocks < TLM_ARCHIVE_MAX_BLOCKS, static_cast<FwAssertArgType>(this->m_numBlocks));
+    TlmArchiveFormat::BlockHeader header;
+    header.id = column.id;
+    header.type = column.type;
+    header.valueSize = column.valueSize;
+    header.count = column.count;
+    header.timesSize = static_cast<U16>(column.timesSize);
+    header.firstSeconds = column.firstSeconds;
+    header.firstUSeconds = column.firstUSeconds;
+    Fw::ExternalSerializeBuffer buffer(this->m_scratch, sizeof(this->m_scratch));
+    Fw::SerializeStatus status = header.serialize(buffer);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(column.times, column.timesSize, Fw::Serialization::OMIT_LENGTH);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(column.values, static_cast<FwSizeType>(column.count) * column.valueSize,
+                                  Fw::Serialization::OMIT_LENGTH);
+    }
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+
+    Block& block = this->m_blocks[this->m_numBlocks];
+    block.column = static_cast<U16>(&column - this->m_columns);
+    block.entry = column.range;
+    block.entry.offset = this->m_fileSize;
+    block.entry.size = buffer.getBuffLength();
+    block.entry.count = column.count;
+    if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+        this->abandonPartition();
+        return false;
+    }
+    this->m_numBlocks++;
+    column.count = 0;
+    column.timesSize = 0;
+    return true;
+}
+
+bool TlmArchive::writeIndex() {
+    TlmArchiveFormat::Trailer trailer;
+    trailer.directoryOffset = this->m_fileSize;
+    trailer.numChannels = 0;
+    // the directory, a channel at a time, with the first block of each channel in the index grouped by channel
+    Fw::ExternalSerializeBuffer buffer(this->m_scratch, sizeof(this->m_scratch));
+    U32 firstBlock = 0;
+    for (FwSizeType column = 0; column < this->m_numColumns; column++) {
+        TlmArchiveFormat::DirectoryEntry entry;
+        entry.id = this->m_columns[column].id;
+        entry.type = this->m_columns[column].type;
+        entry.valueSize = this->m_columns[column].valueSize;
+        entry.firstBlock = firstBlock;
+        entry.numBlocks = 0;
+        for (FwSizeType block = 0; block < this->m_numBlocks; block++) {
+            if (this->m_blocks[block].column == column) {
+                entry.numBlocks++;
+            }
+        }
+        if (entry.numBlocks == 0) {
+            continue;
+        }
+        firstBlock += entry.numBlocks;
+        trailer.numChannels++;
+        if (buffer.getBuffCapacity() - buffer.getBuffLength() < TlmArchiveFormat::DirectoryEntry::SIZE) {
+            if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+                this->abandonPartition();
+                return false;
+            }
+            buffer.resetSer();
+        }
+        const Fw::SerializeStatus status = entry.serialize(buffer);
+        FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    }
+    if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+        this->abandonPartition();
+        return false;
+    }
+    buffer.resetSer();
+
+    trailer.indexOffset = this->m_fileSize;
+    for (FwSizeType column = 0; column < this->m_numColumns; column++) {
+        for (FwSizeType block = 0; block < this->m_numBlocks; block++) {
+            if (this->m_blocks[block].column != column) {
+                continue;
+            }
+            if (buffer.getBuffCapacity() - buffer.getBuffLength() < TlmArchiveFormat::IndexEntry::SIZE) {
+                if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+                    this->abandonPartition();
+                    return false;
+                }
+                buffer.resetSer();
+            }
+            const Fw::SerializeStatus status = this->m_blocks[block].entry.serialize(buffer);
+            FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+        }
+    }
+    if (buffer.getBuffCapacity() - buffer.getBuffLength() < TlmArchiveFormat::Trailer::SIZE) {
+        if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+            this->abandonPartition();
+            return false;
+        }
+        buffer.resetSer();
+    }
+    const Fw::SerializeStatus status = trailer.serialize(buffer);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, status);
+    if (not this->writeData(buffer.getBuffAddr(), buffer.getBuffLength())) {
+        this->abandonPartition();
+        return false;
+    }
+    return true;
+}
+
+bool TlmArchive::writeData(const U8* data, FwSizeType size) {
+    FwSignedSizeType writeSize = static_cast<FwSignedSizeType>(size);
+    const Os::File::Status status = this->m_file.write(data, writeSize);
+    if (status == Os::File::OP_OK) {
+        this->m_bytesWritten += static_cast<U64>(writeSize);
+        this->m_fileSize += static_cast<U32>(writeSize);
+    }
+    if ((status != Os::File::OP_OK) or (writeSize != static_cast<FwSignedSizeType>(size))) {
+        this->log_WARNING_HI_FileWriteError(status, static_cast<U32>(writeSize), static_cast<U32>(size),
+                                            this->m_fileName);
+        return false;
+    }
+    return true;
+}
+
+void TlmArchive::writeTelemetry() {
+    this->tlmWrite_SamplesArchived(this->m_samplesArchived);
+    this->tlmWrite_SamplesDropped(this->m_samplesDropped);
+    this->tlmWrite_BytesWritten(this->m_bytesWritten);
+    this->tlmWrite_FilesClosed(this->m_filesClosed);
+}
+
+}  // end namespace Svc
@@ -0,0 +1,237 @@
+// ======================================================================
+// \title  TlmArchive.hpp
+// \brief  hpp file for TlmArchive component implementation class
+// ======================================================================
+
+#ifndef Svc_TlmArchive_HPP
+#define Svc_TlmArchive_HPP
+
+#include <TlmArchiveCfg.hpp>
+
+#include "Fw/Types/FileNameString.hpp"
+#include "Os/File.hpp"
+#include "Svc/TlmArchive/TlmArchiveComponentAc.hpp"
+#include "Svc/TlmArchive/TlmArchiveFormat.hpp"
+#include "Svc/TlmPacketizer/TlmPacketizerTypes.hpp"
+
+namespace Svc {
+
+//! Archives telemetry packets into time-partitioned, columnar files
+//!
+//! Telemetry packets from TlmChan, or packetized telemetry from TlmPacketizer, are split into samples. Each
+//! channel gets a column: its samples are buffered into blocks holding a delta-encoded time column and a value
+//! column, and a full block is appended to the file of the current partition. Closing a partition file writes
+//! the index of its blocks, with their time and value ranges, so that TlmArchiveReader reads only the blocks a
+//! query needs. See TlmArchiveFormat for the file layout.
+class TlmArchive : public TlmArchiveComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Construction, initialization, and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object TlmArchive
+    //!
+    TlmArchive(const char* const compName  //!< The component name
+    );
+
+    //! Destroy object TlmArchive
+    //!
+    //! The current partition file is closed without its index. TlmArchiveReader still reads its blocks, by
+    //! scanning the file.
+    ~TlmArchive();
+
+    //! Configure the archive
+    //!
+    //! The channel table gives the value size of each channel in TlmChan packets, and the type of the numeric
+    //! channels, whose value range is indexed. The packet list gives the layout of TlmPacketizer packets.
+    //! Both must stay valid while the component runs.
+    void configure(const Fw::StringBase& filePrefix,                     //!< The file name prefix
+                   U32 partitionSeconds,                                 //!< The number of seconds in a partition
+                   const TlmArchiveChannel* channels,                    //!< The channel table
+                   FwSizeType numChannels,                               //!< The number of channels in the table
+                   const TlmPacketizerPacketList* packetList = nullptr  //!< The TlmPacketizer packets, if any
+    );
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for user-defined typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for comIn
+    //!
+    void comIn_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                       Fw::ComBuffer& data,            //!< The packet
+                       U32 context                     //!< The call order
+                       ) final;
+
+    //! Handler implementation for pingIn
+    //!
+    void pingIn_handler(const NATIVE_INT_TYPE portNum,  //!< The port number
+                        U32 key                         //!< Value to return to pinger
+                        ) final;
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Handler implementations for commands
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for command CLOSE_PARTITION
+    //!
+    void CLOSE_PARTITION_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                    U32 cmdSeq            //!< The command sequence number
+                                    ) final;
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Types
+    // ----------------------------------------------------------------------
+
+    //! The column of a channel, buffering the current block
+    struct Column {
+        FwChanIdType id;                   //!< The channel
+        TlmArchiveFormat::ValueType type;  //!< The value type
+        U16 valueSize;                     //!< The size of a value
+        U16 count;                         //!< The number of samples in the block
+        FwSizeType timesSize;              //!< The size of the time column of the block
+        U32 firstSeconds;                  //!< The seconds of the first time tag of the block
+        U32 firstUSeconds;                 //!< The microseconds of the first time tag of the block
+        I64 lastTime;                      //!< The last time tag, in microseconds
+        TlmArchiveFormat::IndexEntry range;  //!< The time and value ranges of the block
+        U8 times[TLM_ARCHIVE_BLOCK_SIZE];    //!< The time column of the block
+        U8 values[TLM_ARCHIVE_BLOCK_SIZE];   //!< The value column of the block
+    };
+
+    //! A block written to the current partition file
+    struct Block {
+        U16 column;                          //!< The column of the block
+        TlmArchiveFormat::IndexEntry entry;  //!< The index entry of the block
+    };
+
+    static_assert(TLM_ARCHIVE_BLOCK_SIZE >= FW_TLM_BUFFER_MAX_SIZE, "a block must hold the largest value");
+    static_assert(TLM_ARCHIVE_BLOCK_SIZE <= 0xFFFF, "block column sizes are stored as U16");
+    static_assert(TLM_ARCHIVE_MAX_CHANNELS < 0xFFFF, "columns are stored as U16");
+    static_assert(TLM_ARCHIVE_MAX_BLOCKS > TLM_ARCHIVE_MAX_CHANNELS, "closing a file takes a block per column");
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private helper functions
+    // ----------------------------------------------------------------------
+
+    //! Archive the samples of a TlmChan packet
+    void archiveTlmPacket(Fw::ComBuffer& data  //!< The packet, after its descriptor
+    );
+
+    //! Archive the samples of a TlmPacketizer packet
+    void archivePacketizedTlm(Fw::ComBuffer& data  //!< The packet, after its descriptor
+    );
+
+    //! Archive a sample
+    void archiveSample(FwChanIdType id,          //!< The channel
+                       const Fw::Time& timeTag,  //!< The time tag
+                       const U8* value,          //!< The serialized value
+                       FwSizeType size           //!< The size of the value
+    );
+
+    //! Find a channel in the channel table
+    //! \return The channel, nullptr if it is not in the table
+    const TlmArchiveChannel* findChannel(FwChanIdType id) const;
+
+    //! Get the column of a channel, adding it if needed
+    //! \return The column, nullptr if the table is full
+    Column* getColumn(FwChanIdType id,  //!< The channel
+                      FwSizeType size   //!< The size of a value
+    );
+
+    //! Open a file for the partition holding a time tag
+    //! \return True if the file is open
+    bool openPartition(const Fw::Time& timeTag);
+
+    //! Write the buffered blocks, the directory, the index and the trailer, and close the partition file
+    void closePartition();
+
+    //! Close the partition file after an error, dropping the buffered samples
+    void abandonPartition();
+
+    //! Write the buffered block of a column to the partition file
+    //! \return True on success
+    bool flushColumn(Column& column);
+
+    //! Write the directory, the index and the trailer
+    //! \return True on success
+    bool writeIndex();
+
+    //! Write data to the partition file
+    //! \return True on success
+    bool writeData(const U8* data,  //!< The data
+                   FwSizeType size  //!< The size of the data
+    );
+
+    //! Write the telemetry
+    void writeTelemetry();
+
+  PRIVATE:
+    // ----------------------------------------------------------------------
+    // Private member variables
+    // ----------------------------------------------------------------------
+
+    //! The file name prefix
+    Fw::FileNameString m_filePrefix;
+
+    //! The number of seconds in a partition
+    U32 m_partitionSeconds;
+
+    //! The channel table
+    const TlmArchiveChannel* m_channels;
+
+    //! The number of channels in the table
+    FwSizeType m_numChannels;
+
+    //! The TlmPacketizer packets
+    const TlmPacketizerPacketList* m_packetList;
+
+    //! The columns
+    Column m_columns[TLM_ARCHIVE_MAX_CHANNELS];
+
+    //! The number of columns in use
+    FwSizeType m_numColumns;
+
+    //! The blocks written to the partition file
+    Block m_blocks[TLM_ARCHIVE_MAX_BLOCKS];
+
+    //! The number of blocks written to the partition file
+    FwSizeType m_numBlocks;
+
+    //! The partition file
+    Os::File m_file;
+
+    //! The name of the partition file
+    Fw::FileNameString m_fileName;
+
+    //! Whether a partition file is open
+    bool m_fileOpen;
+
+    //! The header of the partition file
+    TlmArchiveFormat::Header m_header;
+
+    //! The size of the partition file
+    U32 m_fileSize;
+
+    //! Scratch space for serializing blocks and the index
+    U8 m_scratch[TlmArchiveFormat::BlockHeader::SIZE + 2 * TLM_ARCHIVE_BLOCK_SIZE];
+
+    //! The number of samples archived
+    U32 m_samplesArchived;
+
+    //! The number of samples dropped
+    U32 m_samplesDropped;
+
+    //! The number of bytes written
+    U64 m_bytesWritten;
+
+    //! The number of partition files completed
+    U32 m_filesClosed;
+};
+
+}  // end namespace Svc
+
+#endif
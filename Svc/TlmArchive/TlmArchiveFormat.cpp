@@ -0,0 +1,330 @@
+// ======================================================================
+// \title  TlmArchiveFormat.cpp
+// \brief  cpp file for the layout of telemetry archive files
+// ======================================================================
+
+#include <Svc/TlmArchive/TlmArchiveFormat.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Serialization
+// ----------------------------------------------------------------------
+
+Fw::SerializeStatus TlmArchiveFormat::Header::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(MAGIC);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(VERSION);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->timeBase);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->context);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->partitionStart);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->partitionSeconds);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::Header::deserialize(Fw::SerializeBufferBase& buffer) {
+    U32 magic = 0;
+    U8 version = 0;
+    Fw::SerializeStatus status = buffer.deserialize(magic);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(version);
+    }
+    if ((status == Fw::FW_SERIALIZE_OK) and ((magic != MAGIC) or (version != VERSION))) {
+        status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->timeBase);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->context);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->partitionStart);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->partitionSeconds);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::BlockHeader::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->id);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(static_cast<U8>(this->type));
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->valueSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->count);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->timesSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->firstSeconds);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->firstUSeconds);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::BlockHeader::deserialize(Fw::SerializeBufferBase& buffer) {
+    U8 type = 0;
+    Fw::SerializeStatus status = buffer.deserialize(this->id);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(type);
+    }
+    if ((status == Fw::FW_SERIALIZE_OK) and (type >= VALUE_MAX)) {
+        status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    this->type = static_cast<ValueType>(type);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->valueSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->count);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->timesSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->firstSeconds);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->firstUSeconds);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::DirectoryEntry::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->id);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(static_cast<U8>(this->type));
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->valueSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->firstBlock);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->numBlocks);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::DirectoryEntry::deserialize(Fw::SerializeBufferBase& buffer) {
+    U8 type = 0;
+    Fw::SerializeStatus status = buffer.deserialize(this->id);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(type);
+    }
+    if ((status == Fw::FW_SERIALIZE_OK) and (type >= VALUE_MAX)) {
+        status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    this->type = static_cast<ValueType>(type);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->valueSize);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->firstBlock);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->numBlocks);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::IndexEntry::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->offset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->size);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->count);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->minTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->maxTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->hasRange);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->minValue);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->maxValue);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::IndexEntry::deserialize(Fw::SerializeBufferBase& buffer) {
+    Fw::SerializeStatus status = buffer.deserialize(this->offset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->size);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->count);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->minTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->maxTime);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->hasRange);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->minValue);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->maxValue);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::Trailer::serialize(Fw::SerializeBufferBase& buffer) const {
+    Fw::SerializeStatus status = buffer.serialize(this->directoryOffset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->numChannels);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(this->indexOffset);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.serialize(MAGIC);
+    }
+    return status;
+}
+
+Fw::SerializeStatus TlmArchiveFormat::Trailer::deserialize(Fw::SerializeBufferBase& buffer) {
+    U32 magic = 0;
+    Fw::SerializeStatus status = buffer.deserialize(this->directoryOffset);
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->numChannels);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(this->indexOffset);
+    }
+    if (status == Fw::FW_SERIALIZE_OK) {
+        status = buffer.deserialize(magic);
+    }
+    // a file whose writer stopped before closing it has no trailer
+    if ((status == Fw::FW_SERIALIZE_OK) and (magic != MAGIC)) {
+        status = Fw::FW_DESERIALIZE_FORMAT_ERROR;
+    }
+    return status;
+}
+
+// ----------------------------------------------------------------------
+// Public static functions
+// ----------------------------------------------------------------------
+
+FwSizeType TlmArchiveFormat::getValueSize(ValueType type) {
+    switch (type) {
+        case VALUE_U8:
+        case VALUE_I8:
+            return sizeof(U8);
+        case VALUE_U16:
+        case VALUE_I16:
+            return sizeof(U16);
+        case VALUE_U32:
+        case VALUE_I32:
+        case VALUE_F32:
+            return sizeof(U32);
+        case VALUE_U64:
+        case VALUE_I64:
+        case VALUE_F64:
+            return sizeof(U64);
+        default:
+            return 0;
+    }
+}
+
+#define TLMARCHIVE_DECODE(TYPE, T)                                  \
+    case TYPE: {                                                    \
+        T decoded = 0;                                              \
+        if (buffer.deserialize(decoded) != Fw::FW_SERIALIZE_OK) {   \
+            return false;                                           \
+        }                                                           \
+        value = static_cast<F64>(decoded);                          \
+        return true;                                                \
+    }
+
+bool TlmArchiveFormat::decodeValue(ValueType type, const U8* data, FwSizeType size, F64& value) {
+    const FwSizeType valueSize = getValueSize(type);
+    if ((valueSize == 0) or (size != valueSize)) {
+        return false;
+    }
+    Fw::ExternalSerializeBuffer buffer(const_cast<U8*>(data), static_cast<Fw::Serializable::SizeType>(size));
+    (void)buffer.setBuffLen(static_cast<Fw::Serializable::SizeType>(size));
+    switch (type) {
+        TLMARCHIVE_DECODE(VALUE_U8, U8)
+        TLMARCHIVE_DECODE(VALUE_I8, I8)
+        TLMARCHIVE_DECODE(VALUE_U16, U16)
+        TLMARCHIVE_DECODE(VALUE_I16, I16)
+        TLMARCHIVE_DECODE(VALUE_U32, U32)
+        TLMARCHIVE_DECODE(VALUE_I32, I32)
+        TLMARCHIVE_DECODE(VALUE_U64, U64)
+        TLMARCHIVE_DECODE(VALUE_I64, I64)
+        TLMARCHIVE_DECODE(VALUE_F32, F32)
+        TLMARCHIVE_DECODE(VALUE_F64, F64)
+        default:
+            return false;
+    }
+}
+
+#undef TLMARCHIVE_DECODE
+
+FwSizeType TlmArchiveFormat::encodeVarint(I64 value, U8* data) {
+    FW_ASSERT(data != nullptr);
+    // zigzag maps small magnitudes of either sign to small numbers
+    U64 zigzag = (static_cast<U64>(value) << 1) ^ static_cast<U64>(value >> 63);
+    FwSizeType size = 0;
+    while (zigzag >= 0x80) {
+        data[size++] = static_cast<U8>(zigzag | 0x80);
+        zigzag >>= 7;
+    }
+    data[size++] = static_cast<U8>(zigzag);
+    return size;
+}
+
+FwSizeType TlmArchiveFormat::decodeVarint(const U8* data, FwSizeType size, I64& value) {
+    FW_ASSERT(data != nullptr);
+    U64 zigzag = 0;
+    for (FwSizeType byte = 0; (byte < size) and (byte < MAX_VARINT_SIZE); byte++) {
+        zigzag |= static_cast<U64>(data[byte] & 0x7F) << (7 * byte);
+        if ((data[byte] & 0x80) == 0) {
+            value = static_cast<I64>(zigzag >> 1) ^ -static_cast<I64>(zigzag & 1);
+            return byte + 1;
+        }
+    }
+    return 0;
+}
+
+void TlmArchiveFormat::formatFileName(Fw::StringBase& fileName,
+                                      const Fw::StringBase& prefix,
+                                      FwTimeBaseStoreType timeBase,
+                                      U32 partitionStart,
+                                      U32 fileNumber) {
+    fileName.format("%s_%" PRI_FwTimeBaseStoreType "_%010" PRIu32 "_%" PRIu32 ".tla", prefix.toChar(), timeBase,
+                    partitionStart, fileNumber);
+}
+
+}  // namespace Svc
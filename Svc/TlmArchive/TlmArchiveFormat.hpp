@@ -0,0 +1,199 @@
+// ======================================================================
+// \title  TlmArchiveFormat.hpp
+// \brief  hpp file for the layout of telemetry archive files
+// ======================================================================
+
+#ifndef Svc_TlmArchiveFormat_HPP
+#define Svc_TlmArchiveFormat_HPP
+
+#include <FpConfig.hpp>
+#include <Fw/Time/Time.hpp>
+#include <Fw/Types/Serializable.hpp>
+#include <Fw/Types/StringBase.hpp>
+
+namespace Svc {
+
+//! Layout of the telemetry archive files written by TlmArchive and read by TlmArchiveReader
+//!
+//! Samples are partitioned by time. A partition covers a fixed number of seconds of one time base and is stored
+//! in one or more files named `<prefix>_<time base>_<partition start>_<file number>.tla`. A file holds, in order:
+//!
+//!     header | blocks | directory | index | trailer
+//!
+//! A block holds consecutive samples of one channel as two columns. The time column holds each time tag as the
+//! zigzag varint of its difference in microseconds from the previous one, starting from the first time tag in the
+//! block header. The value column holds the serialized values, which all have the size given in the block header.
+//! The directory lists the channels of the file. The index lists the blocks of each channel, grouped by channel,
+//! with the time range of each block and, for numeric channels, its value range. The trailer locates the directory
+//! and the index. A query reads the trailer, the directory, the index entries of its channel, and only the blocks
+//! that overlap the ranges asked for.
+class TlmArchiveFormat {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants and Types
+    // ----------------------------------------------------------------------
+
+    //! The type of the values of a channel, for the value range index
+    enum ValueType : U8 {
+        VALUE_RAW,  //!< Not numeric, no value range is kept
+        VALUE_U8,
+        VALUE_I8,
+        VALUE_U16,
+        VALUE_I16,
+        VALUE_U32,
+        VALUE_I32,
+        VALUE_U64,
+        VALUE_I64,
+        VALUE_F32,
+        VALUE_F64,
+        VALUE_MAX  //!< Number of value types
+    };
+
+    //! The magic number at the start and at the end of a file
+    static constexpr U32 MAGIC = 0x544C4131;
+    //! The format version
+    static constexpr U8 VERSION = 1;
+    //! The largest size of a varint
+    static constexpr FwSizeType MAX_VARINT_SIZE = 10;
+
+    //! The file header
+    struct Header {
+        FwTimeBaseStoreType timeBase;     //!< The time base of the partition
+        FwTimeContextStoreType context;   //!< The time context of the samples in the file
+        U32 partitionStart;               //!< The first second of the partition
+        U32 partitionSeconds;             //!< The number of seconds in the partition
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = sizeof(U32) + sizeof(U8) + sizeof(FwTimeBaseStoreType) +
+                                           sizeof(FwTimeContextStoreType) + 2 * sizeof(U32);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! The header of a block
+    struct BlockHeader {
+        FwChanIdType id;    //!< The channel
+        ValueType type;     //!< The value type
+        U16 valueSize;      //!< The size of a value
+        U16 count;          //!< The number of samples
+        U16 timesSize;      //!< The size of the time column
+        U32 firstSeconds;   //!< The seconds of the first time tag
+        U32 firstUSeconds;  //!< The microseconds of the first time tag
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = sizeof(FwChanIdType) + sizeof(U8) + 3 * sizeof(U16) + 2 * sizeof(U32);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! A channel in the directory
+    struct DirectoryEntry {
+        FwChanIdType id;  //!< The channel
+        ValueType type;   //!< The value type
+        U16 valueSize;    //!< The size of a value
+        U32 firstBlock;   //!< The index entry of the first block of the channel
+        U32 numBlocks;    //!< The number of blocks of the channel
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = sizeof(FwChanIdType) + sizeof(U8) + sizeof(U16) + 2 * sizeof(U32);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! A block in the index
+    struct IndexEntry {
+        U32 offset;       //!< The file offset of the block
+        U32 size;         //!< The size of the block, with its header
+        U16 count;        //!< The number of samples
+        I64 minTime;      //!< The earliest time tag, in microseconds
+        I64 maxTime;      //!< The latest time tag, in microseconds
+        bool hasRange;    //!< Whether the value range is kept, false for channels that are not numeric
+        F64 minValue;     //!< The lowest value
+        F64 maxValue;     //!< The highest value
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE =
+            2 * sizeof(U32) + sizeof(U16) + 2 * sizeof(I64) + sizeof(U8) + 2 * sizeof(F64);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+    //! The file trailer
+    struct Trailer {
+        U32 directoryOffset;  //!< The file offset of the directory
+        U32 numChannels;      //!< The number of channels in the directory
+        U32 indexOffset;      //!< The file offset of the index
+
+        //! The serialized size
+        static constexpr FwSizeType SIZE = 4 * sizeof(U32);
+
+        Fw::SerializeStatus serialize(Fw::SerializeBufferBase& buffer) const;
+        Fw::SerializeStatus deserialize(Fw::SerializeBufferBase& buffer);
+    };
+
+  public:
+    // ----------------------------------------------------------------------
+    // Public static functions
+    // ----------------------------------------------------------------------
+
+    //! Get the size of a value of a numeric type
+    //! \return The size, zero for VALUE_RAW
+    static FwSizeType getValueSize(ValueType type  //!< The value type
+    );
+
+    //! Decode a value as a number
+    //! \return True if the type is numeric and the value has its size
+    static bool decodeValue(ValueType type,   //!< The value type
+                            const U8* data,   //!< The serialized value
+                            FwSizeType size,  //!< The size of the serialized value
+                            F64& value        //!< The value (output)
+    );
+
+    //! Encode a signed number as a zigzag varint
+    //! \return The encoded size, at most MAX_VARINT_SIZE
+    static FwSizeType encodeVarint(I64 value,  //!< The number
+                                   U8* data    //!< The encoded number, holding MAX_VARINT_SIZE bytes
+    );
+
+    //! Decode a zigzag varint
+    //! \return The encoded size, zero if the data ends before the varint
+    static FwSizeType decodeVarint(const U8* data,   //!< The data
+                                   FwSizeType size,  //!< The size of the data
+                                   I64& value        //!< The number (output)
+    );
+
+    //! Get a time tag in microseconds
+    static I64 toMicroseconds(U32 seconds, U32 useconds) {
+        return static_cast<I64>(seconds) * 1000000 + static_cast<I64>(useconds);
+    }
+
+    //! Get the first second of the partition holding a second
+    static U32 getPartitionStart(U32 seconds,          //!< The second
+                                 U32 partitionSeconds  //!< The number of seconds in a partition
+    ) {
+        return seconds - (seconds % partitionSeconds);
+    }
+
+    //! Format the name of a file of a partition
+    static void formatFileName(Fw::StringBase& fileName,        //!< The file name (output)
+                               const Fw::StringBase& prefix,    //!< The file name prefix
+                               FwTimeBaseStoreType timeBase,    //!< The time base of the partition
+                               U32 partitionStart,              //!< The first second of the partition
+                               U32 fileNumber                   //!< The number of the file in the partition
+    );
+};
+
+//! A channel to archive
+struct TlmArchiveChannel {
+    FwChanIdType id;                    //!< Id of channel
+    TlmArchiveFormat::ValueType type;   //!< Type of channel, VALUE_RAW for channels that are not numbers
+    FwSizeType size;                    //!< Serialized size of channel in bytes
+};
+
+}  // namespace Svc
+
+#endif
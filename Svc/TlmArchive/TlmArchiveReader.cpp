@@ -0,0 +1,285 @@
+// ======================================================================
+// \title  TlmArchiveReader.cpp
+// \brief  cpp file for TlmArchiveReader, range queries of telemetry archives
+// ======================================================================
+
+#include <Svc/TlmArchive/TlmArchiveReader.hpp>
+#include <Fw/Types/Assert.hpp>
+
+namespace Svc {
+
+TlmArchiveReader::TlmArchiveReader() : m_filePrefix(), m_partitionSeconds(0), m_header(), m_bytesRead(0), m_blocksRead(0) {}
+
+TlmArchiveReader::~TlmArchiveReader() {}
+
+void TlmArchiveReader::configure(const Fw::StringBase& filePrefix, U32 partitionSeconds) {
+    FW_ASSERT(partitionSeconds > 0);
+    this->m_filePrefix = filePrefix;
+    this->m_partitionSeconds = partitionSeconds;
+}
+
+TlmArchiveReader::Status TlmArchiveReader::query(FwChanIdType id,
+                                                 const Fw::Time& start,
+                                                 const Fw::Time& end,
+                                                 Visitor& visitor) {
+    Query query;
+    query.id = id;
+    query.start = TlmArchiveFormat::toMicroseconds(start.getSeconds(), start.getUSeconds());
+    query.end = TlmArchiveFormat::toMicroseconds(end.getSeconds(), end.getUSeconds());
+    query.hasRange = false;
+    query.low = 0.0;
+    query.high = 0.0;
+    return this->run(query, start, end, visitor);
+}
+
+TlmArchiveReader::Status TlmArchiveReader::query(FwChanIdType id,
+                                                 const Fw::Time& start,
+                                                 const Fw::Time& end,
+                                                 F64 low,
+                                                 F64 high,
+                                                 Visitor& visitor) {
+    Query query;
+    query.id = id;
+    query.start = TlmArchiveFormat::toMicroseconds(start.getSeconds(), start.getUSeconds());
+    query.end = TlmArchiveFormat::toMicroseconds(end.getSeconds(), end.getUSeconds());
+    query.hasRange = true;
+    query.low = low;
+    query.high = high;
+    return this->run(query, start, end, visitor);
+}
+
+TlmArchiveReader::Status TlmArchiveReader::run(const Query& query,
+                                               const Fw::Time& start,
+                                               const Fw::Time& end,
+                                               Visitor& visitor) {
+    FW_ASSERT(this->m_partitionSeconds > 0);
+    FW_ASSERT(start.getTimeBase() == end.getTimeBase(), start.getTimeBase(), end.getTimeBase());
+    const FwTimeBaseStoreType timeBase = static_cast<FwTimeBaseStoreType>(start.getTimeBase());
+    Status result = QUERY_OK;
+    // U64 so that the last partition of the U32 seconds range ends the loop
+    for (U64 partition = TlmArchiveFormat::getPartitionStart(start.getSeconds(), this->m_partitionSeconds);
+         partition <= end.getSeconds(); partition += this->m_partitionSeconds) {
+        for (U32 fileNumber = 0; fileNumber < TLM_ARCHIVE_MAX_FILES_PER_PARTITION; fileNumber++) {
+            Fw::FileNameString fileName;
+            TlmArchiveFormat::formatFileName(fileName, this->m_filePrefix, timeBase, static_cast<U32>(partition),
+                                             fileNumber);
+            Os::File file;
+            const Os::File::Status fileStatus = file.open(fileName.toChar(), Os::File::OPEN_READ);
+            if (fileStatus == Os::File::DOESNT_EXIST) {
+                break;
+            }
+            Status status = FILE_ERROR;
+            if (fileStatus == Os::File::OP_OK) {
+                status = this->queryFile(file, query, visitor);
+                file.close();
+            }
+            if (result == QUERY_OK) {
+                result = status;
+            }
+        }
+    }
+    return result;
+}
+
+TlmArchiveReader::Status TlmArchiveReader::queryFile(Os::File& file, const Query& query, Visitor& visitor) {
+    FwSignedSizeType fileSize = 0;
+    if (file.size(fileSize) != Os::File::OP_OK) {
+        return FILE_ERROR;
+    }
+    if (fileSize < static_cast<FwSignedSizeType>(TlmArchiveFormat::Header::SIZE)) {
+        return FORMAT_ERROR;
+    }
+    Status status = this->readAt(file, 0, this->m_block, TlmArchiveFormat::Header::SIZE);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+    (void)buffer.setBuffLen(TlmArchiveFormat::Header::SIZE);
+    if (this->m_header.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+        return FORMAT_ERROR;
+    }
+
+    // a file without a trailer was not closed by its writer
+    const FwSignedSizeType trailerOffset = fileSize - static_cast<FwSignedSizeType>(TlmArchiveFormat::Trailer::SIZE);
+    TlmArchiveFormat::Trailer trailer;
+    if (trailerOffset < static_cast<FwSignedSizeType>(TlmArchiveFormat::Header::SIZE)) {
+        return this->scanFile(file, fileSize, query, visitor);
+    }
+    status = this->readAt(file, trailerOffset, this->m_block, TlmArchiveFormat::Trailer::SIZE);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    buffer.resetSer();
+    (void)buffer.setBuffLen(TlmArchiveFormat::Trailer::SIZE);
+    if (trailer.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+        return this->scanFile(file, fileSize, query, visitor);
+    }
+    if ((trailer.directoryOffset > trailer.indexOffset) or (trailer.indexOffset > trailerOffset) or
+        (static_cast<U64>(trailer.numChannels) * TlmArchiveFormat::DirectoryEntry::SIZE !=
+         trailer.indexOffset - trailer.directoryOffset)) {
+        return FORMAT_ERROR;
+    }
+
+    // find the channel in the directory
+    TlmArchiveFormat::DirectoryEntry channel;
+    bool found = false;
+    const U32 entriesPerRead = sizeof(this->m_block) / TlmArchiveFormat::DirectoryEntry::SIZE;
+    for (U32 done = 0; (done < trailer.numChannels) and (not found);) {
+        const U32 count = FW_MIN(trailer.numChannels - done, entriesPerRead);
+        status = this->readAt(file, trailer.directoryOffset + done * TlmArchiveFormat::DirectoryEntry::SIZE,
+                              this->m_block, count * TlmArchiveFormat::DirectoryEntry::SIZE);
+        if (status != QUERY_OK) {
+            return status;
+        }
+        buffer.resetSer();
+        (void)buffer.setBuffLen(static_cast<Fw::Serializable::SizeType>(count * TlmArchiveFormat::DirectoryEntry::SIZE));
+        for (U32 entry = 0; (entry < count) and (not found); entry++) {
+            if (channel.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+                return FORMAT_ERROR;
+            }
+            found = (channel.id == query.id);
+        }
+        done += count;
+    }
+    if (not found) {
+        return QUERY_OK;
+    }
+
+    // read the blocks of the channel whose ranges overlap the query
+    Fw::ExternalSerializeBuffer entries(this->m_entries, sizeof(this->m_entries));
+    for (U32 done = 0; done < channel.numBlocks;) {
+        const U32 count = FW_MIN(channel.numBlocks - done, static_cast<U32>(ENTRIES_PER_READ));
+        const U64 offset = trailer.indexOffset + static_cast<U64>(channel.firstBlock + done) * TlmArchiveFormat::IndexEntry::SIZE;
+        if (offset + count * TlmArchiveFormat::IndexEntry::SIZE > static_cast<U64>(trailerOffset)) {
+            return FORMAT_ERROR;
+        }
+        status = this->readAt(file, static_cast<FwSignedSizeType>(offset), this->m_entries,
+                              count * TlmArchiveFormat::IndexEntry::SIZE);
+        if (status != QUERY_OK) {
+            return status;
+        }
+        entries.resetSer();
+        (void)entries.setBuffLen(static_cast<Fw::Serializable::SizeType>(count * TlmArchiveFormat::IndexEntry::SIZE));
+        for (U32 entry = 0; entry < count; entry++) {
+            TlmArchiveFormat::IndexEntry block;
+            if (block.deserialize(entries) != Fw::FW_SERIALIZE_OK) {
+                return FORMAT_ERROR;
+            }
+            if ((block.maxTime < query.start) or (block.minTime > query.end)) {
+                continue;
+            }
+            if (query.hasRange and
+                ((not block.hasRange) or (block.maxValue < query.low) or (block.minValue > query.high))) {
+                continue;
+            }
+            status = this->readBlock(file, block.offset, block.size, query, visitor);
+            if (status != QUERY_OK) {
+                return status;
+            }
+        }
+        done += count;
+    }
+    return QUERY_OK;
+}
+
+TlmArchiveReader::Status TlmArchiveReader::scanFile(Os::File& file,
+                                                    FwSignedSizeType fileSize,
+                                                    const Query& query,
+                                                    Visitor& visitor) {
+    FwSignedSizeType offset = TlmArchiveFormat::Header::SIZE;
+    while (offset + static_cast<FwSignedSizeType>(TlmArchiveFormat::BlockHeader::SIZE) <= fileSize) {
+        const Status status = this->readAt(file, offset, this->m_block, TlmArchiveFormat::BlockHeader::SIZE);
+        if (status != QUERY_OK) {
+            return status;
+        }
+        Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+        (void)buffer.setBuffLen(TlmArchiveFormat::BlockHeader::SIZE);
+        TlmArchiveFormat::BlockHeader header;
+        if (header.deserialize(buffer) != Fw::FW_SERIALIZE_OK) {
+            break;
+        }
+        const FwSignedSizeType size = static_cast<FwSignedSizeType>(TlmArchiveFormat::BlockHeader::SIZE) +
+                                      header.timesSize + static_cast<FwSignedSizeType>(header.count) * header.valueSize;
+        // the last block may have been cut short when the writer stopped
+        if ((header.count == 0) or (size > static_cast<FwSignedSizeType>(sizeof(this->m_block))) or
+            (offset + size > fileSize)) {
+            break;
+        }
+        if (header.id == query.id) {
+            const Status blockStatus =
+                this->readBlock(file, static_cast<U32>(offset), static_cast<U32>(size), query, visitor);
+            if (blockStatus != QUERY_OK) {
+                return blockStatus;
+            }
+        }
+        offset += size;
+    }
+    return QUERY_OK;
+}
+
+TlmArchiveReader::Status TlmArchiveReader::readBlock(Os::File& file,
+                                                     U32 offset,
+                                                     U32 size,
+                                                     const Query& query,
+                                                     Visitor& visitor) {
+    if ((size < TlmArchiveFormat::BlockHeader::SIZE) or (size > sizeof(this->m_block))) {
+        return FORMAT_ERROR;
+    }
+    const Status status = this->readAt(file, offset, this->m_block, size);
+    if (status != QUERY_OK) {
+        return status;
+    }
+    this->m_blocksRead++;
+    Fw::ExternalSerializeBuffer buffer(this->m_block, sizeof(this->m_block));
+    (void)buffer.setBuffLen(size);
+    TlmArchiveFormat::BlockHeader header;
+    if ((header.deserialize(buffer) != Fw::FW_SERIALIZE_OK) or (header.id != query.id) or
+        (TlmArchiveFormat::BlockHeader::SIZE + header.timesSize + static_cast<U32>(header.count) * header.valueSize !=
+         size)) {
+        return FORMAT_ERROR;
+    }
+
+    const U8* times = &this->m_block[TlmArchiveFormat::BlockHeader::SIZE];
+    const U8* values = times + header.timesSize;
+    FwSizeType timesOffset = 0;
+    I64 time = TlmArchiveFormat::toMicroseconds(header.firstSeconds, header.firstUSeconds);
+    for (U32 sample = 0; sample < header.count; sample++) {
+        I64 delta = 0;
+        const FwSizeType deltaSize =
+            TlmArchiveFormat::decodeVarint(&times[timesOffset], header.timesSize - timesOffset, delta);
+        if (deltaSize == 0) {
+            return FORMAT_ERROR;
+        }
+        timesOffset += deltaSize;
+        time += delta;
+        if ((time < query.start) or (time > query.end) or (time < 0)) {
+            continue;
+        }
+        const U8* value = &values[sample * header.valueSize];
+        if (query.hasRange) {
+            F64 number = 0.0;
+            if ((not TlmArchiveFormat::decodeValue(header.type, value, header.valueSize, number)) or
+                (number < query.low) or (number > query.high)) {
+                continue;
+            }
+        }
+        const Fw::Time timeTag(static_cast<TimeBase>(this->m_header.timeBase), this->m_header.context,
+                               static_cast<U32>(time / 1000000), static_cast<U32>(time % 1000000));
+        visitor.visitSample(header.id, timeTag, value, header.valueSize);
+    }
+    return QUERY_OK;
+}
+
+TlmArchiveReader::Status TlmArchiveReader::readAt(Os::File& file, FwSignedSizeType offset, U8* data, FwSizeType size) {
+    if (file.seek(offset, Os::File::SeekType::ABSOLUTE) != Os::File::OP_OK) {
+        return FILE_ERROR;
+    }
+    FwSignedSizeType readSize = static_cast<FwSignedSizeType>(size);
+    if ((file.read(data, readSize) != Os::File::OP_OK) or (readSize != static_cast<FwSignedSizeType>(size))) {
+        return FILE_ERROR;
+    }
+    this->m_bytesRead += static_cast<U64>(readSize);
+    return QUERY_OK;
+}
+
+}  // namespace Svc
@@ -0,0 +1,134 @@
+// ======================================================================
+// \title  TlmArchiveReader.hpp
+// \brief  hpp file for TlmArchiveReader, range queries of telemetry archives
+// ======================================================================
+
+#ifndef Svc_TlmArchiveReader_HPP
+#define Svc_TlmArchiveReader_HPP
+
+#include <TlmArchiveCfg.hpp>
+
+#include "Fw/Types/FileNameString.hpp"
+#include "Os/File.hpp"
+#include "Svc/TlmArchive/TlmArchiveFormat.hpp"
+
+namespace Svc {
+
+//! Reads the samples of a channel over a time range from the files written by TlmArchive
+//!
+//! Only the partitions overlapping the time range are opened. In each file, the reader reads the directory and
+//! the index entries of the channel, then only the blocks whose time range, and value range when one is asked
+//! for, overlap the query. A file without an index, left by a writer that stopped before closing it, is scanned
+//! block by block instead.
+class TlmArchiveReader {
+  public:
+    //! The query status
+    enum Status {
+        QUERY_OK,      //!< The query read every file of its partitions
+        FILE_ERROR,    //!< A file could not be read, its samples are missing from the query
+        FORMAT_ERROR,  //!< A file or a block is malformed, its samples are missing from the query
+    };
+
+    //! Receives the samples of a query
+    class Visitor {
+      public:
+        virtual ~Visitor() {}
+
+        //! Receive a sample. Samples arrive in order within a block, and blocks in file order.
+        virtual void visitSample(FwChanIdType id,          //!< The channel
+                                 const Fw::Time& timeTag,  //!< The time tag
+                                 const U8* value,          //!< The serialized value
+                                 FwSizeType size           //!< The size of the value
+                                 ) = 0;
+    };
+
+    //! Constructor
+    TlmArchiveReader();
+
+    //! Destructor
+    ~TlmArchiveReader();
+
+    //! Configure the reader with the settings of the archive
+    void configure(const Fw::StringBase& filePrefix,  //!< The file name prefix
+                   U32 partitionSeconds               //!< The number of seconds in a partition
+    );
+
+    //! Read the samples of a channel with a time tag in [start, end]
+    //! \return The query status
+    Status query(FwChanIdType id,         //!< The channel
+                 const Fw::Time& start,   //!< The earliest time tag
+                 const Fw::Time& end,     //!< The latest time tag, in the time base of start
+                 Visitor& visitor         //!< The receiver of the samples
+    );
+
+    //! Read the samples of a numeric channel with a time tag in [start, end] and a value in [low, high]
+    //! \return The query status
+    Status query(FwChanIdType id,         //!< The channel
+                 const Fw::Time& start,   //!< The earliest time tag
+                 const Fw::Time& end,     //!< The latest time tag, in the time base of start
+                 F64 low,                 //!< The lowest value
+                 F64 high,                //!< The highest value
+                 Visitor& visitor         //!< The receiver of the samples
+    );
+
+    //! Get the number of bytes read by queries
+    U64 getBytesRead() const { return this->m_bytesRead; }
+
+    //! Get the number of blocks read by queries
+    U32 getBlocksRead() const { return this->m_blocksRead; }
+
+  PRIVATE:
+    //! A query
+    struct Query {
+        FwChanIdType id;  //!< The channel
+        I64 start;        //!< The earliest time tag, in microseconds
+        I64 end;          //!< The latest time tag, in microseconds
+        bool hasRange;    //!< Whether the value range applies
+        F64 low;          //!< The lowest value
+        F64 high;         //!< The highest value
+    };
+
+    //! The number of index entries read at a time
+    static constexpr FwSizeType ENTRIES_PER_READ = 32;
+
+    //! Run a query over the partitions of its time range
+    Status run(const Query& query, const Fw::Time& start, const Fw::Time& end, Visitor& visitor);
+
+    //! Run a query over a file
+    Status queryFile(Os::File& file, const Query& query, Visitor& visitor);
+
+    //! Run a query over a file without an index
+    Status scanFile(Os::File& file, FwSignedSizeType fileSize, const Query& query, Visitor& visitor);
+
+    //! Read and decode a block
+    //! \return The status, FORMAT_ERROR if the block does not have the expected channel and size
+    Status readBlock(Os::File& file, U32 offset, U32 size, const Query& query, Visitor& visitor);
+
+    //! Read data at an offset
+    Status readAt(Os::File& file, FwSignedSizeType offset, U8* data, FwSizeType size);
+
+    //! The file name prefix
+    Fw::FileNameString m_filePrefix;
+
+    //! The number of seconds in a partition
+    U32 m_partitionSeconds;
+
+    //! The header of the file being read
+    TlmArchiveFormat::Header m_header;
+
+    //! The block being read, also scratch space for the directory
+    U8 m_block[TlmArchiveFormat::BlockHeader::SIZE + 2 * TLM_ARCHIVE_BLOCK_SIZE];
+
+    //! The index entries being read
+    U8 m_entries[ENTRIES_PER_READ * TlmArchiveFormat::IndexEntry::SIZE];
+
+    //! The number of bytes read
+    U64 m_bytesRead;
+
+    //! The number of blocks read
+    U32 m_blocksRead;
+};
+
+}  // namespace Svc
+
+#endif
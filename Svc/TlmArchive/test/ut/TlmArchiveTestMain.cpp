@@ -0,0 +1,45 @@
+// ----------------------------------------------------------------------
+// TestMain.cpp
+// ----------------------------------------------------------------------
+
+#include "TlmArchiveTester.hpp"
+
+TEST(Nominal, TlmPackets) {
+    Svc::TlmArchiveTester tester;
+    tester.testTlmPackets();
+}
+
+TEST(Nominal, PacketizedTlm) {
+    Svc::TlmArchiveTester tester;
+    tester.testPacketizedTlm();
+}
+
+TEST(Nominal, RangeQueries) {
+    Svc::TlmArchiveTester tester;
+    tester.testRangeQueries();
+}
+
+TEST(Nominal, FileRoll) {
+    Svc::TlmArchiveTester tester;
+    tester.testFileRoll();
+}
+
+TEST(Nominal, UnclosedFile) {
+    Svc::TlmArchiveTester tester;
+    tester.testUnclosedFile();
+}
+
+TEST(OffNominal, InvalidInput) {
+    Svc::TlmArchiveTester tester;
+    tester.testOffNominal();
+}
+
+TEST(Benchmark, DISABLED_Queries) {
+    Svc::TlmArchiveTester tester;
+    tester.benchmarkQueries();
+}
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
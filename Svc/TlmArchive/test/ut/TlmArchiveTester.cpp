@@ -0,0 +1,553 @@
+// ======================================================================
+// \title  TlmArchiveTester.cpp
+// \brief  cpp file for TlmArchive test harness implementation class
+// ======================================================================
+
+#include "TlmArchiveTester.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include <Fw/Com/ComPacket.hpp>
+#include <Fw/Tlm/TlmPacket.hpp>
+#include <Os/FileSystem.hpp>
+
+#define INSTANCE 0
+#define MAX_HISTORY_SIZE 100
+#define QUEUE_DEPTH 10
+
+namespace {
+
+const char* const FILE_PREFIX = "TlmArchiveTest";
+const U32 PARTITION_SECONDS = 100;
+
+const FwChanIdType COUNTER = 0x10;
+const FwChanIdType TEMPERATURE = 0x11;
+const FwChanIdType STATUS = 0x12;
+const FwSizeType STATUS_SIZE = 6;
+
+const Svc::TlmArchiveChannel CHANNELS[] = {
+    {COUNTER, Svc::TlmArchiveFormat::VALUE_U32, sizeof(U32)},
+    {TEMPERATURE, Svc::TlmArchiveFormat::VALUE_F32, sizeof(F32)},
+    {STATUS, Svc::TlmArchiveFormat::VALUE_RAW, STATUS_SIZE},
+};
+
+//! A channel of TlmPacketizer packets only
+const FwChanIdType MODE = 0x20;
+
+const Svc::TlmPacketizerChannelEntry PACKET_CHANNELS[] = {
+    {COUNTER, sizeof(U32)},
+    {TEMPERATURE, sizeof(F32)},
+    {MODE, sizeof(U16)},
+};
+
+const Svc::TlmPacketizerPacket PACKET = {PACKET_CHANNELS, 5, 1, FW_NUM_ARRAY_ELEMENTS(PACKET_CHANNELS)};
+
+U32 decodeU32(const std::vector<U8>& value) {
+    EXPECT_EQ(value.size(), sizeof(U32));
+    return (static_cast<U32>(value[0]) << 24) | (static_cast<U32>(value[1]) << 16) |
+           (static_cast<U32>(value[2]) << 8) | static_cast<U32>(value[3]);
+}
+
+F32 decodeF32(const std::vector<U8>& value) {
+    const U32 bits = decodeU32(value);
+    F32 number = 0.0f;
+    (void)memcpy(&number, &bits, sizeof(number));
+    return number;
+}
+
+void serializeValue(Fw::TlmBuffer& buffer, U32 value) {
+    buffer.resetSer();
+    ASSERT_EQ(buffer.serialize(value), Fw::FW_SERIALIZE_OK);
+}
+
+void serializeValue(Fw::TlmBuffer& buffer, F32 value) {
+    buffer.resetSer();
+    ASSERT_EQ(buffer.serialize(value), Fw::FW_SERIALIZE_OK);
+}
+
+}  // namespace
+
+namespace Svc {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+TlmArchiveTester::TlmArchiveTester() : TlmArchiveGTestBase("Tester", MAX_HISTORY_SIZE), component("TlmArchive") {
+    this->initComponents();
+    this->connectPorts();
+    this->removeFiles();
+    this->component.configure(Fw::String(FILE_PREFIX), PARTITION_SECONDS, CHANNELS, FW_NUM_ARRAY_ELEMENTS(CHANNELS));
+}
+
+TlmArchiveTester::~TlmArchiveTester() {
+    this->removeFiles();
+}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void TlmArchiveTester::testTlmPackets() {
+    // 241 seconds over three partitions
+    for (U32 second = 10; second <= 250; second++) {
+        this->sendTlmPacket(second, 500, second * 3, static_cast<F32>(second) / 4.0f);
+    }
+    // leaving a partition closes its file
+    ASSERT_EVENTS_PartitionFileClosed_SIZE(2);
+    this->closePartition();
+    ASSERT_EVENTS_PartitionFileClosed_SIZE(3);
+    ASSERT_TLM_SamplesArchived(this->tlmHistory_SamplesArchived->size() - 1, 241 * 3);
+    ASSERT_TLM_SamplesDropped_SIZE(1);
+    ASSERT_TLM_SamplesDropped(0, 0);
+    ASSERT_TLM_FilesClosed(this->tlmHistory_FilesClosed->size() - 1, 3);
+
+    TlmArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), PARTITION_SECONDS);
+    Collector counters;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, 1000, 0), counters),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(counters.samples.size(), 241u);
+    for (U32 sample = 0; sample < 241; sample++) {
+        ASSERT_EQ(counters.samples[sample].id, COUNTER);
+        ASSERT_EQ(counters.samples[sample].timeTag, Fw::Time(TB_NONE, 10 + sample, 500));
+        ASSERT_EQ(decodeU32(counters.samples[sample].value), (10 + sample) * 3);
+    }
+
+    // a range inside one partition, bounds included
+    Collector temperatures;
+    ASSERT_EQ(reader.query(TEMPERATURE, Fw::Time(TB_NONE, 150, 500), Fw::Time(TB_NONE, 160, 500), temperatures),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(temperatures.samples.size(), 11u);
+    ASSERT_EQ(decodeF32(temperatures.samples[0].value), 150.0f / 4.0f);
+    ASSERT_EQ(decodeF32(temperatures.samples[10].value), 160.0f / 4.0f);
+
+    Collector statuses;
+    ASSERT_EQ(reader.query(STATUS, Fw::Time(TB_NONE, 200, 0), Fw::Time(TB_NONE, 200, 999999), statuses),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(statuses.samples.size(), 1u);
+    const U8 status[STATUS_SIZE] = {'S', 'T', 200, 0, 0, 0};
+    ASSERT_EQ(statuses.samples[0].value, std::vector<U8>(status, status + STATUS_SIZE));
+
+    // another time base has no files
+    Collector none;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_PROC_TIME, 0, 0), Fw::Time(TB_PROC_TIME, 1000, 0), none),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(none.samples.size(), 0u);
+}
+
+void TlmArchiveTester::testPacketizedTlm() {
+    TlmPacketizerPacketList packetList;
+    packetList.list[0] = &PACKET;
+    packetList.numEntries = 1;
+    this->component.configure(Fw::String(FILE_PREFIX), PARTITION_SECONDS, CHANNELS, FW_NUM_ARRAY_ELEMENTS(CHANNELS),
+                              &packetList);
+    for (U32 second = 0; second < 50; second++) {
+        Fw::ComBuffer packet;
+        ASSERT_EQ(packet.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)),
+                  Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packet.serialize(PACKET.id), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packet.serialize(Fw::Time(TB_NONE, second, 0)), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packet.serialize(second), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packet.serialize(static_cast<F32>(second) / 2.0f), Fw::FW_SERIALIZE_OK);
+        ASSERT_EQ(packet.serialize(static_cast<U16>(second % 3)), Fw::FW_SERIALIZE_OK);
+        this->invoke_to_comIn(0, packet, 0);
+        this->component.doDispatch();
+    }
+    this->closePartition();
+    ASSERT_EVENTS_SIZE(1);
+    ASSERT_EVENTS_PartitionFileClosed_SIZE(1);
+
+    TlmArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), PARTITION_SECONDS);
+    Collector modes;
+    ASSERT_EQ(reader.query(MODE, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, 99, 0), modes),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(modes.samples.size(), 50u);
+    for (U32 sample = 0; sample < 50; sample++) {
+        ASSERT_EQ(modes.samples[sample].timeTag, Fw::Time(TB_NONE, sample, 0));
+        ASSERT_EQ(modes.samples[sample].value.size(), sizeof(U16));
+        ASSERT_EQ(modes.samples[sample].value[1], sample % 3);
+    }
+    // channels missing from the table have no value range
+    Collector ranged;
+    ASSERT_EQ(reader.query(MODE, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, 99, 0), 0.0, 10.0, ranged),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(ranged.samples.size(), 0u);
+    Collector temperatures;
+    ASSERT_EQ(reader.query(TEMPERATURE, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, 99, 0), 10.0, 12.0, temperatures),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(temperatures.samples.size(), 5u);
+    ASSERT_EQ(temperatures.samples[0].timeTag, Fw::Time(TB_NONE, 20, 0));
+}
+
+void TlmArchiveTester::testRangeQueries() {
+    this->component.configure(Fw::String(FILE_PREFIX), 10000, CHANNELS, FW_NUM_ARRAY_ELEMENTS(CHANNELS));
+    // a block holds 128 counter values
+    const U32 SECONDS = 1024;
+    for (U32 second = 0; second < SECONDS; second++) {
+        this->sendTlmPacket(second, 0, second, 20.0f);
+    }
+    this->closePartition();
+
+    TlmArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), 10000);
+    Collector all;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, SECONDS, 0), all),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(all.samples.size(), SECONDS);
+    ASSERT_EQ(reader.getBlocksRead(), SECONDS / 128);
+
+    // a time range within a block reads the block
+    const U32 blocksRead = reader.getBlocksRead();
+    const U64 bytesRead = reader.getBytesRead();
+    Collector window;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 500, 0), Fw::Time(TB_NONE, 510, 0), window),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(window.samples.size(), 11u);
+    ASSERT_EQ(decodeU32(window.samples[0].value), 500u);
+    ASSERT_EQ(reader.getBlocksRead() - blocksRead, 1u);
+    ASSERT_LT(reader.getBytesRead() - bytesRead, bytesRead / 4);
+
+    // a value range over all time reads the blocks whose range holds it
+    Collector values;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, SECONDS, 0), 700.0, 705.0, values),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(values.samples.size(), 6u);
+    ASSERT_EQ(values.samples[0].timeTag, Fw::Time(TB_NONE, 700, 0));
+    ASSERT_EQ(reader.getBlocksRead() - blocksRead, 2u);
+
+    // a value range no block holds reads no block
+    Collector hot;
+    ASSERT_EQ(reader.query(TEMPERATURE, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, SECONDS, 0), 30.0, 100.0, hot),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(hot.samples.size(), 0u);
+    ASSERT_EQ(reader.getBlocksRead() - blocksRead, 2u);
+}
+
+void TlmArchiveTester::testFileRoll() {
+    this->component.configure(Fw::String(FILE_PREFIX), 1000000, CHANNELS, FW_NUM_ARRAY_ELEMENTS(CHANNELS));
+    // more blocks than a file indexes, all in one partition
+    const U32 PACKETS = 128 * TLM_ARCHIVE_MAX_BLOCKS / 2;
+    for (U32 packet = 0; packet < PACKETS; packet++) {
+        this->sendTlmPacket(packet / 10, (packet % 10) * 100000, packet, 20.0f);
+    }
+    ASSERT_EVENTS_PartitionFileClosed_SIZE(1);
+    this->closePartition();
+    ASSERT_EVENTS_PartitionFileClosed_SIZE(2);
+    Fw::FileNameString second;
+    TlmArchiveFormat::formatFileName(second, Fw::String(FILE_PREFIX), TB_NONE, 0, 1);
+    ASSERT_EQ(Os::FileSystem::getPathType(second.toChar()), Os::FileSystem::FILE);
+
+    TlmArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), 1000000);
+    Collector counters;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, PACKETS, 0), counters),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(counters.samples.size(), PACKETS);
+    for (U32 sample = 0; sample < PACKETS; sample++) {
+        ASSERT_EQ(decodeU32(counters.samples[sample].value), sample);
+    }
+}
+
+void TlmArchiveTester::testUnclosedFile() {
+    this->component.configure(Fw::String(FILE_PREFIX), 10000, CHANNELS, FW_NUM_ARRAY_ELEMENTS(CHANNELS));
+    for (U32 second = 0; second < 300; second++) {
+        this->sendTlmPacket(second, 0, second, 20.0f);
+    }
+    // only full blocks are in the file so far, and it has no index
+    TlmArchiveReader reader;
+    reader.configure(Fw::String(FILE_PREFIX), 10000);
+    Collector partial;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, 10000, 0), partial),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(partial.samples.size(), 256u);
+    ASSERT_EQ(decodeU32(partial.samples[255].value), 255u);
+
+    this->closePartition();
+    Collector all;
+    ASSERT_EQ(reader.query(COUNTER, Fw::Time(TB_NONE, 0, 0), Fw::Time(TB_NONE, 10000, 0), all),
+              TlmArchiveReader::QUERY_OK);
+    ASSERT_EQ(all.samples.size(), 300u);
+}
+
+void TlmArchiveTester::testOffNominal() {
+    // an unknown channel drops the rest of its packet
+    Fw::TlmPacket packet;
+    ASSERT_EQ(packet.resetPktSer(), Fw::FW_SERIALIZE_OK);
+    Fw::Time timeTag(TB_NONE, 1, 0);
+    Fw::TlmBuffer value;
+    serializeValue(value, 1U);
+    ASSERT_EQ(packet.addValue(COUNTER, timeTag, value), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(packet.addValue(0x99, timeTag, value), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(packet.addValue(COUNTER, timeTag, value), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_comIn(0, packet.getBuffer(), 0);
+    this->component.doDispatch();
+    ASSERT_EVENTS_UnknownChannel_SIZE(1);
+    ASSERT_EVENTS_UnknownChannel(0, 0x99);
+    ASSERT_TLM_SamplesArchived(0, 1);
+
+    // a packetized packet needs the packet list
+    Fw::ComBuffer packetized;
+    ASSERT_EQ(packetized.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)),
+              Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(packetized.serialize(PACKET.id), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(packetized.serialize(timeTag), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_comIn(0, packetized, 0);
+    this->component.doDispatch();
+    ASSERT_EVENTS_UnknownPacket_SIZE(1);
+    ASSERT_EVENTS_UnknownPacket(0, PACKET.id);
+
+    // other packets and packets cut short are invalid
+    Fw::ComBuffer event;
+    ASSERT_EQ(event.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_LOG)), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_comIn(0, event, 0);
+    this->component.doDispatch();
+    Fw::ComBuffer truncated;
+    ASSERT_EQ(truncated.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_TELEM)),
+              Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(truncated.serialize(COUNTER), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(truncated.serialize(timeTag), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(truncated.serialize(static_cast<U16>(1)), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_comIn(0, truncated, 0);
+    this->component.doDispatch();
+    ASSERT_EVENTS_InvalidPacket_SIZE(2);
+
+    // channels beyond the column table are dropped
+    static TlmPacketizerChannelEntry manyChannels[TLM_ARCHIVE_MAX_CHANNELS + 5];
+    for (FwSizeType channel = 0; channel < FW_NUM_ARRAY_ELEMENTS(manyChannels); channel++) {
+        manyChannels[channel].id = static_cast<FwChanIdType>(0x1000 + channel);
+        manyChannels[channel].size = 1;
+    }
+    const TlmPacketizerPacket manyPacket = {manyChannels, 6, 1, FW_NUM_ARRAY_ELEMENTS(manyChannels)};
+    TlmPacketizerPacketList packetList;
+    packetList.list[0] = &manyPacket;
+    packetList.numEntries = 1;
+    this->component.configure(Fw::String(FILE_PREFIX), PARTITION_SECONDS, CHANNELS, FW_NUM_ARRAY_ELEMENTS(CHANNELS),
+                              &packetList);
+    Fw::ComBuffer many;
+    ASSERT_EQ(many.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)),
+              Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(many.serialize(manyPacket.id), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(many.serialize(timeTag), Fw::FW_SERIALIZE_OK);
+    for (FwSizeType channel = 0; channel < FW_NUM_ARRAY_ELEMENTS(manyChannels); channel++) {
+        ASSERT_EQ(many.serialize(static_cast<U8>(channel)), Fw::FW_SERIALIZE_OK);
+    }
+    this->invoke_to_comIn(0, many, 0);
+    this->component.doDispatch();
+    // one column is already taken by the counter
+    ASSERT_EVENTS_ChannelTableFull_SIZE(6);
+    ASSERT_EVENTS_ChannelTableFull(0, 0x1000 + TLM_ARCHIVE_MAX_CHANNELS - 1);
+    ASSERT_TLM_SamplesDropped(this->tlmHistory_SamplesDropped->size() - 1, 6);
+
+    this->closePartition();
+    ASSERT_EVENTS_PartitionFileClosed_SIZE(1);
+}
+
+void TlmArchiveTester::benchmarkQueries() {
+    // Twenty channels at 1 Hz for three days, in one hour partitions
+    const U32 NUM_CHANNELS = 20;
+    const U32 SECONDS = 3 * 24 * 3600;
+    const U32 HOUR = 3600;
+    TlmArchiveChannel channels[NUM_CHANNELS];
+    for (U32 channel = 0; channel < NUM_CHANNELS; channel++) {
+        channels[channel].id = 0x100 + channel;
+        channels[channel].type = (channel % 2 == 0) ? TlmArchiveFormat::VALUE_U32 : TlmArchiveFormat::VALUE_F32;
+        channels[channel].size = sizeof(U32);
+    }
+    this->component.configure(Fw::String(FILE_PREFIX), HOUR, channels, NUM_CHANNELS);
+
+    // the same packets in a ComLogger file: a U16 length, then the packet
+    const char* const comLoggerFile = "TlmArchiveTest.com";
+    Os::File comLogger;
+    ASSERT_EQ(comLogger.open(comLoggerFile, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    for (U32 second = 0; second < SECONDS; second++) {
+        Fw::TlmPacket packet;
+        ASSERT_EQ(packet.resetPktSer(), Fw::FW_SERIALIZE_OK);
+        Fw::Time timeTag(TB_NONE, second, 0);
+        for (U32 channel = 0; channel < NUM_CHANNELS; channel++) {
+            Fw::TlmBuffer value;
+            if (channel % 2 == 0) {
+                serializeValue(value, second / (60 * (channel + 1)));
+            } else {
+                // a temperature with a rare excursion
+                const bool hot = (channel == 1) and (second % 20000 < 5);
+                serializeValue(value, static_cast<F32>((hot ? 80.0 : 20.0) + sin(second / (100.0 + channel))));
+            }
+            ASSERT_EQ(packet.addValue(channels[channel].id, timeTag, value), Fw::FW_SERIALIZE_OK);
+        }
+        this->invoke_to_comIn(0, packet.getBuffer(), 0);
+        this->component.doDispatch();
+        U8 length[sizeof(U16)];
+        Fw::ExternalSerializeBuffer lengthBuffer(length, sizeof(length));
+        ASSERT_EQ(lengthBuffer.serialize(static_cast<U16>(packet.getBuffer().getBuffLength())), Fw::FW_SERIALIZE_OK);
+        FwSignedSizeType size = sizeof(length);
+        ASSERT_EQ(comLogger.write(length, size), Os::File::OP_OK);
+        size = packet.getBuffer().getBuffLength();
+        ASSERT_EQ(comLogger.write(packet.getBuffer().getBuffAddr(), size), Os::File::OP_OK);
+    }
+    comLogger.close();
+    this->closePartition();
+
+    struct Query {
+        const char* name;
+        FwChanIdType id;
+        U32 start;
+        U32 end;
+        bool hasRange;
+        F64 low;
+        F64 high;
+    } queries[] = {
+        {"one channel, one hour", 0x100, SECONDS / 2, SECONDS / 2 + HOUR - 1, false, 0.0, 0.0},
+        {"one channel, three days", 0x100, 0, SECONDS - 1, false, 0.0, 0.0},
+        {"one channel above 70, three days", 0x101, 0, SECONDS - 1, true, 70.0, 1000.0},
+    };
+
+    for (const Query& query : queries) {
+        // scan the ComLogger file, decoding every packet
+        auto start = std::chrono::steady_clock::now();
+        U64 scanBytes = 0;
+        U32 scanSamples = 0;
+        ASSERT_EQ(comLogger.open(comLoggerFile, Os::File::OPEN_READ), Os::File::OP_OK);
+        while (true) {
+            U8 length[sizeof(U16)];
+            FwSignedSizeType size = sizeof(length);
+            if ((comLogger.read(length, size) != Os::File::OP_OK) or (size != sizeof(length))) {
+                break;
+            }
+            Fw::ComBuffer packet;
+            const FwSignedSizeType packetSize = (static_cast<FwSignedSizeType>(length[0]) << 8) | length[1];
+            size = packetSize;
+            ASSERT_EQ(comLogger.read(packet.getBuffAddr(), size), Os::File::OP_OK);
+            ASSERT_EQ(size, packetSize);
+            scanBytes += sizeof(length) + static_cast<U64>(size);
+            ASSERT_EQ(packet.setBuffLen(static_cast<Fw::Serializable::SizeType>(size)), Fw::FW_SERIALIZE_OK);
+            FwPacketDescriptorType descriptor = 0;
+            ASSERT_EQ(packet.deserialize(descriptor), Fw::FW_SERIALIZE_OK);
+            while (packet.getBuffLeft() > 0) {
+                FwChanIdType id = 0;
+                Fw::Time timeTag;
+                ASSERT_EQ(packet.deserialize(id), Fw::FW_SERIALIZE_OK);
+                ASSERT_EQ(packet.deserialize(timeTag), Fw::FW_SERIALIZE_OK);
+                if ((id == query.id) and (timeTag.getSeconds() >= query.start) and
+                    (timeTag.getSeconds() <= query.end)) {
+                    F64 number = 0.0;
+                    const U8* value = packet.getBuffAddr() + (packet.getBuffLength() - packet.getBuffLeft());
+                    const bool numeric = TlmArchiveFormat::decodeValue(channels[id - 0x100].type, value, sizeof(U32),
+                                                                       number);
+                    if ((not query.hasRange) or (numeric and (number >= query.low) and (number <= query.high))) {
+                        scanSamples++;
+                    }
+                }
+                ASSERT_EQ(packet.deserializeSkip(sizeof(U32)), Fw::FW_SERIALIZE_OK);
+            }
+        }
+        comLogger.close();
+        const double scanSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // query the archive
+        start = std::chrono::steady_clock::now();
+        TlmArchiveReader reader;
+        reader.configure(Fw::String(FILE_PREFIX), HOUR);
+        Collector collector;
+        const Fw::Time startTime(TB_NONE, query.start, 0);
+        const Fw::Time endTime(TB_NONE, query.end, 0);
+        const TlmArchiveReader::Status status =
+            query.hasRange ? reader.query(query.id, startTime, endTime, query.low, query.high, collector)
+                           : reader.query(query.id, startTime, endTime, collector);
+        const double archiveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        ASSERT_EQ(status, TlmArchiveReader::QUERY_OK);
+        ASSERT_EQ(collector.samples.size(), scanSamples);
+
+        printf("%s: %" PRIu32 " samples, ComLogger scan %.1f ms reading %" PRIu64 " bytes, archive %.1f ms reading %" PRIu64
+               " bytes in %" PRIu32 " blocks\n",
+               query.name, scanSamples, scanSeconds * 1000.0, scanBytes, archiveSeconds * 1000.0, reader.getBytesRead(),
+               reader.getBlocksRead());
+    }
+    (void)Os::FileSystem::removeFile(comLoggerFile);
+    for (U32 partition = 0; partition < SECONDS; partition += HOUR) {
+        Fw::FileNameString fileName;
+        TlmArchiveFormat::formatFileName(fileName, Fw::String(FILE_PREFIX), TB_NONE, partition, 0);
+        (void)Os::FileSystem::removeFile(fileName.toChar());
+    }
+}
+
+// ----------------------------------------------------------------------
+// Types
+// ----------------------------------------------------------------------
+
+void TlmArchiveTester::Collector::visitSample(FwChanIdType id,
+                                              const Fw::Time& timeTag,
+                                              const U8* value,
+                                              FwSizeType size) {
+    Sample sample;
+    sample.id = id;
+    sample.timeTag = timeTag;
+    sample.value.assign(value, value + size);
+    this->samples.push_back(sample);
+}
+
+// ----------------------------------------------------------------------
+// Helper methods
+// ----------------------------------------------------------------------
+
+void TlmArchiveTester::sendTlmPacket(U32 seconds, U32 useconds, U32 counter, F32 temperature) {
+    Fw::TlmPacket packet;
+    ASSERT_EQ(packet.resetPktSer(), Fw::FW_SERIALIZE_OK);
+    Fw::Time timeTag(TB_NONE, seconds, useconds);
+    Fw::TlmBuffer value;
+    serializeValue(value, counter);
+    ASSERT_EQ(packet.addValue(COUNTER, timeTag, value), Fw::FW_SERIALIZE_OK);
+    serializeValue(value, temperature);
+    ASSERT_EQ(packet.addValue(TEMPERATURE, timeTag, value), Fw::FW_SERIALIZE_OK);
+    const U8 status[STATUS_SIZE] = {'S', 'T', static_cast<U8>(seconds), 0, 0, 0};
+    value.resetSer();
+    ASSERT_EQ(value.serialize(status, STATUS_SIZE, Fw::Serialization::OMIT_LENGTH), Fw::FW_SERIALIZE_OK);
+    ASSERT_EQ(packet.addValue(STATUS, timeTag, value), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_comIn(0, packet.getBuffer(), 0);
+    this->component.doDispatch();
+}
+
+void TlmArchiveTester::closePartition() {
+    this->sendCmd_CLOSE_PARTITION(INSTANCE, 0);
+    this->component.doDispatch();
+    ASSERT_CMD_RESPONSE(this->cmdResponseHistory->size() - 1, TlmArchiveComponentBase::OPCODE_CLOSE_PARTITION, 0,
+                        Fw::CmdResponse::OK);
+}
+
+void TlmArchiveTester::removeFiles() {
+    const U32 partitionSizes[] = {PARTITION_SECONDS, 10000, 1000000};
+    for (U32 partitionSeconds : partitionSizes) {
+        for (U32 partition = 0; partition < 3; partition++) {
+            for (U32 fileNumber = 0; fileNumber < 3; fileNumber++) {
+                Fw::FileNameString fileName;
+                TlmArchiveFormat::formatFileName(fileName, Fw::String(FILE_PREFIX), TB_NONE,
+                                                 partition * partitionSeconds, fileNumber);
+                (void)Os::FileSystem::removeFile(fileName.toChar());
+            }
+        }
+    }
+}
+
+void TlmArchiveTester::connectPorts() {
+    this->connect_to_comIn(0, this->component.get_comIn_InputPort(0));
+    this->connect_to_pingIn(0, this->component.get_pingIn_InputPort(0));
+    this->connect_to_cmdIn(0, this->component.get_cmdIn_InputPort(0));
+    this->component.set_pingOut_OutputPort(0, this->get_from_pingOut(0));
+    this->component.set_cmdRegIn_OutputPort(0, this->get_from_cmdRegIn(0));
+    this->component.set_cmdResponseOut_OutputPort(0, this->get_from_cmdResponseOut(0));
+    this->component.set_timeGetOut_OutputPort(0, this->get_from_timeGetOut(0));
+    this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
+    this->component.set_eventOut_OutputPort(0, this->get_from_eventOut(0));
+    this->component.set_textEventOut_OutputPort(0, this->get_from_textEventOut(0));
+}
+
+void TlmArchiveTester::initComponents() {
+    this->init();
+    this->component.init(QUEUE_DEPTH, INSTANCE);
+}
+
+}  // end namespace Svc
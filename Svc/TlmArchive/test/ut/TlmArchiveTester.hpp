@@ -0,0 +1,117 @@
+// ======================================================================
+// \title  TlmArchiveTester.hpp
+// \brief  hpp file for TlmArchive test harness implementation class
+// ======================================================================
+
+#ifndef TESTER_HPP
+#define TESTER_HPP
+
+#include <vector>
+
+#include "Svc/TlmArchive/TlmArchive.hpp"
+#include "Svc/TlmArchive/TlmArchiveReader.hpp"
+#include "TlmArchiveGTestBase.hpp"
+
+namespace Svc {
+
+class TlmArchiveTester : public TlmArchiveGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object TlmArchiveTester
+    //!
+    TlmArchiveTester();
+
+    //! Destroy object TlmArchiveTester
+    //!
+    ~TlmArchiveTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Archive TlmChan packets over several partitions and read them back
+    //!
+    void testTlmPackets();
+
+    //! Archive TlmPacketizer packets and read them back
+    //!
+    void testPacketizedTlm();
+
+    //! Check that time and value range queries only read the blocks they need
+    //!
+    void testRangeQueries();
+
+    //! Fill the index of a file so that the partition continues in a second file
+    //!
+    void testFileRoll();
+
+    //! Read a file whose writer stopped before writing the index
+    //!
+    void testUnclosedFile();
+
+    //! Drop unknown channels, unknown packets and invalid packets
+    //!
+    void testOffNominal();
+
+    //! Compare archive queries with a scan of ComLogger files
+    //!
+    void benchmarkQueries();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Types
+    // ----------------------------------------------------------------------
+
+    //! A sample read back from the archive
+    struct Sample {
+        FwChanIdType id;
+        Fw::Time timeTag;
+        std::vector<U8> value;
+    };
+
+    //! Collects the samples of a query
+    class Collector : public TlmArchiveReader::Visitor {
+      public:
+        void visitSample(FwChanIdType id, const Fw::Time& timeTag, const U8* value, FwSizeType size) override;
+        std::vector<Sample> samples;
+    };
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper methods
+    // ----------------------------------------------------------------------
+
+    //! Connect ports
+    //!
+    void connectPorts();
+
+    //! Initialize components
+    //!
+    void initComponents();
+
+    //! Send a TlmChan packet with one value of each channel
+    void sendTlmPacket(U32 seconds, U32 useconds, U32 counter, F32 temperature);
+
+    //! Send the CLOSE_PARTITION command
+    void closePartition();
+
+    //! Remove the archive files of the test
+    void removeFiles();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    //!
+    TlmArchive component;
+};
+
+}  // end namespace Svc
+
+#endif
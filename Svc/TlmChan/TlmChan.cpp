@@ -13,10 +13,19 @@
 #include <Fw/Com/ComBuffer.hpp>
 #include <Fw/Types/Assert.hpp>
 #include <Svc/TlmChan/TlmChan.hpp>
+#include <cmath>
+#include <cstring>
 
 namespace Svc {
 
-TlmChan::TlmChan(const char* name) : TlmChanComponentBase(name), m_activeBuffer(0) {
+TlmChan::TlmChan(const char* name)
+    : TlmChanComponentBase(name),
+      m_activeBuffer(0),
+      m_numChanStates(0),
+      m_filters(nullptr),
+      m_numFilters(0),
+      m_defaultFilter(nullptr),
+      m_suppressed(0) {
     // clear slot pointers
     for (NATIVE_UINT_TYPE entry = 0; entry < TLMCHAN_NUM_TLM_HASH_SLOTS; entry++) {
         this->m_tlmEntries[0].slots[entry] = nullptr;
@@ -42,6 +51,150 @@ TlmChan::TlmChan(const char* name) : TlmChanComponentBase(name), m_activeBuffer(
 
 TlmChan::~TlmChan() {}
 
+void TlmChan::setFilters(const TlmChanFilter* filters,
+                         NATIVE_UINT_TYPE numFilters,
+                         const TlmChanFilter* defaultFilter) {
+    FW_ASSERT(filters or (numFilters == 0));
+    this->lock();
+    this->m_filters = filters;
+    this->m_numFilters = numFilters;
+    this->m_defaultFilter = defaultFilter;
+    // channels already written take their new filter
+    for (NATIVE_UINT_TYPE state = 0; state < this->m_numChanStates; state++) {
+        this->m_chanStates[state].filter = this->findFilter(this->m_chanStates[state].id);
+        this->m_chanStates[state].sent = false;
+    }
+    this->unLock();
+}
+
+const TlmChanFilter* TlmChan::findFilter(FwChanIdType id) const {
+    for (NATIVE_UINT_TYPE filter = 0; filter < this->m_numFilters; filter++) {
+        if (this->m_filters[filter].id == id) {
+            return &this->m_filters[filter];
+        }
+    }
+    return this->m_defaultFilter;
+}
+
+NATIVE_UINT_TYPE TlmChan::getChanState(FwChanIdType id) {
+    // the channel may already have a bucket in the other buffer
+    const TlmEntry* other = this->findEntry(1 - this->m_activeBuffer, id);
+    if (other) {
+        return other->state;
+    }
+    FW_ASSERT(this->m_numChanStates < TLMCHAN_HASH_BUCKETS, static_cast<FwAssertArgType>(this->m_numChanStates));
+    ChanState& state = this->m_chanStates[this->m_numChanStates];
+    state.id = id;
+    state.filter = this->findFilter(id);
+    state.sent = false;
+    state.lastBuffer = this->m_activeBuffer;
+    return this->m_numChanStates++;
+}
+
+TlmChan::TlmEntry* TlmChan::findEntry(U32 buffer, FwChanIdType id) {
+    FW_ASSERT(buffer < 2, static_cast<FwAssertArgType>(buffer));
+    for (TlmEntry* entry = this->m_tlmEntries[buffer].slots[this->doHash(id)]; entry != nullptr; entry = entry->next) {
+        if (entry->id == id) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+U64 TlmChan::fingerprint(const U8* data, FwSizeType length) {
+    U64 value = 0;
+    if (length <= sizeof(value)) {
+        // short values are compared exactly
+        memcpy(&value, data, static_cast<size_t>(length));
+    } else {
+        // FNV-1a
+        value = 0xCBF29CE484222325ULL;
+        for (FwSizeType byte = 0; byte < length; byte++) {
+            value = (value ^ data[byte]) * 0x100000001B3ULL;
+        }
+    }
+    return value;
+}
+
+bool TlmChan::decodeValue(TlmChanValueType type, Fw::TlmBuffer& val, F64& value) {
+    Fw::ExternalSerializeBuffer buff(val.getBuffAddr(), val.getBuffLength());
+    Fw::SerializeStatus stat = buff.setBuffLen(val.getBuffLength());
+    FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, static_cast<NATIVE_INT_TYPE>(stat));
+    switch (type) {
+#define TLMCHAN_DECODE(TYPE)                   \
+    case TLMCHAN_VALUE_##TYPE: {               \
+        TYPE decoded = 0;                      \
+        stat = buff.deserialize(decoded);      \
+        value = static_cast<F64>(decoded);     \
+        break;                                 \
+    }
+        TLMCHAN_DECODE(U8)
+        TLMCHAN_DECODE(I8)
+        TLMCHAN_DECODE(U16)
+        TLMCHAN_DECODE(I16)
+        TLMCHAN_DECODE(U32)
+        TLMCHAN_DECODE(I32)
+        TLMCHAN_DECODE(U64)
+        TLMCHAN_DECODE(I64)
+        TLMCHAN_DECODE(F32)
+        TLMCHAN_DECODE(F64)
+#undef TLMCHAN_DECODE
+        default:
+            return false;
+    }
+    return (Fw::FW_SERIALIZE_OK == stat) and (buff.getBuffLeft() == 0);
+}
+
+bool TlmChan::passFilter(ChanState& state, const Fw::Time& timeTag, Fw::TlmBuffer& val) {
+    const TlmChanFilter* filter = state.filter;
+    if (filter == nullptr) {
+        return true;
+    }
+    const FwSizeType length = val.getBuffLength();
+    const U64 print = fingerprint(val.getBuffAddr(), length);
+    F64 value = 0.0;
+    const bool numeric = (filter->mode != TLMCHAN_FILTER_ON_CHANGE) and decodeValue(filter->type, val, value);
+
+    bool pass = true;
+    if (state.sent) {
+        const Fw::Time::Comparison order = Fw::Time::compare(timeTag, state.sentTime);
+        // a time tag from another time base or going backwards sends the update
+        bool stale = true;
+        if ((Fw::Time::GT == order) or (Fw::Time::EQ == order)) {
+            stale = (filter->maxStaleness != 0) and
+                    (timeTag.getSeconds() - state.sentTime.getSeconds() >= filter->maxStaleness);
+        }
+        if (not stale) {
+            switch (filter->mode) {
+                case TLMCHAN_FILTER_ON_CHANGE:
+                    pass = (length != state.length) or (print != state.fingerprint);
+                    break;
+                case TLMCHAN_FILTER_ABSOLUTE:
+                    // a value that does not decode as the type is sent as is
+                    pass = (not numeric) or not(fabs(value - state.value) <= filter->deadband);
+                    break;
+                case TLMCHAN_FILTER_RELATIVE:
+                    pass = (not numeric) or not(fabs(value - state.value) <= filter->deadband * fabs(state.value));
+                    break;
+                default:
+                    FW_ASSERT(0, filter->mode);
+                    break;
+            }
+        }
+    }
+
+    if (pass) {
+        state.sent = true;
+        state.length = length;
+        state.fingerprint = print;
+        state.value = value;
+        state.sentTime = timeTag;
+    } else {
+        this->m_suppressed++;
+    }
+    return pass;
+}
+
 NATIVE_UINT_TYPE TlmChan::doHash(FwChanIdType id) {
     return (id % TLMCHAN_HASH_MOD_VALUE) % TLMCHAN_NUM_TLM_HASH_SLOTS;
 }
@@ -52,25 +205,16 @@ void TlmChan::pingIn_handler(const NATIVE_INT_TYPE portNum, U32 key) {
 }
 
 void TlmChan::TlmGet_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time& timeTag, Fw::TlmBuffer& val) {
-    // Compute index for entry
-
-    NATIVE_UINT_TYPE index = this->doHash(id);
-
-    // Search to see if channel has been stored
-    TlmEntry* entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
-    for (NATIVE_UINT_TYPE bucket = 0; bucket < TLMCHAN_HASH_BUCKETS; bucket++) {
-        if (entryToUse) {  // If bucket exists, check id
-            if (entryToUse->id == id) {
-                break;
-            } else {  // otherwise go to next bucket
-                entryToUse = entryToUse->next;
-            }
-        } else {  // no buckets left to search
-            break;
-        }
+    // Search to see if channel has been stored in either buffer
+    TlmEntry* entryToUse = this->findEntry(this->m_activeBuffer, id);
+    if (entryToUse == nullptr) {
+        entryToUse = this->findEntry(1 - this->m_activeBuffer, id);
     }
 
     if (entryToUse) {
+        // the latest value is in the other buffer until the channel is written after the buffers are swapped
+        entryToUse = this->findEntry(this->m_chanStates[entryToUse->state].lastBuffer, id);
+        FW_ASSERT(entryToUse, static_cast<FwAssertArgType>(id));
         val = entryToUse->buffer;
         timeTag = entryToUse->lastUpdate;
     } else {  // requested entry may not be written yet; empty buffer
@@ -106,6 +250,7 @@ void TlmChan::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time
                 prevEntry->next = entryToUse;
                 // clear next pointer
                 entryToUse->next = nullptr;
+                entryToUse->state = this->getChanState(id);
                 break;
             }
         }
@@ -117,15 +262,32 @@ void TlmChan::TlmRecv_handler(NATIVE_INT_TYPE portNum, FwChanIdType id, Fw::Time
             &this->m_tlmEntries[this->m_activeBuffer].buckets[this->m_tlmEntries[this->m_activeBuffer].free++];
         entryToUse = this->m_tlmEntries[this->m_activeBuffer].slots[index];
         entryToUse->next = nullptr;
+        entryToUse->state = this->getChanState(id);
     }
 
-    // copy into entry
     FW_ASSERT(entryToUse);
+    // claim the entry even when the update is dropped, so the channel is found next time
     entryToUse->used = true;
     entryToUse->id = id;
+    ChanState& state = this->m_chanStates[entryToUse->state];
+    // drop updates the filter of the channel suppresses
+    if (not this->passFilter(state, timeTag, val)) {
+        // seed the entry with the last value sent, so it holds a value whichever buffer is active
+        if (state.lastBuffer != this->m_activeBuffer) {
+            const TlmEntry* lastEntry = this->findEntry(state.lastBuffer, id);
+            FW_ASSERT(lastEntry, static_cast<FwAssertArgType>(id));
+            entryToUse->lastUpdate = lastEntry->lastUpdate;
+            entryToUse->buffer = lastEntry->buffer;
+            state.lastBuffer = this->m_activeBuffer;
+        }
+        return;
+    }
+
+    // copy into entry
     entryToUse->updated = true;
     entryToUse->lastUpdate = timeTag;
     entryToUse->buffer = val;
+    state.lastBuffer = this->m_activeBuffer;
 }
 
 void TlmChan::Run_handler(NATIVE_INT_TYPE portNum, U32 context) {
@@ -142,8 +304,12 @@ void TlmChan::Run_handler(NATIVE_INT_TYPE portNum, U32 context) {
     for (U32 entry = 0; entry < TLMCHAN_HASH_BUCKETS; entry++) {
         this->m_tlmEntries[this->m_activeBuffer].buckets[entry].updated = false;
     }
+    const U32 suppressed = this->m_suppressed;
     this->unLock();
 
+    // written outside the lock, since the update comes back through TlmRecv
+    this->tlmWrite_SuppressedUpdates(suppressed);
+
     // go through each entry and send a packet if it has been updated
     Fw::TlmPacket pkt;
     pkt.resetPktSer();
@@ -15,6 +15,7 @@
 
 #include <Fw/Tlm/TlmPacket.hpp>
 #include <Svc/TlmChan/TlmChanComponentAc.hpp>
+#include <Svc/TlmChan/TlmChanTypes.hpp>
 #include <TlmChanImplCfg.hpp>
 
 namespace Svc {
@@ -24,6 +25,13 @@ class TlmChan : public TlmChanComponentBase {
     TlmChan(const char* compName);
     virtual ~TlmChan();
 
+    //! Set the filters deciding which channel updates are sent. Updates of a channel
+    //! without a filter are always sent, unless a default filter is given.
+    void setFilters(const TlmChanFilter* filters,                 //!< filters, one per channel
+                    NATIVE_UINT_TYPE numFilters,                  //!< number of filters
+                    const TlmChanFilter* defaultFilter = nullptr  //!< filter of channels not in filters
+    );
+
   PROTECTED:
     // can be overridden for alternate algorithms
     virtual NATIVE_UINT_TYPE doHash(FwChanIdType id);
@@ -47,6 +55,7 @@ class TlmChan : public TlmChanComponentBase {
         tlmEntry* next;             //!< pointer to next bucket in table
         bool used;                  //!< if entry has been used
         NATIVE_UINT_TYPE bucketNo;  //!< for testing
+        NATIVE_UINT_TYPE state;     //!< index of channel state, shared by both buffers
     } TlmEntry;
 
     struct TlmSet {
@@ -56,6 +65,48 @@ class TlmChan : public TlmChanComponentBase {
     } m_tlmEntries[2];
 
     U32 m_activeBuffer;  // !< which buffer is active for storing telemetry
+
+    //! Filter state of a channel
+    struct ChanState {
+        FwChanIdType id;              //!< telemetry id
+        const TlmChanFilter* filter;  //!< filter of channel, or nullptr to send every update
+        bool sent;                    //!< if a value has been accepted for sending
+        FwSizeType length;            //!< length of last value sent
+        U64 fingerprint;              //!< last value sent, or a hash of it when longer than 8 bytes
+        F64 value;                    //!< numeric last value sent, for deadband filters
+        Fw::Time sentTime;            //!< time tag of last value sent
+        U32 lastBuffer;               //!< buffer whose bucket holds the latest value stored
+    };
+
+    ChanState m_chanStates[TLMCHAN_HASH_BUCKETS];  //!< filter state of each channel
+    NATIVE_UINT_TYPE m_numChanStates;              //!< number of channel states in use
+
+    const TlmChanFilter* m_filters;        //!< channel filters
+    NATIVE_UINT_TYPE m_numFilters;         //!< number of channel filters
+    const TlmChanFilter* m_defaultFilter;  //!< filter of channels without one
+
+    U32 m_suppressed;  //!< number of updates suppressed by filters
+
+    //! Get the state of a channel for a new bucket, shared with the bucket of the other buffer
+    NATIVE_UINT_TYPE getChanState(FwChanIdType id);
+
+    //! Find the bucket of a channel in a buffer
+    //! \return the bucket, or nullptr if the channel has none in the buffer
+    TlmEntry* findEntry(U32 buffer, FwChanIdType id);
+
+    //! Find the filter of a channel
+    const TlmChanFilter* findFilter(FwChanIdType id) const;
+
+    //! Check an update against the filter of the channel, and record it as sent if it passes
+    //! \return true if the update is to be sent
+    bool passFilter(ChanState& state, const Fw::Time& timeTag, Fw::TlmBuffer& val);
+
+    //! Compute the fingerprint of a value
+    static U64 fingerprint(const U8* data, FwSizeType length);
+
+    //! Decode a numeric value
+    //! \return true if the value decoded as the type
+    static bool decodeValue(TlmChanValueType type, Fw::TlmBuffer& val, F64& value);
 };
 
 }  // namespace Svc
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief Types for filtering telemetry channel updates in Svc::TlmChan
+ *
+ * \copyright
+ * Copyright 2009-2015, by the California Institute of Technology.
+ * ALL RIGHTS RESERVED.  United States Government Sponsorship
+ * acknowledged.
+ * <br /><br />
+ */
+
+#ifndef SVC_TLMCHAN_TLMCHANTYPES_HPP_
+#define SVC_TLMCHAN_TLMCHANTYPES_HPP_
+
+#include <FpConfig.hpp>
+
+namespace Svc {
+
+// how an update is compared with the last value of the channel that was sent
+enum TlmChanFilterMode {
+    TLMCHAN_FILTER_ON_CHANGE,  // Suppress updates bit-identical to the last value sent
+    TLMCHAN_FILTER_ABSOLUTE,   // Suppress updates within deadband of the last value sent
+    TLMCHAN_FILTER_RELATIVE,   // Suppress updates within deadband times the magnitude of the last value sent
+};
+
+// type of the channel value, needed to compare values against a deadband
+enum TlmChanValueType {
+    TLMCHAN_VALUE_U8,
+    TLMCHAN_VALUE_I8,
+    TLMCHAN_VALUE_U16,
+    TLMCHAN_VALUE_I16,
+    TLMCHAN_VALUE_U32,
+    TLMCHAN_VALUE_I32,
+    TLMCHAN_VALUE_U64,
+    TLMCHAN_VALUE_I64,
+    TLMCHAN_VALUE_F32,
+    TLMCHAN_VALUE_F64,
+};
+
+struct TlmChanFilter {
+    FwChanIdType id;         //!< Id of channel, unused for the default filter
+    TlmChanFilterMode mode;  //!< comparison with the last value sent
+    TlmChanValueType type;   //!< type of value, for deadband modes
+    F64 deadband;            //!< deadband, for deadband modes
+    U32 maxStaleness;        //!< seconds after the last value sent to send an update regardless, zero for never
+};
+
+}  // namespace Svc
+
+#endif /* SVC_TLMCHAN_TLMCHANTYPES_HPP_ */
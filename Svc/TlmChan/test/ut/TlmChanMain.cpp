@@ -44,6 +44,25 @@ TEST(TlmChanTest, OffNominal) {
     tester.runOffNominal();
 }
 
+TEST(TlmChanTest, FilterTest) {
+    TEST_CASE(107.1.3, "Filtered channelized telemetry");
+    COMMENT("Write channels with on-change and deadband filters and verify which updates are pushed.");
+
+    Svc::TlmChanTester tester;
+
+    // run test
+    tester.runFilters();
+}
+
+TEST(TlmChanTest, DISABLED_BandwidthBenchmark) {
+    COMMENT("Measure bytes pushed per second for a housekeeping mix with and without filters.");
+
+    Svc::TlmChanTester tester;
+
+    // run test
+    tester.runBandwidth();
+}
+
 // TEST(TlmChanTest,TooManyChannels) {
 
 //     COMMENT("Too Many Channel Test");
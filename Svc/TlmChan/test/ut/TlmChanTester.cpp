@@ -6,6 +6,9 @@
 
 #include "TlmChanTester.hpp"
 #include <Fw/Test/UnitTest.hpp>
+#include <cmath>
+#include <cstdio>
+#include <random>
 
 #define INSTANCE 0
 #define MAX_HISTORY_SIZE 10
@@ -25,7 +28,7 @@ namespace Svc {
 // ----------------------------------------------------------------------
 
 TlmChanTester ::TlmChanTester()
-    : TlmChanGTestBase("Tester", MAX_HISTORY_SIZE), component("TlmChan"), m_numBuffs(0), m_bufferRecv(false) {
+    : TlmChanGTestBase("Tester", MAX_HISTORY_SIZE), component("TlmChan"), m_numBuffs(0), m_bufferRecv(false), m_bytesSent(0) {
     this->initComponents();
     this->connectPorts();
 }
@@ -132,6 +135,185 @@ void TlmChanTester::runOffNominal() {
     ASSERT_EQ(0u, buff.getBuffLength());
 }
 
+void TlmChanTester::runFilters() {
+    const TlmChanFilter filters[] = {
+        {27, TLMCHAN_FILTER_ON_CHANGE, TLMCHAN_VALUE_U32, 0.0, 0},
+        {28, TLMCHAN_FILTER_ABSOLUTE, TLMCHAN_VALUE_U32, 5.0, 10},
+        {29, TLMCHAN_FILTER_RELATIVE, TLMCHAN_VALUE_F32, 0.1, 0},
+    };
+    this->component.setFilters(filters, FW_NUM_ARRAY_ELEMENTS(filters));
+
+    // first values are always sent
+    this->clearBuffs();
+    this->sendValue<U32>(27, 10, 0);
+    this->sendValue<U32>(28, 100, 0);
+    this->sendValue<F32>(29, 50.0f, 0);
+    this->sendValue<U32>(30, 1, 0);
+    this->doRun(true);
+    ASSERT_TRUE(this->isSent(27));
+    ASSERT_TRUE(this->isSent(28));
+    ASSERT_TRUE(this->isSent(29));
+    ASSERT_TRUE(this->isSent(30));
+    ASSERT_TLM_SuppressedUpdates_SIZE(1);
+    ASSERT_TLM_SuppressedUpdates(0, 0u);
+
+    // unchanged or within deadband values are suppressed, channels without a filter are sent
+    this->clearBuffs();
+    this->clearTlm();
+    this->sendValue<U32>(27, 10, 1);
+    this->sendValue<U32>(28, 105, 1);
+    this->sendValue<F32>(29, 54.0f, 1);
+    this->sendValue<U32>(30, 1, 1);
+    this->doRun(true);
+    ASSERT_FALSE(this->isSent(27));
+    ASSERT_FALSE(this->isSent(28));
+    ASSERT_FALSE(this->isSent(29));
+    ASSERT_TRUE(this->isSent(30));
+    ASSERT_TLM_SuppressedUpdates_SIZE(1);
+    ASSERT_TLM_SuppressedUpdates(0, 3u);
+
+    // reading a suppressed channel returns the last value sent, whichever buffer is active
+    Fw::TlmBuffer readBack;
+    Fw::Time timeTag;
+    U32 readVal = 0;
+    for (U32 cycle = 0; cycle < 2; cycle++) {
+        this->invoke_to_TlmGet(0, 28, timeTag, readBack);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, readBack.deserialize(readVal));
+        ASSERT_EQ(100u, readVal);
+        ASSERT_EQ(0u, timeTag.getSeconds());
+        this->sendValue<U32>(28, 103, 1);
+        this->invoke_to_TlmGet(0, 28, timeTag, readBack);
+        ASSERT_EQ(Fw::FW_SERIALIZE_OK, readBack.deserialize(readVal));
+        ASSERT_EQ(100u, readVal);
+        ASSERT_FALSE(this->doRun(false));
+    }
+
+    // changes beyond the deadband are sent, compared with the last value sent
+    this->clearBuffs();
+    this->sendValue<U32>(27, 11, 2);
+    this->sendValue<U32>(28, 94, 2);
+    this->sendValue<F32>(29, 56.0f, 2);
+    this->doRun(true);
+    ASSERT_TRUE(this->isSent(27));
+    ASSERT_TRUE(this->isSent(28));
+    ASSERT_TRUE(this->isSent(29));
+
+    // a stale channel is sent regardless
+    this->clearBuffs();
+    this->sendValue<U32>(27, 11, 5);
+    this->sendValue<U32>(28, 94, 5);
+    ASSERT_FALSE(this->doRun(false));
+    this->clearBuffs();
+    this->sendValue<U32>(27, 11, 12);
+    this->sendValue<U32>(28, 94, 12);
+    this->doRun(true);
+    ASSERT_FALSE(this->isSent(27));
+    ASSERT_TRUE(this->isSent(28));
+
+    // a time tag going backwards sends the update
+    this->clearBuffs();
+    this->sendValue<U32>(27, 11, 1);
+    this->doRun(true);
+    ASSERT_TRUE(this->isSent(27));
+
+    // a default filter applies to channels without one
+    const TlmChanFilter onChange = {0, TLMCHAN_FILTER_ON_CHANGE, TLMCHAN_VALUE_U32, 0.0, 0};
+    this->component.setFilters(filters, FW_NUM_ARRAY_ELEMENTS(filters), &onChange);
+    this->clearBuffs();
+    this->sendValue<U32>(30, 1, 13);
+    this->doRun(true);
+    ASSERT_TRUE(this->isSent(30));
+    this->clearBuffs();
+    this->sendValue<U32>(30, 1, 14);
+    ASSERT_FALSE(this->doRun(false));
+
+    // suppressed updates reuse the entry of the channel rather than taking a new bucket each time
+    for (U32 update = 0; update < 2 * TLMCHAN_HASH_BUCKETS; update++) {
+        this->clearBuffs();
+        this->sendValue<U32>(30, 1, 15);
+        ASSERT_FALSE(this->doRun(false));
+    }
+}
+
+void TlmChanTester::runBandwidth() {
+    // A housekeeping mix modeled on the Ref deployment: every channel is written once a second
+    const U32 SECONDS = 600;
+    const FwChanIdType COUNTERS = 0x100;     // 30 command, file and sequence counters, rarely changing
+    const FwChanIdType CONSTANTS = 0x200;    // 20 buffer, configuration and status channels, constant
+    const FwChanIdType CYCLE_TIMES = 0x300;  // 12 rate group and member times in us, jittering
+    const FwChanIdType CPU = 0x400;          // 5 CPU loads in percent, noisy
+    const FwChanIdType MEMORY = 0x500;       // 3 memory sizes in bytes, slowly varying
+    const FwChanIdType SIGNALS = 0x600;      // 5 signal generator outputs, sine waves
+    const FwChanIdType HISTORIES = 0x700;    // 5 signal generator histories of 10 samples
+
+    const TlmChanFilter onChange = {0, TLMCHAN_FILTER_ON_CHANGE, TLMCHAN_VALUE_U32, 0.0, 0};
+    const TlmChanFilter onChangeHeartbeat = {0, TLMCHAN_FILTER_ON_CHANGE, TLMCHAN_VALUE_U32, 0.0, 60};
+    TlmChanFilter deadbands[12 + 5 + 3];
+    NATIVE_UINT_TYPE numDeadbands = 0;
+    for (FwChanIdType chan = 0; chan < 12; chan++) {
+        deadbands[numDeadbands++] = {CYCLE_TIMES + chan, TLMCHAN_FILTER_ABSOLUTE, TLMCHAN_VALUE_U32, 50.0, 60};
+    }
+    for (FwChanIdType chan = 0; chan < 5; chan++) {
+        deadbands[numDeadbands++] = {CPU + chan, TLMCHAN_FILTER_ABSOLUTE, TLMCHAN_VALUE_F32, 5.0, 60};
+    }
+    for (FwChanIdType chan = 0; chan < 3; chan++) {
+        deadbands[numDeadbands++] = {MEMORY + chan, TLMCHAN_FILTER_RELATIVE, TLMCHAN_VALUE_U64, 0.01, 60};
+    }
+
+    struct Config {
+        const char* name;
+        const TlmChanFilter* filters;
+        NATIVE_UINT_TYPE numFilters;
+        const TlmChanFilter* defaultFilter;
+    } configs[] = {
+        {"no filters", nullptr, 0, nullptr},
+        {"on change", nullptr, 0, &onChange},
+        {"on change, 60 s heartbeat", nullptr, 0, &onChangeHeartbeat},
+        {"on change and deadbands, 60 s heartbeat", deadbands, numDeadbands, &onChangeHeartbeat},
+    };
+
+    for (const Config& config : configs) {
+        TlmChanTester tester;
+        tester.component.setFilters(config.filters, config.numFilters, config.defaultFilter);
+        std::mt19937 random(1);
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        U32 counters[30] = {};
+        U64 memory[3] = {400000000, 800000000, 1200000000};
+        for (U32 second = 1; second <= SECONDS; second++) {
+            for (FwChanIdType chan = 0; chan < 30; chan++) {
+                counters[chan] += (uniform(random) < 0.02) ? 1 : 0;
+                tester.sendValue<U32>(COUNTERS + chan, counters[chan], second);
+            }
+            for (FwChanIdType chan = 0; chan < 20; chan++) {
+                tester.sendValue<U32>(CONSTANTS + chan, 100 + chan, second);
+            }
+            for (FwChanIdType chan = 0; chan < 12; chan++) {
+                tester.sendValue<U32>(CYCLE_TIMES + chan, 1000 + static_cast<U32>(100.0 * uniform(random)), second);
+            }
+            for (FwChanIdType chan = 0; chan < 5; chan++) {
+                tester.sendValue<F32>(CPU + chan, static_cast<F32>(20.0 + 8.0 * uniform(random)), second);
+            }
+            for (FwChanIdType chan = 0; chan < 3; chan++) {
+                memory[chan] += static_cast<U64>(100000.0 * uniform(random));
+                tester.sendValue<U64>(MEMORY + chan, memory[chan], second);
+            }
+            for (FwChanIdType chan = 0; chan < 5; chan++) {
+                tester.sendValue<F32>(SIGNALS + chan, static_cast<F32>(sin(0.1 * (second + chan))), second);
+                Fw::TlmBuffer history;
+                for (U32 sample = 0; sample < 10; sample++) {
+                    ASSERT_EQ(Fw::FW_SERIALIZE_OK,
+                              history.serialize(static_cast<F32>(sin(0.1 * (second + chan) - 0.01 * sample))));
+                }
+                Fw::Time timeTag(TB_NONE, second, 0);
+                tester.invoke_to_TlmRecv(0, HISTORIES + chan, timeTag, history);
+            }
+            tester.clearBuffs();
+            tester.doRun(false);
+        }
+        printf("%s: %.1f bytes/s\n", config.name, static_cast<double>(tester.m_bytesSent) / SECONDS);
+    }
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -141,6 +323,7 @@ void TlmChanTester ::from_PktSend_handler(const NATIVE_INT_TYPE portNum, Fw::Com
     this->m_bufferRecv = true;
     this->m_rcvdBuffer[this->m_numBuffs] = data;
     this->m_numBuffs++;
+    this->m_bytesSent += data.getBuffLength();
 }
 
 void TlmChanTester ::from_pingOut_handler(const NATIVE_INT_TYPE portNum, U32 key) {
@@ -256,6 +439,33 @@ void TlmChanTester::sendBuff(FwChanIdType id, U32 val) {
     ASSERT_EQ(retestVal, val);
 }
 
+template <typename T>
+void TlmChanTester::sendValue(FwChanIdType id, T val, U32 seconds) {
+    Fw::TlmBuffer buff;
+    Fw::Time timeTag(TB_NONE, seconds, 0);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serialize(val));
+    this->invoke_to_TlmRecv(0, id, timeTag, buff);
+}
+
+bool TlmChanTester::isSent(FwChanIdType id) {
+    for (NATIVE_UINT_TYPE packet = 0; packet < this->m_numBuffs; packet++) {
+        Fw::TlmPacket pkt;
+        pkt.setBuffer(this->m_rcvdBuffer[packet]);
+        EXPECT_EQ(Fw::FW_SERIALIZE_OK, pkt.resetPktDeser());
+        // the channels in these tests are all four bytes long
+        while (pkt.getBuffer().getBuffLeft() > 0) {
+            FwChanIdType sentId = 0;
+            Fw::Time timeTag;
+            Fw::TlmBuffer val;
+            EXPECT_EQ(Fw::FW_SERIALIZE_OK, pkt.extractValue(sentId, timeTag, val, sizeof(U32)));
+            if (sentId == id) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 void TlmChanTester::clearBuffs() {
     this->m_numBuffs = 0;
     for (NATIVE_INT_TYPE n = 0; n < TLMCHAN_HASH_BUCKETS; n++) {
@@ -338,6 +548,12 @@ void TlmChanTester ::connectPorts() {
 
     // pingOut
     this->component.set_pingOut_OutputPort(0, this->get_from_pingOut(0));
+
+    // timeCaller
+    this->component.set_timeCaller_OutputPort(0, this->get_from_timeCaller(0));
+
+    // tlmOut
+    this->component.set_tlmOut_OutputPort(0, this->get_from_tlmOut(0));
 }
 
 void TlmChanTester ::initComponents() {
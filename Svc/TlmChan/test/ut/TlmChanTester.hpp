@@ -34,6 +34,8 @@ class TlmChanTester : public TlmChanGTestBase {
     void runNominalChannel();
     void runMultiChannel();
     void runOffNominal();
+    void runFilters();
+    void runBandwidth();
 
   private:
     // ----------------------------------------------------------------------
@@ -67,6 +69,9 @@ class TlmChanTester : public TlmChanGTestBase {
     void initComponents();
 
     void sendBuff(FwChanIdType id, U32 val);
+    template <typename T>
+    void sendValue(FwChanIdType id, T val, U32 seconds);
+    bool isSent(FwChanIdType id);
     bool doRun(bool check);
     void checkBuff(NATIVE_UINT_TYPE chanNum, NATIVE_UINT_TYPE totalChan, FwChanIdType id, U32 val);
 
@@ -88,6 +93,7 @@ class TlmChanTester : public TlmChanGTestBase {
     NATIVE_UINT_TYPE m_numBuffs;
     Fw::ComBuffer m_rcvdBuffer[TLMCHAN_HASH_BUCKETS];
     bool m_bufferRecv;
+    U64 m_bytesSent;
 };
 
 }  // end namespace Svc
@@ -19,7 +19,11 @@ namespace Svc {
 // ----------------------------------------------------------------------
 
 TlmPacketizer ::TlmPacketizer(const char* const compName)
-    : TlmPacketizerComponentBase(compName), m_numPackets(0), m_configured(false), m_startLevel(0), m_maxLevel(0) {
+    : TlmPacketizerComponentBase(compName), m_numPackets(0),
+      m_configured(false),
+      m_scatterPlan(nullptr),
+      m_startLevel(0),
+      m_maxLevel(0) {
     // clear slot pointers
     for (NATIVE_UINT_TYPE entry = 0; entry < TLMPACKETIZER_NUM_TLM_HASH_SLOTS; entry++) {
         this->m_tlmEntries.slots[entry] = nullptr;
@@ -55,12 +59,13 @@ void TlmPacketizer::setPacketList(const TlmPacketizerPacketList& packetList,
     FW_ASSERT(packetList.list);
     FW_ASSERT(ignoreList.list);
     FW_ASSERT(packetList.numEntries <= MAX_PACKETIZER_PACKETS, static_cast<FwAssertArgType>(packetList.numEntries));
+    // channels are placed with the hash table unless a scatter plan is given
+    this->m_scatterPlan = nullptr;
     // validate packet sizes against maximum com buffer size and populate hash
     // table
     for (NATIVE_UINT_TYPE pktEntry = 0; pktEntry < packetList.numEntries; pktEntry++) {
         // Initial size is packetized telemetry descriptor + size of time tag + sizeof packet ID
-        NATIVE_UINT_TYPE packetLen =
-            sizeof(FwPacketDescriptorType) + Fw::Time::SERIALIZED_SIZE + sizeof(FwTlmPacketizeIdType);
+        NATIVE_UINT_TYPE packetLen = PACKET_HEADER_SIZE;
         FW_ASSERT(packetList.list[pktEntry]->list, static_cast<FwAssertArgType>(pktEntry));
         // add up entries for each defined packet
         for (NATIVE_UINT_TYPE tlmEntry = 0; tlmEntry < packetList.list[pktEntry]->numEntries; tlmEntry++) {
@@ -126,6 +131,90 @@ void TlmPacketizer::setPacketList(const TlmPacketizerPacketList& packetList,
     this->m_configured = true;
 }
 
+void TlmPacketizer::setPacketList(const TlmPacketizerPacketList& packetList,
+                                  const Svc::TlmPacketizerPacket& ignoreList,
+                                  const NATIVE_UINT_TYPE startLevel,
+                                  const TlmPacketizerScatterPlan& scatterPlan) {
+    this->setPacketList(packetList, ignoreList, startLevel);
+    this->m_scatterPlan = &scatterPlan;
+    // a plan generated from a different packet list would scatter values into the wrong places
+    this->checkScatterPlan(packetList, ignoreList);
+}
+
+void TlmPacketizer::checkScatterPlan(const TlmPacketizerPacketList& packetList,
+                                     const Svc::TlmPacketizerPacket& ignoreList) const {
+    const TlmPacketizerScatterPlan& plan = *this->m_scatterPlan;
+    FW_ASSERT(plan.pages);
+    FW_ASSERT(plan.slots);
+    FW_ASSERT(plan.channels);
+    FW_ASSERT(plan.entries or (plan.numEntries == 0));
+    NATIVE_UINT_TYPE numPacketized = 0;
+    for (NATIVE_UINT_TYPE pktEntry = 0; pktEntry < packetList.numEntries; pktEntry++) {
+        NATIVE_UINT_TYPE offset = 0;
+        for (NATIVE_UINT_TYPE tlmEntry = 0; tlmEntry < packetList.list[pktEntry]->numEntries; tlmEntry++) {
+            const TlmPacketizerChannelEntry& chanEntry = packetList.list[pktEntry]->list[tlmEntry];
+            const TlmPacketizerScatterChannel* channel = this->findScatterChannel(chanEntry.id);
+            FW_ASSERT(channel, static_cast<FwAssertArgType>(chanEntry.id));
+            FW_ASSERT(channel->id == chanEntry.id, static_cast<FwAssertArgType>(channel->id),
+                      static_cast<FwAssertArgType>(chanEntry.id));
+            FW_ASSERT(static_cast<NATIVE_UINT_TYPE>(channel->first) + channel->numEntries <= plan.numEntries,
+                      static_cast<FwAssertArgType>(chanEntry.id));
+            // the ignore list wins over the packets, as it does in the hash table
+            bool ignored = false;
+            for (NATIVE_UINT_TYPE channelEntry = 0; channelEntry < ignoreList.numEntries; channelEntry++) {
+                ignored = ignored or (ignoreList.list[channelEntry].id == chanEntry.id);
+            }
+            if (ignored) {
+                FW_ASSERT(channel->numEntries == 0, static_cast<FwAssertArgType>(chanEntry.id));
+                offset += chanEntry.size;
+                continue;
+            }
+            // find the entry for this place in the packet
+            bool found = false;
+            for (NATIVE_UINT_TYPE entry = channel->first; entry < channel->first + channel->numEntries; entry++) {
+                if ((plan.entries[entry].packet == pktEntry) and (plan.entries[entry].offset == offset)) {
+                    FW_ASSERT(plan.entries[entry].size == chanEntry.size, static_cast<FwAssertArgType>(chanEntry.id),
+                              static_cast<FwAssertArgType>(pktEntry));
+                    found = true;
+                    break;
+                }
+            }
+            FW_ASSERT(found, static_cast<FwAssertArgType>(chanEntry.id), static_cast<FwAssertArgType>(pktEntry));
+            offset += chanEntry.size;
+            numPacketized++;
+        }
+    }
+    // every entry has been matched, so the plan writes nowhere else
+    FW_ASSERT(numPacketized == plan.numEntries, static_cast<FwAssertArgType>(numPacketized),
+              static_cast<FwAssertArgType>(plan.numEntries));
+    for (NATIVE_UINT_TYPE channelEntry = 0; channelEntry < ignoreList.numEntries; channelEntry++) {
+        const FwChanIdType id = ignoreList.list[channelEntry].id;
+        const TlmPacketizerScatterChannel* channel = this->findScatterChannel(id);
+        FW_ASSERT(channel, static_cast<FwAssertArgType>(id));
+        FW_ASSERT(channel->numEntries == 0, static_cast<FwAssertArgType>(id));
+    }
+}
+
+const TlmPacketizerScatterChannel* TlmPacketizer::findScatterChannel(FwChanIdType id) const {
+    const TlmPacketizerScatterPlan& plan = *this->m_scatterPlan;
+    if (id < plan.minId) {
+        return nullptr;
+    }
+    const NATIVE_UINT_TYPE index = static_cast<NATIVE_UINT_TYPE>(id - plan.minId);
+    const NATIVE_UINT_TYPE page = index >> plan.pageShift;
+    if ((page >= plan.numPages) or (plan.pages[page] == TLMPACKETIZER_SCATTER_NONE)) {
+        return nullptr;
+    }
+    const NATIVE_UINT_TYPE slot =
+        (static_cast<NATIVE_UINT_TYPE>(plan.pages[page]) << plan.pageShift) | (index & ((1U << plan.pageShift) - 1));
+    const U16 channel = plan.slots[slot];
+    if (channel == TLMPACKETIZER_SCATTER_NONE) {
+        return nullptr;
+    }
+    FW_ASSERT(channel < plan.numChannels, static_cast<FwAssertArgType>(channel));
+    return &plan.channels[channel];
+}
+
 TlmPacketizer::TlmEntry* TlmPacketizer::findBucket(FwChanIdType id) {
     NATIVE_UINT_TYPE index = this->doHash(id);
     FW_ASSERT(index < TLMPACKETIZER_HASH_BUCKETS);
@@ -185,6 +274,34 @@ void TlmPacketizer ::TlmRecv_handler(const NATIVE_INT_TYPE portNum,
                                      Fw::Time& timeTag,
                                      Fw::TlmBuffer& val) {
     FW_ASSERT(this->m_configured);
+
+    if (this->m_scatterPlan) {
+        const TlmPacketizerScatterChannel* channel = this->findScatterChannel(id);
+        if (not channel) {
+            this->missingChannel(id);
+            return;
+        }
+        // ignored channels have no entries
+        if (channel->numEntries == 0) {
+            return;
+        }
+        const U8* value = val.getBuffAddr();
+        const NATIVE_UINT_TYPE size = val.getBuffLength();
+        const TlmPacketizerScatterEntry* entry = &this->m_scatterPlan->entries[channel->first];
+        const TlmPacketizerScatterEntry* const end = entry + channel->numEntries;
+        // copy telemetry value into each packet it is placed in
+        this->m_lock.lock();
+        for (; entry < end; entry++) {
+            FW_ASSERT(size <= entry->size, static_cast<FwAssertArgType>(id), static_cast<FwAssertArgType>(size));
+            BufferEntry& packet = this->m_fillBuffers[entry->packet];
+            packet.updated = true;
+            packet.latestTime = timeTag;
+            memcpy(&packet.buffer.getBuffAddr()[PACKET_HEADER_SIZE + entry->offset], value, size);
+        }
+        this->m_lock.unLock();
+        return;
+    }
+
     // get hash value for id
     NATIVE_UINT_TYPE index = this->doHash(id);
     TlmEntry* entryToUse = nullptr;
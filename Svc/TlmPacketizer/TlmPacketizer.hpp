@@ -34,6 +34,15 @@ class TlmPacketizer : public TlmPacketizerComponentBase {
         const Svc::TlmPacketizerPacket& ignoreList,  // channels to ignore (i.e. no warning event if not packetized)
         const NATIVE_UINT_TYPE startLevel);          // starting level of packets to send
 
+    //! Set the packet list along with the scatter plan generated from it. Channel updates are then
+    //! placed with one lookup in the plan instead of a hash table search.
+    void setPacketList(
+        const TlmPacketizerPacketList& packetList,   // channels to packetize
+        const Svc::TlmPacketizerPacket& ignoreList,  // channels to ignore (i.e. no warning event if not packetized)
+        const NATIVE_UINT_TYPE startLevel,           // starting level of packets to send
+        const TlmPacketizerScatterPlan& scatterPlan  // placement of channels in packets
+    );
+
     //! Destroy object TlmPacketizer
     //!
     ~TlmPacketizer(void);
@@ -129,6 +138,19 @@ class TlmPacketizer : public TlmPacketizerComponentBase {
 
     TlmEntry* findBucket(FwChanIdType id);
 
+    //! Look up a channel in the scatter plan
+    //! \return the channel, or nullptr if the channel is neither packetized nor ignored
+    const TlmPacketizerScatterChannel* findScatterChannel(FwChanIdType id) const;
+
+    //! Check that the scatter plan places each channel where the packet list does
+    void checkScatterPlan(const TlmPacketizerPacketList& packetList, const Svc::TlmPacketizerPacket& ignoreList) const;
+
+    //! size of packet descriptor, time tag and packet ID preceding the channels in a packet
+    static const NATIVE_UINT_TYPE PACKET_HEADER_SIZE =
+        sizeof(FwPacketDescriptorType) + Fw::Time::SERIALIZED_SIZE + sizeof(FwTlmPacketizeIdType);
+
+    const TlmPacketizerScatterPlan* m_scatterPlan;  //!< scatter plan, or nullptr to use the hash table
+
     NATIVE_UINT_TYPE m_startLevel;  //!< initial level for sending packets
     NATIVE_UINT_TYPE m_maxLevel;    //!< maximum level in all packets
 };
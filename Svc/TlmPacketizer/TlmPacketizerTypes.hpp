@@ -34,6 +34,39 @@ struct TlmPacketizerPacketList {
     const TlmPacketizerPacket* list[MAX_PACKETIZER_PACKETS];  //!<
     NATIVE_UINT_TYPE numEntries;
 };
+
+//! Marks a scatter plan page or slot holding no channel
+static const U16 TLMPACKETIZER_SCATTER_NONE = 0xFFFF;
+
+struct TlmPacketizerScatterEntry {
+    U16 packet;  //!< index of packet in packet list
+    U16 offset;  //!< offset of channel value from the end of the packet header
+    U16 size;    //!< serialized size of channel in bytes
+};
+
+struct TlmPacketizerScatterChannel {
+    FwChanIdType id;  //!< Id of channel
+    U16 first;        //!< index of first scatter entry of channel
+    U16 numEntries;   //!< number of scatter entries of channel, zero for an ignored channel
+};
+
+//! Precomputed placement of each channel in the packets, generated with the packet list
+//!
+//! Channel ids from minId are split into pages of 2^pageShift ids. pages holds, for each page, the
+//! index of its run of slots in slots, or TLMPACKETIZER_SCATTER_NONE for a page with no channels.
+//! Each slot holds the index in channels of the channel with that id, or TLMPACKETIZER_SCATTER_NONE.
+//! The scatter entries of a channel are consecutive.
+struct TlmPacketizerScatterPlan {
+    FwChanIdType minId;                           //!< lowest channel id in plan
+    NATIVE_UINT_TYPE pageShift;                   //!< log2 of the number of ids in a page
+    NATIVE_UINT_TYPE numPages;                    //!< number of pages
+    const U16* pages;                             //!< slot run index of each page
+    const U16* slots;                             //!< channel index of each id in pages with channels
+    const TlmPacketizerScatterChannel* channels;  //!< channels in plan
+    NATIVE_UINT_TYPE numChannels;                 //!< number of channels
+    const TlmPacketizerScatterEntry* entries;     //!< scatter entries
+    NATIVE_UINT_TYPE numEntries;                  //!< number of scatter entries
+};
 }  // namespace Svc
 
 #endif /* SVC_TLMPACKETIZER_TLMPACKETIZERTYPES_HPP_ */
@@ -15,6 +15,10 @@
 #define QUEUE_DEPTH 10
 
 #include <Fw/Com/ComPacket.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <map>
 
 namespace Svc {
 
@@ -22,7 +26,8 @@ namespace Svc {
 // Construction and destruction
 // ----------------------------------------------------------------------
 
-TlmPacketizerTester ::TlmPacketizerTester() : TlmPacketizerGTestBase("Tester", MAX_HISTORY_SIZE), component("TlmPacketizer") {
+TlmPacketizerTester ::TlmPacketizerTester(bool useScatterPlan)
+    : TlmPacketizerGTestBase("Tester", MAX_HISTORY_SIZE), component("TlmPacketizer"), m_useScatterPlan(useScatterPlan) {
     this->initComponents();
     this->connectPorts();
 }
@@ -50,11 +55,11 @@ TlmPacketizerChannelEntry ignoreList[] = {{25, 0}, {50, 0}};
 TlmPacketizerPacket ignore = {ignoreList, 0, 0, FW_NUM_ARRAY_ELEMENTS(ignoreList)};
 
 void TlmPacketizerTester ::initTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
 }
 
 void TlmPacketizerTester ::pushTlmTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -88,7 +93,7 @@ void TlmPacketizerTester ::pushTlmTest() {
 }
 
 void TlmPacketizerTester ::sendPacketsTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -156,7 +161,7 @@ void TlmPacketizerTester ::sendPacketsTest() {
 }
 
 void TlmPacketizerTester ::sendPacketLevelsTest() {
-    this->component.setPacketList(packetList, ignore, 1);
+    this->setPacketList(packetList, ignore, 1);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -224,7 +229,7 @@ void TlmPacketizerTester ::sendPacketLevelsTest() {
 }
 
 void TlmPacketizerTester ::updatePacketsTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -537,7 +542,7 @@ void TlmPacketizerTester ::updatePacketsTest() {
 }
 
 void TlmPacketizerTester ::ignoreTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -602,8 +607,57 @@ void TlmPacketizerTester ::ignoreTest() {
     ASSERT_from_PktSend_SIZE(0);
 }
 
+void TlmPacketizerTester ::ignorePacketizedTest() {
+    // channel 100 is in packet 4, but the ignore list wins
+    TlmPacketizerChannelEntry packetizedIgnoreList[] = {{25, 0}, {100, 2}};
+    TlmPacketizerPacket packetizedIgnore = {packetizedIgnoreList, 0, 0, FW_NUM_ARRAY_ELEMENTS(packetizedIgnoreList)};
+    this->setPacketList(packetList, packetizedIgnore, 2);
+    Fw::Time ts;
+    Fw::TlmBuffer buff;
+
+    Fw::ComBuffer comBuff;
+
+    // ignored channel that is also packetized
+    ts.set(100, 1000);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serialize(static_cast<U16>(20)));
+    this->invoke_to_TlmRecv(0, 100, ts, buff);
+
+    this->m_testTime.add(1, 0);
+    this->setTestTime(this->m_testTime);
+    this->clearFromPortHistory();
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+
+    // no packets should be pushed
+    ASSERT_from_PktSend_SIZE(0);
+
+    // the rest of the packet is still filled
+    buff.resetSer();
+    ts.add(1, 0);
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serialize(static_cast<U8>(15)));
+    this->invoke_to_TlmRecv(0, 333, ts, buff);
+
+    this->m_testTime.add(1, 0);
+    this->setTestTime(this->m_testTime);
+    this->clearFromPortHistory();
+    this->invoke_to_Run(0, 0);
+    this->component.doDispatch();
+    ASSERT_from_PktSend_SIZE(1);
+
+    comBuff.resetSer();
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK,
+              comBuff.serialize(static_cast<FwPacketDescriptorType>(Fw::ComPacket::FW_PACKET_PACKETIZED_TLM)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serialize(static_cast<FwTlmPacketizeIdType>(4)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serialize(ts));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serialize(static_cast<U32>(0)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serialize(static_cast<U16>(0)));
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, comBuff.serialize(static_cast<U8>(15)));
+
+    ASSERT_from_PktSend(0, comBuff, static_cast<U32>(0));
+}
+
 void TlmPacketizerTester ::sendManualPacketTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -724,7 +778,7 @@ void TlmPacketizerTester ::sendManualPacketTest() {
 }
 
 void TlmPacketizerTester ::setPacketLevelTest() {
-    this->component.setPacketList(packetList, ignore, 0);
+    this->setPacketList(packetList, ignore, 0);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -861,7 +915,7 @@ void TlmPacketizerTester ::setPacketLevelTest() {
 }
 
 void TlmPacketizerTester ::nonPacketizedChannelTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     Fw::Time ts;
     Fw::TlmBuffer buff;
 
@@ -891,7 +945,7 @@ void TlmPacketizerTester ::nonPacketizedChannelTest() {
 }
 
 void TlmPacketizerTester ::pingTest() {
-    this->component.setPacketList(packetList, ignore, 2);
+    this->setPacketList(packetList, ignore, 2);
     // ping component
     this->clearFromPortHistory();
     this->invoke_to_pingIn(0, static_cast<U32>(0x1234));
@@ -900,6 +954,54 @@ void TlmPacketizerTester ::pingTest() {
     ASSERT_from_pingOut(0, static_cast<U32>(0x1234));
 }
 
+void TlmPacketizerTester ::tlmRecvBenchmark() {
+    // 50 components of 20 channels, 10 channels to a packet, the first 200 channels in a second packet too
+    const NATIVE_UINT_TYPE NUM_CHANNELS = 1000;
+    const NATIVE_UINT_TYPE NUM_PACKETS = 100;
+    const NATIVE_UINT_TYPE CHANNELS_PER_COMPONENT = 20;
+    const NATIVE_UINT_TYPE SHARED_CHANNELS = 200;
+    const NATIVE_UINT_TYPE ROUNDS = 200;
+    FW_ASSERT(NUM_CHANNELS <= TLMPACKETIZER_HASH_BUCKETS);
+
+    std::vector<FwChanIdType> ids;
+    for (NATIVE_UINT_TYPE channel = 0; channel < NUM_CHANNELS; channel++) {
+        ids.push_back(0x100 * (1 + channel / CHANNELS_PER_COMPONENT) + channel % CHANNELS_PER_COMPONENT);
+    }
+    std::vector<std::vector<TlmPacketizerChannelEntry> > lists(NUM_PACKETS);
+    for (NATIVE_UINT_TYPE channel = 0; channel < NUM_CHANNELS; channel++) {
+        lists[channel % NUM_PACKETS].push_back({ids[channel], sizeof(U32)});
+    }
+    for (NATIVE_UINT_TYPE channel = 0; channel < SHARED_CHANNELS; channel++) {
+        lists[(channel + NUM_PACKETS / 2) % NUM_PACKETS].push_back({ids[channel], sizeof(U32)});
+    }
+    std::vector<TlmPacketizerPacket> packets(NUM_PACKETS);
+    TlmPacketizerPacketList benchList;
+    for (NATIVE_UINT_TYPE pkt = 0; pkt < NUM_PACKETS; pkt++) {
+        packets[pkt] = {lists[pkt].data(), static_cast<FwTlmPacketizeIdType>(pkt), 0,
+                        static_cast<NATIVE_UINT_TYPE>(lists[pkt].size())};
+        benchList.list[pkt] = &packets[pkt];
+    }
+    benchList.numEntries = NUM_PACKETS;
+    TlmPacketizerPacket noIgnore = {ignoreList, 0, 0, 0};
+
+    this->setPacketList(benchList, noIgnore, 0);
+
+    Fw::Time ts;
+    Fw::TlmBuffer buff;
+    ASSERT_EQ(Fw::FW_SERIALIZE_OK, buff.serialize(static_cast<U32>(0x12345678)));
+    const auto start = std::chrono::steady_clock::now();
+    for (NATIVE_UINT_TYPE round = 0; round < ROUNDS; round++) {
+        for (NATIVE_UINT_TYPE channel = 0; channel < NUM_CHANNELS; channel++) {
+            this->invoke_to_TlmRecv(0, ids[channel], ts, buff);
+        }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EVENTS_SIZE(0);
+    printf("%s: %.1f ns per TlmRecv call\n", this->m_useScatterPlan ? "scatter plan" : "hash table",
+           static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+               (ROUNDS * NUM_CHANNELS));
+}
+
 // ----------------------------------------------------------------------
 // Handlers for typed from ports
 // ----------------------------------------------------------------------
@@ -969,4 +1071,74 @@ void TlmPacketizerTester ::initComponents() {
     this->component.init(QUEUE_DEPTH, INSTANCE);
 }
 
+void TlmPacketizerTester ::setPacketList(const TlmPacketizerPacketList& packetList,
+                                         const TlmPacketizerPacket& ignoreList,
+                                         NATIVE_UINT_TYPE startLevel) {
+    if (this->m_useScatterPlan) {
+        this->buildScatterPlan(packetList, ignoreList, 4);
+        this->component.setPacketList(packetList, ignoreList, startLevel, this->m_scatterPlan);
+    } else {
+        this->component.setPacketList(packetList, ignoreList, startLevel);
+    }
+}
+
+void TlmPacketizerTester ::buildScatterPlan(const TlmPacketizerPacketList& packetList,
+                                            const TlmPacketizerPacket& ignoreList,
+                                            NATIVE_UINT_TYPE pageShift) {
+    // entries of each channel in packet order, ordered by channel id; ignored channels have none
+    std::map<FwChanIdType, std::vector<TlmPacketizerScatterEntry> > channelEntries;
+    for (NATIVE_UINT_TYPE entry = 0; entry < ignoreList.numEntries; entry++) {
+        channelEntries[ignoreList.list[entry].id];
+    }
+    for (NATIVE_UINT_TYPE pkt = 0; pkt < packetList.numEntries; pkt++) {
+        U16 offset = 0;
+        for (NATIVE_UINT_TYPE entry = 0; entry < packetList.list[pkt]->numEntries; entry++) {
+            const TlmPacketizerChannelEntry& channel = packetList.list[pkt]->list[entry];
+            bool ignored = false;
+            for (NATIVE_UINT_TYPE ignoreEntry = 0; ignoreEntry < ignoreList.numEntries; ignoreEntry++) {
+                ignored = ignored or (ignoreList.list[ignoreEntry].id == channel.id);
+            }
+            if (not ignored) {
+                channelEntries[channel.id].push_back({static_cast<U16>(pkt), offset, static_cast<U16>(channel.size)});
+            }
+            offset = static_cast<U16>(offset + channel.size);
+        }
+    }
+
+    this->m_scatterChannels.clear();
+    this->m_scatterEntries.clear();
+    for (const auto& channel : channelEntries) {
+        this->m_scatterChannels.push_back({channel.first, static_cast<U16>(this->m_scatterEntries.size()),
+                                           static_cast<U16>(channel.second.size())});
+        this->m_scatterEntries.insert(this->m_scatterEntries.end(), channel.second.begin(), channel.second.end());
+    }
+
+    const FwChanIdType minId = channelEntries.empty() ? 0 : channelEntries.begin()->first;
+    const NATIVE_UINT_TYPE numPages =
+        channelEntries.empty() ? 0 : ((channelEntries.rbegin()->first - minId) >> pageShift) + 1;
+    this->m_scatterPages.assign(numPages, TLMPACKETIZER_SCATTER_NONE);
+    this->m_scatterSlots.clear();
+    U16 channelIndex = 0;
+    for (const auto& channel : channelEntries) {
+        const NATIVE_UINT_TYPE index = channel.first - minId;
+        U16& page = this->m_scatterPages[index >> pageShift];
+        if (page == TLMPACKETIZER_SCATTER_NONE) {
+            page = static_cast<U16>(this->m_scatterSlots.size() >> pageShift);
+            this->m_scatterSlots.resize(this->m_scatterSlots.size() + (1U << pageShift), TLMPACKETIZER_SCATTER_NONE);
+        }
+        this->m_scatterSlots[(static_cast<NATIVE_UINT_TYPE>(page) << pageShift) | (index & ((1U << pageShift) - 1))] =
+            channelIndex++;
+    }
+
+    this->m_scatterPlan = {minId,
+                           pageShift,
+                           numPages,
+                           this->m_scatterPages.data(),
+                           this->m_scatterSlots.data(),
+                           this->m_scatterChannels.data(),
+                           static_cast<NATIVE_UINT_TYPE>(this->m_scatterChannels.size()),
+                           this->m_scatterEntries.data(),
+                           static_cast<NATIVE_UINT_TYPE>(this->m_scatterEntries.size())};
+}
+
 }  // end namespace Svc
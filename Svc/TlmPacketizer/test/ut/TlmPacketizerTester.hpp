@@ -11,6 +11,7 @@
 #ifndef TESTER_HPP
 #define TESTER_HPP
 
+#include <vector>
 #include "TlmPacketizerGTestBase.hpp"
 #include "Svc/TlmPacketizer/TlmPacketizer.hpp"
 
@@ -24,7 +25,8 @@ class TlmPacketizerTester : public TlmPacketizerGTestBase {
   public:
     //! Construct object TlmPacketizerTester
     //!
-    TlmPacketizerTester(void);
+    explicit TlmPacketizerTester(bool useScatterPlan = false /*!< Pass a scatter plan with the packet list*/
+    );
 
     //! Destroy object TlmPacketizerTester
     //!
@@ -67,6 +69,10 @@ class TlmPacketizerTester : public TlmPacketizerGTestBase {
     //!
     void ignoreTest(void);
 
+    //! ignore test with a channel that is also packetized
+    //!
+    void ignorePacketizedTest(void);
+
     //! manually send packet test
     //!
     void sendManualPacketTest(void);
@@ -75,6 +81,10 @@ class TlmPacketizerTester : public TlmPacketizerGTestBase {
     //!
     void setPacketLevelTest(void);
 
+    //! TlmRecv cost with 1000 channels across 100 packets
+    //!
+    void tlmRecvBenchmark(void);
+
   private:
     // ----------------------------------------------------------------------
     // Handlers for typed from ports
@@ -112,6 +122,18 @@ class TlmPacketizerTester : public TlmPacketizerGTestBase {
     //!
     void initComponents(void);
 
+    //! Set the packet list of the component, with a scatter plan if selected
+    //!
+    void setPacketList(const TlmPacketizerPacketList& packetList,
+                       const TlmPacketizerPacket& ignoreList,
+                       NATIVE_UINT_TYPE startLevel);
+
+    //! Build a scatter plan the way the packet autocoder does
+    //!
+    void buildScatterPlan(const TlmPacketizerPacketList& packetList,
+                          const TlmPacketizerPacket& ignoreList,
+                          NATIVE_UINT_TYPE pageShift);
+
   private:
     // ----------------------------------------------------------------------
     // Variables
@@ -122,6 +144,14 @@ class TlmPacketizerTester : public TlmPacketizerGTestBase {
     TlmPacketizer component;
 
     Fw::Time m_testTime;  //!< store test time for packets
+
+    bool m_useScatterPlan;  //!< pass a scatter plan with the packet list
+
+    std::vector<U16> m_scatterPages;                             //!< pages of scatter plan
+    std::vector<U16> m_scatterSlots;                             //!< slots of scatter plan
+    std::vector<TlmPacketizerScatterChannel> m_scatterChannels;  //!< channels of scatter plan
+    std::vector<TlmPacketizerScatterEntry> m_scatterEntries;     //!< entries of scatter plan
+    TlmPacketizerScatterPlan m_scatterPlan;                      //!< scatter plan
 };
 
 }  // end namespace Svc
@@ -50,6 +50,12 @@ TEST(TestNominal, IgnoredChannelTest) {
     tester.ignoreTest();
 }
 
+TEST(TestNominal, IgnoredPacketizedChannelTest) {
+    TEST_CASE(100.1.8, "Ignored channels that are also packetized");
+    Svc::TlmPacketizerTester tester;
+    tester.ignorePacketizedTest();
+}
+
 TEST(TestNominal, SendPacketTest) {
     TEST_CASE(100.1.7, "Manually sent packets");
     Svc::TlmPacketizerTester tester;
@@ -69,6 +75,52 @@ TEST(TestOffNominal, NonPacketizedChannelTest) {
     tester.nonPacketizedChannelTest();
 }
 
+TEST(TestScatterPlan, SendPackets) {
+    TEST_CASE(100.3.1, "Send Packets with scatter plan");
+    Svc::TlmPacketizerTester tester(true);
+    tester.sendPacketsTest();
+}
+
+TEST(TestScatterPlan, UpdatePacketsTest) {
+    TEST_CASE(100.3.2, "Update Packets with scatter plan");
+    Svc::TlmPacketizerTester tester(true);
+    tester.updatePacketsTest();
+}
+
+TEST(TestScatterPlan, IgnoredChannelTest) {
+    TEST_CASE(100.3.3, "Ignored Channels with scatter plan");
+    Svc::TlmPacketizerTester tester(true);
+    tester.ignoreTest();
+}
+
+TEST(TestScatterPlan, SendPacketTest) {
+    TEST_CASE(100.3.4, "Manually sent packets with scatter plan");
+    Svc::TlmPacketizerTester tester(true);
+    tester.sendManualPacketTest();
+}
+
+TEST(TestScatterPlan, IgnoredPacketizedChannelTest) {
+    TEST_CASE(100.3.6, "Ignored channels that are also packetized with scatter plan");
+    Svc::TlmPacketizerTester tester(true);
+    tester.ignorePacketizedTest();
+}
+
+TEST(TestScatterPlan, NonPacketizedChannelTest) {
+    TEST_CASE(100.3.5, "Non-packetized Channels with scatter plan");
+    Svc::TlmPacketizerTester tester(true);
+    tester.nonPacketizedChannelTest();
+}
+
+TEST(Benchmark, DISABLED_TlmRecvHashTable) {
+    Svc::TlmPacketizerTester tester;
+    tester.tlmRecvBenchmark();
+}
+
+TEST(Benchmark, DISABLED_TlmRecvScatterPlan) {
+    Svc::TlmPacketizerTester tester(true);
+    tester.tlmRecvBenchmark();
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
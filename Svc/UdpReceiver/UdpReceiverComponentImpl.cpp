@@ -19,6 +19,7 @@
 #include <cstdlib>
 #include <unistd.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <arpa/inet.h>
 #include <Os/TaskString.hpp>
 
@@ -127,28 +128,43 @@ namespace Svc {
 
   void UdpReceiverComponentImpl::doRecv() {
 
-      // wait for data from the socket
-      NATIVE_INT_TYPE psize = recvfrom(
+      // wait for data from the socket, then take whatever else is already queued in the same call
+      struct mmsghdr messages[UDP_RECEIVER_BATCH_SIZE];
+      struct iovec vectors[UDP_RECEIVER_BATCH_SIZE];
+      memset(messages, 0, sizeof(messages));
+      for (NATIVE_UINT_TYPE packet = 0; packet < UDP_RECEIVER_BATCH_SIZE; packet++) {
+          vectors[packet].iov_base = this->m_recvBuff[packet].getBuffAddr();
+          vectors[packet].iov_len = this->m_recvBuff[packet].getBuffCapacity();
+          messages[packet].msg_hdr.msg_iov = &vectors[packet];
+          messages[packet].msg_hdr.msg_iovlen = 1;
+      }
+      NATIVE_INT_TYPE packets = recvmmsg(
               this->m_fd,
-              this->m_recvBuff.getBuffAddr(),
-              this->m_recvBuff.getBuffCapacity(),
-              MSG_WAITALL,
-              0,
+              messages,
+              UDP_RECEIVER_BATCH_SIZE,
+              MSG_WAITFORONE,
               0);
-      if (-1 == psize) {
+      if (-1 == packets) {
           if (errno != EINTR) {
               Fw::LogStringArg arg(strerror(errno));
               this->log_WARNING_HI_UR_RecvError(arg);
           }
           return;
       }
+      for (NATIVE_INT_TYPE packet = 0; packet < packets; packet++) {
+          this->decodePacket(this->m_recvBuff[packet], messages[packet].msg_len);
+      }
+  }
+
+  void UdpReceiverComponentImpl::decodePacket(UdpSerialBuffer& recvBuff, NATIVE_UINT_TYPE psize) {
+
       // reset buffer for deserialization
-      Fw::SerializeStatus stat = this->m_recvBuff.setBuffLen(psize);
+      Fw::SerializeStatus stat = recvBuff.setBuffLen(psize);
       FW_ASSERT(Fw::FW_SERIALIZE_OK == stat, stat);
 
       // get sequence number
       U8 seqNum;
-      stat = this->m_recvBuff.deserialize(seqNum);
+      stat = recvBuff.deserialize(seqNum);
       // check for deserialization error or port number too high
       if (stat != Fw::FW_SERIALIZE_OK) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_SEQ,stat);
@@ -176,7 +192,7 @@ namespace Svc {
 
       // get port number
       U8 portNum;
-      stat = this->m_recvBuff.deserialize(portNum);
+      stat = recvBuff.deserialize(portNum);
       // check for deserialization error or port number too high
       if (stat != Fw::FW_SERIALIZE_OK or portNum > this->getNum_PortsOut_OutputPorts()) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_PORT,stat);
@@ -185,7 +201,7 @@ namespace Svc {
       }
       // get buffer for port
 
-      stat = this->m_recvBuff.deserialize(this->m_portBuff);
+      stat = recvBuff.deserialize(this->m_portBuff);
       if (stat != Fw::FW_SERIALIZE_OK) {
           this->log_WARNING_HI_UR_DecodeError(DECODE_BUFFER,stat);
           this->m_decodeErrors++;
@@ -65,7 +65,7 @@ namespace Svc {
       );
 
       static void workerTask(void* ptr); //!< worker task entry point
-      void doRecv(); //!< receives a single packet (helps unit testing)
+      void doRecv(); //!< receives up to UDP_RECEIVER_BATCH_SIZE packets in one call (helps unit testing)
       Os::Task m_socketTask;
 
       NATIVE_INT_TYPE m_fd; //!< socket file descriptor
@@ -113,7 +113,13 @@ namespace Svc {
           // Should be the max of all the input ports serialized sizes...
           U8 m_buff[UDP_RECEIVER_MSG_SIZE];
 
-      } m_recvBuff;
+      } m_recvBuff[UDP_RECEIVER_BATCH_SIZE]; //!< receive buffers, one packet each
+
+      //! decode a received packet and send it out on its port
+      void decodePacket(
+              UdpSerialBuffer& recvBuff, /*!< buffer holding the packet */
+              NATIVE_UINT_TYPE psize /*!< size of the packet */
+      );
 
       UdpSerialBuffer m_portBuff; //!< working buffer for decoding packets
 
@@ -20,8 +20,15 @@ namespace Svc {
     enum {
         //! Number of overruns allowed before overrun event is throttled
         ACTIVE_RATE_GROUP_OVERRUN_THROTTLE = 5,
+        //! Upper bound in microseconds of the first member profile histogram bin
+        ACTIVE_RATE_GROUP_PROFILE_BIN_BASE_USEC = 16,
+        //! Each following histogram bin is 2^SHIFT times wider than the previous one
+        ACTIVE_RATE_GROUP_PROFILE_BIN_SHIFT = 2,
     };
 
+    //! Whether member profiling is enabled when the component is constructed
+    static const bool ACTIVE_RATE_GROUP_PROFILE_DEFAULT_ENABLED = false;
+
 }
 
 
@@ -19,4 +19,21 @@
 // The format arguments are base directory, container ID, time seconds, and time microseconds
 constexpr const char *DP_FILENAME_FORMAT = "%s/Dp_%08" PRI_FwDpIdType "_%08" PRIu32 "_%08" PRIu32 ".fdp";
 
+// The number of container IDs that DpManager keeps allocation statistics for
+constexpr FwSizeType DP_MANAGER_NUM_TRACKED_IDS = 16;
+
+// The number of container IDs that DpManager can hold a reserved buffer for
+constexpr FwSizeType DP_MANAGER_NUM_RESERVATIONS = 4;
+
+// Whether container headers have a one-byte flags field after the data product state
+// The flags field marks compressed container data, so DpWriter compression needs it.
+// It grows the container header by one byte. Enable it only when the ground tools
+// that decode data product files expect the field.
+constexpr bool DP_CONTAINER_HEADER_FLAGS = false;
+
+// The size in bytes of the chunks that data product data is compressed in
+// Each chunk is compressed independently, so larger chunks compress better
+// but need more working memory in the compressor. Must not exceed 65536.
+constexpr FwSizeType DP_COMPRESSION_CHUNK_SIZE = 8192;
+
 #endif
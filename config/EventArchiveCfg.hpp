@@ -0,0 +1,27 @@
+/*
+ * EventArchiveCfg.hpp:
+ *
+ * Configuration settings for the EventArchive component and EventArchiveReader.
+ */
+
+#ifndef EVENTARCHIVE_EVENTARCHIVECFG_HPP_
+#define EVENTARCHIVE_EVENTARCHIVECFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Size of the events of a block, in bytes. The component buffers one block.
+        EVENT_ARCHIVE_BLOCK_SIZE = 4096,
+        //! Number of blocks in a segment file. A new file is started for the segment when it is full.
+        EVENT_ARCHIVE_MAX_BLOCKS = 1024,
+        //! Size of the event id filter of a block, in bytes. Must be a power of two.
+        EVENT_ARCHIVE_BLOCK_FILTER_SIZE = 128,
+        //! Size of the event id filter of a segment file, in bytes. Must be a power of two.
+        EVENT_ARCHIVE_FILE_FILTER_SIZE = 2048,
+        //! Number of files a segment may be split into
+        EVENT_ARCHIVE_MAX_FILES_PER_SEGMENT = 100,
+    };
+
+}
+
+#endif /* EVENTARCHIVE_EVENTARCHIVECFG_HPP_ */
@@ -0,0 +1,23 @@
+/*
+ * FanOutCfg.hpp:
+ *
+ * Configuration settings for Svc::FanOutHelper, used by ComSplitter and BufferRepeater.
+ */
+
+#ifndef FANOUT_FANOUTCFG_HPP_
+#define FANOUT_FANOUTCFG_HPP_
+
+#include <FpConfig.hpp>
+
+namespace Svc {
+
+    enum {
+        //! Largest number of output ports of a component using FanOutHelper
+        FAN_OUT_MAX_PORTS = 10,
+        //! Largest message queued for an output port, in bytes
+        FAN_OUT_MAX_MESSAGE_SIZE = FW_COM_BUFFER_MAX_SIZE,
+    };
+
+}
+
+#endif /* FANOUT_FANOUTCFG_HPP_ */
@@ -359,12 +359,32 @@ typedef FwIndexType FwQueueSizeType;
 #define FW_LOG_TEXT_BUFFER_SIZE 256  //!< Max size of string for text log message
 #endif
 
+// Deferred formatting of Fw::Logger messages and text logs, formatted by the thread draining an Fw::LogRing
+#ifndef FW_LOG_RING_SIZE
+#define FW_LOG_RING_SIZE 256  //!< Number of messages held by a log ring. Must be a power of two
+#endif
+
+#ifndef FW_LOG_RING_MAX_ARGUMENTS
+#define FW_LOG_RING_MAX_ARGUMENTS 8  //!< Max number of arguments of a message in a log ring
+#endif
+
+#ifndef FW_LOG_RING_STRING_SIZE
+#define FW_LOG_RING_STRING_SIZE 256  //!< Size of the copies of the string arguments of a message in a log ring
+#endif
+
 // Define if serializables have toString() method. Turning off will save code space and
 // string constants. Must be enabled if text logging enabled
 #ifndef FW_SERIALIZABLE_TO_STRING
 #define FW_SERIALIZABLE_TO_STRING 1  //!< Indicates if autocoded serializables have toString() methods
 #endif
 
+// Whether Fw::Buffer keeps a serialize representation for getSerializeRepr(). Off by default, which keeps Fw::Buffer to
+// the pointer, size, and context; getSerializer() and getDeserializer() are always available. Turn on for code that
+// still calls getSerializeRepr()
+#ifndef FW_BUFFER_SERIALIZE_REPR
+#define FW_BUFFER_SERIALIZE_REPR 0  //!< Indicates if Fw::Buffer provides getSerializeRepr()
+#endif
+
 // Some settings to enable AMPCS compatibility. This breaks regular ISF GUI compatibility
 #ifndef FW_AMPCS_COMPATIBLE
 #define FW_AMPCS_COMPATIBLE 0  //!< Whether or not JPL AMPCS ground system support is enabled.
@@ -404,9 +424,20 @@ typedef FwIndexType FwQueueSizeType;
 #define FW_MUTEX_HANDLE_MAX_SIZE 72  //!< Maximum size of a handle for OS queues
 #endif
 
+// Whether Os::Generic priority queues keep messages in per-priority FIFO buckets while the queued priorities fit in
+// Types::MaxHeap::BUCKET_LEVELS consecutive values. Makes send and receive O(1), but each queue allocates 16 more bytes
+// per message and 512 bytes of buckets (64-bit host), and FW_QUEUE_HANDLE_MAX_SIZE must be at least 392
+#ifndef FW_QUEUE_PRIORITY_BUCKETS
+#define FW_QUEUE_PRIORITY_BUCKETS 0  //!< Indicates if priority queues use priority buckets
+#endif
+
 #ifndef FW_QUEUE_HANDLE_MAX_SIZE
+#if FW_QUEUE_PRIORITY_BUCKETS
+#define FW_QUEUE_HANDLE_MAX_SIZE 392  //!< Maximum size of a handle for OS queues, at least 392 with priority buckets
+#else
 #define FW_QUEUE_HANDLE_MAX_SIZE 352  //!< Maximum size of a handle for OS queues
 #endif
+#endif
 
 #ifndef FW_DIRECTORY_HANDLE_MAX_SIZE
 #define FW_DIRECTORY_HANDLE_MAX_SIZE 16  //!< Maximum size of a handle for OS resources (files, queues, locks, etc.)
@@ -445,6 +476,12 @@ typedef FwIndexType FwQueueSizeType;
 #define FW_FILE_CHUNK_SIZE 512  //!< Chunk size for working with files in the OSAL layer
 #endif
 
+// Note: One buffer of this size is heap-allocated for the duration of a file copy by OSAL implementations that
+// copy through user space (e.g. Posix when the kernel cannot copy the file directly)
+#ifndef FW_FILE_COPY_BUFFER_SIZE
+#define FW_FILE_COPY_BUFFER_SIZE (256 * 1024)  //!< Buffer size for copying files in the OSAL layer
+#endif
+
 // *** NOTE configuration checks are in Fw/Cfg/ConfigCheck.cpp in order to have
 // the type definitions in Fw/Types/BasicTypes available.
 
@@ -0,0 +1,21 @@
+/*
+ * HealthCfg.hpp:
+ *
+ * Configuration settings for the Health component.
+ */
+
+#ifndef HEALTH_HEALTHCFG_HPP_
+#define HEALTH_HEALTHCFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Upper bound in microseconds of the first ping latency histogram bin
+        HEALTH_PING_LATENCY_BIN_BASE_USEC = 64,
+        //! Each following histogram bin is 2^SHIFT times wider than the previous one
+        HEALTH_PING_LATENCY_BIN_SHIFT = 2,
+    };
+
+}
+
+#endif /* HEALTH_HEALTHCFG_HPP_ */
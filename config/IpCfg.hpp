@@ -19,7 +19,12 @@ enum IpCfg {
     SOCKET_IP_SEND_FLAGS = 0,              // send, sendto FLAGS argument
     SOCKET_IP_RECV_FLAGS = 0,              // recv FLAGS argument
     SOCKET_MAX_ITERATIONS = 0xFFFF,        // Maximum send/recv attempts before an error is returned
-    SOCKET_MAX_HOSTNAME_SIZE = 256         // Maximum stored hostname
+    SOCKET_MAX_HOSTNAME_SIZE = 256,        // Maximum stored hostname
+    SOCKET_UDP_BATCH_SIZE = 16,            // Maximum datagrams moved by one batched UDP recv/send
+    SOCKET_UDP_RECV_BUFFER_SIZE = 0,       // UDP SO_RCVBUF size in bytes, 0 keeps the OS default
+    SOCKET_REACTOR_MAX_CLIENTS = 64,       // Maximum clients served at once by a TcpServerReactor
+    SOCKET_REACTOR_QUEUE_SIZE = 65536,     // Default bytes of outgoing data queued per TcpServerReactor client
+    SOCKET_MAX_SEGMENTS = 8                // Maximum segments gathered by one IpSocket::sendv
 };
 static const Fw::TimeInterval SOCKET_RETRY_INTERVAL = Fw::TimeInterval(1, 0);
 
@@ -0,0 +1,23 @@
+/*
+ * LinuxTimerCfg.hpp:
+ *
+ * Configuration settings for the LinuxTimer component.
+ */
+
+#ifndef LINUXTIMER_LINUXTIMERCFG_HPP_
+#define LINUXTIMER_LINUXTIMERCFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Period in milliseconds at which jitter telemetry is written
+        LINUX_TIMER_TLM_PERIOD_MS = 1000,
+        //! Upper bound in microseconds of the first lateness histogram bin
+        LINUX_TIMER_LATENESS_BIN_BASE_USEC = 5,
+        //! Each following histogram bin is 2^SHIFT times wider than the previous one
+        LINUX_TIMER_LATENESS_BIN_SHIFT = 1,
+    };
+
+}
+
+#endif /* LINUXTIMER_LINUXTIMERCFG_HPP_ */
@@ -0,0 +1,21 @@
+/*
+ * TaskMonitorCfg.hpp:
+ *
+ * Configuration settings for the TaskMonitor component.
+ */
+
+#ifndef TASKMONITOR_TASKMONITORCFG_HPP_
+#define TASKMONITOR_TASKMONITORCFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Number of tasks TaskMonitor tracks. Tasks started once the table is full are counted but not reported.
+        TASK_MONITOR_MAX_TASKS = 32,
+        //! Number of queues TaskMonitor can match to tasks
+        TASK_MONITOR_MAX_QUEUES = 48,
+    };
+
+}
+
+#endif /* TASKMONITOR_TASKMONITORCFG_HPP_ */
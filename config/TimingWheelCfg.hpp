@@ -0,0 +1,23 @@
+/*
+ * TimingWheelCfg.hpp:
+ *
+ * Configuration settings for Svc::TimingWheel and the TimingWheelDriver component.
+ */
+
+#ifndef TIMINGWHEEL_TIMINGWHEELCFG_HPP_
+#define TIMINGWHEEL_TIMINGWHEELCFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Each wheel level has 2^TIMING_WHEEL_SLOT_BITS slots
+        TIMING_WHEEL_SLOT_BITS = 6,
+        //! Number of wheel levels. Longest delay is 2^(SLOT_BITS * (LEVELS - 1)) * (2^SLOT_BITS - 1) ticks
+        TIMING_WHEEL_LEVELS = 4,
+        //! Number of one-shot deadlines TimingWheelDriver can have pending at once
+        TIMING_WHEEL_DRIVER_ONE_SHOTS = 16,
+    };
+
+}
+
+#endif /* TIMINGWHEEL_TIMINGWHEELCFG_HPP_ */
@@ -0,0 +1,25 @@
+/*
+ * TlmArchiveCfg.hpp:
+ *
+ * Configuration settings for the TlmArchive component and TlmArchiveReader.
+ */
+
+#ifndef TLMARCHIVE_TLMARCHIVECFG_HPP_
+#define TLMARCHIVE_TLMARCHIVECFG_HPP_
+
+namespace Svc {
+
+    enum {
+        //! Number of channels TlmArchive keeps a column for. Samples of further channels are dropped.
+        TLM_ARCHIVE_MAX_CHANNELS = 64,
+        //! Size of the time and of the value column of a block, in bytes. Each channel buffers one block.
+        TLM_ARCHIVE_BLOCK_SIZE = 512,
+        //! Number of blocks in a partition file. A new file is started for the partition when it is full.
+        TLM_ARCHIVE_MAX_BLOCKS = 1024,
+        //! Number of files a partition may be split into
+        TLM_ARCHIVE_MAX_FILES_PER_PARTITION = 100,
+    };
+
+}
+
+#endif /* TLMARCHIVE_TLMARCHIVECFG_HPP_ */
@@ -12,6 +12,7 @@
 
 namespace Svc {
     static const NATIVE_UINT_TYPE UDP_RECEIVER_MSG_SIZE = 256;
+    static const NATIVE_UINT_TYPE UDP_RECEIVER_BATCH_SIZE = 16; //!< Packets received per recvmmsg call
 }
 
 #endif /* SVC_UDPRECEIVER_UDPRECEIVERCOMPONENTIMPLCFG_HPP_ */